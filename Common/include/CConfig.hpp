@@ -140,6 +140,7 @@ private:
   su2double Damp_Engine_Exhaust;  /*!< \brief Damping factor for the engine exhaust. */
   su2double Damp_Res_Restric,     /*!< \brief Damping factor for the residual restriction. */
   Damp_Correc_Prolong;            /*!< \brief Damping factor for the correction prolongation. */
+  MG_AGGLOMERATION Kind_MG_Agglomeration; /*!< \brief Algorithm used to agglomerate the coarse grids. */
   su2double Position_Plane;    /*!< \brief Position of the Near-Field (y coordinate 2D, and z coordinate 3D). */
   su2double WeightCd;          /*!< \brief Weight of the drag coefficient. */
   su2double dCD_dCL;           /*!< \brief Fixed Cl mode derivate . */
@@ -531,6 +532,7 @@ private:
   Kind_TimeStep_Heat,           /*!< \brief Time stepping method for the (fvm) heat equation. */
   n_Datadriven_files;
   ENUM_DATADRIVEN_METHOD Kind_DataDriven_Method;       /*!< \brief Method used for datset regression in data-driven fluid models. */
+  LUT_SEARCH_MAP Kind_LUT_Search_Map;                  /*!< \brief Point location structure of the look-up tables. */
 
   su2double DataDriven_Relaxation_Factor; /*!< \brief Relaxation factor for Newton solvers in data-driven fluid models. */
 
@@ -625,6 +627,10 @@ private:
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
+  bool Linear_Solver_ILU_Level_Scheduling;       /*!< \brief Use level scheduling for thread-parallel ILU. */
+  SPARSE_MATRIX_FORMAT Linear_Solver_SpMV_Format; /*!< \brief Storage format of the matrix-vector products of the linear solvers. */
+  unsigned short Linear_Solver_AMG_Levels;       /*!< \brief Maximum number of levels of the AMG preconditioner. */
+  unsigned short Linear_Solver_AMG_Smooth_Iter;  /*!< \brief Smoothing sweeps per level of the AMG preconditioner. */
   su2double SemiSpan;                   /*!< \brief Wing Semi span. */
   su2double Roe_Kappa;                  /*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_Adjoint;  /*!< \brief Relaxation coefficient for variable updates of adjoint solvers. */
@@ -695,9 +701,12 @@ private:
   bool Restart,                       /*!< \brief Restart solution (for direct, adjoint, and linearized problems).*/
   Read_Binary_Restart,                /*!< \brief Read binary SU2 native restart files.*/
   Wrt_Restart_Overwrite,              /*!< \brief Overwrite restart files or append iteration number.*/
+  Wrt_Restart_Compressed,             /*!< \brief Compress binary restart files without loss.*/
   Wrt_Surface_Overwrite,              /*!< \brief Overwrite surface output files or append iteration number.*/
   Wrt_Volume_Overwrite,               /*!< \brief Overwrite volume output files or append iteration number.*/
   Restart_Flow;                       /*!< \brief Restart flow solution for adjoint and linearized problems. */
+  unsigned long Restart_Checkpoints_RAM; /*!< \brief Memory (MB per rank) for restart data kept after being read. */
+  string Restart_Checkpoints_Dir;     /*!< \brief Node-local directory where each rank keeps its part of restart files. */
   unsigned short nMarker_Monitoring,  /*!< \brief Number of markers to monitor. */
   nMarker_Designing,                  /*!< \brief Number of markers for the objective function. */
   nMarker_GeoEval,                    /*!< \brief Number of markers for the objective function. */
@@ -820,6 +829,10 @@ private:
   Wrt_MeshQuality,           /*!< \brief Write the mesh quality statistics to the visualization files.  */
   Wrt_MultiGrid,             /*!< \brief Write the coarse grids to the visualization files.  */
   Wrt_Projected_Sensitivity, /*!< \brief Write projected sensitivities (dJ/dx) on surfaces to ASCII file. */
+  Async_Output,              /*!< \brief Write the supported output files in a background thread. */
+  Profiling,                 /*!< \brief Profile the hot paths of the solvers. */
+  Profiling_Trace,           /*!< \brief Write the timeline of the profiled regions. */
+  Profiling_HWCounters,      /*!< \brief Measure instructions and cycles of the profiled regions. */
   Plot_Section_Forces;       /*!< \brief Write sectional forces for specified markers. */
   unsigned short
   Console_Output_Verb,  /*!< \brief Level of verbosity for console output */
@@ -1027,6 +1040,9 @@ private:
   bool RadialBasisFunction_PolynomialOption; /*!< \brief Option of whether to include polynomial terms in Radial Basis Function Interpolation or not. */
   su2double RadialBasisFunction_Parameter;   /*!< \brief Radial basis function parameter (radius). */
   su2double RadialBasisFunction_PruneTol;    /*!< \brief Tolerance to prune the RBF interpolation matrix. */
+  RADIAL_BASIS_SOLVER RadialBasisFunction_Solver; /*!< \brief Method to compute the RBF interpolation coefficients. */
+  su2double RadialBasisFunction_Neighborhood; /*!< \brief Donor neighbourhood of the sparse RBF solver, in radii. */
+  bool SparseInterfaceTransfer;              /*!< \brief Send interface donor values only to the ranks that need them. */
   bool Prestretch;                           /*!< \brief Read a reference geometry for optimization purposes. */
   string Prestretch_FEMFileName;             /*!< \brief File name for reference geometry. */
   string FEA_FileName;              /*!< \brief File name for element-based properties. */
@@ -1040,6 +1056,9 @@ private:
   su2double ParMETIS_tolerance;     /*!< \brief Load balancing tolerance for ParMETIS. */
   long ParMETIS_pointWgt;           /*!< \brief Load balancing weight given to points. */
   long ParMETIS_edgeWgt;            /*!< \brief Load balancing weight given to edges. */
+  bool GeometryCache;               /*!< \brief Reuse the partitioning, dual grid and colorings of a previous run. */
+  string GeometryCache_FileName;    /*!< \brief Prefix of the geometry cache files. */
+  string Profiling_FileName;        /*!< \brief Prefix of the profiling output files. */
   unsigned short DirectDiff;        /*!< \brief Direct Differentation mode. */
   bool DiscreteAdjoint;                /*!< \brief AD-based discrete adjoint mode. */
   su2double Const_DES;                 /*!< \brief Detached Eddy Simulation Constant. */
@@ -1155,6 +1174,7 @@ private:
   unsigned long *VolumeOutputFrequencies; /*!< \brief list containing the writing frequencies */
 
   bool Multizone_Mesh;            /*!< \brief Determines if the mesh contains multiple zones. */
+  bool Multizone_Concurrent;      /*!< \brief Solve the zones concurrently, on disjoint groups of ranks. */
   bool Wrt_ZoneConv;              /*!< \brief Write the convergence history of each individual zone to screen. */
   bool Wrt_ZoneHist;              /*!< \brief Write the convergence history of each individual zone to file. */
   bool SpecialOutput,             /*!< \brief Determines if the special output is written. */
@@ -1203,6 +1223,7 @@ private:
   *Supercatalytic_Wall_Composition,         /*!< \brief Supercatalytic wall mass fractions [dimensionless]. */
   pnorm_heat;                               /*!< \brief pnorm for heat-flux. */
   bool frozen,                              /*!< \brief Flag for determining if mixture is frozen. */
+  chemistry_point_implicit,                 /*!< \brief Flag for the point implicit treatment of the chemistry. */
   ionization,                               /*!< \brief Flag for determining if free electron gas is in the mixture. */
   vt_transfer_res_limit,                    /*!< \brief Flag for determining if residual limiting for source term VT-transfer is used. */
   monoatomic,                               /*!< \brief Flag for monoatomic mixture. */
@@ -1465,6 +1486,12 @@ public:
    */
   static unsigned short GetnDim(const string& val_mesh_filename, unsigned short val_format);
 
+  /*!
+   * \brief Gets the number of volume elements of the zone from its mesh file, before the geometry is read.
+   * \return Number of volume elements of the zone.
+   */
+  unsigned long GetMesh_nElem(void) const;
+
   /*!
    * \brief Initializes pointers to null
    */
@@ -3236,6 +3263,33 @@ public:
    */
   bool GetWrt_Performance(void) const { return Wrt_Performance; }
 
+  /*!
+   * \brief Get whether the supported output files (binary restart, Paraview XML and legacy binary) are written
+   *        in a background thread.
+   * \return <code>TRUE</code> if the output is asynchronous.
+   */
+  bool GetAsync_Output(void) const { return Async_Output; }
+
+  /*!
+   * \brief Get whether the hot paths of the solvers are profiled (see CProfiler).
+   */
+  bool GetProfiling(void) const { return Profiling; }
+
+  /*!
+   * \brief Get whether the timeline of the profiled regions is written (Chrome trace format).
+   */
+  bool GetProfiling_Trace(void) const { return Profiling_Trace; }
+
+  /*!
+   * \brief Get whether the instructions and cycles of the profiled regions are measured.
+   */
+  bool GetProfiling_HWCounters(void) const { return Profiling_HWCounters; }
+
+  /*!
+   * \brief Get the prefix of the profiling output files.
+   */
+  const string& GetProfiling_FileName(void) const { return Profiling_FileName; }
+
   /*!
    * \brief Get information about the computational graph (e.g. memory usage) when using AD in reverse mode.
    * \return <code>TRUE</code> means that the tape statistics will be written after each recording.
@@ -3872,6 +3926,11 @@ public:
    */
   ENUM_DATADRIVEN_METHOD GetKind_DataDriven_Method(void) const { return Kind_DataDriven_Method; }
 
+  /*!
+   * \brief Point location structure of the look-up tables of data-driven and flamelet fluid models.
+   */
+  LUT_SEARCH_MAP GetKind_LUT_Search_Map(void) const { return Kind_LUT_Search_Map; }
+
   /*!
    * \brief Get name of the input file for the data-driven fluid model interpolation method.
    * \return Name of the input file for the interpolation method.
@@ -4227,6 +4286,30 @@ public:
    */
   unsigned short GetLinear_Solver_ILU_n(void) const { return Linear_Solver_ILU_n; }
 
+  /*!
+   * \brief Check if the ILU preconditioner uses level scheduling instead of additive thread partitions.
+   * \return <code>TRUE</code> if the factorization and triangular solves are level-scheduled.
+   */
+  bool GetLinear_Solver_ILU_Level_Scheduling(void) const { return Linear_Solver_ILU_Level_Scheduling; }
+
+  /*!
+   * \brief Get the storage format used in the sparse matrix-vector products of the linear solvers.
+   * \return CSR (native) or SELL-C-sigma (values are copied to a SIMD-friendly layout).
+   */
+  SPARSE_MATRIX_FORMAT GetLinear_Solver_SpMV_Format(void) const { return Linear_Solver_SpMV_Format; }
+
+  /*!
+   * \brief Get the maximum number of levels of the AMG preconditioner.
+   * \return Maximum number of levels, including the finest.
+   */
+  unsigned short GetLinear_Solver_AMG_Levels(void) const { return Linear_Solver_AMG_Levels; }
+
+  /*!
+   * \brief Get the number of pre- and post-smoothing sweeps of the AMG preconditioner.
+   * \return Number of smoothing sweeps per level.
+   */
+  unsigned short GetLinear_Solver_AMG_Smooth_Iter(void) const { return Linear_Solver_AMG_Smooth_Iter; }
+
   /*!
    * \brief Get restart frequency of the linear solver for the implicit formulation.
    * \return Restart frequency of the linear solver for the implicit formulation.
@@ -5396,12 +5479,28 @@ public:
    */
   bool GetRead_Binary_Restart(void) const { return Read_Binary_Restart; }
 
+  /*!
+   * \brief Get the memory (MB per rank) for the data of restart files kept in memory after being read.
+   */
+  unsigned long GetRestart_Checkpoints_RAM(void) const { return Restart_Checkpoints_RAM; }
+
+  /*!
+   * \brief Get the node-local directory where each rank keeps a copy of its part of the restart files.
+   * \return Directory, empty if not used.
+   */
+  const string& GetRestart_Checkpoints_Dir(void) const { return Restart_Checkpoints_Dir; }
+
   /*!
    * \brief Flag for whether restart solution files are overwritten.
    * \return Flag for overwriting. If Flag=false, iteration nr is appended to filename
    */
   bool GetWrt_Restart_Overwrite(void) const { return Wrt_Restart_Overwrite; }
 
+  /*!
+   * \brief Flag for whether binary restart files are compressed (without loss).
+   */
+  bool GetWrt_Restart_Compressed(void) const { return Wrt_Restart_Compressed; }
+
     /*!
    * \brief Flag for whether visualization files are overwritten.
    * \return Flag for overwriting. If Flag=false, iteration nr is appended to filename
@@ -5445,6 +5544,11 @@ public:
    */
   bool GetFrozen(void) const { return frozen; }
 
+  /*!
+   * \brief Indicates whether the explicit updates are preconditioned by the point implicit chemistry.
+   */
+  bool GetChemistry_PointImplicit(void) const { return chemistry_point_implicit; }
+
   /*!
    * \brief Indicates whether electron gas is present in the gas mixture.
    */
@@ -6471,6 +6575,12 @@ public:
    */
   su2double GetDamp_Correc_Prolong(void) const { return Damp_Correc_Prolong; }
 
+  /*!
+   * \brief Get the algorithm used to agglomerate the interior of the coarse grids.
+   * \return Kind of multigrid agglomeration.
+   */
+  MG_AGGLOMERATION GetKind_MG_Agglomeration(void) const { return Kind_MG_Agglomeration; }
+
   /*!
    * \brief Value of the position of the Near Field (y coordinate for 2D, and z coordinate for 3D).
    * \return Value of the Near Field position.
@@ -8722,43 +8832,6 @@ public:
    */
   unsigned long GetNonphysical_Reconstr(void) const { return Nonphys_Reconstr; }
 
-  /*!
-   * \brief Start the timer for profiling subroutines.
-   * \param[in] val_start_time - the value of the start time.
-   */
-  void Tick(double *val_start_time);
-
-  /*!
-   * \brief Stop the timer for profiling subroutines and store results.
-   * \param[in] val_start_time - the value of the start time.
-   * \param[in] val_function_name - string for the name of the profiled subroutine.
-   * \param[in] val_group_id - string for the name of the profiled subroutine.
-   */
-  void Tock(double val_start_time, const string& val_function_name, int val_group_id);
-
-  /*!
-   * \brief Write a CSV file containing the results of the profiling.
-   */
-  void SetProfilingCSV(void);
-
-  /*!
-   * \brief Start the timer for profiling subroutines.
-   * \param[in] val_start_time - the value of the start time.
-   */
-  void GEMM_Tick(double *val_start_time) const;
-
-  /*!
-   * \brief Stop the timer for the GEMM profiling and store results.
-   * \param[in] val_start_time - The value of the start time.
-   * \param[in] M, N, K        - Matrix size of the GEMM call.
-   */
-  void GEMM_Tock(double val_start_time, int M, int N, int K) const;
-
-  /*!
-   * \brief Write a CSV file containing the results of the profiling.
-   */
-  void GEMMProfilingCSV(void);
-
   /*!
    * \brief Set freestream turbonormal for initializing solution.
    */
@@ -9139,6 +9212,21 @@ public:
    */
   su2double GetRadialBasisFunctionPruneTol(void) const { return RadialBasisFunction_PruneTol; }
 
+  /*!
+   * \brief Get the method used to compute the radial basis function interpolation coefficients.
+   */
+  RADIAL_BASIS_SOLVER GetRadialBasisFunctionSolver(void) const { return RadialBasisFunction_Solver; }
+
+  /*!
+   * \brief Get the size of the donor neighbourhood of each target point for the sparse RBF solver, in radii.
+   */
+  su2double GetRadialBasisFunctionNeighborhood(void) const { return RadialBasisFunction_Neighborhood; }
+
+  /*!
+   * \brief Get whether the interface donor values are only sent to the ranks that need them.
+   */
+  bool GetSparseInterfaceTransfer(void) const { return SparseInterfaceTransfer; }
+
   /*!
    * \brief Get the number of donor points to use in Nearest Neighbor interpolation.
    */
@@ -9390,6 +9478,12 @@ public:
    */
   bool GetMultizone_Mesh(void) const { return Multizone_Mesh; }
 
+  /*!
+   * \brief Check if the zones of a Block-Jacobi multizone problem are solved concurrently.
+   * \return YES if each zone is solved by its own group of ranks.
+   */
+  bool GetMultizone_Concurrent(void) const { return Multizone_Concurrent; }
+
   /*!
    * \brief Check if the mesh read supports multiple zones.
    * \return YES if multiple zones can be contained in the mesh file.
@@ -9687,6 +9781,16 @@ public:
    */
   long GetParMETIS_EdgeWeight() const { return ParMETIS_edgeWgt; }
 
+  /*!
+   * \brief Check if the partitioning, dual grid, and edge colorings are cached between runs.
+   */
+  bool GetGeometryCache() const { return GeometryCache; }
+
+  /*!
+   * \brief Get the prefix of the geometry cache files (one per rank).
+   */
+  const string& GetGeometryCache_FileName() const { return GeometryCache_FileName; }
+
   /*!
    * \brief Find the marker index (if any) that is part of a given interface pair.
    * \param[in] iInterface - Number of the interface pair being tested, starting at 0.
@@ -35,6 +35,7 @@
 #include "../../Common/include/option_structure.hpp"
 #include "CFileReaderLUT.hpp"
 #include "CTrapezoidalMap.hpp"
+#include "CUniformGridMap.hpp"
 
 /*!
  * \brief Look up table.
@@ -95,11 +96,20 @@ class CLookUpTable {
    */
   su2vector<su2vector<unsigned long>> hull;
 
+  LUT_SEARCH_MAP search_map; /*!< \brief Point location structure used by all the look-ups. */
+
   /*! \brief
-   * Trapezoidal map objects for the table levels.
+   * Trapezoidal map objects for the table levels, if they are the search structure.
    */
   su2vector<CTrapezoidalMap> trap_map_x_y;
 
+  /*! \brief
+   * Uniform grid maps for the table levels, if they are the search structure.
+   */
+  su2vector<CUniformGridMap> grid_map_x_y;
+
+  unsigned long idx_CV1, idx_CV2; /*!< \brief Column indices of the controlling variables. */
+
   /*! \brief
    * Vector of all the weight factors for the interpolation.
    */
@@ -182,8 +192,8 @@ class CLookUpTable {
    * \param[in] interp_mat_inv - Inverse matrix for interpolation.
    * \param[out] interp_coeffs - Interpolation coefficients.
    */
-  void GetInterpCoeffs(su2double val_CV1, su2double val_CV2, su2activematrix& interp_mat_inv,
-                       std::array<su2double, 3>& interp_coeffs);
+  void GetInterpCoeffs(su2double val_CV1, su2double val_CV2, const su2activematrix& interp_mat_inv,
+                       std::array<su2double, 3>& interp_coeffs) const;
 
   /*!
    * \brief Compute interpolated value of a point P in the triangle.
@@ -228,6 +238,41 @@ class CLookUpTable {
    */
   unsigned long FindNearestNeighborOnHull(su2double val_CV1, su2double val_CV2, unsigned long i_level = 0);
 
+  /*!
+   * \brief Compute the distance-weighted averaging stencil on the nearest two table nodes of the hull.
+   * \param[in] val_CV1 - First coordinate of point P(val_CV1,val_CV2).
+   * \param[in] val_CV2 - Second coordinate of point P(val_CV1,val_CV2).
+   * \param[in] i_level - Table level.
+   * \param[out] nodes - Table nodes of the stencil.
+   * \param[out] weights - Weights of the nodes (the third is always zero).
+   */
+  void GetNearestNeighborWeights(su2double val_CV1, su2double val_CV2, unsigned long i_level,
+                                 std::array<unsigned long, 3>& nodes, std::array<su2double, 3>& weights) const;
+
+  /*!
+   * \brief Find the triangle of a table level that contains a point, with the selected search structure.
+   * \param[in] val_CV1 - First coordinate of point P(val_CV1,val_CV2).
+   * \param[in] val_CV2 - Second coordinate of point P(val_CV1,val_CV2).
+   * \param[in] i_level - Table level.
+   * \param[out] interp_coeffs - Interpolation coefficients of the triangle nodes.
+   * \returns Index of the triangle, CUniformGridMap::NOT_FOUND if the point is outside of the table.
+   */
+  unsigned long FindTriangle(su2double val_CV1, su2double val_CV2, unsigned long i_level,
+                             std::array<su2double, 3>& interp_coeffs) const;
+
+  /*!
+   * \brief Find the interpolation stencil of a point on a table level.
+   * \note Falls back to the nearest neighbors on the hull if the point is outside of the table.
+   * \param[in] val_CV1 - First coordinate of point P(val_CV1,val_CV2).
+   * \param[in] val_CV2 - Second coordinate of point P(val_CV1,val_CV2).
+   * \param[in] i_level - Table level.
+   * \param[out] nodes - Table nodes of the stencil.
+   * \param[out] weights - Weights of the nodes.
+   * \returns 0 if the point is inside the table, 1 otherwise.
+   */
+  unsigned long GetStencilXY(su2double val_CV1, su2double val_CV2, unsigned long i_level,
+                             std::array<unsigned long, 3>& nodes, std::array<su2double, 3>& weights) const;
+
   /*!
    * \brief Interpolate data based on distance-weighted averaging on the nearest two table nodes.
    * \param[in] val_CV1 - First coordinate of point P(val_CV1,val_CV2) to check.
@@ -256,7 +301,8 @@ class CLookUpTable {
    * \param[in] val_id_triangle - ID of the triangle to check.
    * \returns True if the point is in the triangle, false if it is outside.
    */
-  bool IsInTriangle(su2double val_CV1, su2double val_CV2, unsigned long val_id_triangle, unsigned long i_level = 0);
+  bool IsInTriangle(su2double val_CV1, su2double val_CV2, unsigned long val_id_triangle,
+                    unsigned long i_level = 0) const;
 
   /*!
    * \brief Compute the area of a triangle given the 3 points of the triangle.
@@ -268,7 +314,8 @@ class CLookUpTable {
    * \param[in] y3 - The coordinates of the points P1(x1,y1), P2(x2,y2) and P3(x3,y3).
    * \returns The absolute value of the area of the triangle.
    */
-  inline su2double TriArea(su2double x1, su2double y1, su2double x2, su2double y2, su2double x3, su2double y3) {
+  inline su2double TriArea(su2double x1, su2double y1, su2double x2, su2double y2, su2double x3,
+                           su2double y3) const {
     return abs((x1 * (y2 - y3) + x2 * (y3 - y1) + x3 * (y1 - y2)) * 0.5);
   }
 
@@ -280,12 +327,22 @@ class CLookUpTable {
    * \param[in] val_CV3 - Third controlling variable value.
    * \returns Array with first and second controlling variable values for the upper and lower table inclusion levels.
    */
-  std::array<std::array<su2double, 2>, 2> ComputeNormalizedXY(std::pair<unsigned long, unsigned long>& inclusion_levels,
-                                                              const su2double val_CV1, const su2double val_CV2,
-                                                              const su2double val_CV3);
+  std::array<std::array<su2double, 2>, 2> ComputeNormalizedXY(
+      const std::pair<unsigned long, unsigned long>& inclusion_levels, const su2double val_CV1,
+      const su2double val_CV2, const su2double val_CV3) const;
 
  public:
-  CLookUpTable(const std::string& file_name_lut, std::string name_CV1_in, std::string name_CV2_in);
+  enum : unsigned long { NULL_VAR = ~0ul }; /*!< \brief Column index of the "null" variables (no source). */
+
+  /*!
+   * \brief Load the table and build its search structure.
+   * \param[in] file_name_lut - Table file name.
+   * \param[in] name_CV1_in - Name of the first controlling variable.
+   * \param[in] name_CV2_in - Name of the second controlling variable.
+   * \param[in] search_map_in - Point location structure.
+   */
+  CLookUpTable(const std::string& file_name_lut, std::string name_CV1_in, std::string name_CV2_in,
+               LUT_SEARCH_MAP search_map_in = LUT_SEARCH_MAP::TRAPEZOIDAL);
 
   /*!
    * \brief Print information to screen.
@@ -356,7 +413,33 @@ class CLookUpTable {
    * \param[in] within_limits - Whether query point lies within table bounds.
    * \returns Pair of inclusion level indices (first = lower level index, second = upper level index).
    */
-  std::pair<unsigned long, unsigned long> FindInclusionLevels(const su2double val_CV3);
+  std::pair<unsigned long, unsigned long> FindInclusionLevels(const su2double val_CV3) const;
+
+  /*!
+   * \brief Resolve variable names to column indices for the batched look-up.
+   * \param[in] val_names_var - String names of the variables.
+   * \returns Column indices, NULL_VAR for the names for which noSource is true.
+   */
+  std::vector<unsigned long> GetIndexOfVars(const std::vector<std::string>& val_names_var) const;
+
+  /*!
+   * \brief Lookup several variables for a batch of query points.
+   * \note The queries are processed in small blocks, first all points of the block are located with the
+   * uniform grid maps and then each variable is interpolated for all points. Values are consistent with
+   * LookUp_XY (val_CV3 == nullptr) and LookUp_XYZ. The method is const and can be called concurrently.
+   * \param[in] idx_vars - Column indices of the variables (from GetIndexOfVars).
+   * \param[in] n_queries - Number of query points.
+   * \param[in] val_CV1 - Controlling variable 1 of the first query, the others follow with stride.
+   * \param[in] val_CV2 - Controlling variable 2 of the first query.
+   * \param[in] val_CV3 - Controlling variable 3 of the first query, nullptr for a look-up on the first level.
+   * \param[in] stride - Distance between the values of consecutive queries.
+   * \param[out] val_vars - Values of the variables, row-major (n_queries x idx_vars.size()).
+   * \param[out] exit_codes - Optional, 0 if the query was inside the table, 1 if not.
+   * \returns Number of queries outside of the table.
+   */
+  unsigned long LookUp_Batch(const std::vector<unsigned long>& idx_vars, unsigned long n_queries,
+                             const su2double* val_CV1, const su2double* val_CV2, const su2double* val_CV3,
+                             unsigned long stride, su2double* val_vars, unsigned short* exit_codes = nullptr) const;
 
   /*!
    * \brief Determine the minimum and maximum value of the second controlling variable.
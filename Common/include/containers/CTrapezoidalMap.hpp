@@ -69,7 +69,7 @@ class CTrapezoidalMap {
    * \param[in]  val_y  - y-coordinate or second independent variable
    * \param[out] val_index - index to the triangle
    */
-  unsigned long GetTriangle(su2double val_x, su2double val_y);
+  unsigned long GetTriangle(su2double val_x, su2double val_y) const;
 
   /*!
    * \brief get the indices of the vertical coordinate band (xmin,xmax) in the 2D search space
@@ -78,7 +78,7 @@ class CTrapezoidalMap {
    * \param[out] val_band - a pair(i_low,i_up) , the lower index and upper index between which the value val_x
    * can be found
    */
-  std::pair<unsigned long, unsigned long> GetBand(su2double val_x);
+  std::pair<unsigned long, unsigned long> GetBand(su2double val_x) const;
 
   /*!
    * \brief for a given coordinate (val_x,value), known to be in the band (xmin,xmax) with band index (i_low,i_up),
@@ -0,0 +1,88 @@
+/*!
+ * \file CUniformGridMap.hpp
+ * \brief Uniform background grid for point location in a triangulated table level.
+ * \author D. Mayer, T. Economon
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "../../Common/include/containers/C2DContainer.hpp"
+
+/*!
+ * \class CUniformGridMap
+ * \ingroup LookUpInterp
+ * \brief Point location in a triangulation by binning the triangles on a uniform Cartesian background grid.
+ * \details Each cell stores (in CSR format) the triangles whose bounding box overlaps it. A query only tests
+ * the few candidates of its cell, using the barycentric (interpolation) coefficients of each triangle, which
+ * are stored contiguously so that the test and the interpolation weights come from the same memory access.
+ * Queries are const and therefore safe to perform concurrently.
+ * \author D. Mayer, T. Economon
+ */
+class CUniformGridMap {
+ protected:
+  su2double x_min = 0, y_min = 0;  /*!< \brief Lower corner of the grid. */
+  su2double inv_dx = 0, inv_dy = 0; /*!< \brief Inverse cell sizes. */
+  unsigned long n_cells_x = 0, n_cells_y = 0;
+
+  std::vector<unsigned long> cell_ptr;      /*!< \brief Start of the triangle list of each cell. */
+  std::vector<unsigned long> cell_triangle; /*!< \brief Triangles of all cells. */
+
+  /*! \brief Barycentric coefficients of each triangle, coeff_k = c(k,0) + c(k,1) x + c(k,2) y. */
+  std::vector<std::array<su2double, 9>> bary_coeffs;
+
+  double memory_footprint = 0;
+
+ public:
+  enum : unsigned long { NOT_FOUND = ~0ul }; /*!< \brief Returned when no triangle contains the query. */
+
+  CUniformGridMap() = default;
+
+  /*!
+   * \brief Build the grid.
+   * \param[in] samples_x - First coordinate of the table points.
+   * \param[in] samples_y - Second coordinate of the table points.
+   * \param[in] triangles - Point indices of each triangle.
+   * \param[in] interp_mat_inv - Inverse interpolation matrix of each triangle.
+   */
+  CUniformGridMap(const su2double* samples_x, const su2double* samples_y, const su2matrix<unsigned long>& triangles,
+                  const su2vector<su2activematrix>& interp_mat_inv);
+
+  /*!
+   * \brief Find the triangle that contains (val_x, val_y) and its interpolation coefficients.
+   * \param[in] val_x - First coordinate of the query.
+   * \param[in] val_y - Second coordinate of the query.
+   * \param[out] coeffs - Interpolation coefficients of the vertices of the triangle.
+   * \return Index of the triangle, or NOT_FOUND if the query is outside of the triangulation.
+   */
+  unsigned long GetTriangle(su2double val_x, su2double val_y, std::array<su2double, 3>& coeffs) const;
+
+  /*!
+   * \brief Get memory footprint of the grid.
+   * \return Memory footprint in mega bytes.
+   */
+  double GetMemoryFootprint() const { return memory_footprint; }
+};
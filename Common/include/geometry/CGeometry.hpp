@@ -1743,6 +1743,16 @@ class CGeometry {
    */
   void SetNaturalEdgeColoring();
 
+  /*!
+   * \brief Set a previously computed edge coloring (e.g. from a cache).
+   * \param[in] coloring - Edge coloring, must be valid for the edges of this geometry.
+   * \param[in] groupSize - Group size used to compute the coloring.
+   */
+  inline void SetEdgeColoring(CCompressedSparsePatternUL coloring, unsigned long groupSize) {
+    edgeColoring = std::move(coloring);
+    edgeColorGroupSize = groupSize;
+  }
+
   /*!
    * \brief Get the group size used in edge coloring.
    * \return Group size.
@@ -0,0 +1,191 @@
+/*!
+ * \file CGeometryCache.hpp
+ * \brief Headers of the class that stores expensive geometry preprocessing results between runs.
+ * \author P. Gomes
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+class CConfig;
+class CGeometry;
+
+/*!
+ * \class CGeometryCache
+ * \brief Per-rank binary cache of the graph partitioning, of the dual grid metrics, of the edge colorings, and
+ *        of data computed by other components from the mesh (e.g. the parametric coordinates of the FFD boxes).
+ * \details The cache is identified by a key built from the size and modification time of the mesh file, the
+ *          number of ranks and threads, and the options that affect the partitioning and the coloring. The file
+ *          written by each rank is only used if its key matches the current run, and only then (or when the
+ *          cache is written) the contents of the mesh file are hashed to confirm the match. The colorings are
+ *          further validated against a hash of the edges of each grid level, the dual grid metrics against a hash of
+ *          the coordinates and connectivity of the fine grid, the partitioning against the number of points.
+ *          The distributed grid (with its halo layers) is rebuilt, since the mesh file has to be read and
+ *          distributed in any case. So are the communication patterns, the edges, and the agglomeration,
+ *          which are local passes over the elements.
+ * \author P. Gomes
+ */
+class CGeometryCache {
+ private:
+  static constexpr uint64_t MAGIC_NUMBER = 0x53553243;  /*!< \brief "SU2C". */
+  static constexpr uint64_t FORMAT_VERSION = 2;         /*!< \brief Bumped when the layout changes. */
+
+  const int rank, size;
+  const bool enabled;                                   /*!< \brief GEOMETRY_CACHE= YES. */
+  std::string filename;                                 /*!< \brief File of this rank. */
+  const std::string meshFilename;                       /*!< \brief Mesh file the cached data derives from. */
+  uint64_t meshStamp = 0;                               /*!< \brief Hash of the size and time of the mesh file. */
+  uint64_t key = 0;                                     /*!< \brief Identifies the run the cache belongs to. */
+  uint64_t cachedMeshHash = 0;                          /*!< \brief Mesh hash stored in the file of this rank. */
+  bool modified = false;                                /*!< \brief Whether the file needs to be written. */
+  std::map<std::string, std::vector<uint64_t> > sections; /*!< \brief Cached data, by name. */
+
+  /*!
+   * \brief Hash of the contents of the mesh file, computed by the master rank (collective call).
+   * \note The result is kept for the lifetime of the program (for the same stamp), as several instances
+   *       of the cache may be created in one run.
+   */
+  uint64_t GetMeshHash() const;
+
+  /*!
+   * \brief Hash the edges of a grid level, used to validate colorings.
+   */
+  static uint64_t HashEdges(const CGeometry* geometry);
+
+  /*!
+   * \brief Hash the inputs of the dual grid (coordinates, element nodes, and edges) of a grid level.
+   */
+  static uint64_t HashDualGridInputs(const CGeometry* geometry);
+
+  /*!
+   * \brief Read the file of this rank into the sections if its key matches, then confirm the match with the
+   *        hash of the mesh file (collective call).
+   */
+  void Read();
+
+ public:
+  static constexpr uint64_t HASH_SEED = 0xcbf29ce484222325ull; /*!< \brief Initial value of the hashes. */
+
+  /*!
+   * \brief Hash a range of bytes (64-bit FNV-1a), continuing from a previous hash.
+   */
+  static uint64_t Hash(const void* data, size_t nBytes, uint64_t hash);
+
+  /*!
+   * \brief Hash the contents of a file, returns the hash of the name if the file cannot be read.
+   */
+  static uint64_t HashFile(const std::string& name);
+
+  /*!
+   * \brief Hash the size and the modification time of a file, returns 0 if the file does not exist.
+   */
+  static uint64_t StampFile(const std::string& name);
+
+  /*!
+   * \brief Construct the key of the cache and read the file if it exists (collective call).
+   * \param[in] config - Definition of the particular problem (of the zone).
+   */
+  explicit CGeometryCache(const CConfig* config);
+
+  CGeometryCache(const CGeometryCache&) = delete;
+  CGeometryCache& operator=(const CGeometryCache&) = delete;
+
+  /*!
+   * \brief Whether the cache was requested.
+   */
+  inline bool IsEnabled() const { return enabled; }
+
+  /*!
+   * \brief Set the point colors (ranks) of the linearly partitioned auxiliary geometry from the cache.
+   * \note Collective call, either all ranks succeed or none does.
+   * \param[in,out] geometry - Auxiliary geometry that would otherwise be partitioned by ParMETIS.
+   * \return True if the partitioning was set.
+   */
+  bool LoadPartitioning(CGeometry* geometry) const;
+
+  /*!
+   * \brief Store the point colors (ranks) of the auxiliary geometry.
+   * \param[in] geometry - Partitioned auxiliary geometry.
+   */
+  void StorePartitioning(const CGeometry* geometry);
+
+  /*!
+   * \brief Set the edge coloring of a grid level from the cache.
+   * \param[in] iMesh - Grid level.
+   * \param[in,out] geometry - Geometry of the grid level.
+   * \return True if the coloring was set.
+   */
+  bool LoadEdgeColoring(unsigned short iMesh, CGeometry* geometry) const;
+
+  /*!
+   * \brief Store the edge coloring of a grid level.
+   * \note The coloring should have been built with the options used by the solvers.
+   * \param[in] iMesh - Grid level.
+   * \param[in] geometry - Geometry of the grid level.
+   */
+  void StoreEdgeColoring(unsigned short iMesh, CGeometry* geometry);
+
+  /*!
+   * \brief Set the dual grid metrics (volumes, edge and vertex normals) of the fine grid from the cache, and the
+   *        centers of gravity of the elements, i.e. what SetControlVolume and SetBoundControlVolume compute.
+   * \note Collective call, either all ranks succeed or none does.
+   * \param[in,out] geometry - Geometry of the fine grid, with edges and vertices.
+   * \param[in,out] config - Definition of the particular problem, the domain volume is set.
+   * \return True if the metrics were set.
+   */
+  bool LoadDualGrid(CGeometry* geometry, CConfig* config) const;
+
+  /*!
+   * \brief Store the dual grid metrics of the fine grid.
+   * \param[in] geometry - Geometry of the fine grid.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void StoreDualGrid(const CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Get a section stored by another component.
+   * \param[in] name - Name of the section.
+   * \param[in] check - Hash of the inputs the data depends on, the section is only used if it matches.
+   * \param[out] data - Cached data.
+   * \return True if the section was found and matches the check.
+   */
+  bool LoadSection(const std::string& name, uint64_t check, std::vector<uint64_t>& data) const;
+
+  /*!
+   * \brief Store a section for another component.
+   * \param[in] name - Name of the section.
+   * \param[in] check - Hash of the inputs the data depends on.
+   * \param[in] data - Data to cache.
+   */
+  void StoreSection(const std::string& name, uint64_t check, const std::vector<uint64_t>& data);
+
+  /*!
+   * \brief Write the file of this rank if new data was stored (collective call).
+   */
+  void Write();
+};
@@ -66,6 +66,16 @@ class CMultiGridGeometry final : public CGeometry {
   void SetSuitableNeighbors(vector<unsigned long>& Suitable_Indirect_Neighbors, unsigned long iPoint,
                             unsigned long Index_CoarseCV, const CGeometry* fine_grid) const;
 
+  /*!
+   * \brief Agglomerate the domain points that were not agglomerated on the boundaries, using all threads.
+   * \note Seeds are chosen in rounds as distance-2 independent sets, by priority (number of agglomerated
+   *       neighbors), the result does not depend on the number of threads.
+   * \param[in,out] Index_CoarseCV - Number of coarse control volumes, incremented by the new ones.
+   * \param[in] fine_grid - Geometrical definition of the problem (parents of the fine points are set).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ParallelAgglomeration(unsigned long& Index_CoarseCV, CGeometry* fine_grid, const CConfig* config);
+
   /*!
    * \brief Set a representative wall value of the agglomerated control volumes on a particular boundary marker.
    * \param[in] fine_grid - Geometrical definition of the problem.
@@ -494,6 +494,11 @@ class CPoint {
   inline su2double& GetWall_Distance(unsigned long iPoint) { return Wall_Distance(iPoint); }
   inline const su2double& GetWall_Distance(unsigned long iPoint) const { return Wall_Distance(iPoint); }
 
+  /*!
+   * \brief Get the distance to the nearest wall of all points.
+   */
+  inline const su2activevector& GetWall_Distance() const { return Wall_Distance; }
+
   /*!
    * \brief Set the value of the distance to the nearest wall.
    * \param[in] iPoint - Index of the point.
@@ -508,6 +513,11 @@ class CPoint {
    */
   inline su2double GetRoughnessHeight(unsigned long iPoint) const { return RoughnessHeight(iPoint); }
 
+  /*!
+   * \brief Get the roughness height of the nearest wall of all points.
+   */
+  inline const su2activevector& GetRoughnessHeight() const { return RoughnessHeight; }
+
   /*!
    * \brief Set the value of the distance to a sharp edge.
    * \param[in] iPoint - Index of the point.
@@ -559,6 +569,11 @@ class CPoint {
   inline su2double& GetVolume(unsigned long iPoint) { return Volume(iPoint); }
   inline const su2double& GetVolume(unsigned long iPoint) const { return Volume(iPoint); }
 
+  /*!
+   * \brief Get the area or volume of all control volumes.
+   */
+  inline const su2activevector& GetVolume() const { return Volume; }
+
   /*!
    * \brief Set the volume of the control volume.
    * \param[in] iPoint - Index of the point.
@@ -0,0 +1,155 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.hpp
+ * \brief Header file for the class CSU2BinaryMeshReaderFVM.
+ *        The implementations are in the <i>CSU2BinaryMeshReaderFVM.cpp</i> file.
+ * \author T. Economon
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "CMeshReaderFVM.hpp"
+
+/*!
+ * \class CSU2BinaryMeshReaderFVM
+ * \brief Reads a native SU2 binary grid into linear partitions for the finite volume solver (FVM).
+ * \note The file starts with a header of HEADER_SIZE 64-bit unsigned integers, which contains the sizes and the
+ *       byte offsets of each section. The data are stored with the byte order of the machine that wrote the file,
+ *       which is recorded in the header (files with the other byte order are rejected). Each section is an array
+ *       with fixed size records, therefore each rank can read only its linear partition of points and elements
+ *       (instead of scanning the entire file).
+ *       - POINTS: nPoint x nDim doubles (point-major).
+ *       - ELEM_TYPES: nElem bytes with the VTK type of each element.
+ *       - ELEM_OFFSETS: nElem + 1 integers, position of the first node of each element in the connectivity.
+ *       - ELEM_CONN: nConn integers, the (0-based) nodes of all elements.
+ *       - MARKERS: for each marker, the length of the tag, the tag characters, the number of elements, and
+ *         then, for each element, the VTK type and N_POINTS_QUADRILATERAL nodes (unused nodes are 0).
+ * \author T. Economon
+ */
+class CSU2BinaryMeshReaderFVM : public CMeshReaderFVM {
+ public:
+  /*!
+   * \brief Positions of the quantities stored in the header of the file.
+   */
+  enum HeaderField : unsigned short {
+    MAGIC,        /*!< \brief Magic number to identify the file type. */
+    VERSION,      /*!< \brief Version of the format. */
+    ENDIANNESS,   /*!< \brief Byte order marker, BYTE_ORDER_MARK as written by the machine that wrote the file. */
+    NDIME,        /*!< \brief Dimension of the problem. */
+    NPOIN,        /*!< \brief Number of points. */
+    NELEM,        /*!< \brief Number of volume elements. */
+    NCONN,        /*!< \brief Size of the volume connectivity. */
+    NMARK,        /*!< \brief Number of markers. */
+    POINTS,       /*!< \brief Offset (bytes) of the point coordinates. */
+    ELEM_TYPES,   /*!< \brief Offset of the VTK types of the volume elements. */
+    ELEM_OFFSETS, /*!< \brief Offset of the start positions of the volume elements in the connectivity. */
+    ELEM_CONN,    /*!< \brief Offset of the volume connectivity. */
+    MARKERS,      /*!< \brief Offset of the marker section. */
+    HEADER_SIZE
+  };
+  static constexpr uint64_t MAGIC_NUMBER = 0x53553242; /*!< \brief Hex representation of "SU2B". */
+  static constexpr uint64_t FORMAT_VERSION = 2;        /*!< \brief Current version of the format. */
+  static constexpr uint64_t BYTE_ORDER_MARK = 0x0102030405060708; /*!< \brief Reads as 0x0807... if swapped. */
+  static constexpr unsigned short BOUND_CONN_SIZE = 1 + N_POINTS_QUADRILATERAL; /*!< \brief Size of marker records. */
+
+ private:
+  const string meshFilename; /*!< \brief Name of the SU2 binary mesh file being read. */
+
+#ifdef HAVE_MPI
+  MPI_File mesh_file; /*!< \brief MPI file handle, each rank reads its own partition independently. */
+#else
+  ifstream mesh_file; /*!< \brief File object for the SU2 binary mesh file. */
+#endif
+
+  std::array<uint64_t, HEADER_SIZE> header{}; /*!< \brief Header of the file. */
+
+  /*!
+   * \brief Reads a contiguous block of bytes from the file (not collective).
+   * \param[in] offset - Position of the block in the file.
+   * \param[in] nBytes - Size of the block.
+   * \param[out] buffer - Where the block is stored.
+   */
+  void ReadBytes(uint64_t offset, uint64_t nBytes, void* buffer);
+
+  /*!
+   * \brief Reads and checks the header of a file, without opening it for the parallel reading.
+   * \param[in] val_filename - Name of the file.
+   * \returns Header of the file.
+   */
+  static std::array<uint64_t, HEADER_SIZE> ReadFileHeader(const string& val_filename);
+
+  /*!
+   * \brief Reads and checks the header of the file.
+   */
+  void ReadMetadata();
+
+  /*!
+   * \brief Reads the grid points of this rank's linear partition.
+   */
+  void ReadPointCoordinates();
+
+  /*!
+   * \brief Reads a linear partition of the volume elements and redistributes them to the ranks that own their points.
+   */
+  void ReadVolumeElementConnectivity();
+
+  /*!
+   * \brief Reads the surface (boundary) elements, only on the master rank.
+   */
+  void ReadSurfaceElementConnectivity();
+
+ public:
+  /*!
+   * \brief Constructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  CSU2BinaryMeshReaderFVM(CConfig* val_config, unsigned short val_iZone, unsigned short val_nZone);
+
+  /*!
+   * \brief Destructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  ~CSU2BinaryMeshReaderFVM(void) override;
+
+  /*!
+   * \brief Checks the identification fields of a header.
+   * \param[in] fileHeader - Header as read from a file.
+   * \returns Description of the problem, empty if the header is valid.
+   */
+  static string CheckHeader(const std::array<uint64_t, HEADER_SIZE>& fileHeader);
+
+  /*!
+   * \brief Reads the dimension of the problem from the header of a file (used before the geometry is created).
+   * \param[in] val_filename - Name of the file.
+   * \returns Dimension of the problem.
+   */
+  static unsigned short ReadDimension(const string& val_filename);
+
+  /*!
+   * \brief Reads the number of volume elements from the header of a file (used before the geometry is created).
+   * \param[in] val_filename - Name of the file.
+   * \returns Number of volume elements.
+   */
+  static unsigned long ReadNumberOfElements(const string& val_filename);
+};
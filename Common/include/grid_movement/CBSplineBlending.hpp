@@ -40,9 +40,20 @@ using namespace std;
  */
 class CBSplineBlending : public CFreeFormBlending {
  private:
-  vector<su2double> U;          /*!< \brief The knot vector for uniform BSplines on the interval [0,1]. */
-  vector<vector<su2double> > N; /*!< \brief The temporary matrix holding the j+p basis functions up to order p. */
-  unsigned short KnotSize;      /*!< \brief The size of the knot vector. */
+  enum : unsigned short { MAX_ORDER = 16 }; /*!< \brief Maximum order, sizes the temporary basis matrix. */
+
+  vector<su2double> U;     /*!< \brief The knot vector for uniform BSplines on the interval [0,1]. */
+  unsigned short KnotSize; /*!< \brief The size of the knot vector. */
+
+  /*!
+   * \brief Evaluate the i+p basis functions up to order p.
+   * \note The matrix is local to the caller, the basis functions may be evaluated concurrently by multiple threads.
+   * \param[in] val_i - index of the basis function.
+   * \param[in] val_t - Point at which we want to evaluate the i-th basis.
+   * \param[out] N - The matrix holding the j+p basis functions up to order p.
+   * \return Value of the i-th basis function.
+   */
+  su2double EvalBasis(short val_i, su2double val_t, su2double N[][MAX_ORDER]) const;
 
  public:
   /*!
@@ -40,8 +40,6 @@ using namespace std;
  */
 class CBezierBlending : public CFreeFormBlending {
  private:
-  vector<su2double> binomial; /*!< \brief Temporary vector for the Bernstein evaluation. */
-
   /*!
    * \brief Returns the value of the i-th Bernstein polynomial of order n.
    * \param[in] val_n - Order of the Bernstein polynomial.
@@ -61,12 +59,13 @@ class CBezierBlending : public CFreeFormBlending {
 
   /*!
    * \brief Get the binomial coefficient n over i, defined as n!/(m!(n-m)!)
-   * \note If the denominator is 0, the value is 1.
+   * \note If the denominator is 0, the value is 1. Computed without temporaries, the basis
+   *       functions may be evaluated concurrently by multiple threads.
    * \param[in] n - Upper coefficient.
    * \param[in] m - Lower coefficient.
    * \return Value of the binomial coefficient n over m.
    */
-  su2double Binomial(unsigned short n, unsigned short m);
+  static su2double Binomial(unsigned short n, unsigned short m);
 
  public:
   /*!
@@ -37,6 +37,8 @@
  */
 class CFreeFormDefBox : public CGridMovement {
  public:
+  static constexpr unsigned short MAX_DEGREE = 127; /*!< \brief Maximum degree of the FFDBox in each direction. */
+
   unsigned short nDim;                     /*!< \brief Number of dimensions of the problem. */
   unsigned short nCornerPoints,            /*!< \brief Number of corner points of the FFDBox. */
       nControlPoints, nControlPoints_Copy; /*!< \brief Number of control points of the FFDBox. */
@@ -54,8 +56,6 @@ class CFreeFormDefBox : public CGridMovement {
   su2double *ParamCoord, *ParamCoord_,     /*!< \brief Parametric coordinates of a point. */
       *cart_coord, *cart_coord_;           /*!< \brief Cartesian coordinates of a point. */
   su2double ObjFunc;                       /*!< \brief Objective function of the point inversion process. */
-  su2double* Gradient;                     /*!< \brief Gradient of the point inversion process. */
-  su2double** Hessian;                     /*!< \brief Hessian of the point inversion process. */
   su2double MaxCoord[3];                   /*!< \brief Maximum coordinates of the FFDBox. */
   su2double MinCoord[3];                   /*!< \brief Minimum coordinates of the FFDBox. */
   string Tag;                              /*!< \brief Tag to identify the FFDBox. */
@@ -260,6 +260,15 @@ class CFreeFormDefBox : public CGridMovement {
     return ParamCoord_;
   }
 
+  /*!
+   * \brief Get one parametric coordinate (without using temporary storage).
+   * \param[in] val_iSurfacePoints - Surface point of the FFD box.
+   * \param[in] val_iDim - Index of the coordinate.
+   */
+  inline su2double Get_ParametricCoord(unsigned long val_iSurfacePoints, unsigned short val_iDim) const {
+    return ParametricCoord[val_iDim][val_iSurfacePoints];
+  }
+
   /*!
    * \brief Get number of surface points.
    */
@@ -565,6 +574,18 @@ class CFreeFormDefBox : public CGridMovement {
   su2double* GetParametricCoord_Iterative(unsigned long iPoint, su2double* xyz, const su2double* guess,
                                           CConfig* config);
 
+  /*!
+   * \brief Iterative strategy for computing the parametric coordinates, without using member storage.
+   * \note Thread-safe, the point inversion of different points can be done concurrently.
+   * \param[in] iPoint - Index of the point, used in messages and to seed the random restarts.
+   * \param[in] xyz - Cartesians coordinates of the target point.
+   * \param[in] guess - Initial guess for doing the parametric coordinates search.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] uvw - Parametric coordinates of the point.
+   */
+  void GetParametricCoord_Iterative(unsigned long iPoint, const su2double* xyz, const su2double* guess,
+                                    const CConfig* config, su2double* uvw) const;
+
   /*!
    * \brief Compute the cross product.
    * \param[in] v1 - First input vector.
@@ -596,6 +617,14 @@ class CFreeFormDefBox : public CGridMovement {
    */
   su2double* EvalCartesianCoord(su2double* ParamCoord) const;
 
+  /*!
+   * \brief Evaluate the cartesian coordinates of a point from its parametric coordinates.
+   * \note Thread-safe, the basis functions of each direction are evaluated once per point (on the stack).
+   * \param[in] ParamCoord - Parametric coordinates of a point.
+   * \param[out] CartCoord - Cartesian coordinates of the point.
+   */
+  void EvalCartesianCoord(const su2double* ParamCoord, su2double* CartCoord) const;
+
   /*!
    * \brief Get the order in the l direction of the FFD FFDBox.
    * \return Order in the l direction of the FFD FFDBox.
@@ -660,10 +689,9 @@ class CFreeFormDefBox : public CGridMovement {
    * \brief The routine computes the gradient of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2  evaluated at (u, v, w).
    * \param[in] val_coord - Parametric coordiates of the target point.
    * \param[in] xyz - Cartesians coordinates of the point.
-   * \param[in] analytical - Compute the analytical gradient.
-   * \return Value of the analytical gradient.
+   * \param[out] gradient - Value of the analytical gradient.
    */
-  su2double* GetFFDGradient(su2double* val_coord, su2double* xyz);
+  void GetFFDGradient(su2double* val_coord, const su2double* xyz, su2double* gradient) const;
 
   /*!
    * \brief The routine that computes the Hessian of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 evaluated at (u, v, w)
@@ -673,7 +701,7 @@ class CFreeFormDefBox : public CGridMovement {
    * \param[in] xyz - Cartesians coordinates of the target point to compose the functional.
    * \param[in] val_Hessian - Value of the hessian.
    */
-  void GetFFDHessian(su2double* uvw, su2double* xyz, su2double** val_Hessian);
+  void GetFFDHessian(su2double* uvw, const su2double* xyz, su2double val_Hessian[][3]) const;
 
   /*!
    * \brief An auxiliary routine to help us compute the gradient of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 =
@@ -30,6 +30,8 @@
 #include "CGridMovement.hpp"
 #include "CFreeFormDefBox.hpp"
 
+class CGeometryCache;
+
 /*!
  * \class CSurfaceMovement
  * \brief Class for moving the surface numerical grid.
@@ -204,8 +206,11 @@ class CSurfaceMovement : public CGridMovement {
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    * \param[in] FFDBox - Array with all the free forms FFDBoxes of the computation.
+   * \param[in] iFFDBox - Index of FFD box.
+   * \param[in,out] cache - Where the parametric coordinates are loaded from and stored to (optional).
    */
-  void SetParametricCoord(CGeometry* geometry, CConfig* config, CFreeFormDefBox* FFDBox, unsigned short iFFDBox);
+  void SetParametricCoord(CGeometry* geometry, CConfig* config, CFreeFormDefBox* FFDBox, unsigned short iFFDBox,
+                          CGeometryCache* cache = nullptr);
 
   /*!
    * \brief Update the parametric coordinates of a grid point using a point inversion strategy
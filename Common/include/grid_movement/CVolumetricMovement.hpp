@@ -39,6 +39,8 @@
  */
 class CVolumetricMovement : public CGridMovement {
  protected:
+  enum : size_t { OMP_CHUNK_SIZE = 256 }; /*!< \brief Chunk size for point and element loops. */
+
   unsigned short nDim; /*!< \brief Number of dimensions. */
   unsigned short nVar; /*!< \brief Number of variables. */
 
@@ -26,6 +26,7 @@
  */
 #pragma once
 
+#include <functional>
 #include "CInterpolator.hpp"
 #include "../option_structure.hpp"
 #include "../containers/C2DContainer.hpp"
@@ -38,8 +39,11 @@ class CRadialBasisFunction final : public CInterpolator {
   static_assert(su2passivematrix::IsRowMajor, "This class relies on row major storage throughout.");
 
  private:
-  unsigned long MinDonors = 0, AvgDonors = 0, MaxDonors = 0;
-  passivedouble Density = 0.0, AvgCorrection = 0.0, MaxCorrection = 0.0;
+  static constexpr passivedouble SolverTolerance = 1e-10; /*!< \brief Relative residual of the sparse solver. */
+  static constexpr unsigned long SolverMaxIterations = 1000;
+
+  unsigned long MinDonors = 0, AvgDonors = 0, MaxDonors = 0, MaxIterations = 0;
+  passivedouble Density = 0.0, AvgCorrection = 0.0, MaxCorrection = 0.0, MaxTruncation = 0.0;
 
  public:
   /*!
@@ -100,7 +104,49 @@ class CRadialBasisFunction final : public CInterpolator {
    */
   static int CheckPolynomialTerms(su2double max_diff_tol, vector<int>& keep_row, su2passivematrix& P);
 
+  /*!
+   * \brief Compute the interpolation coefficients with a compactly supported RBF (no polynomial terms)
+   * without forming the generator matrix. For each target point, a sparse system is solved on the donors
+   * within "neighborhood" radii of the point, the result is exact if that includes all donors.
+   * \note The callback is called by multiple threads (once per target point).
+   * \param[in] type - Type of radial basis function.
+   * \param[in] radius - Normalizes point-to-point distance when computing RBF values.
+   * \param[in] neighborhood - Size of the donor neighbourhood of each target point, in radii.
+   * \param[in] iterLimit - Maximum number of iterations of the solver.
+   * \param[in] donorCoords - Coordinates of the donor points.
+   * \param[in] targetCoords - Coordinates of the target points.
+   * \param[in] setCoefficients - Called with the index of the target point, its donors (indices in donorCoords),
+   * and the coefficients of those donors, which can be modified.
+   * \param[out] maxIterations - Max. number of iterations of the solver.
+   * \param[out] maxTruncation - Max. coefficient in the outer radius of the neighbourhoods, relative to the
+   * max. coefficient of each target point, large values mean the neighbourhood is too small.
+   * \return Number of target points for which the solver did not converge.
+   */
+  static unsigned long ComputeSparseCoefficients(
+      RADIAL_BASIS type, passivedouble radius, passivedouble neighborhood, unsigned long iterLimit,
+      const su2activematrix& donorCoords, const vector<const su2double*>& targetCoords,
+      const std::function<void(unsigned long, const vector<unsigned long>&, vector<passivedouble>&)>& setCoefficients,
+      unsigned long& maxIterations, passivedouble& maxTruncation);
+
  private:
+  /*!
+   * \brief Gather the donor points of an interface that are close to the target points of this rank.
+   * \param[in] markDonor - Donor marker of the interface.
+   * \param[in] markTarget - Target marker of the interface.
+   * \param[in] nVertexDonor - Number of vertices of the donor marker.
+   * \param[in] distance - Donors are gathered within this distance of the bounding box of the target points.
+   * \param[out] coords - Coordinates of the donor points.
+   * \param[out] globalPoint - Global index of the donor points.
+   * \param[out] processor - Rank that owns the donor points.
+   */
+  void CollectDonorNeighborhood(int markDonor, int markTarget, unsigned long nVertexDonor, passivedouble distance,
+                                su2activematrix& coords, vector<long>& globalPoint, vector<int>& processor) const;
+
+  /*!
+   * \brief Give an MPI-independent order to donor points, by global index.
+   */
+  static void SortByGlobalIndex(su2activematrix& coords, vector<long>& globalPoint, vector<int>& processor);
+
   /*!
    * \brief Helper function, prunes (by setting to zero) small interpolation coefficients,
    * i.e. <= tolerance*max(abs(coeffs)). The vector is re-scaled such that sum(coeffs)==1.
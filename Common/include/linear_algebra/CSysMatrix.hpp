@@ -32,6 +32,7 @@
 #include "CSysVector.hpp"
 #include "CPastixWrapper.hpp"
 
+#include <atomic>
 #include <cstdlib>
 #include <vector>
 #include <cassert>
@@ -152,8 +153,28 @@ class CSysMatrix {
   const unsigned long* col_ind_ilu; /*!< \brief Column index for each of the elements in val() (ILU). */
   unsigned short ilu_fill_in;       /*!< \brief Fill in level for the ILU preconditioner. */
 
+  bool ilu_level_sched; /*!< \brief Use level scheduling (instead of additive thread partitions) in ILU. */
+  vector<unsigned long> ilu_lower_level_ptr;  /*!< \brief Start of each level of the forward sweep (ILU). */
+  vector<unsigned long> ilu_lower_level_rows; /*!< \brief Rows sorted by level of the forward sweep (ILU). */
+  vector<unsigned long> ilu_upper_level_ptr;  /*!< \brief Start of each level of the backward sweep (ILU). */
+  vector<unsigned long> ilu_upper_level_rows; /*!< \brief Rows sorted by level of the backward sweep (ILU). */
+
   ScalarType* invM; /*!< \brief Inverse of (Jacobi) preconditioner, or diagonal of ILU. */
 
+  /*--- Sliced ELLPACK (SELL-C-sigma) copy of the matrix for SIMD matrix-vector products. Rows are sorted
+   *    by length within windows of SELL_SIGMA rows and grouped in slices of SELL_C rows. Each slice is
+   *    padded to its longest row, and the blocks of a slice are stored column-wise, i.e. the entries
+   *    of the SELL_C rows are contiguous for each block entry (lanes of a SIMD register). ---*/
+  enum { SELL_C = 8 };       /*!< \brief Number of rows per slice (SIMD width). */
+  enum { SELL_SIGMA = 256 }; /*!< \brief Size of the sorting window, in rows. */
+  bool sell_format;                    /*!< \brief Use the SELL format in matrix-vector products. */
+  vector<unsigned long> sell_slice_ptr; /*!< \brief Start of each slice, in groups of SELL_C blocks. */
+  vector<unsigned long> sell_rows;      /*!< \brief Row of each slice lane (nPointDomain for padding). */
+  vector<unsigned long> sell_col_ind;   /*!< \brief Column index of each block in SELL format. */
+  vector<unsigned long> sell_src;       /*!< \brief CSR index of each block (nnz for padding). */
+  ScalarType* sell_matrix;              /*!< \brief Entries of the matrix in SELL format. */
+  mutable std::atomic<bool> sell_dirty; /*!< \brief The SELL entries are outdated w.r.t. the CSR entries. */
+
   /*--- Temporary (hence mutable) working memory used in the Linelet preconditioner, outer vector is for threads ---*/
   mutable vector<vector<const ScalarType*> >
       LineletUpper; /*!< \brief Pointers to the upper blocks of the tri-diag system (working memory). */
@@ -179,6 +200,32 @@ class CSysMatrix {
   mutable CPastixWrapper<ScalarType> pastix_wrapper;
 #endif
 
+  /*!
+   * \brief One level of the aggregation-based algebraic multigrid (AMG) hierarchy.
+   * \note Level 0 references the arrays of the matrix itself, coarser levels own their data.
+   *       The hierarchy is local to each rank, couplings with halo points are ignored (as in ILU).
+   */
+  struct CAMGLevel {
+    unsigned long nPoint = 0;                /*!< \brief Number of block rows of the level. */
+    const unsigned long* row_ptr = nullptr;  /*!< \brief Pointers to the first element in each row. */
+    const unsigned long* col_ind = nullptr;  /*!< \brief Column index for each of the elements. */
+    const unsigned long* dia_ptr = nullptr;  /*!< \brief Pointers to the diagonal element in each row. */
+    const ScalarType* matrix = nullptr;      /*!< \brief Entries of the level matrix. */
+
+    vector<unsigned long> rowPtr, colInd, diaPtr; /*!< \brief Storage of the sparse pattern (coarse levels). */
+    vector<ScalarType> values;                    /*!< \brief Storage of the blocks (coarse levels). */
+    vector<ScalarType> invDiag;                   /*!< \brief Inverses of the diagonal blocks (smoother). */
+    vector<unsigned long> parts;                  /*!< \brief Thread partitions of the rows for the smoother. */
+
+    vector<unsigned long> aggregate;      /*!< \brief Point of the next level to which each point belongs. */
+    vector<unsigned long> aggPtr, aggIdx; /*!< \brief Points of this level that form each point of the next. */
+    vector<unsigned long> galerkinMap;    /*!< \brief Block of the next level to which each non-zero is added. */
+
+    mutable vector<ScalarType> sol, rhs, res, solOld; /*!< \brief Working vectors of the multigrid cycle. */
+  };
+  vector<CAMGLevel> AMGLevels;  /*!< \brief The AMG hierarchy, finest level first. */
+  unsigned short amg_smooth_iter = 1; /*!< \brief Number of pre- and post-smoothing sweeps of the AMG cycle. */
+
   /*!
    * \brief Auxilary object to wrap the edge map pointer used in fast block updates, i.e. without linear searches.
    */
@@ -355,6 +402,81 @@ class CSysMatrix {
    */
   void RowProduct(const CSysVector<ScalarType>& vec, unsigned long row_i, ScalarType* prod) const;
 
+  /*!
+   * \brief Build the AMG hierarchy, i.e. aggregates and sparse patterns of the coarse levels.
+   * \note Serial, the aggregation is based on the strength of connection of the current matrix.
+   * \param[in] maxLevels - Maximum number of levels (including the finest).
+   */
+  void SetupAMGHierarchy(unsigned short maxLevels);
+
+  /*!
+   * \brief Symmetric block Gauss-Seidel smoothing of one AMG level (Jacobi across thread partitions).
+   * \param[in] level - The AMG level.
+   * \param[in] rhs - Right hand side.
+   * \param[in,out] sol - Solution, zeroed first if zeroGuess is true.
+   * \param[in] nSweeps - Number of sweeps (each one forward and backward).
+   * \param[in] zeroGuess - Start from a zero solution.
+   */
+  void AMGSmooth(const CAMGLevel& level, const ScalarType* rhs, ScalarType* sol, unsigned short nSweeps,
+                 bool zeroGuess) const;
+
+  /*!
+   * \brief Recursive V-cycle of the AMG preconditioner starting at a given level.
+   * \param[in] iLevel - Index of the level.
+   * \param[in] rhs - Right hand side.
+   * \param[out] sol - Approximate solution.
+   */
+  void AMGCycle(unsigned long iLevel, const ScalarType* rhs, ScalarType* sol) const;
+
+  /*!
+   * \brief Compute the level schedules of the triangular sweeps of ILU. Rows in the same level of
+   *        the forward (backward) sweep do not depend on each other, couplings with halos are ignored.
+   */
+  void SetILULevelSchedule();
+
+  /*!
+   * \brief Eliminate the lower part of an ILU row, considering only the sub-matrix [begin, end[.
+   * \note The diagonal blocks of the rows being eliminated must have been inverted already.
+   */
+  void FactorizeILURow(unsigned long iPoint, unsigned long begin, unsigned long end);
+
+  /*!
+   * \brief Build the slices of the SELL-C-sigma format from the CSR sparse pattern.
+   */
+  void SetSELLStructure();
+
+  /*!
+   * \brief Copy the values of the matrix to the SELL-C-sigma format used in matrix-vector products.
+   * \note Called lazily by the product when the values were modified since the last copy.
+   */
+  void UpdateSELLValues() const;
+
+  /*!
+   * \brief Forward substitution of one row of the ILU preconditioner (columns before "begin" ignored).
+   */
+  inline void ForwardSolveILURow(unsigned long iPoint, unsigned long begin, CSysVector<ScalarType>& prod) const {
+    for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+      const auto jPoint = col_ind_ilu[index];
+      if (jPoint < begin) continue;
+      MatrixVectorProductSub(&ILU_matrix[index * nVar * nVar], &prod[jPoint * nVar], &prod[iPoint * nVar]);
+    }
+  }
+
+  /*!
+   * \brief Backward substitution of one row of the ILU preconditioner (columns from "end" ignored).
+   */
+  inline void BackwardSolveILURow(unsigned long iPoint, unsigned long end, CSysVector<ScalarType>& prod) const {
+    ScalarType aux_vec[MAXNVAR];
+    for (auto iVar = 0ul; iVar < nVar; iVar++) aux_vec[iVar] = prod[iPoint * nVar + iVar];
+
+    for (auto index = dia_ptr_ilu[iPoint] + 1; index < row_ptr_ilu[iPoint + 1]; index++) {
+      const auto jPoint = col_ind_ilu[index];
+      if (jPoint >= end) break;
+      MatrixVectorProductSub(&ILU_matrix[index * nVar * nVar], &prod[jPoint * nVar], aux_vec);
+    }
+    MatrixVectorProduct(&invM[iPoint * nVar * nVar], aux_vec, &prod[iPoint * nVar]);
+  }
+
  public:
   /*!
    * \brief Constructor of the class.
@@ -407,12 +529,20 @@ class CSysMatrix {
 
   /*!
    * \brief Get a pointer to the start of block "ij", non-const version
+   * \note Callers that modify the block through this pointer must call SetSELLDirty.
    */
   FORCEINLINE ScalarType* GetBlock(unsigned long block_i, unsigned long block_j) {
     const CSysMatrix& const_this = *this;
     return const_cast<ScalarType*>(const_this.GetBlock(block_i, block_j));
   }
 
+  /*!
+   * \brief Flag the SELL copy of the values as outdated, must be called by all methods that modify the values.
+   */
+  FORCEINLINE void SetSELLDirty() {
+    if (sell_format && !sell_dirty.load(std::memory_order_relaxed)) sell_dirty.store(true, std::memory_order_relaxed);
+  }
+
   /*!
    * \brief Gets the value of a particular entry in block "ij".
    * \param[in] block_i - Row index.
@@ -441,6 +571,7 @@ class CSysMatrix {
                        OtherType alpha = 1.0) {
     auto mat_ij = GetBlock(block_i, block_j);
     if (!mat_ij) return;
+    SetSELLDirty();
     SU2_OMP_SIMD
     for (auto iVar = 0ul; iVar < nVar * nEqn; ++iVar) {
       mat_ij[iVar] = (Overwrite ? ScalarType(0) : mat_ij[iVar]) + PassiveAssign(alpha * val_block[iVar]);
@@ -473,6 +604,7 @@ class CSysMatrix {
                        OtherType alpha = 1.0) {
     auto mat_ij = GetBlock(block_i, block_j);
     if (!mat_ij) return;
+    SetSELLDirty();
     for (auto iVar = 0ul; iVar < nVar; ++iVar) {
       for (auto jVar = 0ul; jVar < nEqn; ++jVar) {
         *mat_ij = (Overwrite ? ScalarType(0) : *mat_ij) + PassiveAssign(alpha * val_block[iVar][jVar]);
@@ -520,6 +652,7 @@ class CSysMatrix {
                        typename MatrixType::Scalar alpha = 1.0) {
     auto mat_ij = GetBlock(block_i, block_j);
     if (!mat_ij) return;
+    SetSELLDirty();
     for (auto iVar = 0ul; iVar < nVar; ++iVar) {
       for (auto jVar = 0ul; jVar < nEqn; ++jVar) {
         *mat_ij = (Overwrite ? ScalarType(0) : *mat_ij) + PassiveAssign(alpha * val_block(iVar, jVar));
@@ -554,6 +687,7 @@ class CSysMatrix {
   template <class MatrixType, class OtherType = ScalarType>
   inline void UpdateBlocks(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint, const MatrixType& block_i,
                            const MatrixType& block_j, OtherType scale = 1) {
+    SetSELLDirty();
     ScalarType* bii = &matrix[dia_ptr[iPoint] * nVar * nEqn];
     ScalarType* bjj = &matrix[dia_ptr[jPoint] * nVar * nEqn];
     ScalarType* bij = &matrix[edge_ptr(iEdge, 0) * nVar * nEqn];
@@ -592,6 +726,7 @@ class CSysMatrix {
     static_assert(MatTypeSIMD::IsRowMajor, "Block storage is not compatible with matrix.");
     constexpr size_t blkSz = MatTypeSIMD::StaticSize;
     assert(blkSz == nVar * nEqn);
+    SetSELLDirty();
 
     /*--- "Transpose" the blocks, scale, and possibly convert types,
      * giving the compiler the chance to vectorize all of these. ---*/
@@ -640,6 +775,7 @@ class CSysMatrix {
   template <class MatrixType, class OtherType = ScalarType, bool Overwrite = true>
   inline void SetBlocks(unsigned long iEdge, const MatrixType& block_i, const MatrixType& block_j,
                         OtherType scale = 1) {
+    SetSELLDirty();
     ScalarType* bij = &matrix[edge_ptr(iEdge, 0) * nVar * nEqn];
     ScalarType* bji = &matrix[edge_ptr(iEdge, 1) * nVar * nEqn];
 
@@ -682,6 +818,7 @@ class CSysMatrix {
     static_assert(MatTypeSIMD::IsRowMajor, "Block storage is not compatible with matrix.");
     constexpr size_t blkSz = MatTypeSIMD::StaticSize;
     assert(blkSz == nVar * nEqn);
+    SetSELLDirty();
 
     /*--- "Transpose" the blocks, scale, and possibly convert types,
      * giving the compiler the chance to vectorize all of these. ---*/
@@ -723,6 +860,7 @@ class CSysMatrix {
    */
   template <class OtherType, bool Overwrite = true, class T = ScalarType>
   inline void SetBlock2Diag(unsigned long block_i, const OtherType& val_block, T alpha = 1.0) {
+    SetSELLDirty();
     auto mat_ii = &matrix[dia_ptr[block_i] * nVar * nEqn];
 
     for (auto iVar = 0ul; iVar < nVar; iVar++)
@@ -740,6 +878,39 @@ class CSysMatrix {
     SetBlock2Diag<OtherType, false>(block_i, val_block, alpha);
   }
 
+  /*!
+   * \brief SIMD version of AddBlock2Diag, updates the diagonal blocks of multiple points.
+   * \note Nothing is updated if the mask is 0, otherwise it scales the blocks (e.g. -1 subtracts).
+   */
+  template <class MatTypeSIMD, size_t N, class I, class F = ScalarType>
+  FORCEINLINE void AddBlock2Diag(simd::Array<I, N> iPoint, const MatTypeSIMD& block, simd::Array<F, N> mask = 1) {
+    static_assert(MatTypeSIMD::StaticSize, "This method requires static size blocks.");
+    static_assert(MatTypeSIMD::IsRowMajor, "Block storage is not compatible with matrix.");
+    constexpr size_t blkSz = MatTypeSIMD::StaticSize;
+    assert(blkSz == nVar * nEqn);
+    SetSELLDirty();
+
+    /*--- "Transpose" the block, scale, and possibly convert types. ---*/
+    ScalarType blk[N][blkSz];
+
+    for (size_t i = 0; i < blkSz; ++i) {
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (size_t k = 0; k < N; ++k) {
+        blk[k][i] = PassiveAssign(mask[k] * block.data()[i][k]);
+      }
+    }
+
+    /*--- Update one by one skipping if mask is 0. ---*/
+    for (size_t k = 0; k < N; ++k) {
+      if (mask[k] == 0) continue;
+
+      auto bii = &matrix[dia_ptr[iPoint[k]] * blkSz];
+
+      SU2_OMP_SIMD
+      for (size_t i = 0; i < blkSz; ++i) bii[i] += blk[k][i];
+    }
+  }
+
   /*!
    * \brief Short-hand to AddBlock2Diag with alpha = -1, i.e. subtracts from the current diagonal.
    */
@@ -756,6 +927,7 @@ class CSysMatrix {
    */
   template <class OtherType>
   inline void AddVal2Diag(unsigned long block_i, OtherType val_matrix) {
+    SetSELLDirty();
     for (auto iVar = 0ul; iVar < nVar; iVar++)
       matrix[dia_ptr[block_i] * nVar * nVar + iVar * (nVar + 1)] += PassiveAssign(val_matrix);
   }
@@ -769,6 +941,7 @@ class CSysMatrix {
    */
   template <class OtherType>
   inline void AddVal2Diag(unsigned long block_i, unsigned long iVar, OtherType val) {
+    SetSELLDirty();
     matrix[dia_ptr[block_i] * nVar * nVar + iVar * (nVar + 1)] += PassiveAssign(val);
   }
 
@@ -780,6 +953,7 @@ class CSysMatrix {
    */
   template <class OtherType>
   inline void SetVal2Diag(unsigned long block_i, OtherType val_matrix) {
+    SetSELLDirty();
     unsigned long iVar, index = dia_ptr[block_i] * nVar * nVar;
 
     /*--- Clear entire block before setting its diagonal. ---*/
@@ -891,6 +1065,23 @@ class CSysMatrix {
   void ComputeLineletPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
                                     CGeometry* geometry, const CConfig* config) const;
 
+  /*!
+   * \brief Build the algebraic multigrid preconditioner.
+   * \note The aggregates are determined on the first call, subsequent calls only update the coarse operators.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildAMGPreconditioner(const CConfig* config);
+
+  /*!
+   * \brief Multiply CSysVector by the preconditioner (one V-cycle of the AMG hierarchy).
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product A*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
+                                const CConfig* config) const;
+
   /*!
    * \brief Compute the linear residual.
    * \param[in] sol - Solution (x).
@@ -99,6 +99,12 @@ class CSysSolve {
 
   mutable std::vector<VectorType> W; /*!< \brief Large matrix used by FGMRES, w^i+1 = A * z^i. */
   mutable std::vector<VectorType> Z; /*!< \brief Large matrix used by FGMRES, preconditioned W. */
+  mutable std::vector<VectorType> Q; /*!< \brief Products A * Z used by the pipelined FGMRES. */
+  mutable std::vector<VectorType> PBCG; /*!< \brief Additional vectors used by the pipelined BCGSTAB. */
+
+  mutable std::vector<ScalarType> dotLocal;  /*!< \brief Partial sums of batched dot products (this rank). */
+  mutable std::vector<ScalarType> dotGlobal; /*!< \brief Result of batched dot products (all ranks). */
+  mutable CBaseMPIWrapper::Request dotRequest; /*!< \brief Request of the non-blocking reduction of dot products. */
 
   VectorType
       LinSysSol_tmp; /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
@@ -184,6 +190,21 @@ class CSysSolve {
    */
   void ModGramSchmidt(bool shared_hsbg, int i, su2matrix<ScalarType>& Hsbg, std::vector<VectorType>& w) const;
 
+  /*!
+   * \brief Start the reduction (over threads and ranks) of a batch of dot products a[k].b[k], without waiting for it.
+   * \note The MPI reduction is non-blocking for passive types, the results are obtained with FinishDotProducts.
+   * \param[in] n - Number of dot products.
+   * \param[in] a - First vector of each product.
+   * \param[in] b - Second vector of each product.
+   */
+  void StartDotProducts(unsigned long n, const VectorType* const* a, const VectorType* const* b) const;
+
+  /*!
+   * \brief Wait for the reduction started by StartDotProducts.
+   * \return Pointer to the results (shared by all threads, valid until the next call to StartDotProducts).
+   */
+  const ScalarType* FinishDotProducts() const;
+
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -333,6 +354,25 @@ class CSysSolve {
                                   const PrecondType& precond, ScalarType tol, unsigned long m, ScalarType& residual,
                                   bool monitoring, const CConfig* config);
 
+  /*!
+   * \brief Pipelined Flexible Generalized Minimal Residual method, the reductions are non-blocking.
+   * \note Classical Gram-Schmidt with re-orthogonalization, the reduction of the first pass is overlapped with the
+   *       preconditioner, and the one of the second pass with the matrix-vector product, of the next direction.
+   *       The preconditioner must be a linear operator.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PFGMRES_LinSolver(const VectorType& b, VectorType& x, const ProductType& mat_vec,
+                                  const PrecondType& precond, ScalarType tol, unsigned long m, ScalarType& residual,
+                                  bool monitoring, const CConfig* config) const;
+
   /*!
    * \brief Biconjugate Gradient Stabilized Method (BCGSTAB)
    * \param[in] b - the right hand size vector
@@ -349,6 +389,23 @@ class CSysSolve {
                                   const PrecondType& precond, ScalarType tol, unsigned long m, ScalarType& residual,
                                   bool monitoring, const CConfig* config) const;
 
+  /*!
+   * \brief Pipelined BCGSTAB (Cools and Vanroose, 2017), the two reductions of each iteration are non-blocking
+   *        and overlapped with the preconditioner and product, the residual norm is obtained at no extra cost.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PBCGSTAB_LinSolver(const VectorType& b, VectorType& x, const ProductType& mat_vec,
+                                   const PrecondType& precond, ScalarType tol, unsigned long m, ScalarType& residual,
+                                   bool monitoring, const CConfig* config) const;
+
   /*!
    * \brief Generic smoother (modified Richardson iteration with preconditioner)
    * \param[in] b - the right hand size vector
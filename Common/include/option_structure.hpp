@@ -365,6 +365,18 @@ static const MapType<std::string, RADIAL_BASIS> RadialBasisFunction_Map = {
   MakePair("MULTI_QUADRIC", RADIAL_BASIS::MULTI_QUADRIC)
 };
 
+/*!
+ * \brief Methods to compute the radial basis function interpolation coefficients.
+ */
+enum class RADIAL_BASIS_SOLVER {
+  DENSE,   /*!< \brief Inversion of the dense interpolation kernel, any basis function. */
+  SPARSE,  /*!< \brief Iterative solution with the sparse kernel of compactly supported functions. */
+};
+static const MapType<std::string, RADIAL_BASIS_SOLVER> RadialBasisSolver_Map = {
+  MakePair("DENSE", RADIAL_BASIS_SOLVER::DENSE)
+  MakePair("SPARSE", RADIAL_BASIS_SOLVER::SPARSE)
+};
+
 /*!
  * \brief type of radial spanwise interpolation function for the inlet face
  */
@@ -605,6 +617,19 @@ static const MapType<std::string, ENUM_DATADRIVEN_METHOD> DataDrivenMethod_Map =
   MakePair("MLP", ENUM_DATADRIVEN_METHOD::MLP)
 };
 
+/*!
+ * \brief Point location structure of the look-up table levels, only the selected one is built.
+ */
+enum class LUT_SEARCH_MAP {
+  TRAPEZOIDAL,  /*!< \brief Trapezoidal map, exact location with a logarithmic search. */
+  UNIFORM_GRID, /*!< \brief Triangles binned on a uniform grid, faster for the batched look-up. */
+};
+
+static const MapType<std::string, LUT_SEARCH_MAP> LUTSearchMap_Map = {
+  MakePair("TRAPEZOIDAL", LUT_SEARCH_MAP::TRAPEZOIDAL)
+  MakePair("UNIFORM_GRID", LUT_SEARCH_MAP::UNIFORM_GRID)
+};
+
 /*!
  * \brief types of coefficient transport model
  */
@@ -1992,13 +2017,15 @@ enum ENUM_INPUT {
   SU2       = 1,  /*!< \brief SU2 input format. */
   CGNS_GRID = 2,  /*!< \brief CGNS input format for the computational grid. */
   RECTANGLE = 3,  /*!< \brief 2D rectangular mesh with N x M points of size Lx x Ly. */
-  BOX       = 4   /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  BOX       = 4,  /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  SU2_BINARY_GRID = 5  /*!< \brief Native SU2 binary format, read in parallel by linear partitions. */
 };
 static const MapType<std::string, ENUM_INPUT> Input_Map = {
   MakePair("SU2", SU2)
   MakePair("CGNS", CGNS_GRID)
   MakePair("RECTANGLE", RECTANGLE)
   MakePair("BOX", BOX)
+  MakePair("SU2_BINARY", SU2_BINARY_GRID)
 };
 
 
@@ -2017,6 +2044,7 @@ enum class OUTPUT_TYPE {
   SURFACE_PARAVIEW_ASCII,  /*!< \brief Paraview ASCII format for the solution output. */
   SURFACE_PARAVIEW_LEGACY_BINARY, /*!< \brief Paraview binary format for the solution output. */
   MESH,                    /*!< \brief SU2 mesh format. */
+  MESH_BINARY,             /*!< \brief SU2 binary mesh format. */
   RESTART_BINARY,          /*!< \brief SU2 binary restart format. */
   RESTART_ASCII,           /*!< \brief SU2 ASCII restart format. */
   PARAVIEW_XML,            /*!< \brief Paraview XML with binary data format */
@@ -2042,6 +2070,7 @@ static const MapType<std::string, OUTPUT_TYPE> Output_Map = {
   MakePair("SURFACE_PARAVIEW", OUTPUT_TYPE::SURFACE_PARAVIEW_XML)
   MakePair("PARAVIEW_MULTIBLOCK", OUTPUT_TYPE::PARAVIEW_MULTIBLOCK)
   MakePair("MESH", OUTPUT_TYPE::MESH)
+  MakePair("MESH_BINARY", OUTPUT_TYPE::MESH_BINARY)
   MakePair("RESTART_ASCII", OUTPUT_TYPE::RESTART_ASCII)
   MakePair("RESTART", OUTPUT_TYPE::RESTART_BINARY)
   MakePair("CGNS", OUTPUT_TYPE::CGNS)
@@ -2133,6 +2162,18 @@ static const MapType<std::string, MG_CYCLE> MG_Cycle_Map = {
   MakePair("FULLMG_CYCLE", FULLMG_CYCLE)
 };
 
+/*!
+ * \brief Types of multigrid agglomeration algorithms.
+ */
+enum class MG_AGGLOMERATION {
+  QUEUE,     /*!< \brief Sequential, seeds are taken from a priority queue. */
+  PARALLEL,  /*!< \brief Thread-parallel, seeds are distance-2 independent sets of points. */
+};
+static const MapType<std::string, MG_AGGLOMERATION> MG_Agglomeration_Map = {
+  MakePair("QUEUE", MG_AGGLOMERATION::QUEUE)
+  MakePair("PARALLEL", MG_AGGLOMERATION::PARALLEL)
+};
+
 /*!
  * \brief Types of design parameterizations
  */
@@ -2230,12 +2271,16 @@ enum ENUM_LINEAR_SOLVER {
   SMOOTHER,             /*!< \brief Iterative smoother. */
   PASTIX_LDLT,          /*!< \brief PaStiX LDLT (complete) factorization. */
   PASTIX_LU,            /*!< \brief PaStiX LU (complete) factorization. */
+  PIPELINED_FGMRES,     /*!< \brief FGMRES with two non-blocking reductions per iteration, overlapping the products. */
+  PIPELINED_BCGSTAB,    /*!< \brief BCGSTAB with non-blocking reductions overlapped with the products. */
 };
 static const MapType<std::string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("CONJUGATE_GRADIENT", CONJUGATE_GRADIENT)
   MakePair("BCGSTAB", BCGSTAB)
   MakePair("FGMRES", FGMRES)
   MakePair("RESTARTED_FGMRES", RESTARTED_FGMRES)
+  MakePair("PIPELINED_FGMRES", PIPELINED_FGMRES)
+  MakePair("PIPELINED_BCGSTAB", PIPELINED_BCGSTAB)
   MakePair("SMOOTHER", SMOOTHER)
   MakePair("PASTIX_LDLT", PASTIX_LDLT)
   MakePair("PASTIX_LU", PASTIX_LU)
@@ -2295,6 +2340,7 @@ enum ENUM_LINEAR_SOLVER_PREC {
   LU_SGS,         /*!< \brief LU SGS preconditioner. */
   LINELET,        /*!< \brief Line implicit preconditioner. */
   ILU,            /*!< \brief ILU(k) preconditioner. */
+  AMG,            /*!< \brief Aggregation-based algebraic multigrid preconditioner. */
   PASTIX_ILU=10,  /*!< \brief PaStiX ILU(k) preconditioner. */
   PASTIX_LU_P,    /*!< \brief PaStiX LU as preconditioner. */
   PASTIX_LDLT_P,  /*!< \brief PaStiX LDLT as preconditioner. */
@@ -2304,11 +2350,24 @@ static const MapType<std::string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Ma
   MakePair("LU_SGS", LU_SGS)
   MakePair("LINELET", LINELET)
   MakePair("ILU", ILU)
+  MakePair("AMG", AMG)
   MakePair("PASTIX_ILU", PASTIX_ILU)
   MakePair("PASTIX_LU", PASTIX_LU_P)
   MakePair("PASTIX_LDLT", PASTIX_LDLT_P)
 };
 
+/*!
+ * \brief Storage format used by the sparse matrix-vector product of the linear solvers.
+ */
+enum class SPARSE_MATRIX_FORMAT {
+  CSR,           /*!< \brief Block compressed sparse row (the native format of CSysMatrix). */
+  SELL_C_SIGMA,  /*!< \brief Sliced ELLPACK, blocks of consecutive rows interleaved for SIMD. */
+};
+static const MapType<std::string, SPARSE_MATRIX_FORMAT> Sparse_Matrix_Format_Map = {
+  MakePair("CSR", SPARSE_MATRIX_FORMAT::CSR)
+  MakePair("SELL", SPARSE_MATRIX_FORMAT::SELL_C_SIGMA)
+};
+
 /*!
  * \brief Types of analytic definitions for various geometries
  */
@@ -94,14 +94,16 @@ void CBaseMPIWrapper::Error(const std::string& ErrorMsg, const std::string& Func
     }
   }
 
-  /* Check if this rank must write the error message and do so. */
+  /* Check if this rank must write the error message and do so. Ranks whose
+     standard output was disabled (e.g. concurrent zones) use the error stream. */
   if (Rank == MinRankError) {
-    std::cout << std::endl << std::endl;
-    std::cout << "Error in \"" << FunctionName << "\": " << std::endl;
-    std::cout << "-------------------------------------------------------------------------" << std::endl;
-    std::cout << ErrorMsg << std::endl;
-    std::cout << "------------------------------ Error Exit -------------------------------" << std::endl;
-    std::cout << std::endl << std::endl;
+    std::ostream& out = (std::cout.rdbuf() != nullptr) ? std::cout : std::cerr;
+    out << std::endl << std::endl;
+    out << "Error in \"" << FunctionName << "\": " << std::endl;
+    out << "-------------------------------------------------------------------------" << std::endl;
+    out << ErrorMsg << std::endl;
+    out << "------------------------------ Error Exit -------------------------------" << std::endl;
+    out << std::endl << std::endl;
   }
   Abort(currentComm, EXIT_FAILURE);
 }
@@ -151,6 +151,12 @@ class CBaseMPIWrapper {
 
   static inline void Comm_size(Comm comm, int* size) { MPI_Comm_size(comm, size); }
 
+  static inline void Comm_split(Comm comm, int color, int key, Comm* newcomm) {
+    MPI_Comm_split(comm, color, key, newcomm);
+  }
+
+  static inline void Comm_free(Comm* comm) { MPI_Comm_free(comm); }
+
   static inline void Finalize() {
     if (winMinRankErrorInUse) MPI_Win_free(&winMinRankError);
     MPI_Finalize();
@@ -208,6 +214,11 @@ class CBaseMPIWrapper {
     MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
   }
 
+  static inline void Iallreduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm,
+                                Request* request) {
+    MPI_Iallreduce(sendbuf, recvbuf, count, datatype, op, comm, request);
+  }
+
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
     MPI_Gather(sendbuf, sendcnt, sendtype, recvbuf, recvcnt, recvtype, root, comm);
@@ -413,6 +424,10 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
     AMPI_Allreduce(sendbuf, recvbuf, count, convertDatatype(datatype), convertOp(op), convertComm(comm));
   }
 
+  /*--- Non-blocking reductions of active types are not supported, the base (passive) version must not be used. ---*/
+  static void Iallreduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm,
+                         Request* request) = delete;
+
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
     AMPI_Gather(sendbuf, sendcnt, convertDatatype(sendtype), recvbuf, recvcnt, convertDatatype(recvtype), root,
@@ -532,6 +547,10 @@ class CBaseMPIWrapper {
 
   static inline void Comm_size(Comm comm, int* size) { *size = 1; }
 
+  static inline void Comm_split(Comm comm, int color, int key, Comm* newcomm) { *newcomm = comm; }
+
+  static inline void Comm_free(Comm* comm) {}
+
   static inline void Finalize() {}
 
   static inline void Isend(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
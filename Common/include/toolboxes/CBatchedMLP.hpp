@@ -0,0 +1,132 @@
+/*!
+ * \file CBatchedMLP.hpp
+ * \brief Evaluation of multi-layer perceptrons for blocks of query points.
+ * \author E.C.Bunschoten
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "../basic_types/datatype_structure.hpp"
+#include "../linear_algebra/blas_structure.hpp"
+
+/*!
+ * \class CBatchedMLP
+ * \brief Collection of multi-layer perceptrons (MLPCpp .mlp files) evaluated for blocks of query points.
+ * \details The networks are read with MLPToolbox::CReadNeuralNetwork, the query points are processed in blocks of
+ *          BLOCK_SIZE, each layer is evaluated for all the points of a block with one matrix product
+ *          (CBlasStructure::gemm), followed by the bias and the activation function. MLPCpp applies the activation
+ *          functions neuron by neuron inside its own evaluation, here they are applied to the whole block.
+ *          Inputs and outputs are normalized as in MLPToolbox::CLookUp_ANN::PredictANN, the results match the
+ *          point-wise evaluation of the library up to round-off.
+ * \note Only available when SU2 is built with MLPCpp. Predict uses internal work arrays, each thread needs its
+ *       own object.
+ * \author E.C.Bunschoten
+ */
+class CBatchedMLP {
+ public:
+  enum : unsigned long { BLOCK_SIZE = 64 }; /*!< \brief Query points evaluated together. */
+
+ private:
+  /*!
+   * \brief Activation functions of the MLPCpp file format, evaluated for blocks of points.
+   */
+  enum class ACTIVATION { LINEAR, RELU, ELU, SELU, SWISH, SIGMOID, TANH, GELU, EXPONENTIAL, SMOOTH_SLOPE };
+
+  /*!
+   * \brief Weights and normalization of one network of the collection.
+   */
+  struct CNetwork {
+    std::vector<std::string> input_names, output_names;
+    std::vector<std::pair<passivedouble, passivedouble>> input_norm, output_norm; /*!< \brief (min, max). */
+    std::vector<unsigned long> n_neurons;          /*!< \brief Number of neurons of each layer. */
+    std::vector<ACTIVATION> activations;           /*!< \brief Activation function of each layer. */
+    std::vector<std::vector<su2double>> weights;   /*!< \brief Row-major (n_neurons[i] x n_neurons[i+1]). */
+    std::vector<std::vector<su2double>> biases;    /*!< \brief Biases of each layer (empty for the input layer). */
+
+    std::vector<unsigned long> idx_inputs;                           /*!< \brief Query input of each network input. */
+    std::vector<std::pair<unsigned long, unsigned long>> idx_outputs; /*!< \brief (network output, query output). */
+  };
+
+  std::vector<CNetwork> networks;      /*!< \brief Networks of the collection. */
+  unsigned long n_inputs = 0,          /*!< \brief Number of query inputs. */
+      n_outputs = 0;                   /*!< \brief Number of query outputs. */
+  CBlasStructure blas;                 /*!< \brief Matrix product of the layers. */
+  std::vector<su2double> layer_input,  /*!< \brief Outputs of the previous layer for a block of points. */
+      layer_output;                    /*!< \brief Outputs of the current layer for a block of points. */
+
+  /*!
+   * \brief Read a network from an MLPCpp input file with the parser of the library.
+   * \param[in] filename - Name of the .mlp file.
+   * \return The network.
+   */
+  static CNetwork ReadNetwork(const std::string& filename);
+
+  /*!
+   * \brief Add the biases and apply the activation function to the outputs of a layer.
+   * \param[in] function - Activation function.
+   * \param[in] n_points - Number of points in the block.
+   * \param[in] n_neurons - Number of neurons of the layer.
+   * \param[in] bias - Biases of the layer.
+   * \param[in,out] values - Outputs of the layer, row-major (n_points x n_neurons).
+   */
+  static void Activate(ACTIVATION function, unsigned long n_points, unsigned long n_neurons, const su2double* bias,
+                       su2double* values);
+
+ public:
+  /*!
+   * \brief Read the networks of the collection.
+   * \param[in] n_files - Number of .mlp files.
+   * \param[in] filenames - Names of the .mlp files.
+   */
+  CBatchedMLP(unsigned short n_files, const std::string* filenames);
+
+  /*!
+   * \brief Select the networks that provide the query outputs from the query inputs.
+   * \note As for the MLPCpp input-output map, each output is taken from the first network that predicts it and
+   *       whose inputs are all query inputs.
+   * \param[in] input_names - Names of the query inputs.
+   * \param[in] output_names - Names of the query outputs.
+   */
+  void PairVariables(const std::vector<std::string>& input_names, const std::vector<std::string>& output_names);
+
+  /*!
+   * \brief Get the normalization range of a query input.
+   * \param[in] iInput - Index of the query input.
+   * \return (min, max) of the input in the first network that uses it.
+   */
+  std::pair<passivedouble, passivedouble> GetInputNorm(unsigned long iInput) const;
+
+  /*!
+   * \brief Evaluate the paired networks for a batch of query points.
+   * \param[in] n_points - Number of query points.
+   * \param[in] inputs - For each query input, pointer to the values at the n_points points.
+   * \param[out] outputs - Values of the query outputs, row-major (n_points x number of outputs).
+   * \param[out] exit_codes - Optional, 1 if an input of the point is outside the normalization range, 0 otherwise.
+   * \return Number of points with inputs outside the normalization range.
+   */
+  unsigned long Predict(unsigned long n_points, const std::vector<const su2double*>& inputs, su2double* outputs,
+                        unsigned short* exit_codes = nullptr);
+};
@@ -0,0 +1,134 @@
+/*!
+ * \file CPointBins.hpp
+ * \brief Uniform bins of points for fixed radius neighbour searches.
+ * \author P. Gomes
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../containers/C2DContainer.hpp"
+#include "geometry_toolbox.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+/*!
+ * \brief Uniform bins of points, used to find the points within a radius of a given coordinate.
+ * \note The coordinates are not copied, they must outlive the bins.
+ * \author P. Gomes
+ */
+class CPointBins {
+  int nDim = 0;
+  passivedouble binSize = 0.0;
+  passivedouble origin[3] = {0.0};
+  long nBins[3] = {1, 1, 1};
+  std::vector<unsigned long> binStart, binPoints;
+  const su2activematrix* coords = nullptr;
+
+  long BinIndex(int iDim, passivedouble x) const {
+    return std::min(std::max(long(std::floor((x - origin[iDim]) / binSize)), 0l), nBins[iDim] - 1);
+  }
+
+ public:
+  CPointBins(const su2activematrix& coords_, passivedouble radius) : nDim(coords_.cols()), coords(&coords_) {
+    const auto nPoint = coords_.rows();
+    binSize = radius;
+
+    /*--- A single empty bin, the extent of the points is not defined. ---*/
+    if (nPoint == 0) {
+      binStart.assign(2, 0);
+      return;
+    }
+
+    passivedouble extent[3] = {0.0};
+    for (int iDim = 0; iDim < nDim; ++iDim) {
+      origin[iDim] = std::numeric_limits<passivedouble>::max();
+      extent[iDim] = std::numeric_limits<passivedouble>::lowest();
+      for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+        const auto x = SU2_TYPE::GetValue(coords_(iPoint, iDim));
+        origin[iDim] = std::min(origin[iDim], x);
+        extent[iDim] = std::max(extent[iDim], x);
+      }
+      extent[iDim] -= origin[iDim];
+    }
+
+    /*--- Bins of the size of the radius, but not many more bins than points. ---*/
+    auto totalBins = [&]() {
+      passivedouble n = 1;
+      for (int iDim = 0; iDim < nDim; ++iDim) n *= std::floor(extent[iDim] / binSize) + 1;
+      return n;
+    };
+    while (totalBins() > 4.0 * nPoint + 1) binSize *= 2;
+    for (int iDim = 0; iDim < nDim; ++iDim) nBins[iDim] = long(std::floor(extent[iDim] / binSize)) + 1;
+
+    /*--- Counting sort of the points by bin. ---*/
+    std::vector<unsigned long> pointBin(nPoint);
+    binStart.assign(nBins[0] * nBins[1] * nBins[2] + 1, 0);
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      unsigned long iBin = 0;
+      for (int iDim = nDim - 1; iDim >= 0; --iDim)
+        iBin = iBin * nBins[iDim] + BinIndex(iDim, SU2_TYPE::GetValue(coords_(iPoint, iDim)));
+      pointBin[iPoint] = iBin;
+      ++binStart[iBin + 1];
+    }
+    std::partial_sum(binStart.begin(), binStart.end(), binStart.begin());
+    binPoints.resize(nPoint);
+    auto next = binStart;
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) binPoints[next[pointBin[iPoint]]++] = iPoint;
+  }
+
+  /*!
+   * \brief Number of bins along each direction, for testing.
+   */
+  long GetNumBins(int iDim) const { return nBins[iDim]; }
+
+  /*!
+   * \brief Call "func(iPoint, dist)" for each point closer than "radius" to "coord".
+   */
+  template <class F>
+  void ForEachNeighbor(const su2double* coord, passivedouble radius, F&& func) const {
+    long lo[3] = {0, 0, 0}, hi[3] = {0, 0, 0};
+    for (int iDim = 0; iDim < nDim; ++iDim) {
+      const auto x = SU2_TYPE::GetValue(coord[iDim]);
+      if (x + radius < origin[iDim] || x - radius > origin[iDim] + nBins[iDim] * binSize) return;
+      lo[iDim] = BinIndex(iDim, x - radius);
+      hi[iDim] = BinIndex(iDim, x + radius);
+    }
+    for (auto k = lo[2]; k <= hi[2]; ++k) {
+      for (auto j = lo[1]; j <= hi[1]; ++j) {
+        for (auto i = lo[0]; i <= hi[0]; ++i) {
+          const auto iBin = (k * nBins[1] + j) * nBins[0] + i;
+          for (auto it = binStart[iBin]; it < binStart[iBin + 1]; ++it) {
+            const auto iPoint = binPoints[it];
+            const auto dist = SU2_TYPE::GetValue(GeometryToolbox::Distance(nDim, coord, (*coords)[iPoint]));
+            if (dist < radius) func(iPoint, dist);
+          }
+        }
+      }
+    }
+  }
+};
@@ -0,0 +1,109 @@
+/*!
+ * \file CProfiler.hpp
+ * \brief Hierarchical scoped-timer profiler for the hot paths of the solvers.
+ * \author P. Gomes
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+
+/*!
+ * \class CProfiler
+ * \brief Low-overhead profiler of nested code regions (PROFILING= YES).
+ * \details Regions are delimited with SU2_PROFILE_SCOPE("Name"), which times the enclosing C++ scope. Each thread
+ *          (OpenMP or not) accumulates its own tree of regions, nested regions are children of the region that
+ *          was open when they started, i.e. the same name may appear under different parents. At the end of
+ *          the run the trees are merged over threads and ranks, the master writes a summary with min/avg/max
+ *          over ranks (\<file\>.csv and the screen). Optionally, each rank writes a Chrome trace timeline
+ *          (\<file\>_trace_\<rank\>.json, open with chrome://tracing or Perfetto), and the instruction and cycle
+ *          counts of the regions are measured with hardware counters (Linux perf_event).
+ *          When profiling is disabled a scope costs one branch.
+ * \note Region names must have static storage duration (e.g. string literals), they are not copied.
+ * \author P. Gomes
+ */
+class CProfiler {
+ public:
+  /*!
+   * \brief Enable the profiler and start the clock (collective call).
+   * \param[in] trace - Record the timeline of the regions.
+   * \param[in] hwCounters - Measure instructions and cycles.
+   */
+  static void Initialize(bool trace, bool hwCounters);
+
+  /*!
+   * \brief Merge the results of all threads and ranks and write them, then disable the profiler (collective call).
+   * \param[in] fileName - Prefix of the output files.
+   */
+  static void Finalize(const std::string& fileName);
+
+  /*!
+   * \brief Whether the profiler is enabled.
+   */
+  static inline bool IsEnabled() { return Enabled(); }
+
+  /*!
+   * \brief Open a region as a child of the current region of the calling thread.
+   * \param[in] name - Name of the region (not copied).
+   */
+  static void Begin(const char* name);
+
+  /*!
+   * \brief Close the current region of the calling thread.
+   */
+  static void End();
+
+  /*!
+   * \class CScope
+   * \brief Times the lifetime of the object, prefer the SU2_PROFILE_SCOPE macro.
+   */
+  class CScope {
+   private:
+    const bool active;
+
+   public:
+    explicit CScope(const char* name) : active(IsEnabled()) {
+      if (active) Begin(name);
+    }
+    ~CScope() {
+      if (active) End();
+    }
+    CScope(const CScope&) = delete;
+    CScope& operator=(const CScope&) = delete;
+  };
+
+ private:
+  static inline bool& Enabled() {
+    static bool enabled = false;
+    return enabled;
+  }
+};
+
+#define SU2_PROFILE_CONCAT_IMPL(A, B) A##B
+#define SU2_PROFILE_CONCAT(A, B) SU2_PROFILE_CONCAT_IMPL(A, B)
+
+/*!
+ * \brief Time the enclosing scope as a region of the profiler.
+ */
+#define SU2_PROFILE_SCOPE(NAME) const CProfiler::CScope SU2_PROFILE_CONCAT(su2ProfileScope, __LINE__)(NAME)
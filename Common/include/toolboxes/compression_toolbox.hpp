@@ -0,0 +1,82 @@
+/*!
+ * \file compression_toolbox.hpp
+ * \brief Lossless compression of numerical arrays for file output.
+ * \author P. Gomes
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace CompressionToolbox {
+/// \addtogroup CompressionToolbox
+/// @{
+
+/*!
+ * \brief Compress a row-major matrix of fixed-size items, e.g. doubles, without loss.
+ * \details Each column is XOR-ed with its previous row, which zeroes the sign, exponent and leading mantissa
+ *          bytes of smooth data, then the bytes of each column are shuffled into planes (all first bytes, all
+ *          second bytes, ...), and finally the result is compressed with an LZ77 coder that uses the LZ4 block
+ *          format. The decompressed data is bit-identical to the input.
+ * \param[in] data - Matrix data.
+ * \param[in] nRows - Number of rows (e.g. points).
+ * \param[in] nCols - Number of columns (e.g. fields).
+ * \param[in] itemSize - Size of each item in bytes.
+ * \param[out] out - Compressed stream (resized).
+ */
+void Compress(const void* data, size_t nRows, size_t nCols, size_t itemSize, std::vector<char>& out);
+
+/*!
+ * \brief Decompress a stream produced by Compress.
+ * \param[in] in - Compressed stream.
+ * \param[in] inSize - Size of the stream in bytes.
+ * \param[in] nRows - Number of rows.
+ * \param[in] nCols - Number of columns.
+ * \param[in] itemSize - Size of each item in bytes.
+ * \param[out] data - Matrix data, must be allocated with nRows*nCols*itemSize bytes.
+ * \return False if the stream is corrupted or does not match the sizes.
+ */
+bool Decompress(const char* in, size_t inSize, size_t nRows, size_t nCols, size_t itemSize, void* data);
+
+/*!
+ * \brief LZ4-format block compression of a byte array.
+ * \param[in] src - Bytes to compress.
+ * \param[in] srcSize - Number of bytes.
+ * \param[out] dst - Compressed bytes (resized).
+ */
+void CompressBlock(const unsigned char* src, size_t srcSize, std::vector<char>& dst);
+
+/*!
+ * \brief Decompress an LZ4-format block.
+ * \param[in] src - Compressed bytes.
+ * \param[in] srcSize - Number of compressed bytes.
+ * \param[out] dst - Decompressed bytes.
+ * \param[in] dstSize - Expected number of decompressed bytes.
+ * \return False if the block is malformed or does not decompress to dstSize bytes.
+ */
+bool DecompressBlock(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t dstSize);
+
+/// @}
+}  // namespace CompressionToolbox
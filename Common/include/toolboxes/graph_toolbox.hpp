@@ -620,6 +620,7 @@ struct DummyGridColor {
   static_assert(std::is_integral<T>::value, "");
 
   T size;
+  static constexpr T groupSize = 1;
   struct {
     inline T operator[](T i) const { return i; }
   } indices;
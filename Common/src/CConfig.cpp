@@ -33,34 +33,13 @@
 
 #include "../include/fem/fem_gauss_jacobi_quadrature.hpp"
 #include "../include/fem/fem_geometry_structure.hpp"
+#include "../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 
 #include "../include/basic_types/ad_structure.hpp"
 #include "../include/toolboxes/printing_toolbox.hpp"
 
 using namespace PrintingToolbox;
 
-#ifdef PROFILE
-#ifdef HAVE_MKL
-#include "mkl.h"
-#endif
-#endif
-
-vector<string> Profile_Function_tp;       /*!< \brief Vector of string names for profiled functions. */
-vector<double> Profile_Time_tp;           /*!< \brief Vector of elapsed time for profiled functions. */
-vector<double> Profile_ID_tp;             /*!< \brief Vector of group ID number for profiled functions. */
-map<string, vector<int> > Profile_Map_tp; /*!< \brief Map containing the final results for profiled functions. */
-
-map<CLong3T, int> GEMM_Profile_MNK;       /*!< \brief Map, which maps the GEMM size to the index where
-                                                      the data for this GEMM is stored in several vectors. */
-vector<long>   GEMM_Profile_NCalls;       /*!< \brief Vector, which stores the number of calls to this
-                                                      GEMM size. */
-vector<double> GEMM_Profile_TotTime;      /*!< \brief Total time spent for this GEMM size. */
-vector<double> GEMM_Profile_MinTime;      /*!< \brief Minimum time spent for this GEMM size. */
-vector<double> GEMM_Profile_MaxTime;      /*!< \brief Maximum time spent for this GEMM size. */
-
-//#pragma omp threadprivate(Profile_Function_tp, Profile_Time_tp, Profile_ID_tp, Profile_Map_tp)
-
-
 CConfig::CConfig(char case_filename[MAX_STRING_SIZE], SU2_COMPONENT val_software, bool verb_high) {
 
   /*--- Set the case name to the base config file name without extension ---*/
@@ -703,6 +682,11 @@ unsigned short CConfig::GetnZone(const string& val_mesh_filename, unsigned short
       nZone = 1;
       break;
     }
+    case SU2_BINARY_GRID: {
+      /*--- Binary mesh files contain a single zone. ---*/
+      nZone = 1;
+      break;
+    }
   }
 
   return (unsigned short) nZone;
@@ -813,6 +797,10 @@ unsigned short CConfig::GetnDim(const string& val_mesh_filename, unsigned short
       nDim = 3;
       break;
     }
+    case SU2_BINARY_GRID: {
+      nDim = CSU2BinaryMeshReaderFVM::ReadDimension(val_mesh_filename);
+      break;
+    }
   }
 
   /*--- After reading the mesh, assert that the dimension is equal to 2 or 3. ---*/
@@ -821,6 +809,79 @@ unsigned short CConfig::GetnDim(const string& val_mesh_filename, unsigned short
   return (unsigned short) nDim;
 }
 
+unsigned long CConfig::GetMesh_nElem() const {
+
+  unsigned long nElem = 0;
+
+  switch (Mesh_FileFormat) {
+    case SU2: {
+
+      string text_line;
+      ifstream mesh_file(Mesh_FileName);
+      if (mesh_file.fail()) {
+        SU2_MPI::Error(string("The SU2 mesh file named ") + Mesh_FileName + string(" was not found."), CURRENT_FUNCTION);
+      }
+
+      /*--- In a multizone file, skip to the section of this zone (as the mesh reader does). ---*/
+      if (nZone > 1 && Multizone_Mesh) {
+        while (getline(mesh_file, text_line)) {
+          if (text_line.find("IZONE=", 0) != string::npos) {
+            text_line.erase(0, 6);
+            if (atoi(text_line.c_str()) == iZone + 1) break;
+          }
+        }
+      }
+
+      while (getline(mesh_file, text_line)) {
+        if (text_line.find("NELEM=", 0) != string::npos) {
+          text_line.erase(0, 6); nElem = atol(text_line.c_str());
+          break;
+        }
+      }
+      break;
+    }
+
+    case CGNS_GRID: {
+
+#ifdef HAVE_CGNS
+      /*--- The reader uses the first zone of the first database. ---*/
+      int fn;
+      cgsize_t zone_size[9];
+      char zonename[CGNS_STRING_SIZE];
+
+      if (cg_open(Mesh_FileName.c_str(), CG_MODE_READ, &fn) != CG_OK) cg_error_exit();
+      if (cg_zone_read(fn, 1, 1, zonename, zone_size) != CG_OK) cg_error_exit();
+      if (cg_close(fn) != CG_OK) cg_error_exit();
+
+      /*--- Vertices, cells, and boundary vertices of an unstructured zone. ---*/
+      nElem = zone_size[1];
+#else
+      SU2_MPI::Error(string(" SU2 built without CGNS support. \n") +
+                     string(" To use CGNS, build SU2 accordingly."),
+                     CURRENT_FUNCTION);
+#endif
+      break;
+    }
+
+    case RECTANGLE: {
+      nElem = static_cast<unsigned long>(Mesh_Box_Size[0] - 1) * (Mesh_Box_Size[1] - 1);
+      break;
+    }
+
+    case BOX: {
+      nElem = static_cast<unsigned long>(Mesh_Box_Size[0] - 1) * (Mesh_Box_Size[1] - 1) * (Mesh_Box_Size[2] - 1);
+      break;
+    }
+
+    case SU2_BINARY_GRID: {
+      nElem = CSU2BinaryMeshReaderFVM::ReadNumberOfElements(Mesh_FileName);
+      break;
+    }
+  }
+
+  return nElem;
+}
+
 void CConfig::SetPointersNull() {
 
   Marker_CfgFile_GeoEval      = nullptr;   Marker_All_GeoEval       = nullptr;
@@ -1103,6 +1164,8 @@ void CConfig::SetConfig_Options() {
   addBoolOption("MULTIZONE", Multizone_Problem, NO);
   /*!\brief PHYSICAL_PROBLEM \n DESCRIPTION: Physical governing equations \n Options: see \link Solver_Map \endlink \n DEFAULT: NONE \ingroup Config*/
   addEnumOption("MULTIZONE_SOLVER", Kind_MZSolver, Multizone_Map, ENUM_MULTIZONE::MZ_BLOCK_GAUSS_SEIDEL);
+  /*!\brief MULTIZONE_CONCURRENT_ZONES \n DESCRIPTION: Solve the zones of a Block-Jacobi iteration concurrently, each on a group of ranks sized by its load \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("MULTIZONE_CONCURRENT_ZONES", Multizone_Concurrent, false);
 #ifdef CODI_REVERSE_TYPE
   const bool discAdjDefault = true;
 #else
@@ -1169,8 +1232,14 @@ void CConfig::SetConfig_Options() {
   addBoolOption("RESTART_SOL", Restart, false);
   /*!\brief BINARY_RESTART \n DESCRIPTION: Read binary SU2 native restart files. \n Options: YES, NO \ingroup Config */
   addBoolOption("READ_BINARY_RESTART", Read_Binary_Restart, true);
+  /*!\brief RESTART_CHECKPOINTS_RAM \n DESCRIPTION: Memory (MB per rank) for the data of restart files kept after being read (e.g. for the unsteady adjoint). \n DEFAULT: 0 \ingroup Config */
+  addUnsignedLongOption("RESTART_CHECKPOINTS_RAM", Restart_Checkpoints_RAM, 0);
+  /*!\brief RESTART_CHECKPOINTS_DIR \n DESCRIPTION: Node-local directory where each rank keeps its part of the restart files for later runs. \n DEFAULT: none \ingroup Config */
+  addStringOption("RESTART_CHECKPOINTS_DIR", Restart_Checkpoints_Dir, string(""));
   /*!\brief WRT_RESTART_OVERWRITE \n DESCRIPTION: overwrite restart files or append iteration number. \n Options: YES, NO \ingroup Config */
   addBoolOption("WRT_RESTART_OVERWRITE", Wrt_Restart_Overwrite, true);
+  /*!\brief WRT_RESTART_COMPRESSED \n DESCRIPTION: Compress binary restart files without loss. \n Options: YES, NO \ingroup Config */
+  addBoolOption("WRT_RESTART_COMPRESSED", Wrt_Restart_Compressed, false);
   /*!\brief WRT_SURFACE_OVERWRITE \n DESCRIPTION: overwrite visualisation files or append iteration number. \n Options: YES, NO \ingroup Config */
   addBoolOption("WRT_SURFACE_OVERWRITE", Wrt_Surface_Overwrite, true);
   /*!\brief WRT_VOLUME_OVERWRITE \n DESCRIPTION: overwrite visualisation files or append iteration number. \n Options: YES, NO \ingroup Config */
@@ -1187,6 +1256,8 @@ void CConfig::SetConfig_Options() {
   /*!\par CONFIG_CATEGORY: Data-driven fluid model parameters \ingroup Config*/
   /*!\brief INTERPOLATION_METHOD \n DESCRIPTION: Interpolation method used to determine the thermodynamic state of the fluid. \n OPTIONS: See \link DataDrivenMethod_Map \endlink DEFAULT: MLP \ingroup Config*/
   addEnumOption("INTERPOLATION_METHOD",Kind_DataDriven_Method, DataDrivenMethod_Map, ENUM_DATADRIVEN_METHOD::LUT);
+  /*!\brief LUT_SEARCH_MAP \n DESCRIPTION: Point location structure of the look-up table. \n OPTIONS: See \link LUTSearchMap_Map \endlink DEFAULT: TRAPEZOIDAL \ingroup Config*/
+  addEnumOption("LUT_SEARCH_MAP", Kind_LUT_Search_Map, LUTSearchMap_Map, LUT_SEARCH_MAP::TRAPEZOIDAL);
   /*!\brief FILENAME_INTERPOLATOR \n DESCRIPTION: Input file for the interpolation method. \n \ingroup Config*/
   addStringListOption("FILENAMES_INTERPOLATOR", n_Datadriven_files, DataDriven_Method_FileNames);
   /*!\brief DATADRIVEN_NEWTON_RELAXATION \n DESCRIPTION: Relaxation factor for Newton solvers in data-driven fluid model. \n \ingroup Config*/
@@ -1225,6 +1296,8 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("INLET_TEMPERATURE_VE", Inlet_Temperature_ve, 0.0);
   /* DESCRIPTION: Specify if mixture is frozen */
   addBoolOption("FROZEN_MIXTURE", frozen, false);
+  /* DESCRIPTION: Treat the finite rate chemistry point implicitly in explicit time integration */
+  addBoolOption("CHEMISTRY_POINT_IMPLICIT", chemistry_point_implicit, false);
   /* DESCRIPTION: Specify if there is ionization */
   addBoolOption("IONIZATION", ionization, false);
   /* DESCRIPTION: Specify if there is VT transfer residual limiting */
@@ -1831,12 +1904,20 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("LINEAR_SOLVER_ITER", Linear_Solver_Iter, 10);
   /* DESCRIPTION: Fill in level for the ILU preconditioner */
   addUnsignedShortOption("LINEAR_SOLVER_ILU_FILL_IN", Linear_Solver_ILU_n, 0);
+  /* DESCRIPTION: Level-scheduled ILU, keeps the couplings between threads (results independent of thread count) */
+  addBoolOption("LINEAR_SOLVER_ILU_LEVEL_SCHEDULING", Linear_Solver_ILU_Level_Scheduling, false);
+  /* DESCRIPTION: Storage format for the matrix-vector products of the linear solvers (CSR, SELL) */
+  addEnumOption("LINEAR_SOLVER_SPMV_FORMAT", Linear_Solver_SpMV_Format, Sparse_Matrix_Format_Map, SPARSE_MATRIX_FORMAT::CSR);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
   /* DESCRIPTION: Relaxation factor for iterative linear smoothers (SMOOTHER_ILU/JACOBI/LU-SGS/LINELET) */
   addDoubleOption("LINEAR_SOLVER_SMOOTHER_RELAXATION", Linear_Solver_Smoother_Relaxation, 1.0);
   /* DESCRIPTION: Custom number of threads used for additive domain decomposition for ILU and LU_SGS (0 is "auto"). */
   addUnsignedLongOption("LINEAR_SOLVER_PREC_THREADS", Linear_Solver_Prec_Threads, 0);
+  /* DESCRIPTION: Maximum number of levels (including the finest) of the AMG preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_LEVELS", Linear_Solver_AMG_Levels, 10);
+  /* DESCRIPTION: Number of pre- and post-smoothing sweeps of the AMG preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_SMOOTH_ITER", Linear_Solver_AMG_Smooth_Iter, 1);
   /* DESCRIPTION: Relaxation factor for updates of adjoint variables. */
   addDoubleOption("RELAXATION_FACTOR_ADJOINT", Relaxation_Factor_Adjoint, 1.0);
   /* DESCRIPTION: Relaxation of the CHT coupling */
@@ -1900,6 +1981,8 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("MG_DAMP_RESTRICTION", Damp_Res_Restric, 0.75);
   /*!\brief MG_DAMP_PROLONGATION\n DESCRIPTION: Damping factor for the correction prolongation. DEFAULT 0.75 \ingroup Config*/
   addDoubleOption("MG_DAMP_PROLONGATION", Damp_Correc_Prolong, 0.75);
+  /*!\brief MG_AGGLOMERATION\n DESCRIPTION: Algorithm used to agglomerate the interior of the coarse grids \n OPTIONS: see \link MG_Agglomeration_Map \endlink \n DEFAULT: QUEUE \ingroup Config*/
+  addEnumOption("MG_AGGLOMERATION", Kind_MG_Agglomeration, MG_Agglomeration_Map, MG_AGGLOMERATION::QUEUE);
 
   /*!\par CONFIG_CATEGORY: Spatial Discretization \ingroup Config*/
   /*--- Options related to the spatial discretization ---*/
@@ -2175,6 +2258,14 @@ void CConfig::SetConfig_Options() {
   addBoolOption("WRT_PERFORMANCE", Wrt_Performance, false);
   /* DESCRIPTION: Output the tape statistics (discrete adjoint)  \ingroup Config*/
   addBoolOption("WRT_AD_STATISTICS", Wrt_AD_Statistics, false);
+  /* DESCRIPTION: Profile the hot paths of the solvers (summary at the end of the run)  \ingroup Config*/
+  addBoolOption("PROFILING", Profiling, false);
+  /* DESCRIPTION: Write the timeline of the profiled regions (Chrome trace, one file per rank)  \ingroup Config*/
+  addBoolOption("PROFILING_TRACE", Profiling_Trace, false);
+  /* DESCRIPTION: Measure instructions and cycles of the profiled regions (Linux perf_event)  \ingroup Config*/
+  addBoolOption("PROFILING_HW_COUNTERS", Profiling_HWCounters, false);
+  /* DESCRIPTION: Prefix of the profiling output files  \ingroup Config*/
+  addStringOption("PROFILING_FILENAME", Profiling_FileName, string("profiling"));
   /*!\brief MARKER_ANALYZE_AVERAGE
    *  \n DESCRIPTION: Output averaged flow values on specified analyze marker.
    *  Options: AREA, MASSFLUX
@@ -2590,6 +2681,15 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Tolerance to prune small coefficients from the RBF interpolation matrix. */
   addDoubleOption("RADIAL_BASIS_FUNCTION_PRUNE_TOLERANCE", RadialBasisFunction_PruneTol, 1e-6);
 
+  /* DESCRIPTION: Method to compute the RBF interpolation coefficients, SPARSE requires a compact basis function. */
+  addEnumOption("RADIAL_BASIS_FUNCTION_SOLVER", RadialBasisFunction_Solver, RadialBasisSolver_Map, RADIAL_BASIS_SOLVER::DENSE);
+
+  /* DESCRIPTION: Size of the donor neighbourhood of each target point for the SPARSE RBF solver, in radii. */
+  addDoubleOption("RADIAL_BASIS_FUNCTION_NEIGHBORHOOD", RadialBasisFunction_Neighborhood, 5.0);
+
+  /* DESCRIPTION: Send the interface donor values only to the ranks that need them (instead of gathering them). */
+  addBoolOption("SPARSE_INTERFACE_TRANSFER", SparseInterfaceTransfer, false);
+
    /*!\par INLETINTERPOLATION \n
    * DESCRIPTION: Type of spanwise interpolation to use for the inlet face. \n OPTIONS: see \link Inlet_SpanwiseInterpolation_Map \endlink
    * Sets Kind_InletInterpolation \ingroup Config
@@ -2823,6 +2923,12 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: ParMETIS load balancing weight for edges (equiv. to neighbors) */
   addLongOption("PARMETIS_EDGE_WEIGHT", ParMETIS_edgeWgt, 1);
 
+  /* DESCRIPTION: Cache the partitioning, dual grid, and edge colorings to skip their computation in later runs */
+  addBoolOption("GEOMETRY_CACHE", GeometryCache, false);
+
+  /* DESCRIPTION: Prefix of the geometry cache files */
+  addStringOption("GEOMETRY_CACHE_FILENAME", GeometryCache_FileName, string("geometry_cache"));
+
   /*--- options that are used in the Hybrid RANS/LES Simulations  ---*/
   /*!\par CONFIG_CATEGORY:Hybrid_RANSLES Options\ingroup Config*/
 
@@ -2903,6 +3009,9 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Volume solution files */
   addEnumListOption("OUTPUT_FILES", nVolumeOutputFiles, VolumeOutputFiles, Output_Map);
 
+  /* DESCRIPTION: Write the output files in a background thread (requires MPI_THREAD_MULTIPLE) */
+  addBoolOption("ASYNC_OUTPUT", Async_Output, false);
+
   /* DESCRIPTION: Parameter to perturb eigenvalues */
   addDoubleOption("UQ_DELTA_B", uq_delta_b, 1.0);
 
@@ -4024,6 +4133,18 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
                      CURRENT_FUNCTION);
     }
 
+    if (chemistry_point_implicit && Kind_FluidModel != SU2_NONEQ) {
+      SU2_MPI::Error("CHEMISTRY_POINT_IMPLICIT requires the chemistry Jacobian of SU2TCLIB.", CURRENT_FUNCTION);
+    }
+
+    if (chemistry_point_implicit && TimeMarching != TIME_MARCHING::STEADY) {
+      SU2_MPI::Error("CHEMISTRY_POINT_IMPLICIT is only available for steady problems.", CURRENT_FUNCTION);
+    }
+
+    if (chemistry_point_implicit && Kind_TimeIntScheme_Flow == EULER_IMPLICIT) {
+      SU2_MPI::Error("CHEMISTRY_POINT_IMPLICIT requires an explicit TIME_DISCRE_FLOW.", CURRENT_FUNCTION);
+    }
+
     if (Kind_FluidModel == SU2_NONEQ && GasModel == "AIR-7" && nWall_Catalytic != 0) {
       SU2_MPI::Error("Catalytic wall recombination is not yet available for ionized flows in SU2_NEMO.", CURRENT_FUNCTION);
     }
@@ -6974,12 +7095,19 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
             case BCGSTAB:
             case FGMRES:
             case RESTARTED_FGMRES:
+            case PIPELINED_FGMRES:
+            case PIPELINED_BCGSTAB:
               if (Kind_Linear_Solver == BCGSTAB)
                 cout << "BCGSTAB is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == PIPELINED_BCGSTAB)
+                cout << "Pipelined BCGSTAB is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == PIPELINED_FGMRES)
+                cout << "Pipelined FGMRES is used for solving the linear system." << endl;
               else
                 cout << "FGMRES is used for solving the linear system." << endl;
               switch (Kind_Linear_Solver_Prec) {
                 case ILU: cout << "Using a ILU("<< Linear_Solver_ILU_n <<") preconditioning."<< endl; break;
+                case AMG: cout << "Using an algebraic multigrid preconditioning."<< endl; break;
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS:  cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI:  cout << "Using a Jacobi preconditioning."<< endl; break;
@@ -6988,6 +7116,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
             case SMOOTHER:
               switch (Kind_Linear_Solver_Prec) {
                 case ILU:     cout << "A ILU(" << Linear_Solver_ILU_n << ")"; break;
+                case AMG:     cout << "An algebraic multigrid"; break;
                 case LINELET: cout << "A Linelet"; break;
                 case LU_SGS:  cout << "A LU-SGS"; break;
                 case JACOBI:  cout << "A Jacobi"; break;
@@ -7015,12 +7144,12 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
         case STRUCT_TIME_INT::NEWMARK_IMPLICIT:
           if (Time_Domain) cout << "Newmark implicit method for the structural time integration." << endl;
           switch (Kind_Linear_Solver) {
-            case BCGSTAB:
+            case BCGSTAB: case PIPELINED_BCGSTAB:
               cout << "BCGSTAB is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
-            case FGMRES: case RESTARTED_FGMRES:
+            case FGMRES: case RESTARTED_FGMRES: case PIPELINED_FGMRES:
               cout << "FGMRES is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
@@ -9654,418 +9783,6 @@ short CConfig::FindInterfaceMarker(unsigned short iInterface) const {
   return -1;
 }
 
-void CConfig::Tick(double *val_start_time) {
-
-#ifdef PROFILE
-  *val_start_time = SU2_MPI::Wtime();
-#endif
-
-}
-
-void CConfig::Tock(double val_start_time, const string& val_function_name, int val_group_id) {
-
-#ifdef PROFILE
-
-  double val_stop_time = 0.0, val_elapsed_time = 0.0;
-
-  val_stop_time = SU2_MPI::Wtime();
-
-  /*--- Compute the elapsed time for this subroutine ---*/
-  val_elapsed_time = val_stop_time - val_start_time;
-
-  /*--- Store the subroutine name and the elapsed time ---*/
-  Profile_Function_tp.push_back(val_function_name);
-  Profile_Time_tp.push_back(val_elapsed_time);
-  Profile_ID_tp.push_back(val_group_id);
-
-#endif
-
-}
-
-void CConfig::SetProfilingCSV() {
-
-#ifdef PROFILE
-
-  int rank = MASTER_NODE;
-  int size = SINGLE_NODE;
-#ifdef HAVE_MPI
-  SU2_MPI::Comm_rank(SU2_MPI::GetComm(), &rank);
-  SU2_MPI::Comm_size(SU2_MPI::GetComm(), &size);
-#endif
-
-  /*--- Each rank has the same stack trace, so the they have the same
-   function calls and ordering in the vectors. We're going to reduce
-   the timings from each rank and extract the avg, min, and max timings. ---*/
-
-  /*--- First, create a local mapping, so that we can extract the
-   min and max values for each function. ---*/
-
-  for (unsigned int i = 0; i < Profile_Function_tp.size(); i++) {
-
-    /*--- Add the function and initialize if not already stored (the ID
-     only needs to be stored the first time).---*/
-    if (Profile_Map_tp.find(Profile_Function_tp[i]) == Profile_Map_tp.end()) {
-
-      vector<int> profile; profile.push_back(i);
-      Profile_Map_tp.insert(pair<string,vector<int> >(Profile_Function_tp[i],profile));
-
-    } else {
-
-      /*--- This function has already been added, so simply increment the
-       number of calls and total time for this function. ---*/
-
-      Profile_Map_tp[Profile_Function_tp[i]].push_back(i);
-
-    }
-  }
-
-  /*--- We now have everything gathered by function name, so we can loop over
-   each function and store the min/max times. ---*/
-
-  int map_size = 0;
-  for (map<string,vector<int> >::iterator it=Profile_Map_tp.begin(); it!=Profile_Map_tp.end(); ++it) {
-    map_size++;
-  }
-
-  /*--- Allocate and initialize memory ---*/
-
-  double *l_min_red = NULL, *l_max_red = NULL, *l_tot_red = NULL, *l_avg_red = NULL;
-  int *n_calls_red = NULL;
-  double* l_min = new double[map_size];
-  double* l_max = new double[map_size];
-  double* l_tot = new double[map_size];
-  double* l_avg = new double[map_size];
-  int* n_calls  = new int[map_size];
-  for (int i = 0; i < map_size; i++)
-  {
-    l_min[i]   = 1e10;
-    l_max[i]   = 0.0;
-    l_tot[i]   = 0.0;
-    l_avg[i]   = 0.0;
-    n_calls[i] = 0;
-  }
-
-  /*--- Collect the info for each function from the current rank ---*/
-
-  int func_counter = 0;
-  for (map<string,vector<int> >::iterator it=Profile_Map_tp.begin(); it!=Profile_Map_tp.end(); ++it) {
-
-    for (unsigned int i = 0; i < (it->second).size(); i++) {
-      n_calls[func_counter]++;
-      l_tot[func_counter] += Profile_Time_tp[(it->second)[i]];
-      if (Profile_Time_tp[(it->second)[i]] < l_min[func_counter])
-        l_min[func_counter] = Profile_Time_tp[(it->second)[i]];
-      if (Profile_Time_tp[(it->second)[i]] > l_max[func_counter])
-        l_max[func_counter] = Profile_Time_tp[(it->second)[i]];
-
-    }
-    l_avg[func_counter] = l_tot[func_counter]/((double)n_calls[func_counter]);
-    func_counter++;
-  }
-
-  /*--- Now reduce the data ---*/
-
-  if (rank == MASTER_NODE) {
-    l_min_red = new double[map_size];
-    l_max_red = new double[map_size];
-    l_tot_red = new double[map_size];
-    l_avg_red = new double[map_size];
-    n_calls_red  = new int[map_size];
-  }
-
-#ifdef HAVE_MPI
-  MPI_Reduce(n_calls, n_calls_red, map_size, MPI_INT, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
-  MPI_Reduce(l_tot, l_tot_red, map_size, MPI_DOUBLE, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
-  MPI_Reduce(l_avg, l_avg_red, map_size, MPI_DOUBLE, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
-  MPI_Reduce(l_min, l_min_red, map_size, MPI_DOUBLE, MPI_MIN, MASTER_NODE, SU2_MPI::GetComm());
-  MPI_Reduce(l_max, l_max_red, map_size, MPI_DOUBLE, MPI_MAX, MASTER_NODE, SU2_MPI::GetComm());
-#else
-  memcpy(n_calls_red, n_calls, map_size*sizeof(int));
-  memcpy(l_tot_red,   l_tot,   map_size*sizeof(double));
-  memcpy(l_avg_red,   l_avg,   map_size*sizeof(double));
-  memcpy(l_min_red,   l_min,   map_size*sizeof(double));
-  memcpy(l_max_red,   l_max,   map_size*sizeof(double));
-#endif
-
-  /*--- The master rank will write the file ---*/
-
-  if (rank == MASTER_NODE) {
-
-    /*--- Take averages over all ranks on the master ---*/
-
-    for (int i = 0; i < map_size; i++) {
-      l_tot_red[i]   = l_tot_red[i]/(double)size;
-      l_avg_red[i]   = l_avg_red[i]/(double)size;
-      n_calls_red[i] = n_calls_red[i]/size;
-    }
-
-    /*--- Now write a CSV file with the processed results ---*/
-
-    ofstream Profile_File;
-    Profile_File.precision(15);
-    Profile_File.open("profiling.csv");
-
-    /*--- Create the CSV header ---*/
-
-    Profile_File << "\"Function_Name\", \"N_Calls\", \"Avg_Total_Time\", \"Avg_Time\", \"Min_Time\", \"Max_Time\", \"Function_ID\"" << endl;
-
-    /*--- Loop through the map and write the results to the file ---*/
-
-    func_counter = 0;
-    for (map<string,vector<int> >::iterator it=Profile_Map_tp.begin(); it!=Profile_Map_tp.end(); ++it) {
-
-      Profile_File << scientific << it->first << ", " << n_calls_red[func_counter] << ", " << l_tot_red[func_counter] << ", " << l_avg_red[func_counter] << ", " << l_min_red[func_counter] << ", " << l_max_red[func_counter] << ", " << (int)Profile_ID_tp[(it->second)[0]] << endl;
-      func_counter++;
-    }
-
-    Profile_File.close();
-
-  }
-
-  delete [] l_min;
-  delete [] l_max;
-  delete [] l_avg;
-  delete [] l_tot;
-  delete [] n_calls;
-  if (rank == MASTER_NODE) {
-    delete [] l_min_red;
-    delete [] l_max_red;
-    delete [] l_avg_red;
-    delete [] l_tot_red;
-    delete [] n_calls_red;
-  }
-
-#endif
-
-}
-
-void CConfig::GEMM_Tick(double *val_start_time) const {
-
-#ifdef PROFILE
-
-#ifdef HAVE_MKL
-  *val_start_time = dsecnd();
-#else
-  *val_start_time = SU2_MPI::Wtime();
-#endif
-
-#endif
-
-}
-
-void CConfig::GEMM_Tock(double val_start_time, int M, int N, int K) const {
-
-#ifdef PROFILE
-
-  /* Determine the timing value. The actual function called depends on
-     the type of executable. */
-  double val_stop_time = 0.0;
-
-#ifdef HAVE_MKL
-  val_stop_time = dsecnd();
-#else
-  val_stop_time = SU2_MPI::Wtime();
-#endif
-
-  /* Compute the elapsed time. */
-  const double val_elapsed_time = val_stop_time - val_start_time;
-
-  /* Create the CLong3T from the M-N-K values and check if it is already
-     stored in the map GEMM_Profile_MNK. */
-  CLong3T MNK(M, N, K);
-  map<CLong3T, int>::iterator MI = GEMM_Profile_MNK.find(MNK);
-
-  if(MI == GEMM_Profile_MNK.end()) {
-
-    /* Entry is not present yet. Create it. */
-    const int ind = GEMM_Profile_MNK.size();
-    GEMM_Profile_MNK[MNK] = ind;
-
-    GEMM_Profile_NCalls.push_back(1);
-    GEMM_Profile_TotTime.push_back(val_elapsed_time);
-    GEMM_Profile_MinTime.push_back(val_elapsed_time);
-    GEMM_Profile_MaxTime.push_back(val_elapsed_time);
-  }
-  else {
-
-    /* Entry is already present. Determine its index in the
-       map and update the corresponding vectors. */
-    const int ind = MI->second;
-    ++GEMM_Profile_NCalls[ind];
-    GEMM_Profile_TotTime[ind] += val_elapsed_time;
-    GEMM_Profile_MinTime[ind]  = min(GEMM_Profile_MinTime[ind], val_elapsed_time);
-    GEMM_Profile_MaxTime[ind]  = max(GEMM_Profile_MaxTime[ind], val_elapsed_time);
-  }
-
-#endif
-
-}
-
-void CConfig::GEMMProfilingCSV() {
-
-#ifdef PROFILE
-
-  /* Initialize the rank to the master node. */
-  int rank = MASTER_NODE;
-
-#ifdef HAVE_MPI
-  /* Parallel executable. The profiling data must be sent to the master node.
-     First determine the rank and size. */
-  int size;
-  SU2_MPI::Comm_rank(SU2_MPI::GetComm(), &rank);
-  SU2_MPI::Comm_size(SU2_MPI::GetComm(), &size);
-
-  /* Check for the master node. */
-  if(rank == MASTER_NODE) {
-
-    /* Master node. Loop over the other ranks to receive their data. */
-    for(int proc=1; proc<size; ++proc) {
-
-      /* Block until a message from this processor arrives. Determine
-         the number of entries in the receive buffers. */
-      SU2_MPI::Status status;
-      SU2_MPI::Probe(proc, 0, SU2_MPI::GetComm(), &status);
-
-      int nEntries;
-      SU2_MPI::Get_count(&status, MPI_LONG, &nEntries);
-
-      /* Allocate the memory for the receive buffers and receive the
-         three messages using blocking receives. */
-      vector<long>   recvBufNCalls(nEntries);
-      vector<double> recvBufTotTime(nEntries);
-      vector<double> recvBufMinTime(nEntries);
-      vector<double> recvBufMaxTime(nEntries);
-      vector<long>   recvBufMNK(3*nEntries);
-
-      SU2_MPI::Recv(recvBufNCalls.data(), recvBufNCalls.size(),
-                    MPI_LONG, proc, 0, SU2_MPI::GetComm(), &status);
-      SU2_MPI::Recv(recvBufTotTime.data(), recvBufTotTime.size(),
-                    MPI_DOUBLE, proc, 1, SU2_MPI::GetComm(), &status);
-      SU2_MPI::Recv(recvBufMinTime.data(), recvBufMinTime.size(),
-                    MPI_DOUBLE, proc, 2, SU2_MPI::GetComm(), &status);
-      SU2_MPI::Recv(recvBufMaxTime.data(), recvBufMaxTime.size(),
-                    MPI_DOUBLE, proc, 3, SU2_MPI::GetComm(), &status);
-      SU2_MPI::Recv(recvBufMNK.data(), recvBufMNK.size(),
-                    MPI_LONG, proc, 4, SU2_MPI::GetComm(), &status);
-
-      /* Loop over the number of entries. */
-      for(int i=0; i<nEntries; ++i) {
-
-        /* Create the CLong3T from the M-N-K values and check if it is already
-           stored in the map GEMM_Profile_MNK. */
-        CLong3T MNK(recvBufMNK[3*i], recvBufMNK[3*i+1], recvBufMNK[3*i+2]);
-        map<CLong3T, int>::iterator MI = GEMM_Profile_MNK.find(MNK);
-
-        if(MI == GEMM_Profile_MNK.end()) {
-
-          /* Entry is not present yet. Create it. */
-          const int ind = GEMM_Profile_MNK.size();
-          GEMM_Profile_MNK[MNK] = ind;
-
-          GEMM_Profile_NCalls.push_back(recvBufNCalls[i]);
-          GEMM_Profile_TotTime.push_back(recvBufTotTime[i]);
-          GEMM_Profile_MinTime.push_back(recvBufMinTime[i]);
-          GEMM_Profile_MaxTime.push_back(recvBufMaxTime[i]);
-        }
-        else {
-
-          /* Entry is already present. Determine its index in the
-             map and update the corresponding vectors. */
-          const int ind = MI->second;
-          GEMM_Profile_NCalls[ind]  += recvBufNCalls[i];
-          GEMM_Profile_TotTime[ind] += recvBufTotTime[i];
-          GEMM_Profile_MinTime[ind]  = min(GEMM_Profile_MinTime[ind], recvBufMinTime[i]);
-          GEMM_Profile_MaxTime[ind]  = max(GEMM_Profile_MaxTime[ind], recvBufMaxTime[i]);
-        }
-      }
-    }
-  }
-  else {
-
-    /* Not the master node. Create the send buffer for the MNK data. */
-    vector<long> sendBufMNK(3*GEMM_Profile_NCalls.size());
-    for(map<CLong3T, int>::iterator MI =GEMM_Profile_MNK.begin();
-                                    MI!=GEMM_Profile_MNK.end(); ++MI) {
-
-      const int ind = 3*MI->second;
-      sendBufMNK[ind]   = MI->first.long0;
-      sendBufMNK[ind+1] = MI->first.long1;
-      sendBufMNK[ind+2] = MI->first.long2;
-    }
-
-    /* Send the data to the master node using blocking sends. */
-    SU2_MPI::Send(GEMM_Profile_NCalls.data(), GEMM_Profile_NCalls.size(),
-                  MPI_LONG, MASTER_NODE, 0, SU2_MPI::GetComm());
-    SU2_MPI::Send(GEMM_Profile_TotTime.data(), GEMM_Profile_TotTime.size(),
-                  MPI_DOUBLE, MASTER_NODE, 1, SU2_MPI::GetComm());
-    SU2_MPI::Send(GEMM_Profile_MinTime.data(), GEMM_Profile_MinTime.size(),
-                  MPI_DOUBLE, MASTER_NODE, 2, SU2_MPI::GetComm());
-    SU2_MPI::Send(GEMM_Profile_MaxTime.data(), GEMM_Profile_MaxTime.size(),
-                  MPI_DOUBLE, MASTER_NODE, 3, SU2_MPI::GetComm());
-    SU2_MPI::Send(sendBufMNK.data(), sendBufMNK.size(),
-                  MPI_LONG, MASTER_NODE, 4, SU2_MPI::GetComm());
-  }
-
-#endif
-
-  /*--- The master rank will write the file ---*/
-  if (rank == MASTER_NODE) {
-
-    /* Store the elements of the map GEMM_Profile_MNK in
-       vectors for post processing reasons. */
-    const unsigned int nItems = GEMM_Profile_MNK.size();
-    vector<long> M(nItems), N(nItems), K(nItems);
-    for(map<CLong3T, int>::iterator MI =GEMM_Profile_MNK.begin();
-                                    MI!=GEMM_Profile_MNK.end(); ++MI) {
-
-      const int ind = MI->second;
-      M[ind] = MI->first.long0;
-      N[ind] = MI->first.long1;
-      K[ind] = MI->first.long2;
-    }
-
-    /* In order to create a nicer output the profiling data is sorted in
-       terms of CPU time spent. Create a vector of pairs for carrying
-       out this sort. */
-    vector<pair<double, unsigned int> > sortedTime;
-
-    for(unsigned int i=0; i<GEMM_Profile_TotTime.size(); ++i)
-      sortedTime.push_back(make_pair(GEMM_Profile_TotTime[i], i));
-
-    sort(sortedTime.begin(), sortedTime.end());
-
-    /* Open the profiling file. */
-    ofstream Profile_File;
-    Profile_File.precision(15);
-    Profile_File.open("gemm_profiling.csv");
-
-    /* Create the CSV header */
-    Profile_File << "\"Total_Time\", \"N_Calls\", \"Avg_Time\", \"Min_Time\", \"Max_Time\", \"M\", \"N\", \"K\", \"Avg GFLOPs\"" << endl;
-
-    /* Loop through the different items, where the item with the largest total time is
-       written first. As sortedTime is sorted in increasing order, the sequence of
-       sortedTime must be reversed. */
-    for(vector<pair<double, unsigned int> >::reverse_iterator rit =sortedTime.rbegin();
-                                                              rit!=sortedTime.rend(); ++rit) {
-      /* Determine the original index in the profiling vectors. */
-      const unsigned int ind = rit->second;
-      const double AvgTime = GEMM_Profile_TotTime[ind]/GEMM_Profile_NCalls[ind];
-      const double GFlops   = 2.0e-9*M[ind]*N[ind]*K[ind]/AvgTime;
-
-      /* Write the data. */
-      Profile_File << scientific << GEMM_Profile_TotTime[ind] << ", " << GEMM_Profile_NCalls[ind] << ", "
-                   << AvgTime << ", " << GEMM_Profile_MinTime[ind] << ", " << GEMM_Profile_MaxTime[ind] << ", "
-                   << M[ind] << ", " << N[ind] << ", " << K[ind] << ", " << GFlops << endl;
-    }
-
-    /* Close the file. */
-    Profile_File.close();
-  }
-
-#endif
-
-}
-
 void CConfig::SetFreeStreamTurboNormal(const su2double* turboNormal){
 
   FreeStreamTurboNormal[0] = turboNormal[0];
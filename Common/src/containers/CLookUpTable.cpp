@@ -30,16 +30,24 @@
 #include "../../../Common/include/containers/CLookUpTable.hpp"
 
 #include "../../../Common/include/linear_algebra/blas_structure.hpp"
+#include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/CSquareMatrixCM.hpp"
 
 using namespace std;
 
-CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in, string name_CV2_in)
-    : file_name_lut{var_file_name_lut}, name_CV1{std::move(name_CV1_in)}, name_CV2{std::move(name_CV2_in)} {
+CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in, string name_CV2_in,
+                           LUT_SEARCH_MAP search_map_in)
+    : file_name_lut{var_file_name_lut},
+      name_CV1{std::move(name_CV1_in)},
+      name_CV2{std::move(name_CV2_in)},
+      search_map{search_map_in} {
   rank = SU2_MPI::GetRank();
 
   LoadTableRaw(var_file_name_lut);
 
+  idx_CV1 = GetIndexOfVar(name_CV1);
+  idx_CV2 = GetIndexOfVar(name_CV2);
+
   FindTableLimits(name_CV1, name_CV2);
 
   if (rank == MASTER_NODE)
@@ -53,63 +61,78 @@ CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in,
 
   PrintTableInfo();
 
-  if (rank == MASTER_NODE) switch (table_dim) {
-      case 2:
-        cout << "Building a trapezoidal map for the (" + name_CV1 + ", " + name_CV2 +
-                    ") "
-                    "space ..."
-             << endl;
-        break;
-      case 3:
-        cout << "Building trapezoidal map stack for the (" + name_CV1 + ", " + name_CV2 +
-                    ") "
-                    "space ..."
-             << endl;
-        break;
-      default:
-        break;
+  ComputeInterpCoeffs();
+
+  if (search_map == LUT_SEARCH_MAP::TRAPEZOIDAL) {
+    if (rank == MASTER_NODE) switch (table_dim) {
+        case 2:
+          cout << "Building a trapezoidal map for the (" + name_CV1 + ", " + name_CV2 +
+                      ") "
+                      "space ..."
+               << endl;
+          break;
+        case 3:
+          cout << "Building trapezoidal map stack for the (" + name_CV1 + ", " + name_CV2 +
+                      ") "
+                      "space ..."
+               << endl;
+          break;
+        default:
+          break;
+      }
+
+    trap_map_x_y.resize(n_table_levels);
+    su2double startTime = SU2_MPI::Wtime();
+    unsigned short barwidth = 65;
+    bool display_map_info = (n_table_levels < 2);
+    double tmap_memory_footprint = 0;
+    for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
+      trap_map_x_y[i_level] =
+          CTrapezoidalMap(GetDataP(name_CV1, i_level), GetDataP(name_CV2, i_level), table_data[i_level].cols(),
+                          edges[i_level], edge_to_triangle[i_level], display_map_info);
+      tmap_memory_footprint += trap_map_x_y[i_level].GetMemoryFootprint();
+      /* Display a progress bar to monitor table generation process */
+      if (rank == MASTER_NODE) {
+        su2double progress = su2double(i_level) / n_table_levels;
+        auto completed = floor(progress * barwidth);
+        auto to_do = barwidth - completed;
+        cout << "[" << setfill('=') << setw(completed);
+        cout << '>';
+        cout << setfill(' ') << setw(to_do) << std::right << "] " << 100 * progress << "%\r";
+        cout.flush();
+      }
     }
+    su2double stopTime = SU2_MPI::Wtime();
 
-  trap_map_x_y.resize(n_table_levels);
-  su2double startTime = SU2_MPI::Wtime();
-  unsigned short barwidth = 65;
-  bool display_map_info = (n_table_levels < 2);
-  double tmap_memory_footprint = 0;
-  for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
-    trap_map_x_y[i_level] =
-        CTrapezoidalMap(GetDataP(name_CV1, i_level), GetDataP(name_CV2, i_level), table_data[i_level].cols(),
-                        edges[i_level], edge_to_triangle[i_level], display_map_info);
-    tmap_memory_footprint += trap_map_x_y[i_level].GetMemoryFootprint();
-    /* Display a progress bar to monitor table generation process */
     if (rank == MASTER_NODE) {
-      su2double progress = su2double(i_level) / n_table_levels;
-      auto completed = floor(progress * barwidth);
-      auto to_do = barwidth - completed;
-      cout << "[" << setfill('=') << setw(completed);
-      cout << '>';
-      cout << setfill(' ') << setw(to_do) << std::right << "] " << 100 * progress << "%\r";
-      cout.flush();
+      switch (table_dim) {
+        case 2:
+          cout << "\nConstruction of trapezoidal map took " << stopTime - startTime << " seconds\n" << endl;
+          break;
+        case 3:
+          cout << "\nConstruction of trapezoidal map stack took " << stopTime - startTime << " seconds\n" << endl;
+          break;
+        default:
+          break;
+      }
+      cout << "Trapezoidal map memory footprint: " << tmap_memory_footprint << " MB\n";
+      cout << "Table data memory footprint: " << memory_footprint_data << " MB\n" << endl;
     }
-  }
-  su2double stopTime = SU2_MPI::Wtime();
-
-  if (rank == MASTER_NODE) {
-    switch (table_dim) {
-      case 2:
-        cout << "\nConstruction of trapezoidal map took " << stopTime - startTime << " seconds\n" << endl;
-        break;
-      case 3:
-        cout << "\nConstruction of trapezoidal map stack took " << stopTime - startTime << " seconds\n" << endl;
-        break;
-      default:
-        break;
+  } else {
+    /*--- Uniform grid maps, they use the interpolation coefficients. ---*/
+    grid_map_x_y.resize(n_table_levels);
+    double gmap_memory_footprint = 0;
+    for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
+      grid_map_x_y[i_level] = CUniformGridMap(table_data[i_level][idx_CV1], table_data[i_level][idx_CV2],
+                                              triangles[i_level], interp_mat_inv_x_y[i_level]);
+      gmap_memory_footprint += grid_map_x_y[i_level].GetMemoryFootprint();
+    }
+    if (rank == MASTER_NODE) {
+      cout << "Uniform grid map memory footprint: " << gmap_memory_footprint << " MB\n";
+      cout << "Table data memory footprint: " << memory_footprint_data << " MB\n" << endl;
     }
-    cout << "Trapezoidal map memory footprint: " << tmap_memory_footprint << " MB\n";
-    cout << "Table data memory footprint: " << memory_footprint_data << " MB\n" << endl;
   }
 
-  ComputeInterpCoeffs();
-
   if (rank == MASTER_NODE) cout << "LUT fluid model ready for use" << endl;
 }
 
@@ -403,7 +426,7 @@ void CLookUpTable::GetInterpMatInv(const su2double* vec_x, const su2double* vec_
   }
 }
 
-std::pair<unsigned long, unsigned long> CLookUpTable::FindInclusionLevels(const su2double val_CV3) {
+std::pair<unsigned long, unsigned long> CLookUpTable::FindInclusionLevels(const su2double val_CV3) const {
   /*--- Find the table levels with constant z-values directly below and above the query value val_CV3 ---*/
 
   /* Check if val_CV3 lies outside table bounds */
@@ -498,6 +521,131 @@ unsigned long CLookUpTable::LookUp_XYZ(const std::vector<std::string>& val_names
   }
 }
 
+vector<unsigned long> CLookUpTable::GetIndexOfVars(const vector<string>& val_names_var) const {
+  vector<unsigned long> idx_vars(val_names_var.size());
+  for (auto i_var = 0ul; i_var < val_names_var.size(); ++i_var) {
+    if (noSource(val_names_var[i_var])) {
+      idx_vars[i_var] = NULL_VAR;
+    } else {
+      idx_vars[i_var] = GetIndexOfVar(val_names_var[i_var]);
+    }
+  }
+  return idx_vars;
+}
+
+unsigned long CLookUpTable::FindTriangle(su2double val_CV1, su2double val_CV2, unsigned long i_level,
+                                         std::array<su2double, 3>& interp_coeffs) const {
+  if (search_map == LUT_SEARCH_MAP::UNIFORM_GRID)
+    return grid_map_x_y[i_level].GetTriangle(val_CV1, val_CV2, interp_coeffs);
+
+  /* check if x and y value is in table range */
+  if (!(val_CV1 >= *limits_table_x[i_level].first && val_CV1 <= *limits_table_x[i_level].second) ||
+      !(val_CV2 >= *limits_table_y[i_level].first && val_CV2 <= *limits_table_y[i_level].second))
+    return CUniformGridMap::NOT_FOUND;
+
+  /* the triangle found by the trapezoidal map may not contain the point if the table domain is non-rectangular */
+  const auto id_triangle = trap_map_x_y[i_level].GetTriangle(val_CV1, val_CV2);
+  if (!IsInTriangle(val_CV1, val_CV2, id_triangle, i_level)) return CUniformGridMap::NOT_FOUND;
+
+  GetInterpCoeffs(val_CV1, val_CV2, interp_mat_inv_x_y[i_level][id_triangle], interp_coeffs);
+  return id_triangle;
+}
+
+unsigned long CLookUpTable::GetStencilXY(su2double val_CV1, su2double val_CV2, unsigned long i_level,
+                                         std::array<unsigned long, 3>& nodes,
+                                         std::array<su2double, 3>& weights) const {
+  const auto id_triangle = FindTriangle(val_CV1, val_CV2, i_level, weights);
+
+  if (id_triangle == CUniformGridMap::NOT_FOUND) {
+    GetNearestNeighborWeights(val_CV1, val_CV2, i_level, nodes, weights);
+    return 1;
+  }
+  for (int p = 0; p < 3; p++) nodes[p] = triangles[i_level][id_triangle][p];
+  return 0;
+}
+
+unsigned long CLookUpTable::LookUp_Batch(const vector<unsigned long>& idx_vars, unsigned long n_queries,
+                                         const su2double* val_CV1, const su2double* val_CV2,
+                                         const su2double* val_CV3, unsigned long stride, su2double* val_vars,
+                                         unsigned short* exit_codes) const {
+  /*--- Interpolation stencil of a query, a triangle (or the nearest neighbors) on the table levels below and
+   * above the query. The weights of the linear interpolation in z are included in the stencil weights. ---*/
+  struct Stencil {
+    std::array<unsigned long, 2> levels;
+    std::array<std::array<unsigned long, 3>, 2> nodes;
+    std::array<std::array<su2double, 3>, 2> weights;
+  };
+  constexpr unsigned long block_size = 64;
+  std::array<Stencil, block_size> stencils;
+
+  const auto n_vars = idx_vars.size();
+  unsigned long n_misses = 0;
+
+  for (auto begin = 0ul; begin < n_queries; begin += block_size) {
+    const auto n_block = min(block_size, n_queries - begin);
+
+    /*--- Locate all queries of the block. ---*/
+    for (auto i = 0ul; i < n_block; ++i) {
+      const auto iQuery = (begin + i) * stride;
+      const su2double x = val_CV1[iQuery], y = val_CV2[iQuery];
+      auto& st = stencils[i];
+      unsigned long exit_code = 0;
+
+      const auto inclusion_levels = val_CV3 ? FindInclusionLevels(val_CV3[iQuery]) : make_pair(0ul, 0ul);
+
+      if (inclusion_levels.first != inclusion_levels.second) {
+        const su2double z = val_CV3[iQuery];
+        const auto lower_upper_CV1_2 = ComputeNormalizedXY(inclusion_levels, x, y, z);
+        st.levels = {inclusion_levels.first, inclusion_levels.second};
+
+        for (auto k = 0u; k < 2; ++k) {
+          exit_code = max(exit_code, GetStencilXY(lower_upper_CV1_2[k][0], lower_upper_CV1_2[k][1], st.levels[k],
+                                                  st.nodes[k], st.weights[k]));
+        }
+        /*--- Same factors as Linear_Interpolation. ---*/
+        const su2double z_lower = z_values_levels[st.levels[0]], z_upper = z_values_levels[st.levels[1]];
+        const su2double factor_lower = (z_upper - z) / (z_upper - z_lower);
+        const su2double factor_upper = (z - z_lower) / (z_upper - z_lower);
+        for (auto p = 0u; p < 3; ++p) {
+          st.weights[0][p] *= factor_lower;
+          st.weights[1][p] *= factor_upper;
+        }
+      } else {
+        /*--- Single level, also when the query is outside of the z-range (which counts as a miss). ---*/
+        st.levels = {inclusion_levels.first, inclusion_levels.first};
+        exit_code = GetStencilXY(x, y, st.levels[0], st.nodes[0], st.weights[0]);
+        if (val_CV3) exit_code = 1;
+        st.nodes[1] = st.nodes[0];
+        st.weights[1] = {0.0, 0.0, 0.0};
+      }
+      n_misses += exit_code;
+      if (exit_codes) exit_codes[begin + i] = exit_code;
+    }
+
+    /*--- Interpolate the variables, one at a time for all the queries of the block. ---*/
+    for (auto i_var = 0ul; i_var < n_vars; ++i_var) {
+      su2double* out = val_vars + begin * n_vars + i_var;
+
+      if (idx_vars[i_var] == NULL_VAR) {
+        for (auto i = 0ul; i < n_block; ++i) out[i * n_vars] = 0.0;
+        continue;
+      }
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (auto i = 0ul; i < n_block; ++i) {
+        const auto& st = stencils[i];
+        const su2double* lower = table_data[st.levels[0]][idx_vars[i_var]];
+        const su2double* upper = table_data[st.levels[1]][idx_vars[i_var]];
+        su2double val = 0.0;
+        for (auto p = 0u; p < 3; ++p) {
+          val += st.weights[0][p] * lower[st.nodes[0][p]] + st.weights[1][p] * upper[st.nodes[1][p]];
+        }
+        out[i * n_vars] = val;
+      }
+    }
+  }
+  return n_misses;
+}
+
 void CLookUpTable::Linear_Interpolation(const su2double val_CV3, const unsigned long lower_level,
                                         const unsigned long upper_level, su2double& lower_value, su2double& upper_value,
                                         su2double*& var_val) const {
@@ -535,8 +683,8 @@ void CLookUpTable::Linear_Interpolation(const su2double val_CV3, const unsigned
 }
 
 std::array<std::array<su2double, 2>, 2> CLookUpTable::ComputeNormalizedXY(
-    std::pair<unsigned long, unsigned long>& inclusion_levels, const su2double val_CV1, const su2double val_CV2,
-    const su2double val_CV3) {
+    const std::pair<unsigned long, unsigned long>& inclusion_levels, const su2double val_CV1, const su2double val_CV2,
+    const su2double val_CV3) const {
   /* Determine the values of the controlling variables of the upper and lower table levels corresponding to the
      normalized query point coordinates. */
 
@@ -589,24 +737,17 @@ unsigned long CLookUpTable::LookUp_XY(const string& val_name_var, su2double* val
     return exit_code;
   }
 
-  /* check if x and y value is in table range */
-  if ((val_CV1 >= *limits_table_x[i_level].first && val_CV1 <= *limits_table_x[i_level].second) &&
-      (val_CV2 >= *limits_table_y[i_level].first && val_CV2 <= *limits_table_y[i_level].second)) {
-    /* find the triangle that holds the (x, y) point */
-    unsigned long id_triangle = trap_map_x_y[i_level].GetTriangle(val_CV1, val_CV2);
-
-    if (IsInTriangle(val_CV1, val_CV2, id_triangle, i_level)) {
-      /* get interpolation coefficients for point on triangle */
-      std::array<su2double, 3> interp_coeffs{0};
-      GetInterpCoeffs(val_CV1, val_CV2, interp_mat_inv_x_y[i_level][id_triangle], interp_coeffs);
+  /* find the triangle that holds the (x, y) point and the interpolation coefficients */
+  std::array<su2double, 3> interp_coeffs{0};
+  const auto id_triangle = FindTriangle(val_CV1, val_CV2, i_level, interp_coeffs);
 
-      /* first, copy the single triangle from the large triangle list*/
-      std::array<unsigned long, 3> triangle{0};
-      for (int p = 0; p < 3; p++) triangle[p] = triangles[i_level][id_triangle][p];
+  if (id_triangle != CUniformGridMap::NOT_FOUND) {
+    /* first, copy the single triangle from the large triangle list*/
+    std::array<unsigned long, 3> triangle{0};
+    for (int p = 0; p < 3; p++) triangle[p] = triangles[i_level][id_triangle][p];
 
-      *val_var = Interpolate(GetDataP(val_name_var, i_level), triangle, interp_coeffs);
-      exit_code = 0;
-    }
+    *val_var = Interpolate(GetDataP(val_name_var, i_level), triangle, interp_coeffs);
+    exit_code = 0;
   }
   if (exit_code == 1) InterpolateToNearestNeighbors(val_CV1, val_CV2, val_name_var, val_var, i_level);
 
@@ -628,28 +769,12 @@ unsigned long CLookUpTable::LookUp_XY(const vector<string>& val_names_var, vecto
 
 unsigned long CLookUpTable::LookUp_XY(const vector<string>& val_names_var, vector<su2double*>& val_vars,
                                       su2double val_CV1, su2double val_CV2, unsigned long i_level) {
-  unsigned long exit_code = 1;
-  unsigned long id_triangle = 0;
   std::array<su2double, 3> interp_coeffs{0};
   std::array<unsigned long, 3> triangle{0};
 
-  /* check if x value is in table x-dimension range
-   * and if y is in table y-dimension table range */
-  if ((val_CV1 >= *limits_table_x[i_level].first && val_CV1 <= *limits_table_x[i_level].second) &&
-      (val_CV2 >= *limits_table_y[i_level].first && val_CV2 <= *limits_table_y[i_level].second)) {
-    /* if so, try to find the triangle that holds the (prog, enth) point */
-    id_triangle = trap_map_x_y[i_level].GetTriangle(val_CV1, val_CV2);
-
-    /* check if point is inside a triangle (if table domain is non-rectangular,
-     * the previous range check might be true but the point could still be outside of the domain) */
-    if (IsInTriangle(val_CV1, val_CV2, id_triangle, i_level)) {
-      /* if so, get interpolation coefficients for point in  the triangle */
-      GetInterpCoeffs(val_CV1, val_CV2, interp_mat_inv_x_y[i_level][id_triangle], interp_coeffs);
-
-      /* exit_code 0 means point was in triangle */
-      exit_code = 0;
-    }
-  }
+  /* try to find the triangle that holds the (prog, enth) point, exit_code 0 means point was in triangle */
+  const auto id_triangle = FindTriangle(val_CV1, val_CV2, i_level, interp_coeffs);
+  unsigned long exit_code = (id_triangle == CUniformGridMap::NOT_FOUND);
 
   /* loop over variable names and interpolate / get values */
   for (long unsigned int i_var = 0; i_var < val_names_var.size(); ++i_var) {
@@ -670,8 +795,8 @@ unsigned long CLookUpTable::LookUp_XY(const vector<string>& val_names_var, vecto
   return exit_code;
 }
 
-void CLookUpTable::GetInterpCoeffs(su2double val_CV1, su2double val_CV2, su2activematrix& interp_mat_inv,
-                                   std::array<su2double, 3>& interp_coeffs) {
+void CLookUpTable::GetInterpCoeffs(su2double val_CV1, su2double val_CV2, const su2activematrix& interp_mat_inv,
+                                   std::array<su2double, 3>& interp_coeffs) const {
   std::array<su2double, 3> query_vector = {1, val_CV1, val_CV2};
 
   su2double d;
@@ -726,10 +851,10 @@ unsigned long CLookUpTable::FindNearestNeighborOnHull(su2double val_CV1, su2doub
   return neighbor_id;
 }
 
-void CLookUpTable::InterpolateToNearestNeighbors(const su2double val_CV1, const su2double val_CV2,
-                                                 const std::vector<std::string>& names_var,
-                                                 std::vector<su2double*>& var_vals, const unsigned long i_level) {
-  /* Interpolate data using distance-weighted averaging on the two nearest table nodes. */
+void CLookUpTable::GetNearestNeighborWeights(su2double val_CV1, su2double val_CV2, unsigned long i_level,
+                                             std::array<unsigned long, 3>& nodes,
+                                             std::array<su2double, 3>& weights) const {
+  /* Distance-weighted averaging on the two nearest table nodes of the hull. */
 
   su2double min_distance = 1e99, second_distance = 1e99;
   su2double norm_coeff_x = 1. / (*limits_table_x[i_level].second - *limits_table_x[i_level].first);
@@ -737,8 +862,8 @@ void CLookUpTable::InterpolateToNearestNeighbors(const su2double val_CV1, const
   su2double val_CV1_norm = val_CV1 / (*limits_table_x[i_level].second - *limits_table_x[i_level].first);
   su2double val_CV2_norm = val_CV2 / (*limits_table_y[i_level].second - *limits_table_y[i_level].first);
 
-  const su2double* x_table = GetDataP(name_CV1, i_level);
-  const su2double* y_table = GetDataP(name_CV2, i_level);
+  const su2double* x_table = table_data[i_level][idx_CV1];
+  const su2double* y_table = table_data[i_level][idx_CV2];
   unsigned long i_nearest = 0, i_second_nearest = 0;
 
   for (unsigned long i_point = 0; i_point < n_hull_points[i_level]; ++i_point) {
@@ -764,12 +889,24 @@ void CLookUpTable::InterpolateToNearestNeighbors(const su2double val_CV1, const
   min_distance = sqrt(min_distance);
   second_distance = sqrt(second_distance);
 
-  /* Interpolate data using distance-weighted averaging */
   su2double delimiter = (1.0 / min_distance) + (1.0 / second_distance);
+
+  nodes = {i_nearest, i_second_nearest, i_second_nearest};
+  weights = {(1.0 / min_distance) / delimiter, (1.0 / second_distance) / delimiter, 0.0};
+}
+
+void CLookUpTable::InterpolateToNearestNeighbors(const su2double val_CV1, const su2double val_CV2,
+                                                 const std::vector<std::string>& names_var,
+                                                 std::vector<su2double*>& var_vals, const unsigned long i_level) {
+  /* Interpolate data using distance-weighted averaging on the two nearest table nodes. */
+
+  std::array<unsigned long, 3> nodes;
+  std::array<su2double, 3> weights;
+  GetNearestNeighborWeights(val_CV1, val_CV2, i_level, nodes, weights);
+
   for (auto iVar = 0u; iVar < var_vals.size(); iVar++) {
-    su2double data_nearest = GetDataP(names_var[iVar], i_level)[i_nearest],
-              data_second_nearest = GetDataP(names_var[iVar], i_level)[i_second_nearest];
-    *var_vals[iVar] = (data_nearest * (1.0 / min_distance) + data_second_nearest * (1.0 / second_distance)) / delimiter;
+    const su2double* data = GetDataP(names_var[iVar], i_level);
+    *var_vals[iVar] = data[nodes[0]] * weights[0] + data[nodes[1]] * weights[1];
   }
 }
 
@@ -782,7 +919,7 @@ void CLookUpTable::InterpolateToNearestNeighbors(const su2double val_CV1, const
 }
 
 bool CLookUpTable::IsInTriangle(su2double val_CV1, su2double val_CV2, unsigned long val_id_triangle,
-                                unsigned long i_level) {
+                                unsigned long i_level) const {
   su2double tri_x_0 = GetDataP(name_CV1, i_level)[triangles[i_level][val_id_triangle][0]];
   su2double tri_y_0 = GetDataP(name_CV2, i_level)[triangles[i_level][val_id_triangle][0]];
 
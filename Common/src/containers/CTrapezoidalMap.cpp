@@ -178,7 +178,7 @@ CTrapezoidalMap::CTrapezoidalMap(const su2double* samples_x, const su2double* sa
   }
 }
 
-unsigned long CTrapezoidalMap::GetTriangle(su2double val_x, su2double val_y) {
+unsigned long CTrapezoidalMap::GetTriangle(su2double val_x, su2double val_y) const {
   /* find x band in which val_x sits */
   pair<unsigned long, unsigned long> band = GetBand(val_x);
 
@@ -210,7 +210,7 @@ unsigned long CTrapezoidalMap::GetTriangle(su2double val_x, su2double val_y) {
   return triangle[0];
 }
 
-pair<unsigned long, unsigned long> CTrapezoidalMap::GetBand(su2double val_x) {
+pair<unsigned long, unsigned long> CTrapezoidalMap::GetBand(su2double val_x) const {
   unsigned long i_low = 0;
   unsigned long i_up = 0;
 
@@ -218,7 +218,7 @@ pair<unsigned long, unsigned long> CTrapezoidalMap::GetBand(su2double val_x) {
   if (val_x < unique_bands_x.front()) val_x = unique_bands_x.front();
   if (val_x > unique_bands_x.back()) val_x = unique_bands_x.back();
 
-  std::pair<std::vector<su2double>::iterator, std::vector<su2double>::iterator> bounds;
+  std::pair<std::vector<su2double>::const_iterator, std::vector<su2double>::const_iterator> bounds;
   bounds = std::equal_range(unique_bands_x.begin(), unique_bands_x.end(), val_x);
 
   /*--- if upper bound = 0, then use the range [0,1] ---*/
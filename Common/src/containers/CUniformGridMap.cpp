@@ -0,0 +1,137 @@
+/*!
+ * \file CUniformGridMap.cpp
+ * \brief Implementation of the uniform background grid for point location in a triangulated table level.
+ * \author D. Mayer, T. Economon
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "../../Common/include/containers/CUniformGridMap.hpp"
+
+using namespace std;
+
+namespace {
+/*--- Tolerance on the barycentric coordinates (fractions of the triangle area), the same as the relative
+ *    tolerance on the areas in CLookUpTable::IsInTriangle. ---*/
+constexpr passivedouble BARY_TOL = 1e-10;
+
+inline unsigned long CellIndex(su2double val, su2double val_min, su2double inv_size, unsigned long n_cells) {
+  const auto i = static_cast<long>(floor(SU2_TYPE::GetValue((val - val_min) * inv_size)));
+  return static_cast<unsigned long>(min<long>(max<long>(i, 0), n_cells - 1));
+}
+}  // namespace
+
+CUniformGridMap::CUniformGridMap(const su2double* samples_x, const su2double* samples_y,
+                                 const su2matrix<unsigned long>& triangles,
+                                 const su2vector<su2activematrix>& interp_mat_inv) {
+  const unsigned long n_triangles = triangles.rows();
+
+  /*--- Pack the interpolation coefficients, the query vector is (1, x, y). ---*/
+  bary_coeffs.resize(n_triangles);
+  for (auto i_tri = 0ul; i_tri < n_triangles; ++i_tri)
+    for (auto i = 0u; i < 3; ++i)
+      for (auto j = 0u; j < 3; ++j) bary_coeffs[i_tri][3 * i + j] = interp_mat_inv[i_tri][i][j];
+
+  /*--- Bounding box of the triangulation. ---*/
+  su2double x_max = x_min = samples_x[triangles(0, 0)];
+  su2double y_max = y_min = samples_y[triangles(0, 0)];
+  for (auto i_tri = 0ul; i_tri < n_triangles; ++i_tri) {
+    for (auto i_node = 0u; i_node < 3; ++i_node) {
+      const auto iPoint = triangles(i_tri, i_node);
+      x_min = min(x_min, samples_x[iPoint]);
+      x_max = max(x_max, samples_x[iPoint]);
+      y_min = min(y_min, samples_y[iPoint]);
+      y_max = max(y_max, samples_y[iPoint]);
+    }
+  }
+
+  /*--- As many cells as triangles, uniform over the bounding box in the (unscaled) controlling variables.
+   *    Each cell lists the triangles whose bounding box overlaps it, clustered triangles make longer lists. ---*/
+  n_cells_x = n_cells_y = max<unsigned long>(1, ceil(sqrt(double(n_triangles))));
+  inv_dx = (x_max > x_min) ? su2double(n_cells_x) / (x_max - x_min) : su2double(0);
+  inv_dy = (y_max > y_min) ? su2double(n_cells_y) / (y_max - y_min) : su2double(0);
+
+  /*--- Range of cells overlapped by the bounding box of a triangle. ---*/
+  auto cellRange = [&](unsigned long i_tri, array<unsigned long, 4>& range) {
+    su2double tri_x_min = samples_x[triangles(i_tri, 0)], tri_x_max = tri_x_min;
+    su2double tri_y_min = samples_y[triangles(i_tri, 0)], tri_y_max = tri_y_min;
+    for (auto i_node = 1u; i_node < 3; ++i_node) {
+      const auto iPoint = triangles(i_tri, i_node);
+      tri_x_min = min(tri_x_min, samples_x[iPoint]);
+      tri_x_max = max(tri_x_max, samples_x[iPoint]);
+      tri_y_min = min(tri_y_min, samples_y[iPoint]);
+      tri_y_max = max(tri_y_max, samples_y[iPoint]);
+    }
+    range[0] = CellIndex(tri_x_min, x_min, inv_dx, n_cells_x);
+    range[1] = CellIndex(tri_x_max, x_min, inv_dx, n_cells_x);
+    range[2] = CellIndex(tri_y_min, y_min, inv_dy, n_cells_y);
+    range[3] = CellIndex(tri_y_max, y_min, inv_dy, n_cells_y);
+  };
+
+  /*--- Two passes, count and then fill the CSR lists. ---*/
+  cell_ptr.assign(n_cells_x * n_cells_y + 1, 0);
+  array<unsigned long, 4> range;
+
+  for (auto i_tri = 0ul; i_tri < n_triangles; ++i_tri) {
+    cellRange(i_tri, range);
+    for (auto j = range[2]; j <= range[3]; ++j)
+      for (auto i = range[0]; i <= range[1]; ++i) ++cell_ptr[j * n_cells_x + i + 1];
+  }
+  for (auto i_cell = 0ul; i_cell < n_cells_x * n_cells_y; ++i_cell) cell_ptr[i_cell + 1] += cell_ptr[i_cell];
+
+  cell_triangle.resize(cell_ptr.back());
+  vector<unsigned long> fill(cell_ptr.begin(), cell_ptr.end() - 1);
+
+  for (auto i_tri = 0ul; i_tri < n_triangles; ++i_tri) {
+    cellRange(i_tri, range);
+    for (auto j = range[2]; j <= range[3]; ++j)
+      for (auto i = range[0]; i <= range[1]; ++i) cell_triangle[fill[j * n_cells_x + i]++] = i_tri;
+  }
+
+  memory_footprint = (cell_ptr.size() + cell_triangle.size()) * sizeof(unsigned long) +
+                     bary_coeffs.size() * sizeof(array<su2double, 9>);
+  memory_footprint /= 1e6;
+}
+
+unsigned long CUniformGridMap::GetTriangle(su2double val_x, su2double val_y, array<su2double, 3>& coeffs) const {
+  /*--- Outside of the bounding box (also catches NaN queries). ---*/
+  if (!(val_x >= x_min && (val_x - x_min) * inv_dx <= n_cells_x && val_y >= y_min &&
+        (val_y - y_min) * inv_dy <= n_cells_y)) {
+    return NOT_FOUND;
+  }
+  const auto i = CellIndex(val_x, x_min, inv_dx, n_cells_x);
+  const auto j = CellIndex(val_y, y_min, inv_dy, n_cells_y);
+  const auto i_cell = j * n_cells_x + i;
+
+  for (auto k = cell_ptr[i_cell]; k < cell_ptr[i_cell + 1]; ++k) {
+    const auto i_tri = cell_triangle[k];
+    const auto& c = bary_coeffs[i_tri];
+    for (auto i_node = 0u; i_node < 3; ++i_node) {
+      coeffs[i_node] = c[3 * i_node] + c[3 * i_node + 1] * val_x + c[3 * i_node + 2] * val_y;
+    }
+    if (coeffs[0] >= -BARY_TOL && coeffs[1] >= -BARY_TOL && coeffs[2] >= -BARY_TOL) return i_tri;
+  }
+  return NOT_FOUND;
+}
@@ -32,6 +32,7 @@
 #include "../../include/parallelization/omp_structure.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/toolboxes/ndflattener.hpp"
+#include "../../include/toolboxes/CProfiler.hpp"
 
 CGeometry::CGeometry() : size(SU2_MPI::GetSize()), rank(SU2_MPI::GetRank()) {}
 
@@ -576,6 +577,7 @@ void CGeometry::GetCommCountAndType(const CConfig* config, unsigned short commTy
 }
 
 void CGeometry::InitiateComms(CGeometry* geometry, const CConfig* config, unsigned short commType) const {
+  SU2_PROFILE_SCOPE("HaloInitiateComms");
   if (nP2PSend == 0) return;
 
   /*--- Local variables ---*/
@@ -673,6 +675,7 @@ void CGeometry::InitiateComms(CGeometry* geometry, const CConfig* config, unsign
 }
 
 void CGeometry::CompleteComms(CGeometry* geometry, const CConfig* config, unsigned short commType) {
+  SU2_PROFILE_SCOPE("HaloCompleteComms");
   if (nP2PRecv == 0) return;
 
   /*--- Local variables ---*/
@@ -0,0 +1,436 @@
+/*!
+ * \file CGeometryCache.cpp
+ * \brief Implementation of the cache of geometry preprocessing results.
+ * \author P. Gomes
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/geometry/CGeometryCache.hpp"
+#include "../../include/geometry/CGeometry.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sys/stat.h>
+
+constexpr uint64_t CGeometryCache::MAGIC_NUMBER;
+constexpr uint64_t CGeometryCache::FORMAT_VERSION;
+constexpr uint64_t CGeometryCache::HASH_SEED;
+
+uint64_t CGeometryCache::Hash(const void* data, size_t nBytes, uint64_t hash) {
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  for (size_t i = 0; i < nBytes; ++i) {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+uint64_t CGeometryCache::HashFile(const std::string& name) {
+  uint64_t hash = Hash(name.data(), name.size(), HASH_SEED);
+
+  std::ifstream file(name, std::ios::binary);
+  if (!file.is_open()) return hash;
+
+  std::vector<char> buffer(1 << 20);
+  while (file) {
+    file.read(buffer.data(), buffer.size());
+    hash = Hash(buffer.data(), file.gcount(), hash);
+  }
+  return hash;
+}
+
+uint64_t CGeometryCache::StampFile(const std::string& name) {
+  struct stat info;
+  if (stat(name.c_str(), &info) != 0) return 0;
+
+#if defined(__APPLE__)
+  const uint64_t stamp[] = {static_cast<uint64_t>(info.st_size), static_cast<uint64_t>(info.st_mtimespec.tv_sec),
+                            static_cast<uint64_t>(info.st_mtimespec.tv_nsec)};
+#elif defined(_WIN32)
+  const uint64_t stamp[] = {static_cast<uint64_t>(info.st_size), static_cast<uint64_t>(info.st_mtime), 0};
+#else
+  const uint64_t stamp[] = {static_cast<uint64_t>(info.st_size), static_cast<uint64_t>(info.st_mtim.tv_sec),
+                            static_cast<uint64_t>(info.st_mtim.tv_nsec)};
+#endif
+  return Hash(stamp, sizeof(stamp), HASH_SEED);
+}
+
+uint64_t CGeometryCache::GetMeshHash() const {
+  /*--- Mesh file -> (stamp, hash), all ranks go through the same sequence of calls. ---*/
+  static std::map<std::string, std::pair<uint64_t, uint64_t> > known;
+
+  auto it = known.find(meshFilename);
+  if (it != known.end() && it->second.first == meshStamp) return it->second.second;
+
+  unsigned long meshHash = 0;
+  if (rank == MASTER_NODE) meshHash = HashFile(meshFilename);
+  SU2_MPI::Bcast(&meshHash, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+
+  known[meshFilename] = std::make_pair(meshStamp, meshHash);
+  return meshHash;
+}
+
+uint64_t CGeometryCache::HashEdges(const CGeometry* geometry) {
+  const uint64_t nEdge = geometry->GetnEdge();
+  uint64_t hash = Hash(&nEdge, sizeof(uint64_t), HASH_SEED);
+
+  for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+    const uint64_t nodes[] = {geometry->edges->GetNode(iEdge, 0), geometry->edges->GetNode(iEdge, 1)};
+    hash = Hash(nodes, sizeof(nodes), hash);
+  }
+  return hash;
+}
+
+uint64_t CGeometryCache::HashDualGridInputs(const CGeometry* geometry) {
+  const auto nDim = geometry->GetnDim();
+  uint64_t hash = HashEdges(geometry);
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+    passivedouble coord[3] = {0.0};
+    for (auto iDim = 0u; iDim < nDim; ++iDim) coord[iDim] = SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim));
+    hash = Hash(coord, sizeof(coord), hash);
+  }
+
+  /*--- The order of the nodes determines the orientation of the elements. ---*/
+  auto hashElements = [&hash](CPrimalGrid* const* elems, unsigned long nElem) {
+    for (auto iElem = 0ul; iElem < nElem; ++iElem) {
+      for (auto iNode = 0u; iNode < elems[iElem]->GetnNodes(); ++iNode) {
+        const uint64_t node = elems[iElem]->GetNode(iNode);
+        hash = Hash(&node, sizeof(uint64_t), hash);
+      }
+    }
+  };
+  hashElements(geometry->elem, geometry->GetnElem());
+  for (auto iMarker = 0u; iMarker < geometry->GetnMarker(); ++iMarker)
+    hashElements(geometry->bound[iMarker], geometry->GetnElem_Bound(iMarker));
+
+  return hash;
+}
+
+CGeometryCache::CGeometryCache(const CConfig* config)
+    : rank(SU2_MPI::GetRank()),
+      size(SU2_MPI::GetSize()),
+      enabled(config->GetGeometryCache()),
+      meshFilename(config->GetMesh_FileName()) {
+  if (!enabled) return;
+
+  const auto iZone = config->GetiZone();
+  const auto nZone = config->GetnZone();
+
+  filename = config->GetGeometryCache_FileName();
+  if (nZone > 1) filename += "_" + PrintingToolbox::to_string(iZone);
+  filename += "_" + PrintingToolbox::to_string(rank) + ".dat";
+
+  /*--- The key is cheap to compute, it uses the size and modification time of the mesh file (the contents
+   *    are only hashed on a match) and the options that affect the partitioning and the coloring.
+   *    The rank is included to detect files that were moved or renamed. ---*/
+
+  unsigned long stamp = 0;
+  if (rank == MASTER_NODE) stamp = StampFile(meshFilename);
+  SU2_MPI::Bcast(&stamp, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+  meshStamp = stamp;
+
+#ifdef CODI_REVERSE_TYPE
+  const uint64_t relaxColoring = config->GetEdgeColoringRelaxDiscAdj();
+#else
+  const uint64_t relaxColoring = false;
+#endif
+  const passivedouble tolerance = config->GetParMETIS_Tolerance();
+  uint64_t toleranceBits = 0;
+  memcpy(&toleranceBits, &tolerance, sizeof(uint64_t));
+
+  const uint64_t keyData[] = {FORMAT_VERSION,
+                              meshStamp,
+                              static_cast<uint64_t>(size),
+                              static_cast<uint64_t>(rank),
+                              iZone,
+                              nZone,
+                              config->GetMesh_FileFormat(),
+                              toleranceBits,
+                              static_cast<uint64_t>(config->GetParMETIS_PointWeight()),
+                              static_cast<uint64_t>(config->GetParMETIS_EdgeWeight()),
+                              static_cast<uint64_t>(omp_get_max_threads()),
+                              config->GetEdgeColoringGroupSize(),
+                              relaxColoring};
+  key = Hash(keyData, sizeof(keyData), HASH_SEED);
+
+  Read();
+}
+
+void CGeometryCache::Read() {
+  std::ifstream file(filename, std::ios::binary);
+
+  auto readValue = [&file]() {
+    uint64_t value = 0;
+    file.read(reinterpret_cast<char*>(&value), sizeof(uint64_t));
+    return value;
+  };
+
+  if (file.is_open() && readValue() == MAGIC_NUMBER && readValue() == FORMAT_VERSION && readValue() == key) {
+    cachedMeshHash = readValue();
+    const auto nSection = readValue();
+    decltype(sections) cached;
+
+    for (auto iSection = 0ul; iSection < nSection && file; ++iSection) {
+      std::string name(readValue(), ' ');
+      file.read(&name[0], name.size());
+
+      auto& data = cached[name];
+      data.resize(readValue());
+      file.read(reinterpret_cast<char*>(data.data()), data.size() * sizeof(uint64_t));
+    }
+
+    /*--- Discard truncated files. ---*/
+    if (file) sections = std::move(cached);
+  }
+
+  /*--- Confirm candidate matches with the contents of the mesh file. ---*/
+  int candidate = !sections.empty();
+  int anyCandidate = candidate;
+  SU2_MPI::Allreduce(&candidate, &anyCandidate, 1, MPI_INT, MPI_MAX, SU2_MPI::GetComm());
+  if (!anyCandidate) return;
+
+  if (GetMeshHash() != cachedMeshHash) sections.clear();
+}
+
+void CGeometryCache::Write() {
+  if (!enabled) return;
+
+  /*--- The mesh hash is needed by the ranks that write, and its computation is collective. ---*/
+  int localModified = modified;
+  int anyModified = localModified;
+  SU2_MPI::Allreduce(&localModified, &anyModified, 1, MPI_INT, MPI_MAX, SU2_MPI::GetComm());
+  if (!anyModified) return;
+
+  const auto meshHash = GetMeshHash();
+  if (!modified) return;
+
+  std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+
+  auto writeValue = [&file](uint64_t value) { file.write(reinterpret_cast<const char*>(&value), sizeof(uint64_t)); };
+
+  writeValue(MAGIC_NUMBER);
+  writeValue(FORMAT_VERSION);
+  writeValue(key);
+  writeValue(meshHash);
+  writeValue(sections.size());
+
+  for (const auto& section : sections) {
+    writeValue(section.first.size());
+    file.write(section.first.data(), section.first.size());
+    writeValue(section.second.size());
+    file.write(reinterpret_cast<const char*>(section.second.data()), section.second.size() * sizeof(uint64_t));
+  }
+
+  if (!file) {
+    cout << "WARNING: Rank " << rank << " could not write the geometry cache file " << filename << "." << endl;
+  }
+  modified = false;
+}
+
+bool CGeometryCache::LoadPartitioning(CGeometry* geometry) const {
+  if (!enabled) return false;
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto it = sections.find("partitioning");
+
+  int valid = (it != sections.end()) && (it->second.size() == nPoint);
+  if (valid) {
+    for (const auto color : it->second) valid &= (color < static_cast<uint64_t>(size));
+  }
+
+  /*--- All ranks must agree, otherwise the partitioning is recomputed. ---*/
+  int allValid = valid;
+  SU2_MPI::Allreduce(&valid, &allValid, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+  if (!allValid) return false;
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) geometry->nodes->SetColor(iPoint, it->second[iPoint]);
+
+  if (rank == MASTER_NODE) cout << "Loaded the partitioning from the geometry cache." << endl;
+  return true;
+}
+
+void CGeometryCache::StorePartitioning(const CGeometry* geometry) {
+  if (!enabled) return;
+
+  auto& data = sections["partitioning"];
+  data.resize(geometry->GetnPoint());
+  for (auto iPoint = 0ul; iPoint < data.size(); ++iPoint) data[iPoint] = geometry->nodes->GetColor(iPoint);
+  modified = true;
+}
+
+bool CGeometryCache::LoadEdgeColoring(unsigned short iMesh, CGeometry* geometry) const {
+  if (!enabled) return false;
+
+  const auto it = sections.find("edge_coloring_" + PrintingToolbox::to_string(iMesh));
+  if (it == sections.end()) return false;
+
+  /*--- Layout: edge hash, group size, number of colors, pointers (nColor+1), edge indices. ---*/
+  const auto& data = it->second;
+  if (data.size() < 3 || data[0] != HashEdges(geometry)) return false;
+
+  const auto nColor = data[2];
+  if (data.size() < 4 + nColor || data.size() != 4 + nColor + data[3 + nColor]) return false;
+
+  su2vector<unsigned long> outerPtr(nColor + 1);
+  su2vector<unsigned long> innerIdx(data[3 + nColor]);
+  for (auto i = 0ul; i < outerPtr.size(); ++i) outerPtr(i) = data[3 + i];
+  for (auto i = 0ul; i < innerIdx.size(); ++i) innerIdx(i) = data[4 + nColor + i];
+
+  geometry->SetEdgeColoring(CCompressedSparsePatternUL(std::move(outerPtr), std::move(innerIdx)), data[1]);
+  return true;
+}
+
+void CGeometryCache::StoreEdgeColoring(unsigned short iMesh, CGeometry* geometry) {
+  if (!enabled) return;
+
+  const auto& coloring = geometry->GetEdgeColoring();
+  if (coloring.empty()) return;
+
+  const auto nColor = coloring.getOuterSize();
+  const auto nNonZero = coloring.getNumNonZeros();
+
+  auto& data = sections["edge_coloring_" + PrintingToolbox::to_string(iMesh)];
+  data.clear();
+  data.reserve(4 + nColor + nNonZero);
+  data.push_back(HashEdges(geometry));
+  data.push_back(geometry->GetEdgeColorGroupSize());
+  data.push_back(nColor);
+  data.insert(data.end(), coloring.outerPtr(), coloring.outerPtr() + nColor + 1);
+  data.insert(data.end(), coloring.innerIdx(), coloring.innerIdx() + nNonZero);
+  modified = true;
+}
+
+bool CGeometryCache::LoadDualGrid(CGeometry* geometry, CConfig* config) const {
+  if (!enabled) return false;
+
+  const auto nDim = geometry->GetnDim();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nEdge = geometry->GetnEdge();
+  const auto nMarker = geometry->GetnMarker();
+  unsigned long nVertex = 0;
+  for (auto iMarker = 0u; iMarker < nMarker; ++iMarker) nVertex += geometry->GetnVertex(iMarker);
+
+  /*--- Layout: input hash, domain volume, point volumes, edge normals, vertex normals. ---*/
+  const auto it = sections.find("dual_grid");
+  int valid = (it != sections.end()) && (it->second.size() == 2 + nPoint + (nEdge + nVertex) * nDim) &&
+              (it->second[0] == HashDualGridInputs(geometry));
+
+  /*--- All ranks must agree, the computation of the domain volume is collective. ---*/
+  int allValid = valid;
+  SU2_MPI::Allreduce(&valid, &allValid, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+  if (!allValid) return false;
+
+  auto value = it->second.begin() + 1;
+  auto nextValue = [&value]() {
+    passivedouble x;
+    memcpy(&x, &*(value++), sizeof(passivedouble));
+    return x;
+  };
+
+  config->SetDomainVolume(nextValue());
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) geometry->nodes->SetVolume(iPoint, nextValue());
+
+  su2double normal[3] = {0.0};
+  for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+    for (auto iDim = 0u; iDim < nDim; ++iDim) normal[iDim] = nextValue();
+    geometry->edges->SetNormal(iEdge, normal);
+  }
+  for (auto iMarker = 0u; iMarker < nMarker; ++iMarker) {
+    for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); ++iVertex) {
+      for (auto iDim = 0u; iDim < nDim; ++iDim) normal[iDim] = nextValue();
+      geometry->vertex[iMarker][iVertex]->SetNormal(normal);
+    }
+  }
+
+  /*--- The centers of gravity of the elements are a by-product of the dual grid computation. ---*/
+  auto setCenters = [&](CPrimalGrid** elems, unsigned long nElem) {
+    for (auto iElem = 0ul; iElem < nElem; ++iElem) {
+      std::array<const su2double*, N_POINTS_MAXIMUM> coord;
+      for (auto iNode = 0u; iNode < elems[iElem]->GetnNodes(); ++iNode)
+        coord[iNode] = geometry->nodes->GetCoord(elems[iElem]->GetNode(iNode));
+      elems[iElem]->SetCoord_CG(nDim, coord);
+    }
+  };
+  setCenters(geometry->elem, geometry->GetnElem());
+  for (auto iMarker = 0u; iMarker < nMarker; ++iMarker)
+    setCenters(geometry->bound[iMarker], geometry->GetnElem_Bound(iMarker));
+
+  if (rank == MASTER_NODE) cout << "Loaded the dual grid from the geometry cache." << endl;
+  return true;
+}
+
+void CGeometryCache::StoreDualGrid(const CGeometry* geometry, const CConfig* config) {
+  if (!enabled) return;
+
+  const auto nDim = geometry->GetnDim();
+
+  auto& data = sections["dual_grid"];
+  data.clear();
+  data.push_back(HashDualGridInputs(geometry));
+
+  auto pushValue = [&data](const su2double& x) {
+    const passivedouble passive = SU2_TYPE::GetValue(x);
+    uint64_t bits = 0;
+    memcpy(&bits, &passive, sizeof(passivedouble));
+    data.push_back(bits);
+  };
+
+  pushValue(config->GetDomainVolume());
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) pushValue(geometry->nodes->GetVolume(iPoint));
+
+  for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); ++iEdge)
+    for (auto iDim = 0u; iDim < nDim; ++iDim) pushValue(geometry->edges->GetNormal(iEdge)[iDim]);
+
+  for (auto iMarker = 0u; iMarker < geometry->GetnMarker(); ++iMarker)
+    for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); ++iVertex)
+      for (auto iDim = 0u; iDim < nDim; ++iDim) pushValue(geometry->vertex[iMarker][iVertex]->GetNormal(iDim));
+
+  modified = true;
+}
+
+bool CGeometryCache::LoadSection(const std::string& name, uint64_t check, std::vector<uint64_t>& data) const {
+  if (!enabled) return false;
+
+  const auto it = sections.find(name);
+  if (it == sections.end() || it->second.empty() || it->second[0] != check) return false;
+
+  data.assign(it->second.begin() + 1, it->second.end());
+  return true;
+}
+
+void CGeometryCache::StoreSection(const std::string& name, uint64_t check, const std::vector<uint64_t>& data) {
+  if (!enabled) return;
+
+  auto& section = sections[name];
+  section.clear();
+  section.reserve(1 + data.size());
+  section.push_back(check);
+  section.insert(section.end(), data.begin(), data.end());
+  modified = true;
+}
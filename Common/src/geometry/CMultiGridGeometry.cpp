@@ -60,7 +60,6 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry* fine_grid, CConfig* config, un
 
   /*--- Create the coarse grid structure using as baseline the fine grid ---*/
 
-  CMultiGridQueue MGQueue_InnerCV(fine_grid->GetnPoint());
   vector<unsigned long> Suitable_Indirect_Neighbors;
 
   nodes = new CPoint(fine_grid->GetnPoint(), nDim, iMesh, config);
@@ -195,115 +194,125 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry* fine_grid, CConfig* config, un
     }
   }
 
-  /*--- Update the queue with the results from the boundary agglomeration ---*/
+  /*--- Agglomerate the domain points, either with a thread-parallel algorithm or
+   with the sequential priority queue. ---*/
 
-  for (auto iPoint = 0ul; iPoint < fine_grid->GetnPoint(); iPoint++) {
-    if (fine_grid->nodes->GetAgglomerate(iPoint)) {
-      MGQueue_InnerCV.RemoveCV(iPoint);
+  if (config->GetKind_MG_Agglomeration() == MG_AGGLOMERATION::PARALLEL) {
+    ParallelAgglomeration(Index_CoarseCV, fine_grid, config);
+  } else {
+    CMultiGridQueue MGQueue_InnerCV(fine_grid->GetnPoint());
+
+    /*--- Update the queue with the results from the boundary agglomeration ---*/
 
-    } else {
-      /*--- Count the number of agglomerated neighbors, and modify the queue,
-       Points with more agglomerated neighbors are processed first. ---*/
+    for (auto iPoint = 0ul; iPoint < fine_grid->GetnPoint(); iPoint++) {
+      if (fine_grid->nodes->GetAgglomerate(iPoint)) {
+        MGQueue_InnerCV.RemoveCV(iPoint);
 
-      short priority = 0;
-      for (auto jPoint : fine_grid->nodes->GetPoints(iPoint)) {
-        priority += fine_grid->nodes->GetAgglomerate(jPoint);
+      } else {
+        /*--- Count the number of agglomerated neighbors, and modify the queue,
+         Points with more agglomerated neighbors are processed first. ---*/
+
+        short priority = 0;
+        for (auto jPoint : fine_grid->nodes->GetPoints(iPoint)) {
+          priority += fine_grid->nodes->GetAgglomerate(jPoint);
+        }
+        MGQueue_InnerCV.MoveCV(iPoint, priority);
       }
-      MGQueue_InnerCV.MoveCV(iPoint, priority);
     }
-  }
 
-  /*--- Agglomerate the domain points. ---*/
+    /*--- Agglomerate the domain points. ---*/
 
-  auto iteration = 0ul;
-  while (!MGQueue_InnerCV.EmptyQueue() && (iteration < fine_grid->GetnPoint())) {
-    const auto iPoint = MGQueue_InnerCV.NextCV();
-    iteration++;
+    auto iteration = 0ul;
+    while (!MGQueue_InnerCV.EmptyQueue() && (iteration < fine_grid->GetnPoint())) {
+      const auto iPoint = MGQueue_InnerCV.NextCV();
+      iteration++;
 
-    /*--- If the element has not being previously agglomerated, belongs to the physical domain,
-     and satisfies several geometrical criteria then the seed CV is accepted for agglomeration. ---*/
+      /*--- If the element has not being previously agglomerated, belongs to the physical domain,
+       and satisfies several geometrical criteria then the seed CV is accepted for agglomeration. ---*/
 
-    if ((!fine_grid->nodes->GetAgglomerate(iPoint)) && (fine_grid->nodes->GetDomain(iPoint)) &&
-        (GeometricalCheck(iPoint, fine_grid, config))) {
-      unsigned short nChildren = 1;
+      if ((!fine_grid->nodes->GetAgglomerate(iPoint)) && (fine_grid->nodes->GetDomain(iPoint)) &&
+          (GeometricalCheck(iPoint, fine_grid, config))) {
+        unsigned short nChildren = 1;
 
-      /*--- We set an index for the parent control volume ---*/
+        /*--- We set an index for the parent control volume ---*/
 
-      fine_grid->nodes->SetParent_CV(iPoint, Index_CoarseCV);
+        fine_grid->nodes->SetParent_CV(iPoint, Index_CoarseCV);
 
-      /*--- We add the seed point (child) to the parent control volume ---*/
+        /*--- We add the seed point (child) to the parent control volume ---*/
 
-      nodes->SetChildren_CV(Index_CoarseCV, 0, iPoint);
+        nodes->SetChildren_CV(Index_CoarseCV, 0, iPoint);
 
-      /*--- Update the queue with the seed point (remove the seed and
-       increase the priority of its neighbors) ---*/
+        /*--- Update the queue with the seed point (remove the seed and
+         increase the priority of its neighbors) ---*/
 
-      MGQueue_InnerCV.Update(iPoint, fine_grid);
+        MGQueue_InnerCV.Update(iPoint, fine_grid);
 
-      /*--- Now we do a sweep over all the nodes that surround the seed point ---*/
+        /*--- Now we do a sweep over all the nodes that surround the seed point ---*/
 
-      for (auto CVPoint : fine_grid->nodes->GetPoints(iPoint)) {
-        /*--- Determine if the CVPoint can be agglomerated ---*/
+        for (auto CVPoint : fine_grid->nodes->GetPoints(iPoint)) {
+          /*--- Determine if the CVPoint can be agglomerated ---*/
 
-        if ((!fine_grid->nodes->GetAgglomerate(CVPoint)) && (fine_grid->nodes->GetDomain(CVPoint)) &&
-            (GeometricalCheck(CVPoint, fine_grid, config))) {
-          /*--- We set the value of the parent ---*/
+          if ((!fine_grid->nodes->GetAgglomerate(CVPoint)) && (fine_grid->nodes->GetDomain(CVPoint)) &&
+              (GeometricalCheck(CVPoint, fine_grid, config))) {
+            /*--- We set the value of the parent ---*/
 
-          fine_grid->nodes->SetParent_CV(CVPoint, Index_CoarseCV);
+            fine_grid->nodes->SetParent_CV(CVPoint, Index_CoarseCV);
 
-          /*--- We set the value of the child ---*/
+            /*--- We set the value of the child ---*/
 
-          nodes->SetChildren_CV(Index_CoarseCV, nChildren, CVPoint);
-          nChildren++;
+            nodes->SetChildren_CV(Index_CoarseCV, nChildren, CVPoint);
+            nChildren++;
 
-          /*--- Update the queue with the new control volume (remove the CV and
-           increase the priority of its neighbors) ---*/
+            /*--- Update the queue with the new control volume (remove the CV and
+             increase the priority of its neighbors) ---*/
 
-          MGQueue_InnerCV.Update(CVPoint, fine_grid);
+            MGQueue_InnerCV.Update(CVPoint, fine_grid);
+          }
         }
-      }
 
-      /*--- Identify the indirect neighbors ---*/
+        /*--- Identify the indirect neighbors ---*/
 
-      Suitable_Indirect_Neighbors.clear();
-      if (fine_grid->nodes->GetAgglomerate_Indirect(iPoint))
-        SetSuitableNeighbors(Suitable_Indirect_Neighbors, iPoint, Index_CoarseCV, fine_grid);
+        Suitable_Indirect_Neighbors.clear();
+        if (fine_grid->nodes->GetAgglomerate_Indirect(iPoint))
+          SetSuitableNeighbors(Suitable_Indirect_Neighbors, iPoint, Index_CoarseCV, fine_grid);
 
-      /*--- Now we do a sweep over all the indirect nodes that can be added ---*/
+        /*--- Now we do a sweep over all the indirect nodes that can be added ---*/
 
-      for (auto CVPoint : Suitable_Indirect_Neighbors) {
-        /*--- The new point can be agglomerated ---*/
+        for (auto CVPoint : Suitable_Indirect_Neighbors) {
+          /*--- The new point can be agglomerated ---*/
 
-        if ((!fine_grid->nodes->GetAgglomerate(CVPoint)) && (fine_grid->nodes->GetDomain(CVPoint))) {
-          /*--- We set the value of the parent ---*/
+          if ((!fine_grid->nodes->GetAgglomerate(CVPoint)) && (fine_grid->nodes->GetDomain(CVPoint))) {
+            /*--- We set the value of the parent ---*/
 
-          fine_grid->nodes->SetParent_CV(CVPoint, Index_CoarseCV);
+            fine_grid->nodes->SetParent_CV(CVPoint, Index_CoarseCV);
 
-          /*--- We set the indirect agglomeration information ---*/
+            /*--- We set the indirect agglomeration information ---*/
 
-          if (fine_grid->nodes->GetAgglomerate_Indirect(CVPoint)) nodes->SetAgglomerate_Indirect(Index_CoarseCV, true);
+            if (fine_grid->nodes->GetAgglomerate_Indirect(CVPoint))
+              nodes->SetAgglomerate_Indirect(Index_CoarseCV, true);
 
-          /*--- We set the value of the child ---*/
+            /*--- We set the value of the child ---*/
 
-          nodes->SetChildren_CV(Index_CoarseCV, nChildren, CVPoint);
-          nChildren++;
+            nodes->SetChildren_CV(Index_CoarseCV, nChildren, CVPoint);
+            nChildren++;
 
-          /*--- Update the queue with the new control volume (remove the CV and
-           increase the priority of the neighbors) ---*/
+            /*--- Update the queue with the new control volume (remove the CV and
+             increase the priority of the neighbors) ---*/
 
-          MGQueue_InnerCV.Update(CVPoint, fine_grid);
+            MGQueue_InnerCV.Update(CVPoint, fine_grid);
+          }
         }
-      }
 
-      /*--- Update the number of control of childrens ---*/
+        /*--- Update the number of control of childrens ---*/
 
-      nodes->SetnChildren_CV(Index_CoarseCV, nChildren);
-      Index_CoarseCV++;
-    } else {
-      /*--- The seed point can not be agglomerated because of size, domain, streching, etc.
-       move the point to the lowest priority ---*/
+        nodes->SetnChildren_CV(Index_CoarseCV, nChildren);
+        Index_CoarseCV++;
+      } else {
+        /*--- The seed point can not be agglomerated because of size, domain, streching, etc.
+         move the point to the lowest priority ---*/
 
-      MGQueue_InnerCV.MoveCV(iPoint, -1);
+        MGQueue_InnerCV.MoveCV(iPoint, -1);
+      }
     }
   }
 
@@ -688,6 +697,203 @@ void CMultiGridGeometry::SetSuitableNeighbors(vector<unsigned long>& Suitable_In
   Suitable_Indirect_Neighbors.resize(it2 - Suitable_Indirect_Neighbors.begin());
 }
 
+void CMultiGridGeometry::ParallelAgglomeration(unsigned long& Index_CoarseCV, CGeometry* fine_grid,
+                                               const CConfig* config) {
+  /*--- The seeds of each round form a distance-2 independent set of the points that can still be
+   agglomerated, i.e. no two seeds share a neighbor, therefore each seed can take its neighbors
+   without conflicts. As in the queue, points with more agglomerated neighbors are preferred, ties
+   are broken with a hash of the index, this makes the result independent of the number of threads.
+   The rounds continue until there are no candidates left. ---*/
+
+  const auto nPointFine = fine_grid->GetnPoint();
+  const auto* fine_nodes = fine_grid->nodes;
+
+  constexpr auto NONE = std::numeric_limits<unsigned long>::max();
+  constexpr auto BOUNDARY = NONE - 1;
+  enum : char { IGNORED, UNDECIDED, SEED, REJECTED };
+
+  /*--- Seed that owns each point (or NONE / BOUNDARY), priority of the candidates, and best
+   candidate in the direct neighborhood of each point. ---*/
+  vector<unsigned long> owner(nPointFine), priority(nPointFine), best(nPointFine);
+  vector<char> status(nPointFine), eligible(nPointFine), nearSeed(nPointFine), indirect(nPointFine, false);
+
+  /*--- Total order used to select the seeds, NONE is last. ---*/
+  auto Precedes = [&priority](unsigned long iPoint, unsigned long jPoint) {
+    if (iPoint == NONE) return false;
+    if (jPoint == NONE) return true;
+    return (priority[iPoint] > priority[jPoint]) || (priority[iPoint] == priority[jPoint] && iPoint < jPoint);
+  };
+
+  /*--- 24-bit integer hash (splitmix64 finalizer). ---*/
+  auto Hash = [](unsigned long iPoint) {
+    uint64_t x = iPoint + 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return static_cast<unsigned long>((x ^ (x >> 31)) >> 40);
+  };
+
+  /*--- Shared counters, they are reset between barriers, after all threads have used them. ---*/
+  unsigned long nCandidates = 0, nUndecided = 0;
+
+  SU2_OMP_PARALLEL {
+    vector<unsigned long> indirectSeeds;
+
+    SU2_OMP_FOR_STAT(256)
+    for (auto iPoint = 0ul; iPoint < nPointFine; iPoint++) {
+      const bool agglomerated = fine_nodes->GetAgglomerate(iPoint);
+      owner[iPoint] = agglomerated ? BOUNDARY : NONE;
+      eligible[iPoint] = !agglomerated && fine_nodes->GetDomain(iPoint) && GeometricalCheck(iPoint, fine_grid, config);
+    }
+    END_SU2_OMP_FOR
+
+    while (true) {
+      /*--- Candidates of this round and their priority. ---*/
+
+      SU2_OMP_FOR_(schedule(static, 256) reduction(+ : nCandidates))
+      for (auto iPoint = 0ul; iPoint < nPointFine; iPoint++) {
+        status[iPoint] = IGNORED;
+        if (!eligible[iPoint] || owner[iPoint] != NONE) continue;
+
+        unsigned long nAgglomerated = 0;
+        for (auto jPoint : fine_nodes->GetPoints(iPoint)) nAgglomerated += (owner[jPoint] != NONE);
+
+        priority[iPoint] = (min(nAgglomerated, 255ul) << 24) | Hash(iPoint);
+        status[iPoint] = UNDECIDED;
+        ++nCandidates;
+      }
+      END_SU2_OMP_FOR
+
+      if (nCandidates == 0) break;
+
+      /*--- Distance-2 independent set. A candidate becomes a seed if it precedes all undecided
+       candidates within distance 2, candidates within distance 2 of a seed are rejected. ---*/
+
+      do {
+        SU2_OMP_FOR_STAT(256)
+        for (auto iPoint = 0ul; iPoint < nPointFine; iPoint++) {
+          auto iBest = (status[iPoint] == UNDECIDED) ? iPoint : NONE;
+          for (auto jPoint : fine_nodes->GetPoints(iPoint)) {
+            if (status[jPoint] == UNDECIDED && Precedes(jPoint, iBest)) iBest = jPoint;
+          }
+          best[iPoint] = iBest;
+        }
+        END_SU2_OMP_FOR
+
+        SU2_OMP_MASTER
+        nUndecided = 0;
+        END_SU2_OMP_MASTER
+
+        SU2_OMP_FOR_STAT(256)
+        for (auto iPoint = 0ul; iPoint < nPointFine; iPoint++) {
+          if (status[iPoint] != UNDECIDED) continue;
+          auto iBest = best[iPoint];
+          for (auto jPoint : fine_nodes->GetPoints(iPoint)) {
+            if (Precedes(best[jPoint], iBest)) iBest = best[jPoint];
+          }
+          if (iBest == iPoint) status[iPoint] = SEED;
+        }
+        END_SU2_OMP_FOR
+
+        SU2_OMP_FOR_STAT(256)
+        for (auto iPoint = 0ul; iPoint < nPointFine; iPoint++) {
+          bool seed = (status[iPoint] == SEED);
+          for (auto jPoint : fine_nodes->GetPoints(iPoint)) seed |= (status[jPoint] == SEED);
+          nearSeed[iPoint] = seed;
+        }
+        END_SU2_OMP_FOR
+
+        SU2_OMP_FOR_(schedule(static, 256) reduction(+ : nUndecided))
+        for (auto iPoint = 0ul; iPoint < nPointFine; iPoint++) {
+          if (status[iPoint] != UNDECIDED) continue;
+          bool reject = nearSeed[iPoint];
+          for (auto jPoint : fine_nodes->GetPoints(iPoint)) reject |= nearSeed[jPoint];
+          if (reject) {
+            status[iPoint] = REJECTED;
+          } else {
+            ++nUndecided;
+          }
+        }
+        END_SU2_OMP_FOR
+      } while (nUndecided != 0);
+
+      SU2_OMP_MASTER
+      nCandidates = 0;
+      END_SU2_OMP_MASTER
+
+      /*--- The seeds take their direct neighbors, these are not shared with other seeds. ---*/
+
+      SU2_OMP_FOR_STAT(256)
+      for (auto iPoint = 0ul; iPoint < nPointFine; iPoint++) {
+        if (status[iPoint] != SEED) continue;
+        owner[iPoint] = iPoint;
+        for (auto jPoint : fine_nodes->GetPoints(iPoint)) {
+          if (eligible[jPoint] && owner[jPoint] == NONE) owner[jPoint] = iPoint;
+        }
+      }
+      END_SU2_OMP_FOR
+
+      /*--- Indirect neighbors (quads and hexs), second neighbors of a seed reached via two or more of
+       its first neighbors, see SetSuitableNeighbors. Each point selects the seed that precedes the
+       others, instead of the seeds selecting points, to avoid conflicts. ---*/
+
+      SU2_OMP_FOR_DYN(256)
+      for (auto iPoint = 0ul; iPoint < nPointFine; iPoint++) {
+        if (owner[iPoint] != NONE || !fine_nodes->GetDomain(iPoint)) continue;
+
+        indirectSeeds.clear();
+        for (auto jPoint : fine_nodes->GetPoints(iPoint)) {
+          for (auto kPoint : fine_nodes->GetPoints(jPoint)) {
+            if (status[kPoint] == SEED && fine_nodes->GetAgglomerate_Indirect(kPoint)) indirectSeeds.push_back(kPoint);
+          }
+        }
+        sort(indirectSeeds.begin(), indirectSeeds.end());
+
+        auto iBest = NONE;
+        for (auto it = indirectSeeds.begin(); it != indirectSeeds.end();) {
+          const auto seed = *it;
+          const auto last = upper_bound(it, indirectSeeds.end(), seed);
+          const auto points = fine_nodes->GetPoints(iPoint);
+          const bool firstNeighbor = find(points.begin(), points.end(), seed) != points.end();
+          if (last - it > 1 && !firstNeighbor && Precedes(seed, iBest)) iBest = seed;
+          it = last;
+        }
+        if (iBest != NONE) {
+          owner[iPoint] = iBest;
+          indirect[iPoint] = true;
+        }
+      }
+      END_SU2_OMP_FOR
+    }
+  }
+  END_SU2_OMP_PARALLEL
+
+  /*--- Create the coarse control volumes, the seed is the first child. ---*/
+
+  for (auto iPoint = 0ul; iPoint < nPointFine; iPoint++) {
+    if (owner[iPoint] != iPoint) continue;
+    fine_grid->nodes->SetParent_CV(iPoint, Index_CoarseCV);
+    nodes->SetChildren_CV(Index_CoarseCV, 0, iPoint);
+    nodes->SetnChildren_CV(Index_CoarseCV, 1);
+    Index_CoarseCV++;
+  }
+
+  for (auto iPoint = 0ul; iPoint < nPointFine; iPoint++) {
+    const auto seed = owner[iPoint];
+    if (seed >= BOUNDARY || seed == iPoint) continue;
+
+    const auto iCoarsePoint = fine_grid->nodes->GetParent_CV(seed);
+    const auto nChildren = nodes->GetnChildren_CV(iCoarsePoint);
+    fine_grid->nodes->SetParent_CV(iPoint, iCoarsePoint);
+    nodes->SetChildren_CV(iCoarsePoint, nChildren, iPoint);
+    nodes->SetnChildren_CV(iCoarsePoint, nChildren + 1);
+
+    /*--- The indirect agglomeration information is inherited as in the sequential algorithm. ---*/
+
+    if (indirect[iPoint] && fine_grid->nodes->GetAgglomerate_Indirect(iPoint))
+      nodes->SetAgglomerate_Indirect(iCoarsePoint, true);
+  }
+}
+
 void CMultiGridGeometry::SetPoint_Connectivity(const CGeometry* fine_grid) {
   /*--- Temporary, CPoint (nodes) then compresses this structure. ---*/
   vector<vector<unsigned long> > points(nPoint);
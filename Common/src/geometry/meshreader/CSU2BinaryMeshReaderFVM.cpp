@@ -0,0 +1,367 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.cpp
+ * \brief Reads a native SU2 binary grid into linear partitions for the
+ *        finite volume solver (FVM).
+ * \author T. Economon
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+
+CSU2BinaryMeshReaderFVM::CSU2BinaryMeshReaderFVM(CConfig* val_config, unsigned short val_iZone,
+                                                 unsigned short val_nZone)
+    : CMeshReaderFVM(val_config, val_iZone, val_nZone), meshFilename(config->GetMesh_FileName()) {
+  if (val_nZone > 1 && config->GetMultizone_Mesh()) {
+    SU2_MPI::Error(
+        "SU2 binary mesh files contain a single zone.\n"
+        "Use one mesh file per zone (MULTIZONE_MESH= NO).",
+        CURRENT_FUNCTION);
+  }
+
+  const bool actuator_disk =
+      (((config->GetnMarker_ActDiskInlet() != 0) || (config->GetnMarker_ActDiskOutlet() != 0)) &&
+       ((config->GetKind_SU2() == SU2_COMPONENT::SU2_CFD) ||
+        ((config->GetKind_SU2() == SU2_COMPONENT::SU2_DEF) && (config->GetActDisk_SU2_DEF()))));
+  if (actuator_disk && !config->GetActDisk_DoubleSurface()) {
+    SU2_MPI::Error(
+        "Actuator disks cannot be split when reading SU2 binary meshes.\n"
+        "Use the SU2 ASCII format, or a mesh with double surfaces (repeated points).",
+        CURRENT_FUNCTION);
+  }
+
+  /*--- All ranks open the file, but each one reads only its linear partition of points and elements. ---*/
+
+#ifdef HAVE_MPI
+  if (MPI_File_open(SU2_MPI::GetComm(), meshFilename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &mesh_file)) {
+#else
+  mesh_file.open(meshFilename, ios::in | ios::binary);
+  if (mesh_file.fail()) {
+#endif
+    SU2_MPI::Error(string("Unable to open SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+  }
+
+  ReadMetadata();
+
+  ReadPointCoordinates();
+
+  ReadVolumeElementConnectivity();
+
+  ReadSurfaceElementConnectivity();
+
+#ifdef HAVE_MPI
+  MPI_File_close(&mesh_file);
+#else
+  mesh_file.close();
+#endif
+}
+
+CSU2BinaryMeshReaderFVM::~CSU2BinaryMeshReaderFVM(void) = default;
+
+void CSU2BinaryMeshReaderFVM::ReadBytes(uint64_t offset, uint64_t nBytes, void* buffer) {
+  auto* bytes = static_cast<char*>(buffer);
+  bool fail = false;
+
+  /*--- Large blocks are read in chunks whose size fits in an int. ---*/
+  const uint64_t maxChunk = 1ul << 30;
+
+  for (uint64_t pos = 0; pos < nBytes; pos += maxChunk) {
+    const auto chunk = min(maxChunk, nBytes - pos);
+#ifdef HAVE_MPI
+    MPI_Status status;
+    int count = 0;
+    fail |= (MPI_File_read_at(mesh_file, MPI_Offset(offset + pos), bytes + pos, int(chunk), MPI_BYTE, &status) !=
+             MPI_SUCCESS);
+    MPI_Get_count(&status, MPI_BYTE, &count);
+    fail |= (uint64_t(count) != chunk);
+#else
+    mesh_file.seekg(std::streamoff(offset + pos));
+    mesh_file.read(bytes + pos, std::streamsize(chunk));
+    fail |= mesh_file.fail();
+#endif
+  }
+
+  if (fail) {
+    SU2_MPI::Error(string("Error reading SU2 binary mesh file ") + meshFilename + string(", it may be truncated."),
+                   CURRENT_FUNCTION);
+  }
+}
+
+void CSU2BinaryMeshReaderFVM::ReadMetadata() {
+  /*--- Only the master reads the header, which is then broadcast to all ranks. ---*/
+
+  if (rank == MASTER_NODE) ReadBytes(0, HEADER_SIZE * sizeof(uint64_t), header.data());
+
+  SU2_MPI::Bcast(header.data(), HEADER_SIZE * sizeof(uint64_t), MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
+
+  const auto headerError = CheckHeader(header);
+  if (!headerError.empty()) {
+    SU2_MPI::Error(string("File ") + meshFilename + headerError, CURRENT_FUNCTION);
+  }
+
+  dimension = header[NDIME];
+  numberOfGlobalPoints = header[NPOIN];
+  numberOfGlobalElements = header[NELEM];
+  numberOfMarkers = header[NMARK];
+
+  if ((dimension != 2) && (dimension != 3)) {
+    SU2_MPI::Error(string("Invalid dimension in SU2 binary mesh file ") + meshFilename, CURRENT_FUNCTION);
+  }
+}
+
+void CSU2BinaryMeshReaderFVM::ReadPointCoordinates() {
+  /* Get a partitioner to help with linear partitioning. */
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints, 0);
+
+  /* Determine number of local points */
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+
+  /*--- The coordinates are stored point by point, read the contiguous block of this rank. ---*/
+
+  vector<passivedouble> coordinates(numberOfLocalPoints * dimension);
+
+  const uint64_t offset =
+      header[POINTS] + pointPartitioner.GetFirstIndexOnRank(rank) * dimension * sizeof(passivedouble);
+  ReadBytes(offset, coordinates.size() * sizeof(passivedouble), coordinates.data());
+
+  /* Load into the coordinate class data structure. */
+  localPointCoordinates.resize(dimension);
+  for (int iDim = 0; iDim < dimension; iDim++) {
+    localPointCoordinates[iDim].resize(numberOfLocalPoints);
+    for (auto iPoint = 0ul; iPoint < numberOfLocalPoints; iPoint++) {
+      localPointCoordinates[iDim][iPoint] = coordinates[iPoint * dimension + iDim];
+    }
+  }
+}
+
+void CSU2BinaryMeshReaderFVM::ReadVolumeElementConnectivity() {
+  /*--- Each rank reads a linear partition of the elements, these are then sent to the ranks that own
+   their points in the linear partitioning of the points (as the ASCII reader stores all elements that
+   contain at least one owned point). ---*/
+
+  CLinearPartitioner elementPartitioner(numberOfGlobalElements, 0);
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints, 0);
+
+  const auto firstElem = elementPartitioner.GetFirstIndexOnRank(rank);
+  const auto nElemRead = elementPartitioner.GetSizeOnRank(rank);
+
+  vector<unsigned char> elemTypes(nElemRead);
+  ReadBytes(header[ELEM_TYPES] + firstElem, nElemRead, elemTypes.data());
+
+  vector<uint64_t> elemOffsets(nElemRead + 1);
+  ReadBytes(header[ELEM_OFFSETS] + firstElem * sizeof(uint64_t), elemOffsets.size() * sizeof(uint64_t),
+            elemOffsets.data());
+
+  vector<uint64_t> elemConn(elemOffsets[nElemRead] - elemOffsets[0]);
+  ReadBytes(header[ELEM_CONN] + elemOffsets[0] * sizeof(uint64_t), elemConn.size() * sizeof(uint64_t),
+            elemConn.data());
+
+  /*--- Copy into the standard format per element: [globalID vtkType n0 n1 n2 n3 n4 n5 n6 n7],
+   and count how many elements must be sent to each rank (an element is sent only once per rank). ---*/
+
+  vector<unsigned long> connElemTemp(nElemRead * SU2_CONN_SIZE, 0);
+  vector<int> nElemSend(size, 0), elemFlag(size, -1);
+
+  for (auto iElem = 0ul; iElem < nElemRead; iElem++) {
+    const auto nPointsElem = nPointsOfElementType(elemTypes[iElem]);
+
+    if (elemOffsets[iElem + 1] - elemOffsets[iElem] != nPointsElem) {
+      SU2_MPI::Error(string("Inconsistent element connectivity in SU2 binary mesh file ") + meshFilename,
+                     CURRENT_FUNCTION);
+    }
+
+    auto* conn = &connElemTemp[iElem * SU2_CONN_SIZE];
+    conn[0] = firstElem + iElem;
+    conn[1] = elemTypes[iElem];
+
+    for (unsigned short iNode = 0; iNode < nPointsElem; iNode++) {
+      const auto iPoint = elemConn[elemOffsets[iElem] - elemOffsets[0] + iNode];
+      conn[SU2_CONN_SKIP + iNode] = iPoint;
+
+      const auto iProcessor = pointPartitioner.GetRankContainingIndex(iPoint);
+      if (elemFlag[iProcessor] != int(iElem)) {
+        elemFlag[iProcessor] = iElem;
+        nElemSend[iProcessor]++;
+      }
+    }
+  }
+
+  /*--- Release the file buffers before communicating. ---*/
+
+  vector<unsigned char>().swap(elemTypes);
+  vector<uint64_t>().swap(elemOffsets);
+  vector<uint64_t>().swap(elemConn);
+
+  /*--- Communicate the number of elements to be sent/received amongst all processors. ---*/
+
+  vector<int> nElemRecv(size, 0);
+  SU2_MPI::Alltoall(nElemSend.data(), 1, MPI_INT, nElemRecv.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  /*--- Displacements and counts in terms of values (instead of elements). ---*/
+
+  vector<int> sendCount(size), sendDispl(size + 1, 0), recvCount(size), recvDispl(size + 1, 0);
+  for (int iProcessor = 0; iProcessor < size; iProcessor++) {
+    sendCount[iProcessor] = nElemSend[iProcessor] * SU2_CONN_SIZE;
+    recvCount[iProcessor] = nElemRecv[iProcessor] * SU2_CONN_SIZE;
+    sendDispl[iProcessor + 1] = sendDispl[iProcessor] + sendCount[iProcessor];
+    recvDispl[iProcessor + 1] = recvDispl[iProcessor] + recvCount[iProcessor];
+  }
+
+  /*--- Load the send buffer. ---*/
+
+  vector<unsigned long> connSend(sendDispl[size]);
+  vector<int> index(sendDispl.begin(), sendDispl.end() - 1);
+  elemFlag.assign(size, -1);
+
+  for (auto iElem = 0ul; iElem < nElemRead; iElem++) {
+    const auto* conn = &connElemTemp[iElem * SU2_CONN_SIZE];
+    const auto nPointsElem = nPointsOfElementType(conn[1]);
+
+    for (unsigned short iNode = 0; iNode < nPointsElem; iNode++) {
+      const auto iProcessor = pointPartitioner.GetRankContainingIndex(conn[SU2_CONN_SKIP + iNode]);
+      if (elemFlag[iProcessor] != int(iElem)) {
+        elemFlag[iProcessor] = iElem;
+        for (unsigned short iVal = 0; iVal < SU2_CONN_SIZE; iVal++) connSend[index[iProcessor]++] = conn[iVal];
+      }
+    }
+  }
+  vector<unsigned long>().swap(connElemTemp);
+
+  /*--- Exchange the elements, since the linear partitions of elements are ordered by rank, the elements
+   received by each rank are sorted by global index. ---*/
+
+  localVolumeElementConnectivity.resize(recvDispl[size]);
+
+  SU2_MPI::Alltoallv(connSend.data(), sendCount.data(), sendDispl.data(), MPI_UNSIGNED_LONG,
+                     localVolumeElementConnectivity.data(), recvCount.data(), recvDispl.data(), MPI_UNSIGNED_LONG,
+                     SU2_MPI::GetComm());
+
+  numberOfLocalElements = recvDispl[size] / SU2_CONN_SIZE;
+}
+
+void CSU2BinaryMeshReaderFVM::ReadSurfaceElementConnectivity() {
+  surfaceElementConnectivity.resize(numberOfMarkers);
+  markerNames.resize(numberOfMarkers);
+
+  /*--- The surface connectivity is handled by the master node. ---*/
+
+  if (rank != MASTER_NODE) return;
+
+  uint64_t position = header[MARKERS];
+
+  for (auto iMarker = 0ul; iMarker < numberOfMarkers; ++iMarker) {
+    uint64_t tagLength = 0;
+    ReadBytes(position, sizeof(uint64_t), &tagLength);
+    position += sizeof(uint64_t);
+
+    markerNames[iMarker].resize(tagLength);
+    ReadBytes(position, tagLength, &markerNames[iMarker][0]);
+    position += tagLength;
+
+    if (markerNames[iMarker] == "SEND_RECEIVE") {
+      SU2_MPI::Error(
+          "Mesh file contains deprecated SEND_RECEIVE marker!\n"
+          "Please remove any SEND_RECEIVE markers from the SU2 mesh.",
+          CURRENT_FUNCTION);
+    }
+
+    uint64_t nElem_Bound = 0;
+    ReadBytes(position, sizeof(uint64_t), &nElem_Bound);
+    position += sizeof(uint64_t);
+
+    vector<uint64_t> records(nElem_Bound * BOUND_CONN_SIZE);
+    ReadBytes(position, records.size() * sizeof(uint64_t), records.data());
+    position += records.size() * sizeof(uint64_t);
+
+    auto& connectivity = surfaceElementConnectivity[iMarker];
+    connectivity.resize(nElem_Bound * SU2_CONN_SIZE, 0);
+
+    for (auto iElem_Bound = 0ul; iElem_Bound < nElem_Bound; iElem_Bound++) {
+      const auto* record = &records[iElem_Bound * BOUND_CONN_SIZE];
+      const auto VTK_Type = record[0];
+
+      if (dimension == 3 && VTK_Type == LINE) {
+        SU2_MPI::Error(
+            "Line boundary conditions are not possible for 3D calculations.\n"
+            "Please check the SU2 binary mesh file.",
+            CURRENT_FUNCTION);
+      }
+
+      auto* conn = &connectivity[iElem_Bound * SU2_CONN_SIZE];
+      conn[1] = VTK_Type;
+      for (unsigned short iNode = 0; iNode < nPointsOfElementType(VTK_Type); iNode++) {
+        conn[SU2_CONN_SKIP + iNode] = record[1 + iNode];
+      }
+    }
+  }
+}
+
+string CSU2BinaryMeshReaderFVM::CheckHeader(const std::array<uint64_t, HEADER_SIZE>& fileHeader) {
+  /*--- The marker of a file written with the other byte order reads reversed, check it before the magic
+   number so that the error is not reported as an unknown file type. ---*/
+
+  constexpr uint64_t swappedMark = 0x0807060504030201;
+
+  if (fileHeader[ENDIANNESS] == swappedMark) {
+    return " was written on a machine with a different byte order (endianness).";
+  }
+  if (fileHeader[MAGIC] != MAGIC_NUMBER) {
+    return " is not an SU2 binary mesh file.";
+  }
+  if (fileHeader[VERSION] != FORMAT_VERSION) {
+    return " was written by a different version of SU2, convert the mesh again.";
+  }
+  if (fileHeader[ENDIANNESS] != BYTE_ORDER_MARK) {
+    return " has an invalid byte order marker, it may be corrupted.";
+  }
+  return "";
+}
+
+std::array<uint64_t, CSU2BinaryMeshReaderFVM::HEADER_SIZE> CSU2BinaryMeshReaderFVM::ReadFileHeader(
+    const string& val_filename) {
+  ifstream mesh_file(val_filename, ios::in | ios::binary);
+  if (mesh_file.fail()) {
+    SU2_MPI::Error(string("The SU2 binary mesh file named ") + val_filename + string(" was not found."),
+                   CURRENT_FUNCTION);
+  }
+
+  std::array<uint64_t, HEADER_SIZE> fileHeader{};
+  mesh_file.read(reinterpret_cast<char*>(fileHeader.data()), HEADER_SIZE * sizeof(uint64_t));
+
+  if (mesh_file.fail()) {
+    SU2_MPI::Error(val_filename + string(" is not an SU2 binary mesh file."), CURRENT_FUNCTION);
+  }
+  const auto headerError = CheckHeader(fileHeader);
+  if (!headerError.empty()) {
+    SU2_MPI::Error(val_filename + headerError, CURRENT_FUNCTION);
+  }
+  return fileHeader;
+}
+
+unsigned short CSU2BinaryMeshReaderFVM::ReadDimension(const string& val_filename) {
+  return ReadFileHeader(val_filename)[NDIME];
+}
+
+unsigned long CSU2BinaryMeshReaderFVM::ReadNumberOfElements(const string& val_filename) {
+  return ReadFileHeader(val_filename)[NELEM];
+}
@@ -41,6 +41,10 @@ void CBSplineBlending::SetOrder(short val_order, short n_controlpoints) {
   Degree = Order - 1;
   nControl = n_controlpoints;
 
+  if (Order > MAX_ORDER) {
+    SU2_MPI::Error("The order of the BSplines cannot exceed " + to_string(MAX_ORDER) + ".", CURRENT_FUNCTION);
+  }
+
   KnotSize = Order + nControl;
 
   U.resize(KnotSize, 0.0);
@@ -57,10 +61,6 @@ void CBSplineBlending::SetOrder(short val_order, short n_controlpoints) {
   for (iKnot = nControl - Order; iKnot < nControl; iKnot++) {
     U[Order + iKnot] = 1.0;
   }
-
-  /*--- Allocate the temporary vectors for the basis evaluation ---*/
-
-  N.resize(Order, vector<su2double>(Order, 0.0));
 }
 
 su2double CBSplineBlending::GetBasis(short val_i, su2double val_t) {
@@ -78,6 +78,11 @@ su2double CBSplineBlending::GetBasis(short val_i, su2double val_t) {
     return 0.0;
   }
 
+  su2double N[MAX_ORDER][MAX_ORDER];
+  return EvalBasis(val_i, val_t, N);
+}
+
+su2double CBSplineBlending::EvalBasis(short val_i, su2double val_t, su2double N[][MAX_ORDER]) const {
   unsigned short j, k;
   su2double saved, temp;
 
@@ -114,7 +119,8 @@ su2double CBSplineBlending::GetDerivative(short val_i, su2double val_t, short va
 
   /*--- Evaluate the i+p basis functions up to the order p (stored in the matrix N). ---*/
 
-  GetBasis(val_i, val_t);
+  su2double N[MAX_ORDER][MAX_ORDER];
+  EvalBasis(val_i, val_t, N);
 
   /*--- Use the recursive definition for the derivative (hardcoded for 1st and 2nd derivative). ---*/
 
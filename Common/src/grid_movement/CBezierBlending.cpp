@@ -35,7 +35,6 @@ CBezierBlending::~CBezierBlending() = default;
 void CBezierBlending::SetOrder(short val_order, short n_controlpoints) {
   Order = val_order;
   Degree = Order - 1;
-  binomial.resize(Order + 1, 0.0);
 }
 
 su2double CBezierBlending::GetBasis(short val_i, su2double val_t) { return GetBernstein(Degree, val_i, val_t); }
@@ -102,21 +101,14 @@ su2double CBezierBlending::GetBernsteinDerivative(short val_n, short val_i, su2d
 }
 
 su2double CBezierBlending::Binomial(unsigned short n, unsigned short m) {
-  unsigned short i, j;
-  su2double result;
-
-  binomial[0] = 1.0;
-  for (i = 1; i <= n; ++i) {
-    binomial[i] = 1.0;
-    for (j = i - 1U; j > 0; --j) {
-      binomial[j] += binomial[j - 1U];
-    }
-  }
+  if (m > n) return 0.0;
 
-  result = binomial[m];
-  if (fabs(result) < EPS * EPS) {
-    result = 0.0;
-  }
+  /*--- Multiplicative formula in floating point, integer partial products overflow for large n. ---*/
 
+  m = min(m, static_cast<unsigned short>(n - m));
+  passivedouble result = 1.0;
+  for (unsigned short i = 1; i <= m; ++i) {
+    result *= passivedouble(n - m + i) / i;
+  }
   return result;
 }
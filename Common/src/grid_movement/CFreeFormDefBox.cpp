@@ -30,6 +30,8 @@
 #include "../../include/grid_movement/CBSplineBlending.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 
+#include <random>
+
 CFreeFormDefBox::CFreeFormDefBox() : CGridMovement() {}
 
 CFreeFormDefBox::CFreeFormDefBox(const unsigned short Degree[], unsigned short BSplineOrder[],
@@ -52,7 +54,9 @@ CFreeFormDefBox::CFreeFormDefBox(const unsigned short Degree[], unsigned short B
   ParamCoord_ = new su2double[nDim];
   cart_coord = new su2double[nDim];
   cart_coord_ = new su2double[nDim];
-  Gradient = new su2double[nDim];
+
+  if (max(Degree[0], max(Degree[1], Degree[2])) > MAX_DEGREE)
+    SU2_MPI::Error("The degree of FFD boxes is limited to " + to_string(MAX_DEGREE) + ".", CURRENT_FUNCTION);
 
   lDegree = Degree[0];
   lOrder = lDegree + 1;
@@ -139,7 +143,6 @@ CFreeFormDefBox::~CFreeFormDefBox() {
   delete[] ParamCoord_;
   delete[] cart_coord;
   delete[] cart_coord_;
-  delete[] Gradient;
 
   for (iCornerPoints = 0; iCornerPoints < nCornerPoints; iCornerPoints++) delete[] Coord_Corner_Points[iCornerPoints];
   delete[] Coord_Corner_Points;
@@ -811,24 +814,36 @@ su2double* CFreeFormDefBox::GetParametricCoord_Analytical(const su2double* cart_
 }
 
 su2double* CFreeFormDefBox::EvalCartesianCoord(su2double* ParamCoord) const {
+  EvalCartesianCoord(ParamCoord, cart_coord);
+  return cart_coord;
+}
+
+void CFreeFormDefBox::EvalCartesianCoord(const su2double* ParamCoord, su2double* CartCoord) const {
   unsigned short iDim, iDegree, jDegree, kDegree;
 
-  for (iDim = 0; iDim < nDim; iDim++) cart_coord[iDim] = 0.0;
+  /*--- Evaluate the basis functions of each direction once, instead of once per control point. ---*/
+
+  su2double basis_l[MAX_DEGREE + 1], basis_m[MAX_DEGREE + 1], basis_n[MAX_DEGREE + 1];
+
+  for (iDegree = 0; iDegree <= lDegree; iDegree++)
+    basis_l[iDegree] = BlendingFunction[0]->GetBasis(iDegree, ParamCoord[0]);
+  for (jDegree = 0; jDegree <= mDegree; jDegree++)
+    basis_m[jDegree] = BlendingFunction[1]->GetBasis(jDegree, ParamCoord[1]);
+  for (kDegree = 0; kDegree <= nDegree; kDegree++)
+    basis_n[kDegree] = BlendingFunction[2]->GetBasis(kDegree, ParamCoord[2]);
+
+  for (iDim = 0; iDim < nDim; iDim++) CartCoord[iDim] = 0.0;
 
   for (iDegree = 0; iDegree <= lDegree; iDegree++)
     for (jDegree = 0; jDegree <= mDegree; jDegree++)
       for (kDegree = 0; kDegree <= nDegree; kDegree++)
         for (iDim = 0; iDim < nDim; iDim++) {
-          cart_coord[iDim] += Coord_Control_Points[iDegree][jDegree][kDegree][iDim] *
-                              BlendingFunction[0]->GetBasis(iDegree, ParamCoord[0]) *
-                              BlendingFunction[1]->GetBasis(jDegree, ParamCoord[1]) *
-                              BlendingFunction[2]->GetBasis(kDegree, ParamCoord[2]);
+          CartCoord[iDim] += Coord_Control_Points[iDegree][jDegree][kDegree][iDim] * basis_l[iDegree] *
+                             basis_m[jDegree] * basis_n[kDegree];
         }
-
-  return cart_coord;
 }
 
-su2double* CFreeFormDefBox::GetFFDGradient(su2double* val_coord, su2double* xyz) {
+void CFreeFormDefBox::GetFFDGradient(su2double* val_coord, const su2double* xyz, su2double* gradient) const {
   unsigned short iDim, jDim, lmn[3];
 
   /*--- Set the Degree of the spline ---*/
@@ -837,16 +852,14 @@ su2double* CFreeFormDefBox::GetFFDGradient(su2double* val_coord, su2double* xyz)
   lmn[1] = mDegree;
   lmn[2] = nDegree;
 
-  for (iDim = 0; iDim < nDim; iDim++) Gradient[iDim] = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++) gradient[iDim] = 0.0;
 
   for (iDim = 0; iDim < nDim; iDim++)
     for (jDim = 0; jDim < nDim; jDim++)
-      Gradient[jDim] += GetDerivative2(val_coord, iDim, xyz, lmn) * GetDerivative3(val_coord, iDim, jDim, lmn);
-
-  return Gradient;
+      gradient[jDim] += GetDerivative2(val_coord, iDim, xyz, lmn) * GetDerivative3(val_coord, iDim, jDim, lmn);
 }
 
-void CFreeFormDefBox::GetFFDHessian(su2double* uvw, su2double* xyz, su2double** val_Hessian) {
+void CFreeFormDefBox::GetFFDHessian(su2double* uvw, const su2double* xyz, su2double val_Hessian[][3]) const {
   unsigned short iDim, jDim, lmn[3];
 
   /*--- Set the Degree of the spline ---*/
@@ -888,8 +901,15 @@ void CFreeFormDefBox::GetFFDHessian(su2double* uvw, su2double* xyz, su2double**
 
 su2double* CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, su2double* xyz,
                                                          const su2double* ParamCoordGuess, CConfig* config) {
-  su2double *IndepTerm, SOR_Factor = 1.0, MinNormError, NormError, Determinant, AdjHessian[3][3],
-                        Temp[3] = {0.0, 0.0, 0.0};
+  GetParametricCoord_Iterative(iPoint, xyz, ParamCoordGuess, config, ParamCoord);
+  return ParamCoord;
+}
+
+void CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, const su2double* xyz,
+                                                   const su2double* ParamCoordGuess, const CConfig* config,
+                                                   su2double* ParamCoord) const {
+  su2double SOR_Factor = 1.0, MinNormError, NormError, Determinant, AdjHessian[3][3], Temp[3] = {0.0, 0.0, 0.0};
+  su2double Gradient[3], Hessian[3][3], IndepTerm[3];
   unsigned short iDim, jDim, RandonCounter;
   unsigned long iter;
 
@@ -897,12 +917,12 @@ su2double* CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
   unsigned short it_max = config->GetnFFD_Iter();
   unsigned short Random_Trials = 500;
 
-  /*--- Allocate the Hessian ---*/
+  /*--- The random restarts are seeded by the point, the result does not depend on the evaluation order. ---*/
+
+  std::mt19937 RandomGenerator(iPoint);
+  std::uniform_real_distribution<passivedouble> RandomDistribution(0.0, 1.0);
 
-  Hessian = new su2double*[nDim];
-  IndepTerm = new su2double[nDim];
   for (iDim = 0; iDim < nDim; iDim++) {
-    Hessian[iDim] = new su2double[nDim];
     ParamCoord[iDim] = ParamCoordGuess[iDim];
     IndepTerm[iDim] = 0.0;
   }
@@ -915,7 +935,7 @@ su2double* CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
   for (iter = 0; iter < (unsigned long)it_max * Random_Trials; iter++) {
     /*--- The independent term of the solution of our system is -Gradient(sol_old) ---*/
 
-    Gradient = GetFFDGradient(ParamCoord, xyz);
+    GetFFDGradient(ParamCoord, xyz, Gradient);
 
     for (iDim = 0; iDim < nDim; iDim++) IndepTerm[iDim] = -Gradient[iDim];
 
@@ -982,7 +1002,7 @@ su2double* CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
              << "). Min Error: " << MinNormError << ". Iter: " << iter << "." << endl;
       } else {
         SOR_Factor = 0.1;
-        for (iDim = 0; iDim < nDim; iDim++) ParamCoord[iDim] = su2double(rand()) / su2double(RAND_MAX);
+        for (iDim = 0; iDim < nDim; iDim++) ParamCoord[iDim] = RandomDistribution(RandomGenerator);
       }
     }
 
@@ -999,20 +1019,12 @@ su2double* CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
     }
   }
 
-  for (iDim = 0; iDim < nDim; iDim++) delete[] Hessian[iDim];
-  delete[] Hessian;
-  delete[] IndepTerm;
-
   /*--- The code has hit the max number of iterations ---*/
 
   if (iter == (unsigned long)it_max * Random_Trials) {
     cout << "Unknown point: (" << xyz[0] << ", " << xyz[1] << ", " << xyz[2]
          << "). Increase the value of FFD_ITERATIONS." << endl;
   }
-
-  /*--- Real Solution is now ParamCoord; Return it ---*/
-
-  return ParamCoord;
 }
 
 bool CFreeFormDefBox::CheckPointInsideFFD(const su2double* coord) const {
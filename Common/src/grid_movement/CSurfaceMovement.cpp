@@ -26,6 +26,7 @@
  */
 
 #include "../../include/grid_movement/CSurfaceMovement.hpp"
+#include "../../include/geometry/CGeometryCache.hpp"
 #include "../../include/toolboxes/C1DInterpolation.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 
@@ -103,6 +104,10 @@ vector<vector<su2double> > CSurfaceMovement::SetSurface_Deformation(CGeometry* g
 
       FFDBox_unitary.SetControlPoints_Parallelepiped();
 
+      /*--- The parametric coordinates may be cached with the other data derived from the mesh. ---*/
+
+      CGeometryCache geometryCache(config);
+
       for (iFFDBox = 0; iFFDBox < GetnFFDBox(); iFFDBox++) {
         /*--- Compute the support control points for the final FFD using the unitary box ---*/
 
@@ -115,7 +120,7 @@ vector<vector<su2double> > CSurfaceMovement::SetSurface_Deformation(CGeometry* g
         /*--- Compute the parametric coordinates, it also find the points in
          the FFDBox using the parametrics coordinates ---*/
 
-        SetParametricCoord(geometry, config, FFDBox[iFFDBox], iFFDBox);
+        SetParametricCoord(geometry, config, FFDBox[iFFDBox], iFFDBox, &geometryCache);
 
         /*--- If polar coordinates, transform the corners and control points to cartesians ---*/
 
@@ -127,6 +132,8 @@ vector<vector<su2double> > CSurfaceMovement::SetSurface_Deformation(CGeometry* g
           FFDBox[iFFDBox]->SetSphe2Cart_ControlPoints(config);
         }
       }
+      geometryCache.Write();
+
       /*--- Output original FFD FFDBox ---*/
 
       if (rank == MASTER_NODE) {
@@ -717,7 +724,7 @@ void CSurfaceMovement::CopyBoundary(CGeometry* geometry, CConfig* config) {
 }
 
 void CSurfaceMovement::SetParametricCoord(CGeometry* geometry, CConfig* config, CFreeFormDefBox* FFDBox,
-                                          unsigned short iFFDBox) {
+                                          unsigned short iFFDBox, CGeometryCache* cache) {
   const auto nDim = geometry->GetnDim();
   const bool cartesian = (config->GetFFD_CoordSystem() == CARTESIAN);
   const bool cylindrical = (config->GetFFD_CoordSystem() == CYLINDRICAL);
@@ -766,7 +773,6 @@ void CSurfaceMovement::SetParametricCoord(CGeometry* geometry, CConfig* config,
   unsigned long TotalVertex = 0;
   unsigned long VisitedVertex = 0;
   unsigned long MappedVertex = 0;
-  su2double ParamCoordGuess[3] = {0.5, 0.5, 0.5};
 
   /*--- Check that the box is defined correctly for the preliminary point containment check,
    * by checking that the midpoint of the box is considered to be inside it. ---*/
@@ -797,96 +803,223 @@ void CSurfaceMovement::SetParametricCoord(CGeometry* geometry, CConfig* config,
                    CURRENT_FUNCTION);
   }
 
+  /*--- Gather the vertices of the DV markers. ---*/
+
+  vector<unsigned short> VertexMarker;
+  vector<unsigned long> VertexIndex;
+
   for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
     if (config->GetMarker_All_DV(iMarker) == YES) {
-      TotalVertex += geometry->nVertex[iMarker];
-
       for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        /*--- Get the cartesian coordinates ---*/
+        VertexMarker.push_back(iMarker);
+        VertexIndex.push_back(iVertex);
+      }
+    }
+  }
+  TotalVertex = VertexIndex.size();
 
-        su2double CartCoord[3] = {};
-        for (auto iDim = 0u; iDim < nDim; iDim++) CartCoord[iDim] = geometry->vertex[iMarker][iVertex]->GetCoord(iDim);
+  /*--- Status of each vertex, outside the box, inside the box (visited), or mapped to the box. ---*/
 
-        /*--- Transform the cartesian into polar ---*/
+  enum : unsigned short { OUTSIDE = 0, VISITED = 1, MAPPED = 2 };
+  vector<unsigned short> Status(TotalVertex, OUTSIDE);
+  vector<su2double> Diffs(TotalVertex, 0.0);
+  su2activematrix CartCoords(TotalVertex, 3), ParamCoords(TotalVertex, 3);
 
-        if (!cartesian) {
-          const su2double X_0 = config->GetFFD_Axis(0);
-          const su2double Y_0 = config->GetFFD_Axis(1);
-          const su2double Z_0 = config->GetFFD_Axis(2);
+  SU2_OMP_PARALLEL_(for schedule(static, 256))
+  for (auto iVertexDV = 0ul; iVertexDV < TotalVertex; iVertexDV++) {
+    const auto* vertex = geometry->vertex[VertexMarker[iVertexDV]][VertexIndex[iVertexDV]];
 
-          const su2double Xbar = CartCoord[0] - X_0;
-          const su2double Ybar = CartCoord[1] - Y_0;
-          const su2double Zbar = CartCoord[2] - Z_0;
+    /*--- Get the cartesian coordinates ---*/
 
-          CartCoord[1] = atan2(Zbar, Ybar);
-          if (CartCoord[1] > PI_NUMBER / 2.0) CartCoord[1] -= 2.0 * PI_NUMBER;
+    su2double* CartCoord = CartCoords[iVertexDV];
+    for (auto iDim = 0u; iDim < 3; iDim++) CartCoord[iDim] = (iDim < nDim) ? vertex->GetCoord(iDim) : su2double(0.0);
 
-          if (cylindrical) {
-            CartCoord[0] = sqrt(Ybar * Ybar + Zbar * Zbar);
-            CartCoord[2] = Xbar;
-          } else if (spherical || polar) {
-            CartCoord[0] = sqrt(Xbar * Xbar + Ybar * Ybar + Zbar * Zbar);
-            CartCoord[2] = acos(Xbar / CartCoord[0]);
-          }
-        }
+    /*--- Transform the cartesian into polar ---*/
+
+    if (!cartesian) {
+      const su2double X_0 = config->GetFFD_Axis(0);
+      const su2double Y_0 = config->GetFFD_Axis(1);
+      const su2double Z_0 = config->GetFFD_Axis(2);
+
+      const su2double Xbar = CartCoord[0] - X_0;
+      const su2double Ybar = CartCoord[1] - Y_0;
+      const su2double Zbar = CartCoord[2] - Z_0;
+
+      CartCoord[1] = atan2(Zbar, Ybar);
+      if (CartCoord[1] > PI_NUMBER / 2.0) CartCoord[1] -= 2.0 * PI_NUMBER;
+
+      if (cylindrical) {
+        CartCoord[0] = sqrt(Ybar * Ybar + Zbar * Zbar);
+        CartCoord[2] = Xbar;
+      } else if (spherical || polar) {
+        CartCoord[0] = sqrt(Xbar * Xbar + Ybar * Ybar + Zbar * Zbar);
+        CartCoord[2] = acos(Xbar / CartCoord[0]);
+      }
+    }
 
-        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    /*--- Only the points inside the FFD need the point inversion. ---*/
 
-        /*--- If the point is inside the FFD, compute the value of the parametric coordinate. ---*/
+    if (FFDBox->CheckPointInsideFFD(CartCoord)) Status[iVertexDV] = VISITED;
+  }
+  END_SU2_OMP_PARALLEL
+
+  /*--- The vertices are inverted in chunks, within which the last point mapped is the initial
+   * guess for the next, the result is therefore independent of the number of threads. ---*/
+
+  constexpr unsigned long CHUNK_SIZE = 64;
+
+  /*--- The parametric coordinates can be reused (GEOMETRY_CACHE= YES) if the surface, the box,
+   * and the options of the point inversion did not change. ---*/
+
+  const bool useCache = (cache != nullptr) && cache->IsEnabled() && !config->GetAD_Mode();
+  const string cacheName = "ffd_parametric_coord_" + FFDBox->GetTag();
+  uint64_t cacheCheck = CGeometryCache::HASH_SEED;
+  vector<uint64_t> cacheData;
+
+  if (useCache) {
+    auto hashValue = [&cacheCheck](su2double value) {
+      const passivedouble passive = SU2_TYPE::GetValue(value);
+      cacheCheck = CGeometryCache::Hash(&passive, sizeof(passivedouble), cacheCheck);
+    };
+    auto hashIndex = [&cacheCheck](uint64_t index) {
+      cacheCheck = CGeometryCache::Hash(&index, sizeof(uint64_t), cacheCheck);
+    };
+
+    hashIndex(CHUNK_SIZE);
+    hashIndex(config->GetFFD_CoordSystem());
+    hashIndex(config->GetFFD_Blending());
+    hashIndex(config->GetnFFD_Iter());
+    hashValue(config->GetFFD_Tol());
+    hashIndex(FFDBox->GetlOrder());
+    hashIndex(FFDBox->GetmOrder());
+    hashIndex(FFDBox->GetnOrder());
+    for (auto iOrder = 0u; iOrder < FFDBox->GetlOrder(); iOrder++)
+      for (auto jOrder = 0u; jOrder < FFDBox->GetmOrder(); jOrder++)
+        for (auto kOrder = 0u; kOrder < FFDBox->GetnOrder(); kOrder++)
+          for (auto iDim = 0u; iDim < 3; iDim++)
+            hashValue(FFDBox->GetCoordControlPoints(iOrder, jOrder, kOrder)[iDim]);
+
+    hashIndex(TotalVertex);
+    for (auto iVertexDV = 0ul; iVertexDV < TotalVertex; iVertexDV++) {
+      hashIndex(VertexMarker[iVertexDV]);
+      hashIndex(VertexIndex[iVertexDV]);
+      for (auto iDim = 0u; iDim < 3; iDim++) hashValue(CartCoords(iVertexDV, iDim));
+    }
+  }
 
-        if (FFDBox->CheckPointInsideFFD(CartCoord)) {
-          /*--- Find the parametric coordinate ---*/
+  /*--- Layout of the cached data: status, parametric coordinates, and difference, for each vertex. ---*/
 
-          ++VisitedVertex;
-          auto* ParamCoord = FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, config);
+  constexpr unsigned long CACHE_STRIDE = 5;
+  const bool cached = useCache && cache->LoadSection(cacheName, cacheCheck, cacheData) &&
+                      (cacheData.size() == CACHE_STRIDE * TotalVertex);
 
-          /*--- Compute the cartesian coordinates using the parametric coordinates
-           to check that everything is correct ---*/
+  if (cached) {
+    for (auto iVertexDV = 0ul; iVertexDV < TotalVertex; iVertexDV++) {
+      const auto* data = &cacheData[CACHE_STRIDE * iVertexDV];
+      passivedouble values[4];
+      memcpy(values, data + 1, sizeof(values));
 
-          const auto* CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+      Status[iVertexDV] = data[0];
+      for (auto iDim = 0u; iDim < 3; iDim++) ParamCoords(iVertexDV, iDim) = values[iDim];
+      Diffs[iVertexDV] = values[3];
+    }
+  } else {
+    SU2_OMP_PARALLEL_(for schedule(dynamic, 1))
+    for (auto iChunk = 0ul; iChunk < TotalVertex; iChunk += CHUNK_SIZE) {
+      su2double ParamCoordGuess[3] = {0.5, 0.5, 0.5};
 
-          /*--- Compute max difference between original value and the recomputed value ---*/
+      for (auto iVertexDV = iChunk; iVertexDV < min(iChunk + CHUNK_SIZE, TotalVertex); iVertexDV++) {
+        if (Status[iVertexDV] == OUTSIDE) continue;
 
-          const su2double Diff = GeometryToolbox::Distance(nDim, CartCoordNew, CartCoord);
-          my_MaxDiff = max(my_MaxDiff, Diff);
+        const auto iPoint = geometry->vertex[VertexMarker[iVertexDV]][VertexIndex[iVertexDV]]->GetNode();
+        const su2double* CartCoord = CartCoords[iVertexDV];
+        su2double* ParamCoord = ParamCoords[iVertexDV];
 
-          /*--- If the parametric coordinates are in (-tol, 1+tol) the point belongs to the FFDBox ---*/
+        /*--- Find the parametric coordinate ---*/
 
-          if (((ParamCoord[0] >= -config->GetFFD_Tol()) && (ParamCoord[0] <= 1.0 + config->GetFFD_Tol())) &&
-              ((ParamCoord[1] >= -config->GetFFD_Tol()) && (ParamCoord[1] <= 1.0 + config->GetFFD_Tol())) &&
-              ((ParamCoord[2] >= -config->GetFFD_Tol()) && (ParamCoord[2] <= 1.0 + config->GetFFD_Tol()))) {
-            /*--- Rectification of the initial tolerance (we have detected situations
-             where 0.0 and 1.0 do not work properly. ---*/
+        FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, config, ParamCoord);
 
-            const su2double lower_limit = config->GetFFD_Tol();
-            const su2double upper_limit = 1.0 - config->GetFFD_Tol();
+        /*--- Compute the cartesian coordinates using the parametric coordinates
+         to check that everything is correct ---*/
 
-            ParamCoord[0] = fmin(fmax(lower_limit, ParamCoord[0]), upper_limit);
-            ParamCoord[1] = fmin(fmax(lower_limit, ParamCoord[1]), upper_limit);
-            ParamCoord[2] = fmin(fmax(lower_limit, ParamCoord[2]), upper_limit);
+        su2double CartCoordNew[3] = {0.0};
+        FFDBox->EvalCartesianCoord(ParamCoord, CartCoordNew);
 
-            /*--- Set the value of the parametric coordinate ---*/
+        /*--- Compute max difference between original value and the recomputed value ---*/
 
-            ++MappedVertex;
-            FFDBox->Set_MarkerIndex(iMarker);
-            FFDBox->Set_VertexIndex(iVertex);
-            FFDBox->Set_PointIndex(iPoint);
-            FFDBox->Set_ParametricCoord(ParamCoord);
-            FFDBox->Set_CartesianCoord(CartCoord);
+        Diffs[iVertexDV] = GeometryToolbox::Distance(nDim, CartCoordNew, CartCoord);
 
-            ParamCoordGuess[0] = ParamCoord[0];
-            ParamCoordGuess[1] = ParamCoord[1];
-            ParamCoordGuess[2] = ParamCoord[2];
-          }
+        /*--- If the parametric coordinates are in (-tol, 1+tol) the point belongs to the FFDBox ---*/
 
-          if (Diff >= config->GetFFD_Tol()) {
-            cout << "Please check this point: Local (" << ParamCoord[0] << " " << ParamCoord[1] << " " << ParamCoord[2]
-                 << ") <-> Global (" << CartCoord[0] << " " << CartCoord[1] << " " << CartCoord[2] << ") <-> Error "
-                 << Diff << " vs " << config->GetFFD_Tol() << "." << endl;
-          }
+        if (((ParamCoord[0] >= -config->GetFFD_Tol()) && (ParamCoord[0] <= 1.0 + config->GetFFD_Tol())) &&
+            ((ParamCoord[1] >= -config->GetFFD_Tol()) && (ParamCoord[1] <= 1.0 + config->GetFFD_Tol())) &&
+            ((ParamCoord[2] >= -config->GetFFD_Tol()) && (ParamCoord[2] <= 1.0 + config->GetFFD_Tol()))) {
+          /*--- Rectification of the initial tolerance (we have detected situations
+           where 0.0 and 1.0 do not work properly. ---*/
+
+          const su2double lower_limit = config->GetFFD_Tol();
+          const su2double upper_limit = 1.0 - config->GetFFD_Tol();
+
+          ParamCoord[0] = fmin(fmax(lower_limit, ParamCoord[0]), upper_limit);
+          ParamCoord[1] = fmin(fmax(lower_limit, ParamCoord[1]), upper_limit);
+          ParamCoord[2] = fmin(fmax(lower_limit, ParamCoord[2]), upper_limit);
+
+          Status[iVertexDV] = MAPPED;
+
+          ParamCoordGuess[0] = ParamCoord[0];
+          ParamCoordGuess[1] = ParamCoord[1];
+          ParamCoordGuess[2] = ParamCoord[2];
         }
       }
     }
+    END_SU2_OMP_PARALLEL
+
+    if (useCache) {
+      cacheData.resize(CACHE_STRIDE * TotalVertex);
+      for (auto iVertexDV = 0ul; iVertexDV < TotalVertex; iVertexDV++) {
+        auto* data = &cacheData[CACHE_STRIDE * iVertexDV];
+        const passivedouble values[] = {
+            SU2_TYPE::GetValue(ParamCoords(iVertexDV, 0)), SU2_TYPE::GetValue(ParamCoords(iVertexDV, 1)),
+            SU2_TYPE::GetValue(ParamCoords(iVertexDV, 2)), SU2_TYPE::GetValue(Diffs[iVertexDV])};
+        data[0] = Status[iVertexDV];
+        memcpy(data + 1, values, sizeof(values));
+      }
+      cache->StoreSection(cacheName, cacheCheck, cacheData);
+    }
+  }
+
+  /*--- Set the values of the parametric coordinates, in the order of the vertices. ---*/
+
+  for (auto iVertexDV = 0ul; iVertexDV < TotalVertex; iVertexDV++) {
+    if (Status[iVertexDV] == OUTSIDE) continue;
+
+    ++VisitedVertex;
+    my_MaxDiff = max(my_MaxDiff, Diffs[iVertexDV]);
+
+    su2double* CartCoord = CartCoords[iVertexDV];
+    su2double* ParamCoord = ParamCoords[iVertexDV];
+
+    if (Status[iVertexDV] == MAPPED) {
+      const auto iMarker = VertexMarker[iVertexDV];
+      const auto iVertex = VertexIndex[iVertexDV];
+
+      ++MappedVertex;
+      FFDBox->Set_MarkerIndex(iMarker);
+      FFDBox->Set_VertexIndex(iVertex);
+      FFDBox->Set_PointIndex(geometry->vertex[iMarker][iVertex]->GetNode());
+      FFDBox->Set_ParametricCoord(ParamCoord);
+      FFDBox->Set_CartesianCoord(CartCoord);
+    }
+
+    if (Diffs[iVertexDV] >= config->GetFFD_Tol()) {
+      cout << "Please check this point: Local (" << ParamCoord[0] << " " << ParamCoord[1] << " " << ParamCoord[2]
+           << ") <-> Global (" << CartCoord[0] << " " << CartCoord[1] << " " << CartCoord[2] << ") <-> Error "
+           << Diffs[iVertexDV] << " vs " << config->GetFFD_Tol() << "." << endl;
+    }
+  }
+
+  if (cached && rank == MASTER_NODE) {
+    cout << "Loaded the parametric coord of FFD box '" << FFDBox->GetTag() << "' from the geometry cache.\n";
   }
 
   su2double MaxDiff = 0.0;
@@ -1483,63 +1616,63 @@ void CSurfaceMovement::CheckFFDIntersections(CGeometry* geometry, CConfig* confi
 
 void CSurfaceMovement::UpdateParametricCoord(CGeometry* geometry, CConfig* config, CFreeFormDefBox* FFDBox,
                                              unsigned short iFFDBox) {
-  unsigned short iMarker, iDim;
-  unsigned long iVertex, iPoint, iSurfacePoints;
-  su2double CartCoord[3] = {0.0, 0.0, 0.0}, *CartCoordNew, *CartCoordOld;
-  su2double *ParamCoord, *var_coord, ParamCoordGuess[3] = {0.0, 0.0, 0.0};
-  su2double MaxDiff, my_MaxDiff = 0.0, Diff;
-
-  /*--- Recompute the parametric coordinates ---*/
+  su2double MaxDiff, my_MaxDiff = 0.0;
 
-  for (iSurfacePoints = 0; iSurfacePoints < FFDBox->GetnSurfacePoint(); iSurfacePoints++) {
-    /*--- Get the marker of the surface point ---*/
+  /*--- Recompute the parametric coordinates, the surface points are independent. ---*/
 
-    iMarker = FFDBox->Get_MarkerIndex(iSurfacePoints);
+  SU2_OMP_PARALLEL {
+    su2double maxDiff = 0.0;
 
-    if (config->GetMarker_All_DV(iMarker) == YES) {
-      /*--- Get the vertex of the surface point ---*/
+    SU2_OMP_FOR_DYN(64)
+    for (auto iSurfacePoints = 0ul; iSurfacePoints < FFDBox->GetnSurfacePoint(); iSurfacePoints++) {
+      /*--- Get the marker of the surface point ---*/
 
-      iVertex = FFDBox->Get_VertexIndex(iSurfacePoints);
-      iPoint = FFDBox->Get_PointIndex(iSurfacePoints);
+      const auto iMarker = FFDBox->Get_MarkerIndex(iSurfacePoints);
 
-      /*--- Get the parametric and cartesians coordinates of the
-       surface point (they don't mach) ---*/
+      if (config->GetMarker_All_DV(iMarker) == YES) {
+        /*--- Get the vertex of the surface point ---*/
 
-      ParamCoord = FFDBox->Get_ParametricCoord(iSurfacePoints);
+        const auto iVertex = FFDBox->Get_VertexIndex(iSurfacePoints);
+        const auto iPoint = FFDBox->Get_PointIndex(iSurfacePoints);
 
-      /*--- Compute and set the cartesian coord using the variation computed
-       with the previous deformation ---*/
+        /*--- Compute and set the cartesian coord using the variation computed
+         with the previous deformation ---*/
 
-      var_coord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
-      CartCoordOld = geometry->nodes->GetCoord(iPoint);
-      for (iDim = 0; iDim < 3; iDim++) CartCoord[iDim] = CartCoordOld[iDim] + var_coord[iDim];
-      FFDBox->Set_CartesianCoord(CartCoord, iSurfacePoints);
+        su2double CartCoord[3] = {0.0, 0.0, 0.0};
+        const su2double* var_coord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
+        const su2double* CartCoordOld = geometry->nodes->GetCoord(iPoint);
+        for (auto iDim = 0u; iDim < 3; iDim++) CartCoord[iDim] = CartCoordOld[iDim] + var_coord[iDim];
+        FFDBox->Set_CartesianCoord(CartCoord, iSurfacePoints);
 
-      /*--- Find the parametric coordinate using as ParamCoordGuess the previous value ---*/
+        /*--- Find the parametric coordinate using as ParamCoordGuess the previous value ---*/
 
-      ParamCoordGuess[0] = ParamCoord[0];
-      ParamCoordGuess[1] = ParamCoord[1];
-      ParamCoordGuess[2] = ParamCoord[2];
-      ParamCoord = FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, config);
+        su2double ParamCoordGuess[3], ParamCoord[3];
+        for (auto iDim = 0u; iDim < 3; iDim++)
+          ParamCoordGuess[iDim] = FFDBox->Get_ParametricCoord(iSurfacePoints, iDim);
+        FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, config, ParamCoord);
 
-      /*--- Set the new value of the parametric coordinates ---*/
+        /*--- Set the new value of the parametric coordinates ---*/
 
-      FFDBox->Set_ParametricCoord(ParamCoord, iSurfacePoints);
+        FFDBox->Set_ParametricCoord(ParamCoord, iSurfacePoints);
 
-      /*--- Compute the cartesian coordinates using the parametric coordinates
-       to check that everything is correct ---*/
+        /*--- Compute the cartesian coordinates using the parametric coordinates
+         to check that everything is correct ---*/
 
-      CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+        su2double CartCoordNew[3];
+        FFDBox->EvalCartesianCoord(ParamCoord, CartCoordNew);
 
-      /*--- Compute max difference between original value and the recomputed value ---*/
+        /*--- Compute max difference between original value and the recomputed value ---*/
 
-      Diff = 0.0;
-      for (iDim = 0; iDim < geometry->GetnDim(); iDim++)
-        Diff += (CartCoordNew[iDim] - CartCoord[iDim]) * (CartCoordNew[iDim] - CartCoord[iDim]);
-      Diff = sqrt(Diff);
-      my_MaxDiff = max(my_MaxDiff, Diff);
+        const su2double Diff = GeometryToolbox::Distance(geometry->GetnDim(), CartCoordNew, CartCoord);
+        maxDiff = max(maxDiff, Diff);
+      }
     }
+    END_SU2_OMP_FOR
+    SU2_OMP_CRITICAL
+    my_MaxDiff = max(my_MaxDiff, maxDiff);
+    END_SU2_OMP_CRITICAL
   }
+  END_SU2_OMP_PARALLEL
 
 #ifdef HAVE_MPI
   SU2_MPI::Allreduce(&my_MaxDiff, &MaxDiff, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
@@ -1599,10 +1732,8 @@ void CSurfaceMovement::ApplyDesignVariables(CGeometry* geometry, CConfig* config
 
 su2double CSurfaceMovement::SetCartesianCoord(CGeometry* geometry, CConfig* config, CFreeFormDefBox* FFDBox,
                                               unsigned short iFFDBox, bool ResetDef) {
-  su2double *CartCoordNew, Diff, my_MaxDiff = 0.0, MaxDiff, *ParamCoord, VarCoord[3] = {0.0, 0.0, 0.0},
-                                 CartCoordOld[3] = {0.0, 0.0, 0.0};
-  unsigned short iMarker, iDim;
-  unsigned long iVertex, iPoint, iSurfacePoints;
+  su2double my_MaxDiff = 0.0, MaxDiff;
+  const su2double Zero[3] = {0.0, 0.0, 0.0};
 
   bool cylindrical = (config->GetFFD_CoordSystem() == CYLINDRICAL);
   bool spherical = (config->GetFFD_CoordSystem() == SPHERICAL);
@@ -1613,96 +1744,101 @@ su2double CSurfaceMovement::SetCartesianCoord(CGeometry* geometry, CConfig* conf
     because a loop over GetnSurfacePoint is no sufficient ---*/
 
   if (ResetDef) {
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-        geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
+    for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); iMarker++) {
+      for (auto iVertex = 0ul; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        geometry->vertex[iMarker][iVertex]->SetVarCoord(Zero);
       }
     }
   }
 
-  /*--- Recompute the cartesians coordinates ---*/
+  /*--- Recompute the cartesians coordinates, each surface point is a different vertex. ---*/
 
-  for (iSurfacePoints = 0; iSurfacePoints < FFDBox->GetnSurfacePoint(); iSurfacePoints++) {
-    /*--- Get the marker of the surface point ---*/
+  SU2_OMP_PARALLEL {
+    su2double maxDiff = 0.0;
 
-    iMarker = FFDBox->Get_MarkerIndex(iSurfacePoints);
+    SU2_OMP_FOR_STAT(256)
+    for (auto iSurfacePoints = 0ul; iSurfacePoints < FFDBox->GetnSurfacePoint(); iSurfacePoints++) {
+      /*--- Get the marker of the surface point ---*/
 
-    if (config->GetMarker_All_DV(iMarker) == YES) {
-      /*--- Get the vertex of the surface point ---*/
+      const auto iMarker = FFDBox->Get_MarkerIndex(iSurfacePoints);
 
-      iVertex = FFDBox->Get_VertexIndex(iSurfacePoints);
-      iPoint = FFDBox->Get_PointIndex(iSurfacePoints);
-
-      /*--- Set to zero the variation of the coordinates ---*/
+      if (config->GetMarker_All_DV(iMarker) == YES) {
+        /*--- Get the vertex of the surface point ---*/
 
-      geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
+        const auto iVertex = FFDBox->Get_VertexIndex(iSurfacePoints);
+        const auto iPoint = FFDBox->Get_PointIndex(iSurfacePoints);
 
-      /*--- Get the parametric coordinate of the surface point ---*/
+        /*--- Set to zero the variation of the coordinates ---*/
 
-      ParamCoord = FFDBox->Get_ParametricCoord(iSurfacePoints);
+        geometry->vertex[iMarker][iVertex]->SetVarCoord(Zero);
 
-      /*--- Compute the new cartesian coordinate, and set the value in
-       the FFDBox structure ---*/
+        /*--- Get the parametric coordinate of the surface point ---*/
 
-      CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+        su2double ParamCoord[3], CartCoordNew[3];
+        for (auto iDim = 0u; iDim < 3; iDim++) ParamCoord[iDim] = FFDBox->Get_ParametricCoord(iSurfacePoints, iDim);
 
-      /*--- If polar coordinates, compute the cartesians from the polar value ---*/
+        /*--- Compute the new cartesian coordinate, and set the value in
+         the FFDBox structure ---*/
 
-      if (cylindrical) {
-        su2double X_0, Y_0, Z_0, Xbar, Ybar, Zbar;
-        X_0 = config->GetFFD_Axis(0);
-        Y_0 = config->GetFFD_Axis(1);
-        Z_0 = config->GetFFD_Axis(2);
+        FFDBox->EvalCartesianCoord(ParamCoord, CartCoordNew);
 
-        Xbar = CartCoordNew[2];
-        Ybar = CartCoordNew[0] * cos(CartCoordNew[1]);
-        Zbar = CartCoordNew[0] * sin(CartCoordNew[1]);
+        /*--- If polar coordinates, compute the cartesians from the polar value ---*/
 
-        CartCoordNew[0] = Xbar + X_0;
-        CartCoordNew[1] = Ybar + Y_0;
-        CartCoordNew[2] = Zbar + Z_0;
+        if (cylindrical) {
+          su2double X_0, Y_0, Z_0, Xbar, Ybar, Zbar;
+          X_0 = config->GetFFD_Axis(0);
+          Y_0 = config->GetFFD_Axis(1);
+          Z_0 = config->GetFFD_Axis(2);
 
-      } else if (spherical || polar) {
-        su2double X_0, Y_0, Z_0, Xbar, Ybar, Zbar;
-        X_0 = config->GetFFD_Axis(0);
-        Y_0 = config->GetFFD_Axis(1);
-        Z_0 = config->GetFFD_Axis(2);
-
-        Xbar = CartCoordNew[0] * cos(CartCoordNew[2]);
-        Ybar = CartCoordNew[0] * cos(CartCoordNew[1]) * sin(CartCoordNew[2]);
-        Zbar = CartCoordNew[0] * sin(CartCoordNew[1]) * sin(CartCoordNew[2]);
-
-        CartCoordNew[0] = Xbar + X_0;
-        CartCoordNew[1] = Ybar + Y_0;
-        CartCoordNew[2] = Zbar + Z_0;
-      }
+          Xbar = CartCoordNew[2];
+          Ybar = CartCoordNew[0] * cos(CartCoordNew[1]);
+          Zbar = CartCoordNew[0] * sin(CartCoordNew[1]);
 
-      FFDBox->Set_CartesianCoord(CartCoordNew, iSurfacePoints);
+          CartCoordNew[0] = Xbar + X_0;
+          CartCoordNew[1] = Ybar + Y_0;
+          CartCoordNew[2] = Zbar + Z_0;
 
-      /*--- Get the original cartesian coordinates of the surface point ---*/
+        } else if (spherical || polar) {
+          su2double X_0, Y_0, Z_0, Xbar, Ybar, Zbar;
+          X_0 = config->GetFFD_Axis(0);
+          Y_0 = config->GetFFD_Axis(1);
+          Z_0 = config->GetFFD_Axis(2);
+
+          Xbar = CartCoordNew[0] * cos(CartCoordNew[2]);
+          Ybar = CartCoordNew[0] * cos(CartCoordNew[1]) * sin(CartCoordNew[2]);
+          Zbar = CartCoordNew[0] * sin(CartCoordNew[1]) * sin(CartCoordNew[2]);
+
+          CartCoordNew[0] = Xbar + X_0;
+          CartCoordNew[1] = Ybar + Y_0;
+          CartCoordNew[2] = Zbar + Z_0;
+        }
 
-      for (iDim = 0; iDim < nDim; iDim++) {
-        CartCoordOld[iDim] = geometry->nodes->GetCoord(iPoint, iDim);
-      }
+        FFDBox->Set_CartesianCoord(CartCoordNew, iSurfacePoints);
 
-      /*--- Set the value of the variation of the coordinates ---*/
+        /*--- Set the value of the variation of the coordinates ---*/
 
-      Diff = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        VarCoord[iDim] = CartCoordNew[iDim] - CartCoordOld[iDim];
-        if ((fabs(VarCoord[iDim]) <= EPS) && (config->GetDirectDiff() != D_DESIGN) && (!config->GetAD_Mode()))
-          VarCoord[iDim] = 0.0;
-        Diff += (VarCoord[iDim] * VarCoord[iDim]);
-      }
-      Diff = sqrt(Diff);
+        su2double VarCoord[3] = {0.0, 0.0, 0.0}, Diff = 0.0;
+        for (auto iDim = 0u; iDim < nDim; iDim++) {
+          VarCoord[iDim] = CartCoordNew[iDim] - geometry->nodes->GetCoord(iPoint, iDim);
+          if ((fabs(VarCoord[iDim]) <= EPS) && (config->GetDirectDiff() != D_DESIGN) && (!config->GetAD_Mode()))
+            VarCoord[iDim] = 0.0;
+          Diff += (VarCoord[iDim] * VarCoord[iDim]);
+        }
+        Diff = sqrt(Diff);
 
-      my_MaxDiff = max(my_MaxDiff, Diff);
+        maxDiff = max(maxDiff, Diff);
 
-      /*--- Set the variation of the coordinates ---*/
+        /*--- Set the variation of the coordinates ---*/
 
-      geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
+        geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
+      }
     }
+    END_SU2_OMP_FOR
+    SU2_OMP_CRITICAL
+    my_MaxDiff = max(my_MaxDiff, maxDiff);
+    END_SU2_OMP_CRITICAL
   }
+  END_SU2_OMP_PARALLEL
 
   SU2_MPI::Allreduce(&my_MaxDiff, &MaxDiff, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
 
@@ -57,20 +57,19 @@ CVolumetricMovement::CVolumetricMovement(CGeometry* geometry, CConfig* config)
 CVolumetricMovement::~CVolumetricMovement() = default;
 
 void CVolumetricMovement::UpdateGridCoord(CGeometry* geometry, CConfig* config) {
-  unsigned short iDim;
-  unsigned long iPoint, total_index;
-  su2double new_coord;
-
   /*--- Update the grid coordinates using the solution of the linear system
    after grid deformation (LinSysSol contains the x, y, z displacements). ---*/
 
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
-    for (iDim = 0; iDim < nDim; iDim++) {
-      total_index = iPoint * nDim + iDim;
-      new_coord = geometry->nodes->GetCoord(iPoint, iDim) + LinSysSol[total_index];
+  SU2_OMP_PARALLEL_(for schedule(static, OMP_CHUNK_SIZE))
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      const auto total_index = iPoint * nDim + iDim;
+      su2double new_coord = geometry->nodes->GetCoord(iPoint, iDim) + LinSysSol[total_index];
       if (fabs(new_coord) < EPS * EPS) new_coord = 0.0;
       geometry->nodes->SetCoord(iPoint, iDim, new_coord);
     }
+  }
+  END_SU2_OMP_PARALLEL
 
   /*--- LinSysSol contains the non-transformed displacements in the periodic halo cells.
    * Hence we still need a communication of the transformed coordinates, otherwise periodicity
@@ -222,10 +221,7 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry* geometry, CConfig* co
 
 void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry* geometry, su2double& MinVolume,
                                                           su2double& MaxVolume, bool Screen_Output) {
-  unsigned long iElem, ElemCounter = 0, PointCorners[8];
-  su2double Volume = 0.0, CoordCorners[8][3];
-  unsigned short nNodes = 0, iNodes, iDim;
-  bool RightVol = true;
+  unsigned long ElemCounter = 0;
 
   if (rank == MASTER_NODE && Screen_Output) cout << "Computing volumes of the grid elements." << endl;
 
@@ -234,46 +230,62 @@ void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry* geometry, s
 
   /*--- Load up each triangle and tetrahedron to check for negative volumes. ---*/
 
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE) nNodes = 3;
-    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON) nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID) nNodes = 5;
-    if (geometry->elem[iElem]->GetVTK_Type() == PRISM) nNodes = 6;
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON) nNodes = 8;
+  SU2_OMP_PARALLEL {
+    /*--- Thread-local extrema and count of negative volumes. ---*/
+    su2double maxVolume = -1E22, minVolume = 1E22;
+    unsigned long nNegative = 0;
 
-    for (iNodes = 0; iNodes < nNodes; iNodes++) {
-      PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
-      for (iDim = 0; iDim < nDim; iDim++) {
-        CoordCorners[iNodes][iDim] = geometry->nodes->GetCoord(PointCorners[iNodes], iDim);
-      }
-    }
+    SU2_OMP_FOR_STAT(OMP_CHUNK_SIZE)
+    for (auto iElem = 0ul; iElem < geometry->GetnElem(); iElem++) {
+      unsigned short nNodes = 0;
+      unsigned long PointCorners[8];
+      su2double Volume = 0.0, CoordCorners[8][3];
 
-    /*--- 2D elements ---*/
+      if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE) nNodes = 3;
+      if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
+      if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON) nNodes = 4;
+      if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID) nNodes = 5;
+      if (geometry->elem[iElem]->GetVTK_Type() == PRISM) nNodes = 6;
+      if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON) nNodes = 8;
 
-    if (nDim == 2) {
-      if (nNodes == 3) Volume = GetTriangle_Area(CoordCorners);
-      if (nNodes == 4) Volume = GetQuadrilateral_Area(CoordCorners);
-    }
+      for (auto iNodes = 0u; iNodes < nNodes; iNodes++) {
+        PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
+        for (auto iDim = 0u; iDim < nDim; iDim++) {
+          CoordCorners[iNodes][iDim] = geometry->nodes->GetCoord(PointCorners[iNodes], iDim);
+        }
+      }
 
-    /*--- 3D Elementes ---*/
+      /*--- 2D elements ---*/
 
-    if (nDim == 3) {
-      if (nNodes == 4) Volume = GetTetra_Volume(CoordCorners);
-      if (nNodes == 5) Volume = GetPyram_Volume(CoordCorners);
-      if (nNodes == 6) Volume = GetPrism_Volume(CoordCorners);
-      if (nNodes == 8) Volume = GetHexa_Volume(CoordCorners);
-    }
+      if (nDim == 2) {
+        if (nNodes == 3) Volume = GetTriangle_Area(CoordCorners);
+        if (nNodes == 4) Volume = GetQuadrilateral_Area(CoordCorners);
+      }
 
-    RightVol = true;
-    if (Volume < 0.0) RightVol = false;
+      /*--- 3D Elementes ---*/
 
-    MaxVolume = max(MaxVolume, Volume);
-    MinVolume = min(MinVolume, Volume);
-    geometry->elem[iElem]->SetVolume(Volume);
+      if (nDim == 3) {
+        if (nNodes == 4) Volume = GetTetra_Volume(CoordCorners);
+        if (nNodes == 5) Volume = GetPyram_Volume(CoordCorners);
+        if (nNodes == 6) Volume = GetPrism_Volume(CoordCorners);
+        if (nNodes == 8) Volume = GetHexa_Volume(CoordCorners);
+      }
 
-    if (!RightVol) ElemCounter++;
+      maxVolume = max(maxVolume, Volume);
+      minVolume = min(minVolume, Volume);
+      geometry->elem[iElem]->SetVolume(Volume);
+
+      if (Volume < 0.0) nNegative++;
+    }
+    END_SU2_OMP_FOR
+    SU2_OMP_CRITICAL {
+      MaxVolume = max(MaxVolume, maxVolume);
+      MinVolume = min(MinVolume, minVolume);
+      ElemCounter += nNegative;
+    }
+    END_SU2_OMP_CRITICAL
   }
+  END_SU2_OMP_PARALLEL
 
 #ifdef HAVE_MPI
   unsigned long ElemCounter_Local = ElemCounter;
@@ -289,23 +301,24 @@ void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry* geometry, s
 
   /*--- Volume from  0 to 1 ---*/
 
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    Volume = geometry->elem[iElem]->GetVolume() / MaxVolume;
+  SU2_OMP_PARALLEL_(for schedule(static, OMP_CHUNK_SIZE))
+  for (auto iElem = 0ul; iElem < geometry->GetnElem(); iElem++) {
+    const su2double Volume = geometry->elem[iElem]->GetVolume() / MaxVolume;
     geometry->elem[iElem]->SetVolume(Volume);
   }
+  END_SU2_OMP_PARALLEL
 
   if ((ElemCounter != 0) && (rank == MASTER_NODE) && (Screen_Output))
     cout << "There are " << ElemCounter << " elements with negative volume.\n" << endl;
 }
 
 void CVolumetricMovement::ComputenNonconvexElements(CGeometry* geometry, bool Screen_Output) {
-  unsigned long iElem;
-  unsigned short iDim;
   unsigned long nNonconvexElements = 0;
 
   /*--- Load up each tetrahedron to check for convex properties. ---*/
   if (nDim == 2) {
-    for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+    SU2_OMP_PARALLEL_(for schedule(static, OMP_CHUNK_SIZE) reduction(+ : nNonconvexElements))
+    for (auto iElem = 0ul; iElem < geometry->GetnElem(); iElem++) {
       su2double minCrossProduct = 1.e6, maxCrossProduct = -1.e6;
 
       const auto nNodes = geometry->elem[iElem]->GetnNodes();
@@ -325,7 +338,7 @@ void CVolumetricMovement::ComputenNonconvexElements(CGeometry* geometry, bool Sc
         /*--- Calculate minimum and maximum angle between edge vectors adjacent to each node ---*/
         su2double edgeVector_i[3], edgeVector_j[3];
 
-        for (iDim = 0; iDim < nDim; iDim++) {
+        for (auto iDim = 0u; iDim < nDim; iDim++) {
           if (iNodes == 0) {
             edgeVector_i[iDim] = CoordCorners[nNodes - 1][iDim] - CoordCorners[iNodes][iDim];
           } else {
@@ -352,6 +365,7 @@ void CVolumetricMovement::ComputenNonconvexElements(CGeometry* geometry, bool Sc
         nNonconvexElements++;
       }
     }
+    END_SU2_OMP_PARALLEL
   } else if (rank == MASTER_NODE) {
     cout << "\nWARNING: Convexity is not checked for 3D elements (issue #1171).\n" << endl;
   }
@@ -366,10 +380,9 @@ void CVolumetricMovement::ComputenNonconvexElements(CGeometry* geometry, bool Sc
 
 void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry* geometry, CConfig* config, su2double& MinDistance,
                                                      su2double& MaxDistance) const {
-  unsigned long nVertex_SolidWall, ii, jj, iVertex, iPoint, pointID;
+  unsigned long nVertex_SolidWall, ii, jj, iVertex, iPoint;
   unsigned short iMarker, iDim;
-  su2double dist, MaxDistance_Local, MinDistance_Local;
-  int rankID;
+  su2double MaxDistance_Local, MinDistance_Local;
 
   /*--- Initialize min and max distance ---*/
 
@@ -419,18 +432,33 @@ void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry* geometry, CConfi
     for (iPoint = 0; iPoint < geometry->GetnPoint(); ++iPoint) geometry->nodes->SetWall_Distance(iPoint, 0.0);
   } else {
     /*--- Solid wall boundary nodes are present. Compute the wall
-     distance for all nodes. ---*/
+     distance for all nodes (the ADT searches are thread-safe). ---*/
 
-    for (iPoint = 0; iPoint < geometry->GetnPoint(); ++iPoint) {
-      WallADT.DetermineNearestNode(geometry->nodes->GetCoord(iPoint), dist, pointID, rankID);
-      geometry->nodes->SetWall_Distance(iPoint, dist);
+    SU2_OMP_PARALLEL {
+      su2double maxDist = -1E22, minDist = 1E22;
 
-      MaxDistance = max(MaxDistance, dist);
+      SU2_OMP_FOR_DYN(OMP_CHUNK_SIZE)
+      for (auto jPoint = 0ul; jPoint < geometry->GetnPoint(); ++jPoint) {
+        su2double dist;
+        unsigned long pointID;
+        int rankID;
+        WallADT.DetermineNearestNode(geometry->nodes->GetCoord(jPoint), dist, pointID, rankID);
+        geometry->nodes->SetWall_Distance(jPoint, dist);
 
-      /*--- To discard points on the surface we use > EPS ---*/
+        maxDist = max(maxDist, dist);
 
-      if (sqrt(dist) > EPS) MinDistance = min(MinDistance, dist);
+        /*--- To discard points on the surface we use > EPS ---*/
+
+        if (sqrt(dist) > EPS) minDist = min(minDist, dist);
+      }
+      END_SU2_OMP_FOR
+      SU2_OMP_CRITICAL {
+        MaxDistance = max(MaxDistance, maxDist);
+        MinDistance = min(MinDistance, minDist);
+      }
+      END_SU2_OMP_CRITICAL
     }
+    END_SU2_OMP_PARALLEL
 
     MaxDistance_Local = MaxDistance;
     MaxDistance = 0.0;
@@ -448,24 +476,10 @@ void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry* geometry, CConfi
 }
 
 su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry* geometry, CConfig* config) {
-  unsigned short iVar, iDim, nNodes = 0, iNodes, StiffMatrix_nElem = 0;
-  unsigned long iElem, PointCorners[8];
-  su2double **StiffMatrix_Elem = nullptr, CoordCorners[8][3];
-  su2double MinVolume = 0.0, MaxVolume = 0.0, MinDistance = 0.0, MaxDistance = 0.0, ElemVolume = 0.0,
-            ElemDistance = 0.0;
+  su2double MinVolume = 0.0, MaxVolume = 0.0, MinDistance = 0.0, MaxDistance = 0.0;
 
   bool Screen_Output = config->GetDeform_Output();
 
-  /*--- Allocate maximum size (quadrilateral and hexahedron) ---*/
-
-  if (nDim == 2)
-    StiffMatrix_nElem = 8;
-  else
-    StiffMatrix_nElem = 24;
-
-  StiffMatrix_Elem = new su2double*[StiffMatrix_nElem];
-  for (iVar = 0; iVar < StiffMatrix_nElem; iVar++) StiffMatrix_Elem[iVar] = new su2double[StiffMatrix_nElem];
-
   /*--- Compute min volume in the entire mesh. ---*/
 
   ComputeDeforming_Element_Volume(geometry, MinVolume, MaxVolume, Screen_Output);
@@ -481,48 +495,71 @@ su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry* geometr
       cout << "Min. distance: " << MinDistance << ", max. distance: " << MaxDistance << "." << endl;
   }
 
-  /*--- Compute contributions from each element by forming the stiffness matrix (FEA) ---*/
-
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE) nNodes = 3;
-    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON) nNodes = 4;
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID) nNodes = 5;
-    if (geometry->elem[iElem]->GetVTK_Type() == PRISM) nNodes = 6;
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON) nNodes = 8;
+  /*--- Elements of the same color do not share nodes, hence their contributions can be added to the
+   stiffness matrix concurrently. If the coloring is poor (too few elements per color) the assembly
+   runs on a single thread, which is also what happens when OpenMP is not used. ---*/
 
-    for (iNodes = 0; iNodes < nNodes; iNodes++) {
-      PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
-      for (iDim = 0; iDim < nDim; iDim++) {
-        CoordCorners[iNodes][iDim] = geometry->nodes->GetCoord(PointCorners[iNodes], iDim);
-      }
-    }
+  su2double parallelEff = 1.0;
+  const auto& coloring = geometry->GetElementColoring(&parallelEff);
+  const auto nColor = coloring.getOuterSize();
 
-    /*--- Extract Element volume and distance to compute the stiffness ---*/
+  /*--- Compute contributions from each element by forming the stiffness matrix (FEA) ---*/
 
-    ElemVolume = geometry->elem[iElem]->GetVolume();
+  SU2_OMP_PARALLEL_ON(parallelEff < COLORING_EFF_THRESH ? 1 : omp_get_max_threads()) {
+    /*--- Allocate maximum size (quadrilateral and hexahedron), one per thread. ---*/
+
+    su2double StiffMatrix_Data[24][24];
+    su2double* StiffMatrix_Elem[24];
+    for (auto iVar = 0u; iVar < 24; iVar++) StiffMatrix_Elem[iVar] = StiffMatrix_Data[iVar];
+
+    for (auto iColor = 0ul; iColor < nColor; iColor++) {
+      const auto nElemColor = coloring.getNumNonZeros(iColor);
+      const auto* elemColor = coloring.innerIdx(iColor);
+
+      SU2_OMP_FOR_DYN(geometry->GetElementColorGroupSize())
+      for (auto k = 0ul; k < nElemColor; k++) {
+        const auto iElem = elemColor[k];
+        unsigned short nNodes = 0;
+        unsigned long PointCorners[8];
+        su2double CoordCorners[8][3], ElemDistance = 0.0;
+
+        if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE) nNodes = 3;
+        if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
+        if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON) nNodes = 4;
+        if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID) nNodes = 5;
+        if (geometry->elem[iElem]->GetVTK_Type() == PRISM) nNodes = 6;
+        if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON) nNodes = 8;
+
+        for (auto iNodes = 0u; iNodes < nNodes; iNodes++) {
+          PointCorners[iNodes] = geometry->elem[iElem]->GetNode(iNodes);
+          for (auto iDim = 0u; iDim < nDim; iDim++) {
+            CoordCorners[iNodes][iDim] = geometry->nodes->GetCoord(PointCorners[iNodes], iDim);
+          }
+        }
 
-    if ((config->GetDeform_Stiffness_Type() == SOLID_WALL_DISTANCE)) {
-      ElemDistance = 0.0;
-      for (iNodes = 0; iNodes < nNodes; iNodes++)
-        ElemDistance += geometry->nodes->GetWall_Distance(PointCorners[iNodes]);
-      ElemDistance = ElemDistance / (su2double)nNodes;
-    }
+        /*--- Extract Element volume and distance to compute the stiffness ---*/
 
-    if (nDim == 2)
-      SetFEA_StiffMatrix2D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume,
-                           ElemDistance);
-    if (nDim == 3)
-      SetFEA_StiffMatrix3D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume,
-                           ElemDistance);
+        const su2double ElemVolume = geometry->elem[iElem]->GetVolume();
 
-    AddFEA_StiffMatrix(geometry, StiffMatrix_Elem, PointCorners, nNodes);
-  }
+        if ((config->GetDeform_Stiffness_Type() == SOLID_WALL_DISTANCE)) {
+          for (auto iNodes = 0u; iNodes < nNodes; iNodes++)
+            ElemDistance += geometry->nodes->GetWall_Distance(PointCorners[iNodes]);
+          ElemDistance = ElemDistance / (su2double)nNodes;
+        }
 
-  /*--- Deallocate memory and exit ---*/
+        if (nDim == 2)
+          SetFEA_StiffMatrix2D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume,
+                               ElemDistance);
+        if (nDim == 3)
+          SetFEA_StiffMatrix3D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume,
+                               ElemDistance);
 
-  for (iVar = 0; iVar < StiffMatrix_nElem; iVar++) delete[] StiffMatrix_Elem[iVar];
-  delete[] StiffMatrix_Elem;
+        AddFEA_StiffMatrix(geometry, StiffMatrix_Elem, PointCorners, nNodes);
+      }
+      END_SU2_OMP_FOR
+    }
+  }
+  END_SU2_OMP_PARALLEL
 
   return MinVolume;
 }
@@ -1614,12 +1651,10 @@ void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry* geometry, su2double** St
 
   unsigned short nVar = geometry->GetnDim();
 
-  su2double** StiffMatrix_Node;
-  StiffMatrix_Node = new su2double*[nVar];
-  for (iVar = 0; iVar < nVar; iVar++) StiffMatrix_Node[iVar] = new su2double[nVar];
+  /*--- Local storage, this function is called concurrently for elements of the same color. ---*/
 
-  for (iVar = 0; iVar < nVar; iVar++)
-    for (jVar = 0; jVar < nVar; jVar++) StiffMatrix_Node[iVar][jVar] = 0.0;
+  su2double StiffMatrix_Data[3][3] = {{0.0}};
+  su2double* StiffMatrix_Node[3] = {StiffMatrix_Data[0], StiffMatrix_Data[1], StiffMatrix_Data[2]};
 
   /*--- Transform the stiffness matrix for the hexahedral element into the
    contributions for the individual nodes relative to each other. ---*/
@@ -1635,11 +1670,6 @@ void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry* geometry, su2double** St
       StiffMatrix.AddBlock(PointCorners[iVar], PointCorners[jVar], StiffMatrix_Node);
     }
   }
-
-  /*--- Deallocate memory and exit ---*/
-
-  for (iVar = 0; iVar < nVar; iVar++) delete[] StiffMatrix_Node[iVar];
-  delete[] StiffMatrix_Node;
 }
 
 void CVolumetricMovement::SetBoundaryDisplacements(CGeometry* geometry, CConfig* config) {
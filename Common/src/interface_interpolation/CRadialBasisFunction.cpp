@@ -28,6 +28,7 @@
 #include "../../include/interface_interpolation/CRadialBasisFunction.hpp"
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
+#include "../../include/toolboxes/CPointBins.hpp"
 #include "../../include/toolboxes/CSymmetricMatrix.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 
@@ -44,6 +45,139 @@ extern "C" void dgemm_(const char*, const char*, const int*, const int*, const i
 #define DGEMM dgemm_
 #endif
 
+namespace {
+/*!
+ * \brief Sparse (CSR) donor-to-donor kernel of a compactly supported radial basis function.
+ */
+struct CSparseKernel {
+  vector<unsigned long> rowPtr, colIdx;
+  vector<passivedouble> values, diag;
+
+  /*!
+   * \brief Assemble the kernel of a subset of the points.
+   * \param[in] points - Indices (in coords) of the points in the subset, they become the rows of the kernel.
+   * \param[in] localIndex - Map from indices in coords to rows of the kernel, -1 if the point is not in the subset.
+   */
+  void Assemble(RADIAL_BASIS type, passivedouble radius, const su2activematrix& coords, const CPointBins& bins,
+                const vector<unsigned long>& points, const vector<long>& localIndex) {
+    const auto nPoint = points.size();
+    rowPtr.assign(nPoint + 1, 0);
+    colIdx.clear();
+    values.clear();
+    diag.assign(nPoint, 0.0);
+
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      bins.ForEachNeighbor(coords[points[iPoint]], radius, [&](unsigned long jPoint, passivedouble dist) {
+        if (localIndex[jPoint] < 0) return;
+        const auto value = SU2_TYPE::GetValue(CRadialBasisFunction::Get_RadialBasisValue(type, radius, dist));
+        colIdx.push_back(localIndex[jPoint]);
+        values.push_back(value);
+        if (jPoint == points[iPoint]) diag[iPoint] = value;
+      });
+      rowPtr[iPoint + 1] = colIdx.size();
+    }
+  }
+
+  /*!
+   * \brief Apply the symmetric Gauss-Seidel preconditioner, Z = (D+U)^-1 D (D+L)^-1 R.
+   * \note The diagonal of the kernel is the value of the RBF at distance 0, i.e. Jacobi alone does nothing.
+   */
+  void Precondition(const su2passivematrix& R, su2passivematrix& Z) const {
+    const auto nPoint = R.rows();
+    const auto nCol = R.cols();
+
+    for (auto i = 0ul; i < nPoint; ++i) {
+      for (auto k = 0ul; k < nCol; ++k) Z(i, k) = R(i, k);
+      for (auto nz = rowPtr[i]; nz < rowPtr[i + 1]; ++nz) {
+        const auto j = colIdx[nz];
+        if (j < i)
+          for (auto k = 0ul; k < nCol; ++k) Z(i, k) -= values[nz] * Z(j, k);
+      }
+      for (auto k = 0ul; k < nCol; ++k) Z(i, k) /= diag[i];
+    }
+    for (auto i = nPoint; i-- > 0;) {
+      for (auto k = 0ul; k < nCol; ++k) Z(i, k) *= diag[i];
+      for (auto nz = rowPtr[i]; nz < rowPtr[i + 1]; ++nz) {
+        const auto j = colIdx[nz];
+        if (j > i)
+          for (auto k = 0ul; k < nCol; ++k) Z(i, k) -= values[nz] * Z(j, k);
+      }
+      for (auto k = 0ul; k < nCol; ++k) Z(i, k) /= diag[i];
+    }
+  }
+
+  /*!
+   * \brief Solve K X = B for the columns of B with the preconditioned conjugate gradient method.
+   * \note The columns are independent systems, iterated together to amortize accesses to K.
+   * \param[out] iter - Number of iterations.
+   * \return True if all columns converged.
+   */
+  bool Solve(const su2passivematrix& B, su2passivematrix& X, passivedouble tol, unsigned long maxIter,
+             su2passivematrix& R, su2passivematrix& Z, su2passivematrix& P, su2passivematrix& KP,
+             unsigned long& iter) const {
+    const auto nPoint = B.rows();
+    const auto nCol = B.cols();
+    vector<passivedouble> rr(nCol, 0.0), rz(nCol, 0.0), bb(nCol), pKp(nCol), alpha(nCol), beta(nCol);
+
+    X = 0.0;
+    R = B;
+    Precondition(R, Z);
+    P = Z;
+    for (auto i = 0ul; i < nPoint; ++i) {
+      for (auto k = 0ul; k < nCol; ++k) {
+        rr[k] += pow(R(i, k), 2);
+        rz[k] += R(i, k) * Z(i, k);
+      }
+    }
+    for (auto k = 0ul; k < nCol; ++k) bb[k] = rr[k] * pow(tol, 2);
+
+    auto converged = [&]() {
+      bool conv = true;
+      for (auto k = 0ul; k < nCol; ++k) conv &= (rr[k] <= bb[k]);
+      return conv;
+    };
+
+    for (iter = 0; iter < maxIter && !converged(); ++iter) {
+      /*--- KP = K * P and p^T K p. ---*/
+      pKp.assign(nCol, 0.0);
+      for (auto i = 0ul; i < nPoint; ++i) {
+        for (auto k = 0ul; k < nCol; ++k) KP(i, k) = 0.0;
+        for (auto nz = rowPtr[i]; nz < rowPtr[i + 1]; ++nz) {
+          const auto j = colIdx[nz];
+          for (auto k = 0ul; k < nCol; ++k) KP(i, k) += values[nz] * P(j, k);
+        }
+        for (auto k = 0ul; k < nCol; ++k) pKp[k] += P(i, k) * KP(i, k);
+      }
+      for (auto k = 0ul; k < nCol; ++k) alpha[k] = (rr[k] > bb[k] && pKp[k] > 0) ? rz[k] / pKp[k] : 0.0;
+
+      /*--- Update solution and residual. ---*/
+      for (auto k = 0ul; k < nCol; ++k) rr[k] = 0.0;
+      for (auto i = 0ul; i < nPoint; ++i) {
+        for (auto k = 0ul; k < nCol; ++k) {
+          X(i, k) += alpha[k] * P(i, k);
+          R(i, k) -= alpha[k] * KP(i, k);
+          rr[k] += pow(R(i, k), 2);
+        }
+      }
+
+      /*--- New search directions. ---*/
+      Precondition(R, Z);
+      for (auto k = 0ul; k < nCol; ++k) beta[k] = 0.0;
+      for (auto i = 0ul; i < nPoint; ++i)
+        for (auto k = 0ul; k < nCol; ++k) beta[k] += R(i, k) * Z(i, k);
+      for (auto k = 0ul; k < nCol; ++k) {
+        const auto rzNew = beta[k];
+        beta[k] = (alpha[k] != 0.0) ? rzNew / rz[k] : 0.0;
+        rz[k] = rzNew;
+      }
+      for (auto i = 0ul; i < nPoint; ++i)
+        for (auto k = 0ul; k < nCol; ++k) P(i, k) = Z(i, k) + beta[k] * P(i, k);
+    }
+    return converged();
+  }
+};
+}  // namespace
+
 CRadialBasisFunction::CRadialBasisFunction(CGeometry**** geometry_container, const CConfig* const* config,
                                            unsigned int iZone, unsigned int jZone)
     : CInterpolator(geometry_container, config, iZone, jZone) {
@@ -63,6 +197,10 @@ void CRadialBasisFunction::PrintStatistics() const {
   else
     cout << " <<< WARNING >>>\n";
   cout << "  Interpolation matrix is " << Density << "% dense." << endl;
+  if (MaxIterations > 0) {
+    cout << "  Max. iterations of the sparse RBF solver: " << MaxIterations << "\n"
+         << "  Max. relative coefficient at the edge of the donor neighbourhoods: " << MaxTruncation << "\n";
+  }
   cout.unsetf(ios::floatfield);
 }
 
@@ -104,6 +242,16 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   const bool usePolynomial = config[donorZone]->GetRadialBasisFunctionPolynomialOption();
   const su2double paramRBF = config[donorZone]->GetRadialBasisFunctionParameter();
   const su2double pruneTol = config[donorZone]->GetRadialBasisFunctionPruneTol();
+  const bool sparse = config[donorZone]->GetRadialBasisFunctionSolver() == RADIAL_BASIS_SOLVER::SPARSE;
+  const passivedouble neighborhood = SU2_TYPE::GetValue(config[donorZone]->GetRadialBasisFunctionNeighborhood());
+
+  if (sparse && kindRBF != RADIAL_BASIS::WENDLAND_C2)
+    SU2_MPI::Error("The SPARSE RBF solver requires a compactly supported basis function (WENDLAND_C2).",
+                   CURRENT_FUNCTION);
+  if (sparse && usePolynomial)
+    SU2_MPI::Error("The SPARSE RBF solver requires RADIAL_BASIS_FUNCTION_POLYNOMIAL_TERM= NO.", CURRENT_FUNCTION);
+  if (sparse && neighborhood < 1)
+    SU2_MPI::Error("RADIAL_BASIS_FUNCTION_NEIGHBORHOOD must be at least 1.", CURRENT_FUNCTION);
 
   const auto nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface() / 2;
   const int nDim = donor_geometry->GetnDim();
@@ -116,11 +264,13 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   /*--- Process interface patches in parallel, fetch all donor point coordinates,
    *    then distribute interpolation matrix computation over ranks and threads.
    *    To avoid repeating calls to Collect_VertexInfo we also save the global
-   *    indices of the donor points and the mpi rank index that owns them. ---*/
+   *    indices of the donor points and the mpi rank index that owns them.
+   *    With the sparse solver each rank only fetches the donors near its target points. ---*/
 
   vector<su2activematrix> donorCoordinates(nMarkerInt);
   vector<vector<long> > donorGlobalPoint(nMarkerInt);
   vector<vector<int> > donorProcessor(nMarkerInt);
+  vector<unsigned long> nGlobalVertexDonorVec(nMarkerInt, 0);
   vector<int> assignedProcessor(nMarkerInt, -1);
   vector<unsigned long> totalWork(nProcessor, 0);
 
@@ -143,6 +293,19 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
     /*--- Compute total number of donor vertices. ---*/
     const auto nGlobalVertexDonor =
         accumulate(Buffer_Receive_nVertex_Donor, Buffer_Receive_nVertex_Donor + nProcessor, 0ul);
+    nGlobalVertexDonorVec[iMarkerInt] = nGlobalVertexDonor;
+
+    auto& donorCoord = donorCoordinates[iMarkerInt];
+    auto& donorPoint = donorGlobalPoint[iMarkerInt];
+    auto& donorProc = donorProcessor[iMarkerInt];
+
+    if (sparse) {
+      /*--- Each rank computes the coefficients of its own target points. ---*/
+      CollectDonorNeighborhood(markDonor, markTarget, nVertexDonor, neighborhood * SU2_TYPE::GetValue(paramRBF),
+                               donorCoord, donorPoint, donorProc);
+      assignedProcessor[iMarkerInt] = rank;
+      continue;
+    }
 
     /*--- Gather coordinates and global point indices. ---*/
     Buffer_Send_Coord.resize(MaxLocalVertex_Donor, nDim);
@@ -153,9 +316,6 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
     Collect_VertexInfo(markDonor, markTarget, nVertexDonor, nDim);
 
     /*--- Compresses the gathered donor point information to simplify computations. ---*/
-    auto& donorCoord = donorCoordinates[iMarkerInt];
-    auto& donorPoint = donorGlobalPoint[iMarkerInt];
-    auto& donorProc = donorProcessor[iMarkerInt];
     donorCoord.resize(nGlobalVertexDonor, nDim);
     donorPoint.resize(nGlobalVertexDonor);
     donorProc.resize(nGlobalVertexDonor);
@@ -174,18 +334,7 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
 
     /*--- Give an MPI-independent order to the points (required due to high condition
      *    number of the RBF matrix, avoids diff results with diff number of ranks. ---*/
-    vector<int> order(nGlobalVertexDonor);
-    iota(order.begin(), order.end(), 0);
-    sort(order.begin(), order.end(), [&donorPoint](int i, int j) { return donorPoint[i] < donorPoint[j]; });
-
-    for (int i = 0; i < int(nGlobalVertexDonor); ++i) {
-      int j = order[i];
-      while (j < i) j = order[j];
-      if (i == j) continue;
-      swap(donorProc[i], donorProc[j]);
-      swap(donorPoint[i], donorPoint[j]);
-      for (int iDim = 0; iDim < nDim; ++iDim) swap(donorCoord(i, iDim), donorCoord(j, iDim));
-    }
+    SortByGlobalIndex(donorCoord, donorPoint, donorProc);
 
     /*--- Static work scheduling over ranks based on which one has less work currently. ---*/
     int iProcessor = 0;
@@ -206,7 +355,7 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
 
   SU2_OMP_PARALLEL_(for schedule(dynamic,1))
   for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; ++iMarkerInt) {
-    if (rank == assignedProcessor[iMarkerInt]) {
+    if (!sparse && rank == assignedProcessor[iMarkerInt]) {
       ComputeGeneratorMatrix(kindRBF, usePolynomial, paramRBF, donorCoordinates[iMarkerInt], nPolynomialVec[iMarkerInt],
                              keepPolynomialRowVec[iMarkerInt], CinvTrucVec[iMarkerInt]);
     }
@@ -216,11 +365,13 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   /*--- Final loop over interface markers to compute the interpolation coefficients. ---*/
 
   /*--- Initialize variables for interpolation statistics. ---*/
-  unsigned long totalTargetPoints = 0, totalDonorPoints = 0, denseSize = 0;
+  unsigned long totalTargetPoints = 0, totalDonorPoints = 0, denseSize = 0, totalNotConverged = 0;
   MinDonors = 1 << 30;
   MaxDonors = 0;
+  MaxIterations = 0;
   MaxCorrection = 0.0;
   AvgCorrection = 0.0;
+  MaxTruncation = 0.0;
 
   for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; iMarkerInt++) {
     /*--- Identify the rank that computed the interpolation matrix for this marker. ---*/
@@ -242,35 +393,33 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
     auto& nPolynomial = nPolynomialVec[iMarkerInt];
     auto& keepPolynomialRow = keepPolynomialRowVec[iMarkerInt];
 
-    const auto nGlobalVertexDonor = donorCoord.rows();
+    const auto nGlobalVertexDonor = nGlobalVertexDonorVec[iMarkerInt];
 
 #ifdef HAVE_MPI
-    /*--- For simplicity, broadcast small information about the interpolation matrix. ---*/
-    SU2_MPI::Bcast(&nPolynomial, 1, MPI_INT, iProcessor, SU2_MPI::GetComm());
-    SU2_MPI::Bcast(keepPolynomialRow.data(), nDim, MPI_INT, iProcessor, SU2_MPI::GetComm());
-
-    /*--- Send C_inv_trunc only to the ranks that need it (those with target points),
-     *    partial broadcast. MPI wrapper not used due to passive double. ---*/
-    vector<unsigned long> allNumVertex(nProcessor);
-    SU2_MPI::Allgather(&nVertexTarget, 1, MPI_UNSIGNED_LONG, allNumVertex.data(), 1, MPI_UNSIGNED_LONG,
-                       SU2_MPI::GetComm());
-
-    if (rank == iProcessor) {
-      for (int jProcessor = 0; jProcessor < nProcessor; ++jProcessor)
-        if ((jProcessor != iProcessor) && (allNumVertex[jProcessor] != 0))
-          MPI_Send(C_inv_trunc.data(), C_inv_trunc.size(), MPI_DOUBLE, jProcessor, 0, SU2_MPI::GetComm());
-    } else if (nVertexTarget != 0) {
-      C_inv_trunc.resize(1 + nPolynomial + nGlobalVertexDonor, nGlobalVertexDonor);
-      MPI_Recv(C_inv_trunc.data(), C_inv_trunc.size(), MPI_DOUBLE, iProcessor, 0, SU2_MPI::GetComm(),
-               MPI_STATUS_IGNORE);
+    /*--- With the sparse solver each rank computes the coefficients of its own target points. ---*/
+    if (!sparse) {
+      /*--- For simplicity, broadcast small information about the interpolation matrix. ---*/
+      SU2_MPI::Bcast(&nPolynomial, 1, MPI_INT, iProcessor, SU2_MPI::GetComm());
+      SU2_MPI::Bcast(keepPolynomialRow.data(), nDim, MPI_INT, iProcessor, SU2_MPI::GetComm());
+
+      /*--- Send C_inv_trunc only to the ranks that need it (those with target points),
+       *    partial broadcast. MPI wrapper not used due to passive double. ---*/
+      vector<unsigned long> allNumVertex(nProcessor);
+      SU2_MPI::Allgather(&nVertexTarget, 1, MPI_UNSIGNED_LONG, allNumVertex.data(), 1, MPI_UNSIGNED_LONG,
+                         SU2_MPI::GetComm());
+
+      if (rank == iProcessor) {
+        for (int jProcessor = 0; jProcessor < nProcessor; ++jProcessor)
+          if ((jProcessor != iProcessor) && (allNumVertex[jProcessor] != 0))
+            MPI_Send(C_inv_trunc.data(), C_inv_trunc.size(), MPI_DOUBLE, jProcessor, 0, SU2_MPI::GetComm());
+      } else if (nVertexTarget != 0) {
+        C_inv_trunc.resize(1 + nPolynomial + nGlobalVertexDonor, nGlobalVertexDonor);
+        MPI_Recv(C_inv_trunc.data(), C_inv_trunc.size(), MPI_DOUBLE, iProcessor, 0, SU2_MPI::GetComm(),
+                 MPI_STATUS_IGNORE);
+      }
     }
 #endif
 
-    /*--- Compute interpolation matrix (H). This is a large matrix-matrix product with
-     *    the generator matrix (C_inv_trunc) on the right. We avoid instantiation
-     *    of the entire function matrix (A) and of the result (H), but work
-     *    on a slab (set of rows) of A/H to amortize accesses to C_inv_trunc. ---*/
-
     /*--- Fetch target vertex coordinates. ---*/
 
     if (nVertexTarget) targetVertices[markTarget].resize(nVertexTarget);
@@ -283,106 +432,127 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
     totalTargetPoints += nVertexTarget;
     denseSize += nVertexTarget * nGlobalVertexDonor;
 
-    /*--- Distribute target slabs over the threads in the rank for processing. ---*/
-
-    SU2_OMP_PARALLEL
-    if (nVertexTarget > 0) {
-      constexpr unsigned long targetSlabSize = 32;
-
-      su2passivematrix funcMat(targetSlabSize, 1 + nPolynomial + nGlobalVertexDonor);
-      su2passivematrix interpMat(targetSlabSize, nGlobalVertexDonor);
-
-      /*--- Thread-local variables for statistics. ---*/
-      unsigned long minDonors = 1 << 30, maxDonors = 0, totalDonors = 0;
-      passivedouble sumCorr = 0.0, maxCorr = 0.0;
-
-      SU2_OMP_FOR_DYN(1)
-      for (auto iVertexTarget = 0ul; iVertexTarget < nVertexTarget; iVertexTarget += targetSlabSize) {
-        const auto iLastVertex = min(nVertexTarget, iVertexTarget + targetSlabSize);
-        const auto slabSize = iLastVertex - iVertexTarget;
-
-        /*--- Prepare matrix of functions A (the targets to donors matrix). ---*/
-
-        /*--- Polynominal part: ---*/
-        if (usePolynomial) {
-          /*--- Constant term. ---*/
-          for (auto k = 0ul; k < slabSize; ++k) funcMat(k, 0) = 1.0;
-
-          /*--- Linear terms. ---*/
-          for (int iDim = 0, idx = 1; iDim < nDim; ++iDim) {
-            /*--- Of which one may have been excluded. ---*/
-            if (!keepPolynomialRow[iDim]) continue;
-            for (auto k = 0ul; k < slabSize; ++k)
-              funcMat(k, idx) = SU2_TYPE::GetValue(targetCoord[iVertexTarget + k][iDim]);
-            idx += 1;
-          }
+    /*--- Prune the coefficients of a target point and store them with the donor information,
+     *    the coefficients are ordered as the donors in the arrays above. ---*/
+    vector<unsigned long> nDonorsVec(nVertexTarget);
+    vector<passivedouble> correctionVec(nVertexTarget);
+
+    auto setCoefficients = [&](unsigned long iVertexTarget, const unsigned long* donors, passivedouble* coeffs,
+                               unsigned long nCoeff) {
+      auto& targetVertex = targetVertices[markTarget][iVertexTarget];
+
+      /*--- Prune small coefficients. ---*/
+      const auto info = PruneSmallCoefficients(SU2_TYPE::GetValue(pruneTol), nCoeff, coeffs);
+      nDonorsVec[iVertexTarget] = info.first;
+      correctionVec[iVertexTarget] = fabs(info.second - 1.0);  // far from 1 either way is bad;
+
+      /*--- Allocate and set donor information for this target point. ---*/
+      targetVertex.resize(info.first);
+
+      for (unsigned long i = 0, iSet = 0; i < nCoeff; ++i) {
+        const auto iVertex = donors ? donors[i] : i;
+        if (fabs(coeffs[i]) > 0.0) {
+          targetVertex.processor[iSet] = donorProc[iVertex];
+          targetVertex.globalPoint[iSet] = donorPoint[iVertex];
+          targetVertex.coefficient[iSet] = coeffs[i];
+          ++iSet;
         }
-        /*--- RBF terms: ---*/
-        for (auto iVertexDonor = 0ul; iVertexDonor < nGlobalVertexDonor; ++iVertexDonor) {
-          for (auto k = 0ul; k < slabSize; ++k) {
-            auto dist = GeometryToolbox::Distance(nDim, targetCoord[iVertexTarget + k], donorCoord[iVertexDonor]);
-            auto rbf = Get_RadialBasisValue(kindRBF, paramRBF, dist);
-            funcMat(k, 1 + nPolynomial + iVertexDonor) = SU2_TYPE::GetValue(rbf);
+      }
+    };
+
+    if (sparse) {
+      /*--- Solve a small system on the donor neighbourhood of each target point. ---*/
+      unsigned long maxIter = 0;
+      passivedouble maxTrunc = 0.0;
+      totalNotConverged += ComputeSparseCoefficients(
+          kindRBF, SU2_TYPE::GetValue(paramRBF), neighborhood, SolverMaxIterations, donorCoord, targetCoord,
+          [&](unsigned long iVertexTarget, const vector<unsigned long>& donors, vector<passivedouble>& coeffs) {
+            setCoefficients(iVertexTarget, donors.data(), coeffs.data(), coeffs.size());
+          },
+          maxIter, maxTrunc);
+      MaxIterations = max(MaxIterations, maxIter);
+      MaxTruncation = max(MaxTruncation, maxTrunc);
+    } else {
+      /*--- Compute interpolation matrix (H). This is a large matrix-matrix product with
+       *    the generator matrix (C_inv_trunc) on the right. We avoid instantiation
+       *    of the entire function matrix (A) and of the result (H), but work
+       *    on a slab (set of rows) of A/H to amortize accesses to C_inv_trunc. ---*/
+
+      /*--- Distribute target slabs over the threads in the rank for processing. ---*/
+
+      SU2_OMP_PARALLEL
+      if (nVertexTarget > 0) {
+        constexpr unsigned long targetSlabSize = 32;
+
+        su2passivematrix funcMat(targetSlabSize, 1 + nPolynomial + nGlobalVertexDonor);
+        su2passivematrix interpMat(targetSlabSize, nGlobalVertexDonor);
+
+        SU2_OMP_FOR_DYN(1)
+        for (auto iVertexTarget = 0ul; iVertexTarget < nVertexTarget; iVertexTarget += targetSlabSize) {
+          const auto iLastVertex = min(nVertexTarget, iVertexTarget + targetSlabSize);
+          const auto slabSize = iLastVertex - iVertexTarget;
+
+          /*--- Prepare matrix of functions A (the targets to donors matrix). ---*/
+
+          /*--- Polynominal part: ---*/
+          if (usePolynomial) {
+            /*--- Constant term. ---*/
+            for (auto k = 0ul; k < slabSize; ++k) funcMat(k, 0) = 1.0;
+
+            /*--- Linear terms. ---*/
+            for (int iDim = 0, idx = 1; iDim < nDim; ++iDim) {
+              /*--- Of which one may have been excluded. ---*/
+              if (!keepPolynomialRow[iDim]) continue;
+              for (auto k = 0ul; k < slabSize; ++k)
+                funcMat(k, idx) = SU2_TYPE::GetValue(targetCoord[iVertexTarget + k][iDim]);
+              idx += 1;
+            }
+          }
+          /*--- RBF terms: ---*/
+          for (auto iVertexDonor = 0ul; iVertexDonor < nGlobalVertexDonor; ++iVertexDonor) {
+            for (auto k = 0ul; k < slabSize; ++k) {
+              auto dist = GeometryToolbox::Distance(nDim, targetCoord[iVertexTarget + k], donorCoord[iVertexDonor]);
+              auto rbf = Get_RadialBasisValue(kindRBF, paramRBF, dist);
+              funcMat(k, 1 + nPolynomial + iVertexDonor) = SU2_TYPE::GetValue(rbf);
+            }
           }
-        }
 
-        /*--- Compute slab of the interpolation matrix. ---*/
+          /*--- Compute slab of the interpolation matrix. ---*/
 #ifdef HAVE_LAPACK
-        /*--- interpMat = funcMat * C_inv_trunc, but order of gemm arguments
-         *    is swapped due to row-major storage of su2passivematrix. ---*/
-        const char op = 'N';
-        const int M = interpMat.cols(), N = slabSize, K = funcMat.cols();
-        // lda = C_inv_trunc.cols() = M; ldb = funcMat.cols() = K; ldc = interpMat.cols() = M;
-        const passivedouble alpha = 1.0, beta = 0.0;
-        DGEMM(&op, &op, &M, &N, &K, &alpha, C_inv_trunc[0], &M, funcMat[0], &K, &beta, interpMat[0], &M);
+          /*--- interpMat = funcMat * C_inv_trunc, but order of gemm arguments
+           *    is swapped due to row-major storage of su2passivematrix. ---*/
+          const char op = 'N';
+          const int M = interpMat.cols(), N = slabSize, K = funcMat.cols();
+          // lda = C_inv_trunc.cols() = M; ldb = funcMat.cols() = K; ldc = interpMat.cols() = M;
+          const passivedouble alpha = 1.0, beta = 0.0;
+          DGEMM(&op, &op, &M, &N, &K, &alpha, C_inv_trunc[0], &M, funcMat[0], &K, &beta, interpMat[0], &M);
 #else
-        /*--- Naive product, loop order considers short-wide
-         *    nature of funcMat and interpMat. ---*/
-        interpMat = 0.0;
-        for (auto k = 0ul; k < funcMat.cols(); ++k)
-          for (auto i = 0ul; i < slabSize; ++i)
-            for (auto j = 0ul; j < interpMat.cols(); ++j) interpMat(i, j) += funcMat(i, k) * C_inv_trunc(k, j);
+          /*--- Naive product, loop order considers short-wide
+           *    nature of funcMat and interpMat. ---*/
+          interpMat = 0.0;
+          for (auto k = 0ul; k < funcMat.cols(); ++k)
+            for (auto i = 0ul; i < slabSize; ++i)
+              for (auto j = 0ul; j < interpMat.cols(); ++j) interpMat(i, j) += funcMat(i, k) * C_inv_trunc(k, j);
 #endif
-        /*--- Set interpolation coefficients. ---*/
-
-        for (auto k = 0ul; k < slabSize; ++k) {
-          auto& targetVertex = targetVertices[markTarget][iVertexTarget + k];
-
-          /*--- Prune small coefficients. ---*/
-          auto info = PruneSmallCoefficients(SU2_TYPE::GetValue(pruneTol), interpMat.cols(), interpMat[k]);
-          auto nnz = info.first;
-          totalDonors += nnz;
-          minDonors = min(minDonors, nnz);
-          maxDonors = max(maxDonors, nnz);
-          auto corr = fabs(info.second - 1.0);  // far from 1 either way is bad;
-          sumCorr += corr;
-          maxCorr = max(maxCorr, corr);
-
-          /*--- Allocate and set donor information for this target point. ---*/
-          targetVertex.resize(nnz);
-
-          for (unsigned long iVertex = 0, iSet = 0; iVertex < nGlobalVertexDonor; ++iVertex) {
-            auto coeff = interpMat(k, iVertex);
-            if (fabs(coeff) > 0.0) {
-              targetVertex.processor[iSet] = donorProc[iVertex];
-              targetVertex.globalPoint[iSet] = donorPoint[iVertex];
-              targetVertex.coefficient[iSet] = coeff;
-              ++iSet;
-            }
-          }
-        }
-      }  // end target vertex loop
-      END_SU2_OMP_FOR
-      SU2_OMP_CRITICAL {
-        totalDonorPoints += totalDonors;
-        MinDonors = min(MinDonors, minDonors);
-        MaxDonors = max(MaxDonors, maxDonors);
-        AvgCorrection += sumCorr;
-        MaxCorrection = max(MaxCorrection, maxCorr);
+
+          /*--- Set interpolation coefficients. ---*/
+          for (auto k = 0ul; k < slabSize; ++k)
+            setCoefficients(iVertexTarget + k, nullptr, interpMat[k], nGlobalVertexDonor);
+
+        }  // end target vertex loop
+        END_SU2_OMP_FOR
       }
-      END_SU2_OMP_CRITICAL
+      END_SU2_OMP_PARALLEL
+    }
+
+    /*--- Statistics of the donors and of the pruning. ---*/
+    for (auto iVertexTarget = 0ul; iVertexTarget < nVertexTarget; ++iVertexTarget) {
+      totalDonorPoints += nDonorsVec[iVertexTarget];
+      MinDonors = min(MinDonors, nDonorsVec[iVertexTarget]);
+      MaxDonors = max(MaxDonors, nDonorsVec[iVertexTarget]);
+      AvgCorrection += correctionVec[iVertexTarget];
+      MaxCorrection = max(MaxCorrection, correctionVec[iVertexTarget]);
     }
-    END_SU2_OMP_PARALLEL
 
     /*--- Free global data that will no longer be used. ---*/
     donorCoord.resize(0, 0);
@@ -402,10 +572,13 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
   Reduce(MPI_SUM, denseSize);
   Reduce(MPI_MIN, MinDonors);
   Reduce(MPI_MAX, MaxDonors);
+  Reduce(MPI_MAX, MaxIterations);
+  Reduce(MPI_SUM, totalNotConverged);
 #ifdef HAVE_MPI
-  passivedouble tmp1 = AvgCorrection, tmp2 = MaxCorrection;
+  passivedouble tmp1 = AvgCorrection, tmp2 = MaxCorrection, tmp3 = MaxTruncation;
   MPI_Allreduce(&tmp1, &AvgCorrection, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
   MPI_Allreduce(&tmp2, &MaxCorrection, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  MPI_Allreduce(&tmp3, &MaxTruncation, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
 #endif
   if (totalTargetPoints == 0) SU2_MPI::Error("Somehow there are no target interpolation points.", CURRENT_FUNCTION);
 
@@ -417,12 +590,211 @@ void CRadialBasisFunction::SetTransferCoeff(const CConfig* const* config) {
         " - The pruning tolerance is too aggressive.",
         CURRENT_FUNCTION);
 
+  if (totalNotConverged > 0)
+    SU2_MPI::Error(
+        "The SPARSE RBF solver did not converge in " + to_string(SolverMaxIterations) + " iterations, either:\n"
+        " - Reduce the RBF radius (the kernel is better conditioned with fewer donors per point).\n"
+        " - Use RADIAL_BASIS_FUNCTION_SOLVER= DENSE.",
+        CURRENT_FUNCTION);
+
   MaxCorrection += 1.0;  // put back the reference "1"
   AvgCorrection = AvgCorrection / totalTargetPoints + 1.0;
   AvgDonors = totalDonorPoints / totalTargetPoints;
   Density = totalDonorPoints / (0.01 * denseSize);
 }
 
+void CRadialBasisFunction::SortByGlobalIndex(su2activematrix& coords, vector<long>& globalPoint,
+                                             vector<int>& processor) {
+  const int nPoint = globalPoint.size();
+  const int nDim = coords.cols();
+
+  vector<int> order(nPoint);
+  iota(order.begin(), order.end(), 0);
+  sort(order.begin(), order.end(), [&globalPoint](int i, int j) { return globalPoint[i] < globalPoint[j]; });
+
+  for (int i = 0; i < nPoint; ++i) {
+    int j = order[i];
+    while (j < i) j = order[j];
+    if (i == j) continue;
+    swap(processor[i], processor[j]);
+    swap(globalPoint[i], globalPoint[j]);
+    for (int iDim = 0; iDim < nDim; ++iDim) swap(coords(i, iDim), coords(j, iDim));
+  }
+}
+
+void CRadialBasisFunction::CollectDonorNeighborhood(int markDonor, int markTarget, unsigned long nVertexDonor,
+                                                    passivedouble distance, su2activematrix& coords,
+                                                    vector<long>& globalPoint, vector<int>& processor) const {
+  const int nDim = donor_geometry->GetnDim();
+  const int nProcessor = size;
+
+  /*--- Bounding box of the local target points grown by "distance", it is empty (lower
+   *    bound greater than the upper bound) if the rank has no target points. ---*/
+  vector<su2double> box(2 * nDim), allBoxes(2 * nDim * nProcessor);
+  for (int iDim = 0; iDim < nDim; ++iDim) {
+    box[iDim] = numeric_limits<passivedouble>::max();
+    box[nDim + iDim] = numeric_limits<passivedouble>::lowest();
+  }
+  const auto nVertexTarget = (markTarget != -1) ? target_geometry->GetnVertex(markTarget) : 0ul;
+  for (auto iVertex = 0ul; iVertex < nVertexTarget; ++iVertex) {
+    const auto* coord = target_geometry->nodes->GetCoord(target_geometry->vertex[markTarget][iVertex]->GetNode());
+    for (int iDim = 0; iDim < nDim; ++iDim) {
+      box[iDim] = min(box[iDim], coord[iDim] - distance);
+      box[nDim + iDim] = max(box[nDim + iDim], coord[iDim] + distance);
+    }
+  }
+  SU2_MPI::Allgather(box.data(), 2 * nDim, MPI_DOUBLE, allBoxes.data(), 2 * nDim, MPI_DOUBLE, SU2_MPI::GetComm());
+
+  auto InBox = [&](int iProcessor, const su2double* coord) {
+    const auto* lower = &allBoxes[2 * nDim * iProcessor];
+    for (int iDim = 0; iDim < nDim; ++iDim)
+      if (coord[iDim] < lower[iDim] || coord[iDim] > lower[nDim + iDim]) return false;
+    return true;
+  };
+
+  /*--- Send each rank the local donor points that are inside its box. ---*/
+  vector<unsigned long> localDonors;
+  for (auto iVertex = 0ul; iVertex < nVertexDonor; ++iVertex) {
+    const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+    if (donor_geometry->nodes->GetDomain(iPoint)) localDonors.push_back(iPoint);
+  }
+
+  vector<int> nSend(nProcessor, 0), nRecv(nProcessor);
+  for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor)
+    for (const auto iPoint : localDonors)
+      nSend[iProcessor] += InBox(iProcessor, donor_geometry->nodes->GetCoord(iPoint));
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  vector<int> sendDispl(nProcessor + 1, 0), recvDispl(nProcessor + 1, 0);
+  partial_sum(nSend.begin(), nSend.end(), sendDispl.begin() + 1);
+  partial_sum(nRecv.begin(), nRecv.end(), recvDispl.begin() + 1);
+
+  su2activematrix sendCoord(sendDispl.back(), nDim);
+  vector<unsigned long> sendPoint(sendDispl.back()), recvPoint(recvDispl.back());
+  coords.resize(recvDispl.back(), nDim);
+
+  for (int iProcessor = 0, iSend = 0; iProcessor < nProcessor; ++iProcessor) {
+    for (const auto iPoint : localDonors) {
+      const auto* coord = donor_geometry->nodes->GetCoord(iPoint);
+      if (!InBox(iProcessor, coord)) continue;
+      for (int iDim = 0; iDim < nDim; ++iDim) sendCoord(iSend, iDim) = coord[iDim];
+      sendPoint[iSend] = donor_geometry->nodes->GetGlobalIndex(iPoint);
+      ++iSend;
+    }
+  }
+
+  SU2_MPI::Alltoallv(sendPoint.data(), nSend.data(), sendDispl.data(), MPI_UNSIGNED_LONG, recvPoint.data(),
+                     nRecv.data(), recvDispl.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  /*--- The coordinates are sent as nDim values per point. ---*/
+  for (int iProcessor = 0; iProcessor <= nProcessor; ++iProcessor) {
+    if (iProcessor < nProcessor) {
+      nSend[iProcessor] *= nDim;
+      nRecv[iProcessor] *= nDim;
+    }
+    sendDispl[iProcessor] *= nDim;
+    recvDispl[iProcessor] *= nDim;
+  }
+  SU2_MPI::Alltoallv(sendCoord.data(), nSend.data(), sendDispl.data(), MPI_DOUBLE, coords.data(), nRecv.data(),
+                     recvDispl.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+
+  globalPoint.resize(recvPoint.size());
+  processor.resize(recvPoint.size());
+  for (int iProcessor = 0; iProcessor < nProcessor; ++iProcessor) {
+    for (auto i = recvDispl[iProcessor] / nDim; i < recvDispl[iProcessor + 1] / nDim; ++i) {
+      globalPoint[i] = recvPoint[i];
+      processor[i] = iProcessor;
+    }
+  }
+
+  /*--- MPI-independent order, see SetTransferCoeff. ---*/
+  SortByGlobalIndex(coords, globalPoint, processor);
+}
+
+unsigned long CRadialBasisFunction::ComputeSparseCoefficients(
+    RADIAL_BASIS type, passivedouble radius, passivedouble neighborhood, unsigned long iterLimit,
+    const su2activematrix& donorCoords, const vector<const su2double*>& targetCoords,
+    const std::function<void(unsigned long, const vector<unsigned long>&, vector<passivedouble>&)>& setCoefficients,
+    unsigned long& maxIterations, passivedouble& maxTruncation) {
+  const auto nDonor = donorCoords.rows();
+  const auto nTarget = targetCoords.size();
+  const int nDim = donorCoords.cols();
+
+  const CPointBins bins(donorCoords, radius);
+  unsigned long totalNotConverged = 0;
+  maxIterations = 0;
+  maxTruncation = 0.0;
+
+  SU2_OMP_PARALLEL {
+    /*--- Thread-local work space, sized by the largest neighbourhood. ---*/
+    vector<unsigned long> donors;
+    vector<long> localIndex(nDonor, -1);
+    vector<passivedouble> coeffs;
+    su2passivematrix funcMat, solMat, resMat, precMat, dirMat, prodMat;
+    CSparseKernel kernel;
+
+    unsigned long maxIter = 0, notConverged = 0;
+    passivedouble maxTrunc = 0.0;
+
+    SU2_OMP_FOR_DYN(8)
+    for (auto iTarget = 0ul; iTarget < nTarget; ++iTarget) {
+      const auto* target = targetCoords[iTarget];
+
+      /*--- Donors in the neighbourhood of the target point, in the (MPI-independent) order of the input. ---*/
+      donors.clear();
+      bins.ForEachNeighbor(target, neighborhood * radius,
+                           [&donors](unsigned long iDonor, passivedouble) { donors.push_back(iDonor); });
+      sort(donors.begin(), donors.end());
+      const auto nLocal = donors.size();
+      for (auto i = 0ul; i < nLocal; ++i) localIndex[donors[i]] = i;
+
+      /*--- Kernel of the neighbourhood (K) and target to donors functions (a), K * h = a. ---*/
+      kernel.Assemble(type, radius, donorCoords, bins, donors, localIndex);
+      funcMat.resize(nLocal, 1);
+      for (auto i = 0ul; i < nLocal; ++i) {
+        const auto dist = GeometryToolbox::Distance(nDim, target, donorCoords[donors[i]]);
+        funcMat(i, 0) = SU2_TYPE::GetValue(Get_RadialBasisValue(type, radius, dist));
+      }
+      solMat.resize(nLocal, 1);
+      resMat.resize(nLocal, 1);
+      precMat.resize(nLocal, 1);
+      dirMat.resize(nLocal, 1);
+      prodMat.resize(nLocal, 1);
+
+      unsigned long iter = 0;
+      notConverged += !kernel.Solve(funcMat, solMat, SolverTolerance, iterLimit, resMat, precMat, dirMat, prodMat,
+                                    iter);
+      maxIter = max(maxIter, iter);
+
+      /*--- Largest coefficient in the outer layer of the neighbourhood, relative to the largest one. ---*/
+      coeffs.resize(nLocal);
+      passivedouble maxCoeff = 0.0, maxOuter = 0.0;
+      for (auto i = 0ul; i < nLocal; ++i) {
+        coeffs[i] = solMat(i, 0);
+        maxCoeff = max(maxCoeff, fabs(coeffs[i]));
+        const auto dist = GeometryToolbox::Distance(nDim, target, donorCoords[donors[i]]);
+        if (dist > (neighborhood - 1) * radius) maxOuter = max(maxOuter, fabs(coeffs[i]));
+      }
+      if (maxCoeff > 0) maxTrunc = max(maxTrunc, maxOuter / maxCoeff);
+
+      for (const auto iDonor : donors) localIndex[iDonor] = -1;
+
+      setCoefficients(iTarget, donors, coeffs);
+    }
+    END_SU2_OMP_FOR
+    SU2_OMP_CRITICAL {
+      maxIterations = max(maxIterations, maxIter);
+      maxTruncation = max(maxTruncation, maxTrunc);
+      totalNotConverged += notConverged;
+    }
+    END_SU2_OMP_CRITICAL
+  }
+  END_SU2_OMP_PARALLEL
+
+  return totalNotConverged;
+}
+
 void CRadialBasisFunction::ComputeGeneratorMatrix(RADIAL_BASIS type, bool usePolynomial, su2double radius,
                                                   const su2activematrix& coords, int& nPolynomial,
                                                   vector<int>& keepPolynomialRow, su2passivematrix& C_inv_trunc) {
@@ -29,14 +29,18 @@
 
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/allocation_toolbox.hpp"
+#include "../../include/toolboxes/CProfiler.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 template <class ScalarType>
 CSysMatrix<ScalarType>::CSysMatrix() : rank(SU2_MPI::GetRank()), size(SU2_MPI::GetSize()) {
   nPoint = nPointDomain = nVar = nEqn = 0;
   nnz = nnz_ilu = 0;
   ilu_fill_in = 0;
+  ilu_level_sched = false;
 
   omp_partitions = nullptr;
 
@@ -53,6 +57,10 @@ CSysMatrix<ScalarType>::CSysMatrix() : rank(SU2_MPI::GetRank()), size(SU2_MPI::G
 
   invM = nullptr;
 
+  sell_format = false;
+  sell_matrix = nullptr;
+  sell_dirty = true;
+
 #ifdef USE_MKL
   MatrixMatrixProductJitter = nullptr;
   MatrixVectorProductJitterBetaOne = nullptr;
@@ -67,6 +75,7 @@ CSysMatrix<ScalarType>::~CSysMatrix() {
   MemoryAllocation::aligned_free(ILU_matrix);
   MemoryAllocation::aligned_free(matrix);
   MemoryAllocation::aligned_free(invM);
+  MemoryAllocation::aligned_free(sell_matrix);
 
 #ifdef USE_MKL
   mkl_jit_destroy(MatrixMatrixProductJitter);
@@ -149,6 +158,9 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     col_ind_ilu = csr_ilu.innerIdx();
     dia_ptr_ilu = csr_ilu.diagPtr();
     nnz_ilu = csr_ilu.getNumNonZeros();
+
+    ilu_level_sched = config->GetLinear_Solver_ILU_Level_Scheduling();
+    if (ilu_level_sched) SetILULevelSchedule();
   }
 
   /*--- Allocate data. ---*/
@@ -164,6 +176,14 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
 
   if (diag_needed) allocAndInit(invM, nPointDomain * nVar * nEqn);
 
+  /*--- SIMD-friendly copy of the matrix for the products. ---*/
+
+  sell_format = (config->GetLinear_Solver_SpMV_Format() == SPARSE_MATRIX_FORMAT::SELL_C_SIGMA);
+  if (sell_format) {
+    SetSELLStructure();
+    allocAndInit(sell_matrix, sell_col_ind.size() * nVar * nEqn);
+  }
+
   /*--- Thread parallel initialization. ---*/
 
   int num_threads = omp_get_max_threads();
@@ -227,6 +247,7 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
 template <class T>
 void CSysMatrixComms::Initiate(const CSysVector<T>& x, CGeometry* geometry, const CConfig* config,
                                unsigned short commType) {
+  SU2_PROFILE_SCOPE("HaloInitiateComms");
   if (geometry->nP2PSend == 0) return;
 
   /*--- Local variables ---*/
@@ -342,6 +363,7 @@ void CSysMatrixComms::Initiate(const CSysVector<T>& x, CGeometry* geometry, cons
 
 template <class T>
 void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry* geometry, const CConfig* config, unsigned short commType) {
+  SU2_PROFILE_SCOPE("HaloCompleteComms");
   if (geometry->nP2PRecv == 0) return;
 
   /*--- Local variables ---*/
@@ -455,6 +477,7 @@ void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry* geometry, const CCon
 
 template <class ScalarType>
 void CSysMatrix<ScalarType>::SetValZero() {
+  SetSELLDirty();
   const auto size = nnz * nVar * nEqn;
   const auto chunk = roundUpDiv(size, omp_get_num_threads());
   const auto begin = chunk * omp_get_thread_num();
@@ -465,6 +488,7 @@ void CSysMatrix<ScalarType>::SetValZero() {
 
 template <class ScalarType>
 void CSysMatrix<ScalarType>::SetValDiagonalZero() {
+  SetSELLDirty();
   SU2_OMP_FOR_STAT(omp_heavy_size)
   for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
     for (auto index = 0ul; index < nVar * nEqn; ++index) matrix[dia_ptr[iPoint] * nVar * nEqn + index] = 0.0;
@@ -551,6 +575,7 @@ void CSysMatrix<ScalarType>::MatrixInverse(ScalarType* matrix, ScalarType* inver
 
 template <class ScalarType>
 void CSysMatrix<ScalarType>::DeleteValsRowi(unsigned long i) {
+  SetSELLDirty();
   const auto block_i = i / nVar;
   const auto row = i % nVar;
 
@@ -581,11 +606,56 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& v
 
   SU2_OMP_BARRIER
 
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
-    RowProduct(vec, row_i, &prod[row_i * nVar]);
+  if (sell_format) {
+    /*--- Refresh the SELL copy if the values were modified since the last product. All threads read the flag
+     *    before it is reset by the master, as the update loop ends with a barrier. ---*/
+    if (sell_dirty.load(std::memory_order_relaxed)) {
+      UpdateSELLValues();
+      SU2_OMP_MASTER
+      sell_dirty.store(false, std::memory_order_relaxed);
+      END_SU2_OMP_MASTER
+      SU2_OMP_BARRIER
+    }
+
+    const auto nSlice = sell_slice_ptr.size() - 1;
+    const auto nBlk = nVar * nEqn;
+
+    SU2_OMP_FOR_DYN(roundUpDiv(omp_heavy_size, SELL_C))
+    for (auto iSlice = 0ul; iSlice < nSlice; ++iSlice) {
+      /*--- Accumulate the products of the SELL_C rows of the slice as SIMD lanes. ---*/
+      ScalarType acc[MAXNVAR * SELL_C], vec_j[SELL_C];
+      for (auto i = 0ul; i < nVar * SELL_C; ++i) acc[i] = 0.0;
+
+      for (auto iGroup = sell_slice_ptr[iSlice]; iGroup < sell_slice_ptr[iSlice + 1]; ++iGroup) {
+        const auto cols = &sell_col_ind[iGroup * SELL_C];
+        const auto block = &sell_matrix[iGroup * nBlk * SELL_C];
+
+        for (auto jVar = 0ul; jVar < nEqn; ++jVar) {
+          SU2_OMP_SIMD_IF_NOT_AD
+          for (auto k = 0ul; k < SELL_C; ++k) vec_j[k] = vec[cols[k] * nEqn + jVar];
+
+          for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+            const auto entry = &block[(iVar * nEqn + jVar) * SELL_C];
+            SU2_OMP_SIMD_IF_NOT_AD
+            for (auto k = 0ul; k < SELL_C; ++k) acc[iVar * SELL_C + k] += entry[k] * vec_j[k];
+          }
+        }
+      }
+
+      for (auto k = 0ul; k < SELL_C; ++k) {
+        const auto row_i = sell_rows[iSlice * SELL_C + k];
+        if (row_i == nPointDomain) break;
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) prod[row_i * nVar + iVar] = acc[iVar * SELL_C + k];
+      }
+    }
+    END_SU2_OMP_FOR
+  } else {
+    SU2_OMP_FOR_DYN(omp_heavy_size)
+    for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
+      RowProduct(vec, row_i, &prod[row_i * nVar]);
+    }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 
   /*--- MPI Parallelization. ---*/
 
@@ -593,6 +663,81 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& v
   CSysMatrixComms::Complete(prod, geometry, config);
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::SetSELLStructure() {
+  /*--- Sort the rows by decreasing length within each window, this makes the rows of a slice
+   *    have similar lengths (less padding) while preserving some of the original locality. ---*/
+
+  vector<unsigned long> perm(nPointDomain);
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) perm[iPoint] = iPoint;
+
+  auto rowLength = [this](unsigned long iPoint) { return row_ptr[iPoint + 1] - row_ptr[iPoint]; };
+
+  for (auto begin = 0ul; begin < nPointDomain; begin += SELL_SIGMA) {
+    const auto end = min<unsigned long>(begin + SELL_SIGMA, nPointDomain);
+    stable_sort(perm.begin() + begin, perm.begin() + end,
+                [&](unsigned long a, unsigned long b) { return rowLength(a) > rowLength(b); });
+  }
+
+  /*--- Each slice is as wide as its longest row, padding rows (of the last slice) are marked with nPointDomain. ---*/
+
+  const auto nSlice = roundUpDiv(nPointDomain, SELL_C);
+  sell_rows.assign(nSlice * SELL_C, nPointDomain);
+  sell_slice_ptr.assign(nSlice + 1, 0);
+
+  for (auto iSlice = 0ul; iSlice < nSlice; ++iSlice) {
+    unsigned long width = 0;
+    for (auto k = 0ul; k < SELL_C && iSlice * SELL_C + k < nPointDomain; ++k) {
+      const auto iPoint = perm[iSlice * SELL_C + k];
+      sell_rows[iSlice * SELL_C + k] = iPoint;
+      width = max(width, rowLength(iPoint));
+    }
+    sell_slice_ptr[iSlice + 1] = sell_slice_ptr[iSlice] + width;
+  }
+
+  /*--- Padding blocks are zero and point to a valid column (the row itself) to keep the gathers in bounds. ---*/
+
+  const auto nGroup = sell_slice_ptr[nSlice];
+  sell_col_ind.resize(nGroup * SELL_C);
+  sell_src.resize(nGroup * SELL_C);
+
+  for (auto iSlice = 0ul; iSlice < nSlice; ++iSlice) {
+    for (auto k = 0ul; k < SELL_C; ++k) {
+      const auto iPoint = sell_rows[iSlice * SELL_C + k];
+      const auto length = (iPoint < nPointDomain) ? rowLength(iPoint) : 0ul;
+
+      for (auto iGroup = sell_slice_ptr[iSlice]; iGroup < sell_slice_ptr[iSlice + 1]; ++iGroup) {
+        const auto offset = iGroup - sell_slice_ptr[iSlice];
+        const auto slot = iGroup * SELL_C + k;
+        if (offset < length) {
+          sell_src[slot] = row_ptr[iPoint] + offset;
+          sell_col_ind[slot] = col_ind[sell_src[slot]];
+        } else {
+          sell_src[slot] = nnz;
+          sell_col_ind[slot] = (iPoint < nPointDomain) ? iPoint : 0;
+        }
+      }
+    }
+  }
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::UpdateSELLValues() const {
+  const auto nBlk = nVar * nEqn;
+  const auto nGroup = sell_slice_ptr.back();
+
+  SU2_OMP_FOR_STAT(roundUpDiv(nGroup, omp_get_num_threads()))
+  for (auto iGroup = 0ul; iGroup < nGroup; ++iGroup) {
+    for (auto k = 0ul; k < SELL_C; ++k) {
+      const auto src = sell_src[iGroup * SELL_C + k];
+      if (src == nnz) continue;
+      for (auto iEntry = 0ul; iEntry < nBlk; ++iEntry)
+        sell_matrix[(iGroup * nBlk + iEntry) * SELL_C + k] = matrix[src * nBlk + iEntry];
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::BuildJacobiPreconditioner() {
   /*--- Build Jacobi preconditioner (M = D), compute and store the inverses of the diagonal blocks. ---*/
@@ -647,6 +792,25 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
 
   /*--- Transform system in Upper Matrix ---*/
 
+  if (ilu_level_sched) {
+    /*--- Rows in the same level only depend on rows of previous levels, which are
+     *    fully factorized (and their diagonal inverted), thus all couplings are kept. ---*/
+
+    for (auto iLevel = 0ul; iLevel + 1 < ilu_lower_level_ptr.size(); ++iLevel) {
+      const auto begin = ilu_lower_level_ptr[iLevel];
+      const auto end = ilu_lower_level_ptr[iLevel + 1];
+
+      SU2_OMP_FOR_STAT(roundUpDiv(end - begin, omp_get_num_threads()))
+      for (auto k = begin; k < end; ++k) {
+        const auto iPoint = ilu_lower_level_rows[k];
+        FactorizeILURow(iPoint, 0, nPointDomain);
+        InverseDiagonalBlock_ILUMatrix(iPoint, &invM[iPoint * nVar * nVar]);
+      }
+      END_SU2_OMP_FOR
+    }
+    return;
+  }
+
   /*--- OpenMP Parallelization, a loop construct is used to ensure
    *    the preconditioner is computed correctly even if called
    *    outside of a parallel section. ---*/
@@ -661,58 +825,98 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
      *    to row/col "end-1" (i.e. the range [begin,end[). Which is exactly
      *    what the MPI-only implementation does. ---*/
 
-    ScalarType weight[MAXNVAR * MAXNVAR], aux_block[MAXNVAR * MAXNVAR];
+    for (auto iPoint = begin; iPoint < end; iPoint++) {
+      FactorizeILURow(iPoint, begin, end);
+      InverseDiagonalBlock_ILUMatrix(iPoint, &invM[iPoint * nVar * nVar]);
+    }
+  }
+  END_SU2_OMP_FOR
+}
 
-    for (auto iPoint = begin + 1; iPoint < end; iPoint++) {
-      /*--- Invert and store the previous diagonal block to later compute the weight. ---*/
+template <class ScalarType>
+void CSysMatrix<ScalarType>::FactorizeILURow(unsigned long iPoint, unsigned long begin, unsigned long end) {
+  ScalarType weight[MAXNVAR * MAXNVAR], aux_block[MAXNVAR * MAXNVAR];
 
-      InverseDiagonalBlock_ILUMatrix(iPoint - 1, &invM[(iPoint - 1) * nVar * nVar]);
+  /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
 
-      /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
+  for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+    /*--- jPoint is the column index (jPoint < iPoint). ---*/
 
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        /*--- jPoint is the column index (jPoint < iPoint). ---*/
+    auto jPoint = col_ind_ilu[index];
 
-        auto jPoint = col_ind_ilu[index];
+    /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
 
-        /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
+    if (jPoint < begin) continue;
 
-        if (jPoint < begin) continue;
+    /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
 
-        /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
+    auto Block_ij = &ILU_matrix[index * nVar * nVar];
+    MatrixMatrixProduct(Block_ij, &invM[jPoint * nVar * nVar], weight);
 
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixMatrixProduct(Block_ij, &invM[jPoint * nVar * nVar], weight);
+    /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
 
-        /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
+    for (auto index_ = dia_ptr_ilu[jPoint] + 1; index_ < row_ptr_ilu[jPoint + 1]; index_++) {
+      /*--- Get the column index (kPoint > jPoint). ---*/
 
-        for (auto index_ = dia_ptr_ilu[jPoint] + 1; index_ < row_ptr_ilu[jPoint + 1]; index_++) {
-          /*--- Get the column index (kPoint > jPoint). ---*/
+      auto kPoint = col_ind_ilu[index_];
 
-          auto kPoint = col_ind_ilu[index_];
+      if (kPoint >= end) break;
 
-          if (kPoint >= end) break;
+      /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
 
-          /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
+      auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
 
-          auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
+      if (Block_ik != nullptr) {
+        auto Block_jk = &ILU_matrix[index_ * nVar * nVar];
+        MatrixMatrixProduct(weight, Block_jk, aux_block);
+        MatrixSubtraction(Block_ik, aux_block, Block_ik);
+      }
+    }
 
-          if (Block_ik != nullptr) {
-            auto Block_jk = &ILU_matrix[index_ * nVar * nVar];
-            MatrixMatrixProduct(weight, Block_jk, aux_block);
-            MatrixSubtraction(Block_ik, aux_block, Block_ik);
-          }
-        }
+    /*--- Lastly, store "weight" in the lower triangular part, which
+     will be reused during the forward solve in the precon/smoother. ---*/
 
-        /*--- Lastly, store "weight" in the lower triangular part, which
-         will be reused during the forward solve in the precon/smoother. ---*/
+    for (auto iVar = 0ul; iVar < nVar * nVar; ++iVar) Block_ij[iVar] = weight[iVar];
+  }
+}
 
-        for (auto iVar = 0ul; iVar < nVar * nVar; ++iVar) Block_ij[iVar] = weight[iVar];
-      }
+template <class ScalarType>
+void CSysMatrix<ScalarType>::SetILULevelSchedule() {
+  /*--- The level of a row is one more than the highest level of the rows it depends on.
+   *    Rows are then sorted by level (counting sort), keeping their original order within
+   *    each level for locality. Halo points are not part of the local factorization. ---*/
+
+  auto sortByLevel = [](const vector<unsigned long>& level, vector<unsigned long>& ptr, vector<unsigned long>& rows) {
+    const auto nLevel = *max_element(level.begin(), level.end()) + 1;
+    ptr.assign(nLevel + 1, 0);
+    for (auto lvl : level) ++ptr[lvl + 1];
+    for (auto i = 0ul; i < nLevel; ++i) ptr[i + 1] += ptr[i];
+
+    rows.resize(level.size());
+    auto pos = ptr;
+    for (auto i = 0ul; i < level.size(); ++i) rows[pos[level[i]]++] = i;
+  };
+
+  vector<unsigned long> level(nPointDomain, 0);
+
+  /*--- Forward sweep (and factorization), depends on the lower part. ---*/
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; ++index)
+      level[iPoint] = max(level[iPoint], level[col_ind_ilu[index]] + 1);
+  }
+  sortByLevel(level, ilu_lower_level_ptr, ilu_lower_level_rows);
+
+  /*--- Backward sweep, depends on the upper part. ---*/
+  level.assign(nPointDomain, 0);
+  for (auto iPoint = nPointDomain; iPoint > 0;) {
+    iPoint--;  // unsigned type
+    for (auto index = dia_ptr_ilu[iPoint] + 1; index < row_ptr_ilu[iPoint + 1]; ++index) {
+      const auto jPoint = col_ind_ilu[index];
+      if (jPoint >= nPointDomain) break;
+      level[iPoint] = max(level[iPoint], level[jPoint] + 1);
     }
-    InverseDiagonalBlock_ILUMatrix(end - 1, &invM[(end - 1) * nVar * nVar]);
   }
-  END_SU2_OMP_FOR
+  sortByLevel(level, ilu_upper_level_ptr, ilu_upper_level_rows);
 }
 
 template <class ScalarType>
@@ -721,49 +925,57 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
-  /*--- OpenMP Parallelization ---*/
-  SU2_OMP_FOR_STAT(1)
-  for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
-    const auto begin = omp_partitions[thread];
-    const auto end = omp_partitions[thread + 1];
-    if (begin == end) continue;
+  if (ilu_level_sched) {
+    SU2_OMP_FOR_STAT(omp_light_size)
+    for (auto iVar = 0ul; iVar < nPointDomain * nVar; iVar++) prod[iVar] = vec[iVar];
+    END_SU2_OMP_FOR
 
-    ScalarType aux_vec[MAXNVAR];
+    /*--- Forward and backward sweeps level by level, each level depends only on the previous ones. ---*/
 
-    /*--- Copy vector to then work on prod in place ---*/
+    for (auto iLevel = 0ul; iLevel + 1 < ilu_lower_level_ptr.size(); ++iLevel) {
+      const auto begin = ilu_lower_level_ptr[iLevel];
+      const auto end = ilu_lower_level_ptr[iLevel + 1];
 
-    for (auto iVar = begin * nVar; iVar < end * nVar; iVar++) prod[iVar] = vec[iVar];
+      SU2_OMP_FOR_STAT(roundUpDiv(end - begin, omp_get_num_threads()))
+      for (auto k = begin; k < end; ++k) ForwardSolveILURow(ilu_lower_level_rows[k], 0, prod);
+      END_SU2_OMP_FOR
+    }
 
-    /*--- Forward solve the system using the lower matrix entries that
-     were computed and stored during the ILU preprocessing. Note
-     that we are overwriting the residual vector as we go. ---*/
+    for (auto iLevel = 0ul; iLevel + 1 < ilu_upper_level_ptr.size(); ++iLevel) {
+      const auto begin = ilu_upper_level_ptr[iLevel];
+      const auto end = ilu_upper_level_ptr[iLevel + 1];
 
-    for (auto iPoint = begin + 1; iPoint < end; iPoint++) {
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint < begin) continue;
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], &prod[iPoint * nVar]);
-      }
+      SU2_OMP_FOR_STAT(roundUpDiv(end - begin, omp_get_num_threads()))
+      for (auto k = begin; k < end; ++k) BackwardSolveILURow(ilu_upper_level_rows[k], nPointDomain, prod);
+      END_SU2_OMP_FOR
     }
+  } else {
+    /*--- OpenMP Parallelization ---*/
+    SU2_OMP_FOR_STAT(1)
+    for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread + 1];
+      if (begin == end) continue;
 
-    /*--- Backwards substitution (starts at the last row) ---*/
+      /*--- Copy vector to then work on prod in place ---*/
 
-    for (auto iPoint = end; iPoint > begin;) {
-      iPoint--;  // unsigned type
-      for (auto iVar = 0ul; iVar < nVar; iVar++) aux_vec[iVar] = prod[iPoint * nVar + iVar];
+      for (auto iVar = begin * nVar; iVar < end * nVar; iVar++) prod[iVar] = vec[iVar];
 
-      for (auto index = dia_ptr_ilu[iPoint] + 1; index < row_ptr_ilu[iPoint + 1]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint >= end) break;
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], aux_vec);
-      }
+      /*--- Forward solve the system using the lower matrix entries that
+       were computed and stored during the ILU preprocessing. Note
+       that we are overwriting the residual vector as we go. ---*/
+
+      for (auto iPoint = begin + 1; iPoint < end; iPoint++) ForwardSolveILURow(iPoint, begin, prod);
+
+      /*--- Backwards substitution (starts at the last row) ---*/
 
-      MatrixVectorProduct(&invM[iPoint * nVar * nVar], aux_vec, &prod[iPoint * nVar]);
+      for (auto iPoint = end; iPoint > begin;) {
+        iPoint--;  // unsigned type
+        BackwardSolveILURow(iPoint, end, prod);
+      }
     }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 
   /*--- MPI Parallelization ---*/
 
@@ -970,6 +1182,348 @@ void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<Scala
   CSysMatrixComms::Complete(prod, geometry, config);
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::SetupAMGHierarchy(unsigned short maxLevels) {
+  /*--- Parameters of the aggregation, strong connections have a (squared) block norm of at least
+   *    "theta^2" times the largest off-diagonal norm of the row. Coarsening stops if it becomes
+   *    ineffective, or when the levels become small enough to be solved by smoothing alone. ---*/
+  const ScalarType theta2 = 0.0625;
+  constexpr unsigned long MIN_COARSE_POINTS = 64;
+  constexpr passivedouble MIN_COARSENING_RATIO = 1.25;
+  constexpr auto FREE = std::numeric_limits<unsigned long>::max();
+
+  const auto blkSz = nVar * nVar;
+
+  AMGLevels.clear();
+  AMGLevels.reserve(max<unsigned short>(maxLevels, 1));
+
+  /*--- The finest level is the matrix itself (excluding halos). ---*/
+  AMGLevels.emplace_back();
+  AMGLevels[0].nPoint = nPointDomain;
+  AMGLevels[0].row_ptr = row_ptr;
+  AMGLevels[0].col_ind = col_ind;
+  AMGLevels[0].dia_ptr = dia_ptr;
+  AMGLevels[0].matrix = matrix;
+
+  while (AMGLevels.size() < maxLevels) {
+    auto& fine = AMGLevels.back();
+    const auto n = fine.nPoint;
+    if (n <= MIN_COARSE_POINTS) break;
+
+    /*--- Strength of connection based on the (squared) Frobenius norm of the blocks. ---*/
+
+    vector<ScalarType> norm(fine.row_ptr[n], 0.0), maxNorm(n, 0.0);
+
+    for (auto iPoint = 0ul; iPoint < n; ++iPoint) {
+      for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint + 1]; ++k) {
+        const auto jPoint = fine.col_ind[k];
+        if (jPoint >= n || jPoint == iPoint) continue;
+        for (auto i = 0ul; i < blkSz; ++i) norm[k] += fine.matrix[k * blkSz + i] * fine.matrix[k * blkSz + i];
+        maxNorm[iPoint] = max(maxNorm[iPoint], norm[k]);
+      }
+    }
+
+    auto isStrong = [&](unsigned long iPoint, unsigned long k) {
+      const auto jPoint = fine.col_ind[k];
+      return (jPoint < n) && (jPoint != iPoint) && (norm[k] > 0) && (norm[k] >= theta2 * maxNorm[iPoint]);
+    };
+
+    /*--- Phase 1, points whose strong neighbors are all free become the seeds of new aggregates. ---*/
+
+    vector<unsigned long> aggregate(n, FREE);
+    unsigned long nCoarse = 0;
+
+    for (auto iPoint = 0ul; iPoint < n; ++iPoint) {
+      if (aggregate[iPoint] != FREE) continue;
+      bool seed = false;
+      for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint + 1]; ++k) {
+        if (!isStrong(iPoint, k)) continue;
+        seed = (aggregate[fine.col_ind[k]] == FREE);
+        if (!seed) break;
+      }
+      if (!seed) continue;
+
+      aggregate[iPoint] = nCoarse;
+      for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint + 1]; ++k)
+        if (isStrong(iPoint, k)) aggregate[fine.col_ind[k]] = nCoarse;
+      ++nCoarse;
+    }
+
+    /*--- Phase 2, free points join the aggregate of their strongest neighbor from phase 1. ---*/
+
+    const auto seeds = aggregate;
+
+    for (auto iPoint = 0ul; iPoint < n; ++iPoint) {
+      if (aggregate[iPoint] != FREE) continue;
+      ScalarType strongest = 0.0;
+      for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint + 1]; ++k) {
+        if (!isStrong(iPoint, k) || seeds[fine.col_ind[k]] == FREE || norm[k] <= strongest) continue;
+        strongest = norm[k];
+        aggregate[iPoint] = seeds[fine.col_ind[k]];
+      }
+    }
+
+    /*--- Phase 3, the remaining points are aggregated with their free strong neighbors (or alone). ---*/
+
+    for (auto iPoint = 0ul; iPoint < n; ++iPoint) {
+      if (aggregate[iPoint] != FREE) continue;
+      aggregate[iPoint] = nCoarse;
+      for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint + 1]; ++k)
+        if (isStrong(iPoint, k) && aggregate[fine.col_ind[k]] == FREE) aggregate[fine.col_ind[k]] = nCoarse;
+      ++nCoarse;
+    }
+
+    if (nCoarse * MIN_COARSENING_RATIO > n) break;
+
+    /*--- Lists of fine points that form each coarse point. ---*/
+
+    fine.aggPtr.assign(nCoarse + 1, 0);
+    for (auto iPoint = 0ul; iPoint < n; ++iPoint) ++fine.aggPtr[aggregate[iPoint] + 1];
+    for (auto iCoarse = 0ul; iCoarse < nCoarse; ++iCoarse) fine.aggPtr[iCoarse + 1] += fine.aggPtr[iCoarse];
+
+    fine.aggIdx.resize(n);
+    auto pos = fine.aggPtr;
+    for (auto iPoint = 0ul; iPoint < n; ++iPoint) fine.aggIdx[pos[aggregate[iPoint]]++] = iPoint;
+
+    /*--- Sparse pattern of the Galerkin operator R*A*P, and map from fine to coarse blocks. ---*/
+
+    CAMGLevel coarse;
+    coarse.nPoint = nCoarse;
+    coarse.rowPtr.reserve(nCoarse + 1);
+    coarse.rowPtr.push_back(0);
+    coarse.diaPtr.reserve(nCoarse);
+    fine.galerkinMap.assign(fine.row_ptr[n], FREE);
+
+    vector<unsigned long> cols;
+
+    for (auto iCoarse = 0ul; iCoarse < nCoarse; ++iCoarse) {
+      cols.clear();
+      for (auto idx = fine.aggPtr[iCoarse]; idx < fine.aggPtr[iCoarse + 1]; ++idx) {
+        const auto iPoint = fine.aggIdx[idx];
+        for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint + 1]; ++k)
+          if (fine.col_ind[k] < n) cols.push_back(aggregate[fine.col_ind[k]]);
+      }
+      sort(cols.begin(), cols.end());
+      cols.erase(unique(cols.begin(), cols.end()), cols.end());
+
+      const auto offset = coarse.rowPtr.back();
+      coarse.colInd.insert(coarse.colInd.end(), cols.begin(), cols.end());
+      coarse.diaPtr.push_back(offset + (lower_bound(cols.begin(), cols.end(), iCoarse) - cols.begin()));
+      coarse.rowPtr.push_back(coarse.colInd.size());
+
+      for (auto idx = fine.aggPtr[iCoarse]; idx < fine.aggPtr[iCoarse + 1]; ++idx) {
+        const auto iPoint = fine.aggIdx[idx];
+        for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint + 1]; ++k) {
+          if (fine.col_ind[k] >= n) continue;
+          const auto it = lower_bound(cols.begin(), cols.end(), aggregate[fine.col_ind[k]]);
+          fine.galerkinMap[k] = offset + (it - cols.begin());
+        }
+      }
+    }
+    coarse.values.resize(coarse.colInd.size() * blkSz, 0.0);
+
+    fine.aggregate = std::move(aggregate);
+
+    /*--- This invalidates "fine", the data of the vectors does not move. ---*/
+    AMGLevels.push_back(std::move(coarse));
+
+    auto& level = AMGLevels.back();
+    level.row_ptr = level.rowPtr.data();
+    level.col_ind = level.colInd.data();
+    level.dia_ptr = level.diaPtr.data();
+    level.matrix = level.values.data();
+  }
+
+  /*--- Working memory and thread partitions. ---*/
+
+  for (auto iLevel = 0ul; iLevel < AMGLevels.size(); ++iLevel) {
+    auto& level = AMGLevels[iLevel];
+    const auto n = level.nPoint;
+
+    if (iLevel > 0) {
+      level.sol.resize(n * nVar);
+      level.rhs.resize(n * nVar);
+    }
+    level.res.resize(n * nVar);
+    level.solOld.resize(n * nVar);
+    level.invDiag.resize(n * blkSz);
+
+    const auto nParts = max<unsigned long>(1, min<unsigned long>(omp_num_parts, n / OMP_MIN_SIZE));
+    level.parts.resize(nParts + 1);
+    for (auto iPart = 0ul; iPart <= nParts; ++iPart) level.parts[iPart] = (iPart * n) / nParts;
+  }
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildAMGPreconditioner(const CConfig* config) {
+  /*--- The hierarchy is built once, the aggregates are kept as the matrix values change. ---*/
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    if (AMGLevels.empty()) {
+      amg_smooth_iter = max<unsigned short>(config->GetLinear_Solver_AMG_Smooth_Iter(), 1);
+      SetupAMGHierarchy(config->GetLinear_Solver_AMG_Levels());
+    }
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  const auto blkSz = nVar * nVar;
+
+  for (auto iLevel = 0ul; iLevel < AMGLevels.size(); ++iLevel) {
+    auto& level = AMGLevels[iLevel];
+
+    /*--- Galerkin coarse operator, with piecewise constant prolongation the coarse
+     *    blocks are the sums of the fine blocks coupling two aggregates. ---*/
+    if (iLevel > 0) {
+      const auto& fine = AMGLevels[iLevel - 1];
+
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (auto iCoarse = 0ul; iCoarse < level.nPoint; ++iCoarse) {
+        for (auto i = level.rowPtr[iCoarse] * blkSz; i < level.rowPtr[iCoarse + 1] * blkSz; ++i) level.values[i] = 0.0;
+
+        for (auto idx = fine.aggPtr[iCoarse]; idx < fine.aggPtr[iCoarse + 1]; ++idx) {
+          const auto iPoint = fine.aggIdx[idx];
+          for (auto k = fine.row_ptr[iPoint]; k < fine.row_ptr[iPoint + 1]; ++k) {
+            if (fine.col_ind[k] >= fine.nPoint) continue;
+            auto* dst = &level.values[fine.galerkinMap[k] * blkSz];
+            const auto* src = &fine.matrix[k * blkSz];
+            SU2_OMP_SIMD
+            for (auto i = 0ul; i < blkSz; ++i) dst[i] += src[i];
+          }
+        }
+      }
+      END_SU2_OMP_FOR
+    }
+
+    /*--- Inverse diagonal blocks for the smoother. ---*/
+
+    SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+    for (auto iPoint = 0ul; iPoint < level.nPoint; ++iPoint) {
+      ScalarType block[MAXNVAR * MAXNVAR];
+      MatrixCopy(&level.matrix[level.dia_ptr[iPoint] * blkSz], block);
+      MatrixInverse(block, &level.invDiag[iPoint * blkSz]);
+    }
+    END_SU2_OMP_FOR
+  }
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::AMGSmooth(const CAMGLevel& level, const ScalarType* rhs, ScalarType* sol,
+                                       unsigned short nSweeps, bool zeroGuess) const {
+  const auto n = level.nPoint;
+  const auto blkSz = nVar * nVar;
+  auto* solOld = level.solOld.data();
+
+  const auto nParts = level.parts.size() - 1;
+
+  if (zeroGuess) parallelSet(n * nVar, 0.0, sol);
+
+  for (auto iSweep = 0u; iSweep < nSweeps; ++iSweep) {
+    /*--- Values owned by other partitions are taken from the previous sweep. ---*/
+    parallelCopy(n * nVar, sol, solOld);
+
+    SU2_OMP_FOR_STAT(1)
+    for (auto iPart = 0ul; iPart < nParts; ++iPart) {
+      const auto begin = level.parts[iPart];
+      const auto end = level.parts[iPart + 1];
+
+      auto relaxPoint = [&](unsigned long iPoint) {
+        ScalarType aux_vec[MAXNVAR];
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) aux_vec[iVar] = rhs[iPoint * nVar + iVar];
+
+        for (auto k = level.row_ptr[iPoint]; k < level.row_ptr[iPoint + 1]; ++k) {
+          const auto jPoint = level.col_ind[k];
+          if (jPoint == iPoint || jPoint >= n) continue;
+          const auto* x = (jPoint >= begin && jPoint < end) ? sol : solOld;
+          MatrixVectorProductSub(&level.matrix[k * blkSz], &x[jPoint * nVar], aux_vec);
+        }
+        MatrixVectorProduct(&level.invDiag[iPoint * blkSz], aux_vec, &sol[iPoint * nVar]);
+      };
+
+      /*--- Symmetric sweep, forward then backward. ---*/
+      for (auto iPoint = begin; iPoint < end; ++iPoint) relaxPoint(iPoint);
+      for (auto iPoint = end; iPoint > begin;) relaxPoint(--iPoint);
+    }
+    END_SU2_OMP_FOR
+  }
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::AMGCycle(unsigned long iLevel, const ScalarType* rhs, ScalarType* sol) const {
+  const auto& level = AMGLevels[iLevel];
+  const auto n = level.nPoint;
+  const auto blkSz = nVar * nVar;
+
+  /*--- The coarsest level is only smoothed, with more sweeps. ---*/
+
+  if (iLevel + 1 == AMGLevels.size()) {
+    AMGSmooth(level, rhs, sol, 4 * amg_smooth_iter, true);
+    return;
+  }
+
+  /*--- Pre-smoothing. ---*/
+
+  AMGSmooth(level, rhs, sol, amg_smooth_iter, true);
+
+  /*--- Residual of the level. ---*/
+
+  const auto chunk = computeStaticChunkSize(n, omp_get_num_threads(), OMP_MAX_SIZE_H);
+  auto* res = level.res.data();
+
+  SU2_OMP_FOR_STAT(chunk)
+  for (auto iPoint = 0ul; iPoint < n; ++iPoint) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) res[iPoint * nVar + iVar] = rhs[iPoint * nVar + iVar];
+    for (auto k = level.row_ptr[iPoint]; k < level.row_ptr[iPoint + 1]; ++k) {
+      const auto jPoint = level.col_ind[k];
+      if (jPoint < n) MatrixVectorProductSub(&level.matrix[k * blkSz], &sol[jPoint * nVar], &res[iPoint * nVar]);
+    }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Restriction (sum over the aggregates). ---*/
+
+  const auto& coarse = AMGLevels[iLevel + 1];
+  auto* coarseRhs = coarse.rhs.data();
+  auto* coarseSol = coarse.sol.data();
+
+  SU2_OMP_FOR_STAT(chunk)
+  for (auto iCoarse = 0ul; iCoarse < coarse.nPoint; ++iCoarse) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) coarseRhs[iCoarse * nVar + iVar] = 0.0;
+    for (auto idx = level.aggPtr[iCoarse]; idx < level.aggPtr[iCoarse + 1]; ++idx) {
+      const auto iPoint = level.aggIdx[idx];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) coarseRhs[iCoarse * nVar + iVar] += res[iPoint * nVar + iVar];
+    }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Coarse grid correction and its prolongation (injection). ---*/
+
+  AMGCycle(iLevel + 1, coarseRhs, coarseSol);
+
+  SU2_OMP_FOR_STAT(chunk)
+  for (auto iPoint = 0ul; iPoint < n; ++iPoint) {
+    const auto iCoarse = level.aggregate[iPoint];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) sol[iPoint * nVar + iVar] += coarseSol[iCoarse * nVar + iVar];
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Post-smoothing. ---*/
+
+  AMGSmooth(level, rhs, sol, amg_smooth_iter, false);
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                                      CGeometry* geometry, const CConfig* config) const {
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  AMGCycle(0, &vec[0], &prod[0]);
+
+  /*--- MPI Parallelization ---*/
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::ComputeResidual(const CSysVector<ScalarType>& sol, const CSysVector<ScalarType>& f,
                                              CSysVector<ScalarType>& res) const {
@@ -987,6 +1541,8 @@ template <class ScalarType>
 template <class OtherType>
 void CSysMatrix<ScalarType>::EnforceSolutionAtNode(const unsigned long node_i, const OtherType* x_i,
                                                    CSysVector<OtherType>& b) {
+  SetSELLDirty();
+
   /*--- Eliminate the row associated with node i (Block_ii = I and all other Block_ij = 0).
    *    To preserve eventual symmetry, also attempt to eliminate the column, if the sparse pattern is not
    *    symmetric the entire column may not be eliminated, the result (matrix and vector) is still correct.
@@ -1029,6 +1585,8 @@ template <class ScalarType>
 template <class OtherType>
 void CSysMatrix<ScalarType>::EnforceSolutionAtDOF(unsigned long node_i, unsigned long iVar, OtherType x_i,
                                                   CSysVector<OtherType>& b) {
+  SetSELLDirty();
+
   for (auto index = row_ptr[node_i]; index < row_ptr[node_i + 1]; ++index) {
     const auto node_j = col_ind[index];
 
@@ -1061,6 +1619,8 @@ void CSysMatrix<ScalarType>::EnforceSolutionAtDOF(unsigned long node_i, unsigned
 
 template <class ScalarType>
 void CSysMatrix<ScalarType>::SetDiagonalAsColumnSum() {
+  SetSELLDirty();
+
   SU2_OMP_FOR_DYN(omp_heavy_size)
   for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
     auto block_ii = &matrix[dia_ptr[iPoint] * nVar * nEqn];
@@ -1078,6 +1638,7 @@ void CSysMatrix<ScalarType>::SetDiagonalAsColumnSum() {
 template <class ScalarType>
 void CSysMatrix<ScalarType>::TransposeInPlace() {
   assert(nVar == nEqn && "Cannot transpose with nVar != nEqn.");
+  SetSELLDirty();
 
   auto swapAndTransp = [](unsigned long n, ScalarType* a, ScalarType* b) {
     assert(a != b);
@@ -1159,6 +1720,7 @@ void CSysMatrix<ScalarType>::MatrixMatrixAddition(ScalarType alpha, const CSysMa
   if (!ok) {
     SU2_MPI::Error("Matrices do not have compatible sparsity.", CURRENT_FUNCTION);
   }
+  SetSELLDirty();
 
   SU2_OMP_FOR_STAT(omp_light_size)
   for (auto i = 0ul; i < nnz * nVar * nEqn; ++i) matrix[i] += alpha * B.matrix[i];
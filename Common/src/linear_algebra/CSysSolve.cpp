@@ -33,6 +33,7 @@
 #include "../../include/linear_algebra/CSysMatrix.hpp"
 #include "../../include/linear_algebra/CMatrixVectorProduct.hpp"
 #include "../../include/linear_algebra/CPreconditioner.hpp"
+#include "../../include/toolboxes/CProfiler.hpp"
 
 #include <limits>
 
@@ -172,6 +173,70 @@ void CSysSolve<ScalarType>::ModGramSchmidt(bool shared_hsbg, int i, su2matrix<Sc
   w[i + 1] /= nrm;
 }
 
+template <class ScalarType>
+void CSysSolve<ScalarType>::StartDotProducts(unsigned long n, const CSysVector<ScalarType>* const* a,
+                                             const CSysVector<ScalarType>* const* b) const {
+  /*--- All threads get the same "view" of the vectors and shared variables. ---*/
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    if (dotLocal.size() < n) {
+      dotLocal.resize(n);
+      dotGlobal.resize(n);
+    }
+    for (auto k = 0ul; k < n; ++k) dotLocal[k] = 0.0;
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  /*--- Local dot products for each thread, for all the pairs of vectors. ---*/
+
+  const auto nElm = a[0]->GetNElmDomain();
+  const auto chunk = roundUpDiv(nElm, omp_get_num_threads());
+  const auto begin = min(omp_get_thread_num() * chunk, nElm);
+  const auto end = min(begin + chunk, nElm);
+
+  for (auto k = 0ul; k < n; ++k) {
+    const auto& ak = *a[k];
+    const auto& bk = *b[k];
+    ScalarType sum = 0.0;
+    SU2_OMP_SIMD_IF_NOT_AD
+    for (auto i = begin; i < end; ++i) sum += ak[i] * bk[i];
+    atomicAdd(sum, dotLocal[k]);
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Start the reduction across ranks, only the master thread communicates. ---*/
+
+  SU2_OMP_MASTER {
+#ifdef HAVE_MPI
+    const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
+    if (std::is_same<typename SelectMPIWrapper<ScalarType>::W, CBaseMPIWrapper>::value) {
+      CBaseMPIWrapper::Iallreduce(dotLocal.data(), dotGlobal.data(), n, mpi_type, MPI_SUM, SU2_MPI::GetComm(),
+                                  &dotRequest);
+    } else {
+      /*--- Blocking reduction for active types. ---*/
+      SelectMPIWrapper<ScalarType>::W::Allreduce(dotLocal.data(), dotGlobal.data(), n, mpi_type, MPI_SUM,
+                                                 SU2_MPI::GetComm());
+    }
+#else
+    for (auto k = 0ul; k < n; ++k) dotGlobal[k] = dotLocal[k];
+#endif
+  }
+  END_SU2_OMP_MASTER
+}
+
+template <class ScalarType>
+const ScalarType* CSysSolve<ScalarType>::FinishDotProducts() const {
+#ifdef HAVE_MPI
+  if (std::is_same<typename SelectMPIWrapper<ScalarType>::W, CBaseMPIWrapper>::value) {
+    SU2_OMP_MASTER
+    CBaseMPIWrapper::Wait(&dotRequest, MPI_STATUS_IGNORE);
+    END_SU2_OMP_MASTER
+  }
+#endif
+  /*--- Make view of the results consistent across threads. ---*/
+  SU2_OMP_BARRIER
+  return dotGlobal.data();
+}
+
 template <class ScalarType>
 void CSysSolve<ScalarType>::WriteHeader(const string& solver, ScalarType restol, ScalarType resinit) const {
   cout << "\n# " << solver << " residual history\n";
@@ -564,6 +629,208 @@ unsigned long CSysSolve<ScalarType>::RFGMRES_LinSolver(const CSysVector<ScalarTy
   return 0;
 }
 
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::PFGMRES_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
+                                                       const CMatrixVectorProduct<ScalarType>& mat_vec,
+                                                       const CPreconditioner<ScalarType>& precond, ScalarType tol,
+                                                       unsigned long m, ScalarType& residual, bool monitoring,
+                                                       const CConfig* config) const {
+  const bool masterRank = (SU2_MPI::GetRank() == MASTER_NODE);
+
+  /*---  Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  if (m > 5000) {
+    SU2_MPI::Error("FGMRES subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet. W is the orthonormal basis, Z = M^-1 W, and Q = A Z. ---*/
+
+  if (W.size() <= m || Z.size() <= m || Q.size() <= m) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      for (auto* basis : {&W, &Z, &Q}) {
+        basis->resize(m + 1);
+        for (auto& w : *basis) w.Initialize(x.GetNBlk(), x.GetNBlkDomain(), x.GetNVar(), nullptr);
+      }
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  su2vector<ScalarType> g(m + 1), sn(m + 1), cs(m + 1), y(m), h(m + 1);
+  g = ScalarType(0);
+  sn = ScalarType(0);
+  cs = ScalarType(0);
+  y = ScalarType(0);
+  su2matrix<ScalarType> H(m + 1, m);
+  H = ScalarType(0);
+
+  /*--- Pointers to the pairs of vectors of the batched dot products. ---*/
+  std::vector<const VectorType*> dotA(m + 2), dotB(m + 2);
+
+  /*--- Calculate the norm of the rhs vector. ---*/
+
+  ScalarType norm0 = b.norm();
+
+  /*--- Calculate the initial residual and compute its norm. ---*/
+
+  if (!xIsZero) {
+    mat_vec(x, W[0]);
+    W[0] = b - W[0];
+  } else {
+    W[0] = b;
+  }
+
+  ScalarType beta = W[0].norm();
+
+  if (tol_type == LinearToleranceType::RELATIVE) norm0 = beta;
+
+  if ((beta < tol * norm0) || (beta < eps)) {
+    if (masterRank) {
+      SU2_OMP_MASTER
+      cout << "CSysSolve::PFGMRES(): system solved by initial guess." << endl;
+      END_SU2_OMP_MASTER
+    }
+    residual = beta;
+    return 0;
+  }
+
+  W[0] /= beta;
+  g[0] = beta;
+
+  precond(W[0], Z[0]);
+  mat_vec(Z[0], Q[0]);
+
+  unsigned long i = 0;
+  if ((monitoring) && (masterRank)) {
+    SU2_OMP_MASTER {
+      WriteHeader("PFGMRES", tol, beta);
+      WriteHistory(i, beta / norm0);
+    }
+    END_SU2_OMP_MASTER
+  }
+
+  /*---  Loop over all search directions ---*/
+
+  for (i = 0; i < m; i++) {
+    /*---  Check if solution has converged ---*/
+
+    if (beta < tol * norm0) break;
+
+    /*--- First Gram-Schmidt pass, start the reduction of Q_i . W_k (k <= i) and meanwhile precondition Q_i.
+     *    W_{i+1} is a linear combination of Q_i and W_k, therefore Z_{i+1} is obtained by linearity. ---*/
+
+    for (auto k = 0ul; k <= i; ++k) {
+      dotA[k] = &Q[i];
+      dotB[k] = &W[k];
+    }
+    StartDotProducts(i + 1, dotA.data(), dotB.data());
+
+    const bool next = (i + 1 < m);
+    if (next) precond(Q[i], Z[i + 1]);
+
+    const auto dots = FinishDotProducts();
+
+    W[i + 1] = Q[i];
+    for (auto k = 0ul; k <= i; ++k) {
+      h[k] = dots[k];
+      W[i + 1] -= h[k] * W[k];
+      if (next) Z[i + 1] -= h[k] * Z[k];
+    }
+
+    /*--- Second pass (re-orthogonalization) and norm, start the reduction and meanwhile compute the product
+     *    of the unnormalized direction. The corrections are small, the update of Q_{i+1} by linearity is
+     *    therefore accurate (unlike a recurrence based on the first pass, which amplifies round-off). ---*/
+
+    for (auto k = 0ul; k <= i; ++k) {
+      dotA[k] = &W[i + 1];
+      dotB[k] = &W[k];
+    }
+    dotA[i + 1] = dotB[i + 1] = &W[i + 1];
+    StartDotProducts(i + 2, dotA.data(), dotB.data());
+
+    if (next) mat_vec(Z[i + 1], Q[i + 1]);
+
+    const auto dots2 = FinishDotProducts();
+
+    ScalarType nrm = dots2[i + 1];
+    for (auto k = 0ul; k <= i; ++k) {
+      const ScalarType c = dots2[k];
+      nrm -= c * c;
+      h[k] += c;
+      W[i + 1] -= c * W[k];
+      if (next) {
+        Z[i + 1] -= c * Z[k];
+        Q[i + 1] -= c * Q[k];
+      }
+    }
+    /*--- Recompute the norm explicitly if the estimate is not reliable. ---*/
+    nrm = (nrm > eps * dots2[i + 1]) ? sqrt(nrm) : W[i + 1].norm();
+
+    if ((nrm <= 0.0) || (nrm != nrm)) {
+      SU2_MPI::Error("PFGMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
+    }
+    W[i + 1] /= nrm;
+    if (next) {
+      Z[i + 1] /= nrm;
+      Q[i + 1] /= nrm;
+    }
+
+    for (auto k = 0ul; k <= i; ++k) H[k][i] = h[k];
+    H[i + 1][i] = nrm;
+
+    /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
+     new Givens rotation matrix and apply it to the last two elements of H[:][i] and g ---*/
+
+    for (unsigned long k = 0; k < i; k++) ApplyGivens(sn[k], cs[k], H[k][i], H[k + 1][i]);
+    GenerateGivens(H[i][i], H[i + 1][i], sn[i], cs[i]);
+    ApplyGivens(sn[i], cs[i], g[i], g[i + 1]);
+
+    /*---  Set L2 norm of residual and check if solution has converged ---*/
+
+    beta = fabs(g[i + 1]);
+
+    if ((((monitoring) && (masterRank)) && ((i + 1) % monitorFreq == 0))) {
+      SU2_OMP_MASTER
+      WriteHistory(i + 1, beta / norm0);
+      END_SU2_OMP_MASTER
+    }
+  }
+
+  /*---  Solve the least-squares system and update solution ---*/
+
+  SolveReduced(i, H, g, y);
+
+  for (unsigned long k = 0; k < i; k++) x += y[k] * Z[k];
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+    if (masterRank) {
+      SU2_OMP_MASTER
+      WriteFinalResidual("PFGMRES", i, beta / norm0);
+      END_SU2_OMP_MASTER
+    }
+
+    if (recomputeRes) {
+      mat_vec(x, W[0]);
+      W[0] -= b;
+      ScalarType res = W[0].norm();
+
+      if (fabs(res - beta) > tol * 10) {
+        if (masterRank) {
+          SU2_OMP_MASTER
+          WriteWarning(beta, res, tol);
+          END_SU2_OMP_MASTER
+        }
+      }
+    }
+  }
+
+  residual = beta / norm0;
+  return i;
+}
+
 template <class ScalarType>
 unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
                                                        const CMatrixVectorProduct<ScalarType>& mat_vec,
@@ -737,6 +1004,192 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
   return i;
 }
 
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::PBCGSTAB_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
+                                                        const CMatrixVectorProduct<ScalarType>& mat_vec,
+                                                        const CPreconditioner<ScalarType>& precond, ScalarType tol,
+                                                        unsigned long m, ScalarType& residual, bool monitoring,
+                                                        const CConfig* config) const {
+  const bool masterRank = (SU2_MPI::GetRank() == MASTER_NODE);
+  ScalarType norm_r = 0.0, norm0 = 0.0;
+  unsigned long i = 0;
+
+  /*--- Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet. The algorithm is applied to the right-preconditioned
+   *    system, "hat" vectors are the preconditioned counterparts (M^-1 *) of other vectors. ---*/
+
+  enum { R_HAT, W, W_HAT, T, P_HAT, S, S_HAT, Z_HAT, Q, Q_HAT, Y, N_PBCG };
+
+  if (!bcg_ready || PBCG.size() != N_PBCG) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      auto nVar = b.GetNVar();
+      auto nBlk = b.GetNBlk();
+      auto nBlkDomain = b.GetNBlkDomain();
+
+      for (auto* vec : {&A_x, &r_0, &r, &p, &v, &z}) vec->Initialize(nBlk, nBlkDomain, nVar, nullptr);
+
+      PBCG.resize(N_PBCG);
+      for (auto& vec : PBCG) vec.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+
+      bcg_ready = true;
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  auto& r_hat = PBCG[R_HAT];
+  auto& w = PBCG[W];
+  auto& w_hat = PBCG[W_HAT];
+  auto& t = PBCG[T];
+  auto& p_hat = PBCG[P_HAT];
+  auto& s = PBCG[S];
+  auto& s_hat = PBCG[S_HAT];
+  auto& z_hat = PBCG[Z_HAT];
+  auto& q = PBCG[Q];
+  auto& q_hat = PBCG[Q_HAT];
+  auto& y = PBCG[Y];
+
+  /*--- Calculate the initial residual, compute norm, and check if system is already solved ---*/
+
+  if (!xIsZero) {
+    mat_vec(x, A_x);
+    r = b - A_x;
+  } else {
+    r = b;
+  }
+
+  norm_r = r.norm();
+  norm0 = b.norm();
+
+  if (tol_type == LinearToleranceType::RELATIVE) norm0 = norm_r;
+
+  if ((norm_r < tol * norm0) || (norm_r < eps)) {
+    if (masterRank) {
+      SU2_OMP_MASTER
+      cout << "CSysSolve::PBCGSTAB(): system solved by initial guess." << endl;
+      END_SU2_OMP_MASTER
+    }
+    residual = norm_r / norm0;
+    return 0;
+  }
+
+  if ((monitoring) && (masterRank)) {
+    SU2_OMP_MASTER {
+      WriteHeader("PBCGSTAB", tol, norm_r);
+      WriteHistory(i, norm_r / norm0);
+    }
+    END_SU2_OMP_MASTER
+  }
+
+  /*--- Initialization, w = A M^-1 r, t = A M^-1 w. ---*/
+
+  r_0 = r;
+  precond(r, r_hat);
+  mat_vec(r_hat, w);
+  precond(w, w_hat);
+  mat_vec(w_hat, t);
+
+  ScalarType rho = r_0.dot(r);
+  ScalarType alpha = rho / r_0.dot(w);
+  ScalarType beta = 0.0, omega = 0.0;
+
+  const VectorType* dotA1[] = {&q, &y};
+  const VectorType* dotB1[] = {&y, &y};
+  const VectorType* dotA2[] = {&r_0, &r_0, &r_0, &r_0, &r};
+  const VectorType* dotB2[] = {&r, &w, &s, &z, &r};
+
+  /*--- Loop over all search directions ---*/
+
+  for (i = 0; i < m; i++) {
+    /*--- Update the search directions, z is A M^-1 s. ---*/
+
+    if (i == 0) {
+      p = r;
+      p_hat = r_hat;
+      s = w;
+      s_hat = w_hat;
+      z = t;
+    } else {
+      p = r + beta * (p - omega * s);
+      p_hat = r_hat + beta * (p_hat - omega * s_hat);
+      s = w + beta * (s - omega * z);
+      s_hat = w_hat + beta * (s_hat - omega * z_hat);
+      z = t + beta * (z - omega * v);
+    }
+    q = r - alpha * s;
+    q_hat = r_hat - alpha * s_hat;
+    y = w - alpha * z;
+
+    /*--- Reduce (q,y) and (y,y) while computing v = A M^-1 z. ---*/
+
+    StartDotProducts(2, dotA1, dotB1);
+    precond(z, z_hat);
+    mat_vec(z_hat, v);
+    const auto dots1 = FinishDotProducts();
+
+    /*--- Calculate step-length omega, avoid division by 0. ---*/
+
+    if (dots1[1] == ScalarType(0)) break;
+    omega = dots1[0] / dots1[1];
+
+    /*--- Update solution and residual. ---*/
+
+    x += alpha * p_hat + omega * q_hat;
+    r = q - omega * y;
+    r_hat = q_hat - omega * (w_hat - alpha * z_hat);
+    w = y - omega * (t - alpha * v);
+
+    /*--- Reduce (r0,r), (r0,w), (r0,s), (r0,z), and (r,r) while computing t = A M^-1 w. ---*/
+
+    StartDotProducts(5, dotA2, dotB2);
+    precond(w, w_hat);
+    mat_vec(w_hat, t);
+    const auto dots2 = FinishDotProducts();
+
+    const ScalarType rho_prime = rho;
+    rho = dots2[0];
+    beta = (rho / rho_prime) * (alpha / omega);
+    alpha = rho / (dots2[1] + beta * (dots2[2] - omega * dots2[3]));
+
+    /*--- Check if solution has converged, else output the relative residual if necessary. ---*/
+
+    norm_r = sqrt(dots2[4]);
+    if (norm_r < tol * norm0) break;
+    if (((monitoring) && (masterRank)) && ((i + 1) % monitorFreq == 0)) {
+      SU2_OMP_MASTER
+      WriteHistory(i + 1, norm_r / norm0);
+      END_SU2_OMP_MASTER
+    }
+  }
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+    if (masterRank) {
+      SU2_OMP_MASTER
+      WriteFinalResidual("PBCGSTAB", i, norm_r / norm0);
+      END_SU2_OMP_MASTER
+    }
+
+    if (recomputeRes) {
+      mat_vec(x, A_x);
+      r = b - A_x;
+      ScalarType true_res = r.norm();
+
+      if ((fabs(true_res - norm_r) > tol * 10.0) && (masterRank)) {
+        SU2_OMP_MASTER
+        WriteWarning(norm_r, true_res, tol);
+        END_SU2_OMP_MASTER
+      }
+    }
+  }
+
+  residual = norm_r / norm0;
+  return i;
+}
+
 template <class ScalarType>
 unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarType>& b, CSysVector<ScalarType>& x,
                                                         const CMatrixVectorProduct<ScalarType>& mat_vec,
@@ -866,6 +1319,8 @@ template <class ScalarType>
 unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, const CSysVector<su2double>& LinSysRes,
                                            CSysVector<su2double>& LinSysSol, CGeometry* geometry,
                                            const CConfig* config) {
+  SU2_PROFILE_SCOPE("LinearSolver");
+
   /*---
    A word about the templated types. It is assumed that the residual and solution vectors are always of su2doubles,
    meaning that they are active in the discrete adjoint. The same assumption is made in SetExternalSolve.
@@ -973,6 +1428,14 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
         IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                        ScreenOutput, config);
         break;
+      case PIPELINED_FGMRES:
+        IterLinSol = PFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+                                       ScreenOutput, config);
+        break;
+      case PIPELINED_BCGSTAB:
+        IterLinSol = PBCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter,
+                                        residual, ScreenOutput, config);
+        break;
       case CONJUGATE_GRADIENT:
         IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                   ScreenOutput, config);
@@ -1022,6 +1485,9 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
         case ILU:
           if (RequiresTranspose) Jacobian.BuildILUPreconditioner();
           break;
+        case AMG:
+          if (RequiresTranspose) Jacobian.BuildAMGPreconditioner(config);
+          break;
         case JACOBI:
         case LINELET:
           if (RequiresTranspose) Jacobian.BuildJacobiPreconditioner();
@@ -1059,6 +1525,8 @@ template <class ScalarType>
 unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, const CSysVector<su2double>& LinSysRes,
                                              CSysVector<su2double>& LinSysSol, CGeometry* geometry,
                                              const CConfig* config, const bool directCall) {
+  SU2_PROFILE_SCOPE("LinearSolver");
+
   unsigned short KindSolver, KindPrecond;
   unsigned long MaxIter, IterLinSol = 0;
   ScalarType SolverTol;
@@ -1132,6 +1600,14 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, c
       IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                      ScreenOutput, config);
       break;
+    case PIPELINED_FGMRES:
+      IterLinSol = PFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+                                     ScreenOutput, config);
+      break;
+    case PIPELINED_BCGSTAB:
+      IterLinSol = PBCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+                                      ScreenOutput, config);
+      break;
     case CONJUGATE_GRADIENT:
       IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                 ScreenOutput, config);
@@ -28,6 +28,7 @@
 
 #include "../../include/CConfig.hpp"
 #include "../../include/linear_algebra/blas_structure.hpp"
+#include "../../include/toolboxes/CProfiler.hpp"
 #include <cstring>
 
 /* MKL or BLAS, if supported. */
@@ -55,11 +56,7 @@ CBlasStructure::CBlasStructure()
 /* Dense matrix multiplication, gemm functionality. */
 void CBlasStructure::gemm(const int M, const int N, const int K, const su2double* A, const su2double* B, su2double* C,
                           const CConfig* config) {
-  /* Initialize the variable for the timing, if profiling is active. */
-#ifdef PROFILE
-  double timeGemm;
-  if (config) config->GEMM_Tick(&timeGemm);
-#endif
+  SU2_PROFILE_SCOPE("GEMM");
 
 #if (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)) || \
     !(defined(HAVE_LIBXSMM) || defined(HAVE_MKL) || defined(HAVE_BLAS))
@@ -93,11 +90,6 @@ void CBlasStructure::gemm(const int M, const int N, const int K, const su2double
   dgemm_(&trans, &trans, &N, &M, &K, &alpha, B, &N, A, &K, &beta, C, &N);
 
 #endif
-#endif
-
-  /* Store the profiling information, if needed. */
-#ifdef PROFILE
-  if (config) config->GEMM_Tock(timeGemm, M, N, K);
 #endif
 }
 
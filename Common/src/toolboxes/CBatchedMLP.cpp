@@ -0,0 +1,268 @@
+/*!
+ * \file CBatchedMLP.cpp
+ * \brief Implementation of the batched evaluation of multi-layer perceptrons.
+ * \author E.C.Bunschoten
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CBatchedMLP.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+#if defined(HAVE_MLPCPP)
+#define MLP_CUSTOM_TYPE su2double
+#include "../../../subprojects/MLPCpp/include/CReadNeuralNetwork.hpp"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+using namespace std;
+
+CBatchedMLP::CBatchedMLP(unsigned short n_files, const string* filenames) {
+  unsigned long max_neurons = 0;
+
+  for (auto iFile = 0u; iFile < n_files; iFile++) {
+    networks.push_back(ReadNetwork(filenames[iFile]));
+    for (auto n : networks.back().n_neurons) max_neurons = max(max_neurons, n);
+  }
+
+  layer_input.resize(BLOCK_SIZE * max_neurons);
+  layer_output.resize(BLOCK_SIZE * max_neurons);
+}
+
+CBatchedMLP::CNetwork CBatchedMLP::ReadNetwork(const string& filename) {
+  CNetwork network;
+#if defined(HAVE_MLPCPP)
+  MLPToolbox::CReadNeuralNetwork reader(filename);
+  reader.ReadMLPFile();
+
+  const map<string, ACTIVATION> activation_map = {{"linear", ACTIVATION::LINEAR},
+                                                   {"relu", ACTIVATION::RELU},
+                                                   {"elu", ACTIVATION::ELU},
+                                                   {"selu", ACTIVATION::SELU},
+                                                   {"swish", ACTIVATION::SWISH},
+                                                   {"sigmoid", ACTIVATION::SIGMOID},
+                                                   {"tanh", ACTIVATION::TANH},
+                                                   {"gelu", ACTIVATION::GELU},
+                                                   {"exponential", ACTIVATION::EXPONENTIAL},
+                                                   {"smooth_slope", ACTIVATION::SMOOTH_SLOPE}};
+
+  const auto n_layers = reader.GetNlayers();
+  for (auto iLayer = 0ul; iLayer < n_layers; iLayer++) {
+    network.n_neurons.push_back(reader.GetNneurons(iLayer));
+
+    const auto name = reader.GetActivationFunction(iLayer);
+    const auto it = activation_map.find(name);
+    if (it == activation_map.end()) {
+      SU2_MPI::Error(string("Activation function ") + name + string(" of ") + filename +
+                     string(" is not supported."), CURRENT_FUNCTION);
+    }
+    network.activations.push_back(it->second);
+  }
+
+  for (auto iInput = 0ul; iInput < reader.GetNInputs(); iInput++) {
+    network.input_names.push_back(reader.GetInputName(iInput));
+    const auto norm = reader.GetInputNorm(iInput);
+    network.input_norm.emplace_back(SU2_TYPE::GetValue(norm.first), SU2_TYPE::GetValue(norm.second));
+  }
+  for (auto iOutput = 0ul; iOutput < reader.GetNOutputs(); iOutput++) {
+    network.output_names.push_back(reader.GetOutputName(iOutput));
+    const auto norm = reader.GetOutputNorm(iOutput);
+    network.output_norm.emplace_back(SU2_TYPE::GetValue(norm.first), SU2_TYPE::GetValue(norm.second));
+  }
+
+  /*--- Weights in row-major order (one row per neuron of the previous layer), no biases for the input layer. ---*/
+  network.weights.resize(n_layers - 1);
+  network.biases.resize(n_layers);
+  for (auto iLayer = 1ul; iLayer < n_layers; iLayer++) {
+    const auto n_prev = network.n_neurons[iLayer - 1], n_layer = network.n_neurons[iLayer];
+    for (auto iNeuron = 0ul; iNeuron < n_prev; iNeuron++) {
+      for (auto jNeuron = 0ul; jNeuron < n_layer; jNeuron++) {
+        network.weights[iLayer - 1].push_back(reader.GetWeight(iLayer - 1, iNeuron, jNeuron));
+      }
+    }
+    for (auto iNeuron = 0ul; iNeuron < n_layer; iNeuron++) {
+      network.biases[iLayer].push_back(reader.GetBias(iLayer, iNeuron));
+    }
+  }
+#else
+  SU2_MPI::Error(string("SU2 was not compiled with MLPCpp, ") + filename + string(" cannot be read."),
+                 CURRENT_FUNCTION);
+#endif
+  return network;
+}
+
+void CBatchedMLP::PairVariables(const vector<string>& input_names, const vector<string>& output_names) {
+  n_inputs = input_names.size();
+  n_outputs = output_names.size();
+
+  for (auto& network : networks) {
+    network.idx_inputs.clear();
+    network.idx_outputs.clear();
+  }
+
+  for (auto iOutput = 0ul; iOutput < n_outputs; iOutput++) {
+    bool found = false;
+
+    for (auto& network : networks) {
+      const auto it = find(network.output_names.begin(), network.output_names.end(), output_names[iOutput]);
+      if (it == network.output_names.end()) continue;
+
+      /*--- All the inputs of the network must be query inputs. ---*/
+      vector<unsigned long> idx_inputs;
+      for (const auto& name : network.input_names) {
+        const auto jt = find(input_names.begin(), input_names.end(), name);
+        if (jt == input_names.end()) break;
+        idx_inputs.push_back(jt - input_names.begin());
+      }
+      if (idx_inputs.size() != network.input_names.size()) continue;
+
+      network.idx_inputs = idx_inputs;
+      network.idx_outputs.emplace_back(it - network.output_names.begin(), iOutput);
+      found = true;
+      break;
+    }
+    if (!found) {
+      SU2_MPI::Error(string("No MLP predicts ") + output_names[iOutput] + string(" from the given inputs."),
+                     CURRENT_FUNCTION);
+    }
+  }
+}
+
+pair<passivedouble, passivedouble> CBatchedMLP::GetInputNorm(unsigned long iInput) const {
+  for (const auto& network : networks) {
+    for (auto jInput = 0ul; jInput < network.idx_inputs.size(); jInput++) {
+      if (network.idx_inputs[jInput] == iInput) return network.input_norm[jInput];
+    }
+  }
+  SU2_MPI::Error("The input is not used by any of the paired MLPs.", CURRENT_FUNCTION);
+  return {};
+}
+
+void CBatchedMLP::Activate(ACTIVATION function, unsigned long n_points, unsigned long n_neurons,
+                           const su2double* bias, su2double* values) {
+  /*--- One loop over the block per function, so that it can be vectorized. ---*/
+  auto Apply = [&](auto f) {
+    for (auto iPoint = 0ul; iPoint < n_points; iPoint++) {
+      su2double* y = &values[iPoint * n_neurons];
+      for (auto iNeuron = 0ul; iNeuron < n_neurons; iNeuron++) y[iNeuron] = f(y[iNeuron] + bias[iNeuron]);
+    }
+  };
+
+  switch (function) {
+    case ACTIVATION::LINEAR:
+      Apply([](const su2double& x) -> su2double { return x; });
+      break;
+    case ACTIVATION::RELU:
+      Apply([](const su2double& x) -> su2double { return (x > 0) ? x : su2double(0.0); });
+      break;
+    case ACTIVATION::ELU:
+      Apply([](const su2double& x) -> su2double {
+        if (x > 0) return x;
+        return exp(x) - 1.0;
+      });
+      break;
+    case ACTIVATION::SELU:
+      Apply([](const su2double& x) -> su2double {
+        constexpr passivedouble alpha = 1.67326324, lambda = 1.05070098;
+        if (x > 0) return lambda * x;
+        return lambda * alpha * (exp(x) - 1.0);
+      });
+      break;
+    case ACTIVATION::SWISH:
+      Apply([](const su2double& x) -> su2double { return x / (1.0 + exp(-x)); });
+      break;
+    case ACTIVATION::SIGMOID:
+      Apply([](const su2double& x) -> su2double { return 1.0 / (1.0 + exp(-x)); });
+      break;
+    case ACTIVATION::TANH:
+      Apply([](const su2double& x) -> su2double { return tanh(x); });
+      break;
+    case ACTIVATION::GELU:
+      Apply([](const su2double& x) -> su2double {
+        constexpr passivedouble c = 0.7978845608028654; /*--- sqrt(2/pi) ---*/
+        return 0.5 * x * (1.0 + tanh(c * (x + 0.044715 * pow(x, 3))));
+      });
+      break;
+    case ACTIVATION::EXPONENTIAL:
+      Apply([](const su2double& x) -> su2double { return exp(x); });
+      break;
+    case ACTIVATION::SMOOTH_SLOPE:
+      Apply([](const su2double& x) -> su2double {
+        if (x > 0) return x;
+        return tanh(x);
+      });
+      break;
+  }
+}
+
+unsigned long CBatchedMLP::Predict(unsigned long n_points, const vector<const su2double*>& inputs,
+                                   su2double* outputs, unsigned short* exit_codes) {
+  unsigned long n_outside = 0;
+
+  for (auto iStart = 0ul; iStart < n_points; iStart += BLOCK_SIZE) {
+    const auto n_block = min<unsigned long>(BLOCK_SIZE, n_points - iStart);
+    bool outside[BLOCK_SIZE] = {false};
+
+    for (const auto& network : networks) {
+      if (network.idx_outputs.empty()) continue;
+
+      /*--- Normalized inputs of the block, the points outside the normalization range are flagged. ---*/
+      const auto n_in = network.n_neurons.front();
+      for (auto iPoint = 0ul; iPoint < n_block; iPoint++) {
+        for (auto iInput = 0ul; iInput < n_in; iInput++) {
+          const auto& norm = network.input_norm[iInput];
+          const su2double x = inputs[network.idx_inputs[iInput]][iStart + iPoint];
+          const su2double x_norm = (x - norm.first) / (norm.second - norm.first);
+          outside[iPoint] = outside[iPoint] || (x_norm < 0) || (x_norm > 1);
+          layer_input[iPoint * n_in + iInput] = x_norm;
+        }
+      }
+
+      /*--- Each layer is a matrix product for all the points of the block. ---*/
+      for (auto iLayer = 1ul; iLayer < network.n_neurons.size(); iLayer++) {
+        const int n_prev = network.n_neurons[iLayer - 1], n_layer = network.n_neurons[iLayer];
+        blas.gemm(n_block, n_layer, n_prev, layer_input.data(), network.weights[iLayer - 1].data(),
+                  layer_output.data(), nullptr);
+        Activate(network.activations[iLayer], n_block, n_layer, network.biases[iLayer].data(), layer_output.data());
+        swap(layer_input, layer_output);
+      }
+
+      /*--- De-normalized outputs. ---*/
+      const auto n_out = network.n_neurons.back();
+      for (auto iPoint = 0ul; iPoint < n_block; iPoint++) {
+        for (const auto& idx : network.idx_outputs) {
+          const auto& norm = network.output_norm[idx.first];
+          outputs[(iStart + iPoint) * n_outputs + idx.second] =
+              layer_input[iPoint * n_out + idx.first] * (norm.second - norm.first) + norm.first;
+        }
+      }
+    }
+
+    for (auto iPoint = 0ul; iPoint < n_block; iPoint++) {
+      if (exit_codes) exit_codes[iStart + iPoint] = outside[iPoint];
+      n_outside += outside[iPoint];
+    }
+  }
+  return n_outside;
+}
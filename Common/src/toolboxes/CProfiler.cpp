@@ -0,0 +1,398 @@
+/*!
+ * \file CProfiler.cpp
+ * \brief Implementation of the hierarchical scoped-timer profiler.
+ * \author P. Gomes
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CProfiler.hpp"
+#include "../../include/option_structure.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t MAX_TRACE_EVENTS = 1 << 20; /*!< \brief Per thread, later events are dropped. */
+
+/*--- Region of the tree of a thread. ---*/
+struct CNode {
+  const char* name = "";
+  CNode* parent = nullptr;
+  std::vector<std::unique_ptr<CNode> > children;
+
+  unsigned long calls = 0;
+  double time = 0.0;
+  uint64_t instructions = 0, cycles = 0;
+
+  Clock::time_point start;
+  uint64_t startInstructions = 0, startCycles = 0;
+
+  CNode* Child(const char* childName) {
+    for (auto& child : children) {
+      if (child->name == childName || strcmp(child->name, childName) == 0) return child.get();
+    }
+    children.emplace_back(new CNode);
+    children.back()->name = childName;
+    children.back()->parent = this;
+    return children.back().get();
+  }
+};
+
+/*--- Completed region for the timeline, times in microseconds since the start. ---*/
+struct CEvent {
+  const char* name;
+  double begin, duration;
+};
+
+struct CThreadData {
+  int thread = 0;
+  CNode root;
+  CNode* current = &root;
+  std::vector<CEvent> events;
+  int fdInstructions = -1, fdCycles = -1;
+
+  ~CThreadData() {
+#if defined(__linux__)
+    if (fdInstructions >= 0) close(fdInstructions);
+    if (fdCycles >= 0) close(fdCycles);
+#endif
+  }
+};
+
+struct CState {
+  bool trace = false, hwCounters = false, hwAvailable = true;
+  Clock::time_point start;
+  unsigned long generation = 0;
+  std::mutex mutex;
+  std::vector<std::unique_ptr<CThreadData> > threads;
+};
+
+CState& State() {
+  static CState state;
+  return state;
+}
+
+thread_local CThreadData* localData = nullptr;
+thread_local unsigned long localGeneration = 0;
+
+#if defined(__linux__)
+int OpenCounter(uint64_t kind) {
+  perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof(attr);
+  attr.config = kind;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  /*--- Count the calling thread on any cpu. ---*/
+  return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+}
+#endif
+
+inline uint64_t ReadCounter(int fd) {
+  uint64_t value = 0;
+#if defined(__linux__)
+  if (fd >= 0 && read(fd, &value, sizeof(uint64_t)) != sizeof(uint64_t)) value = 0;
+#endif
+  return value;
+}
+
+/*--- Data of the calling thread, registered on first use after each Initialize. ---*/
+CThreadData* LocalData() {
+  auto& state = State();
+  if (localData != nullptr && localGeneration == state.generation) return localData;
+
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.threads.emplace_back(new CThreadData);
+  auto* data = state.threads.back().get();
+  data->thread = static_cast<int>(state.threads.size()) - 1;
+
+  if (state.hwCounters) {
+#if defined(__linux__)
+    data->fdInstructions = OpenCounter(PERF_COUNT_HW_INSTRUCTIONS);
+    data->fdCycles = OpenCounter(PERF_COUNT_HW_CPU_CYCLES);
+#endif
+    if (data->fdInstructions < 0 || data->fdCycles < 0) state.hwAvailable = false;
+  }
+  localData = data;
+  localGeneration = state.generation;
+  return data;
+}
+
+/*--- Statistics of a region (identified by its path) over threads or ranks. ---*/
+struct CStat {
+  unsigned short depth = 0;
+  unsigned long calls = 0;
+  double time = 0.0;          /*!< \brief Sum over threads. */
+  double maxTime = 0.0;       /*!< \brief Max over threads. */
+  double minRankTime = 0.0, sumRankTime = 0.0, maxRankTime = 0.0;
+  double instructions = 0.0, cycles = 0.0;
+  int nRanks = 0;
+};
+
+using CStatList = std::vector<std::pair<std::string, CStat> >;
+
+CStat& FindOrAdd(CStatList& list, std::map<std::string, size_t>& index, const std::string& path) {
+  auto it = index.find(path);
+  if (it != index.end()) return list[it->second].second;
+  index[path] = list.size();
+  list.emplace_back(path, CStat());
+  return list.back().second;
+}
+
+void MergeThread(const CNode& node, const std::string& prefix, unsigned short depth, CStatList& list,
+                 std::map<std::string, size_t>& index) {
+  for (const auto& child : node.children) {
+    const auto path = prefix.empty() ? std::string(child->name) : prefix + "/" + child->name;
+    auto& stat = FindOrAdd(list, index, path);
+    stat.depth = depth;
+    stat.calls += child->calls;
+    stat.time += child->time;
+    stat.maxTime = std::max(stat.maxTime, child->time);
+    stat.instructions += child->instructions;
+    stat.cycles += child->cycles;
+    MergeThread(*child, path, depth + 1, list, index);
+  }
+}
+
+void WriteTrace(const std::string& fileName, int rank) {
+  std::ofstream file(fileName);
+  file << std::fixed << std::setprecision(3) << "{\"traceEvents\":[\n";
+  bool first = true;
+  for (const auto& data : State().threads) {
+    for (const auto& event : data->events) {
+      if (!first) file << ",\n";
+      first = false;
+      file << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"ts\":" << event.begin
+           << ",\"dur\":" << event.duration << ",\"pid\":" << rank << ",\"tid\":" << data->thread << "}";
+    }
+  }
+  file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+}  // namespace
+
+void CProfiler::Initialize(bool trace, bool hwCounters) {
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+
+  auto& state = State();
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.threads.clear();
+    ++state.generation;
+    state.trace = trace;
+    state.hwCounters = hwCounters;
+    state.hwAvailable = true;
+    state.start = Clock::now();
+  }
+  Enabled() = true;
+
+  /*--- Register the master thread first. ---*/
+  LocalData();
+}
+
+void CProfiler::Begin(const char* name) {
+  auto* data = LocalData();
+  auto* node = data->current->Child(name);
+  data->current = node;
+
+  if (data->fdInstructions >= 0) {
+    node->startInstructions = ReadCounter(data->fdInstructions);
+    node->startCycles = ReadCounter(data->fdCycles);
+  }
+  node->start = Clock::now();
+}
+
+void CProfiler::End() {
+  const auto stop = Clock::now();
+  auto* data = LocalData();
+  auto* node = data->current;
+
+  /*--- Unbalanced or opened before Initialize. ---*/
+  if (node->parent == nullptr) return;
+
+  if (data->fdInstructions >= 0) {
+    node->instructions += ReadCounter(data->fdInstructions) - node->startInstructions;
+    node->cycles += ReadCounter(data->fdCycles) - node->startCycles;
+  }
+  const double elapsed = std::chrono::duration<double>(stop - node->start).count();
+  node->time += elapsed;
+  ++node->calls;
+
+  auto& state = State();
+  if (state.trace && data->events.size() < MAX_TRACE_EVENTS) {
+    const double begin = std::chrono::duration<double, std::micro>(node->start - state.start).count();
+    data->events.push_back({node->name, begin, elapsed * 1e6});
+  }
+  data->current = node->parent;
+}
+
+void CProfiler::Finalize(const std::string& fileName) {
+  if (!IsEnabled()) return;
+  Enabled() = false;
+
+  auto& state = State();
+  const int rank = SU2_MPI::GetRank();
+  const int size = SU2_MPI::GetSize();
+
+  const double localTotal = std::chrono::duration<double>(Clock::now() - state.start).count();
+  double total = localTotal;
+  SU2_MPI::Allreduce(&localTotal, &total, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+
+  int hwAvailable = state.hwAvailable, allHwAvailable = hwAvailable;
+  SU2_MPI::Allreduce(&hwAvailable, &allHwAvailable, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+
+  /*--- Merge the threads of this rank, in order of first appearance. ---*/
+
+  CStatList local;
+  std::map<std::string, size_t> localIndex;
+  for (const auto& data : state.threads) MergeThread(data->root, "", 0, local, localIndex);
+
+  if (state.trace) WriteTrace(fileName + "_trace_" + PrintingToolbox::to_string(rank) + ".json", rank);
+
+  /*--- Serialize and gather on all ranks (the data is small). ---*/
+
+  std::ostringstream buffer;
+  buffer << std::setprecision(17);
+  for (const auto& entry : local) {
+    const auto& stat = entry.second;
+    buffer << entry.first << '\t' << stat.depth << '\t' << stat.calls << '\t' << stat.time << '\t' << stat.maxTime
+           << '\t' << stat.instructions << '\t' << stat.cycles << '\n';
+  }
+  const auto sendBuf = buffer.str();
+
+  int sendCount = sendBuf.size();
+  std::vector<int> recvCounts(size), displs(size + 1, 0);
+  SU2_MPI::Allgather(&sendCount, 1, MPI_INT, recvCounts.data(), 1, MPI_INT, SU2_MPI::GetComm());
+  for (int iRank = 0; iRank < size; ++iRank) displs[iRank + 1] = displs[iRank] + recvCounts[iRank];
+
+  std::vector<char> recvBuf(displs[size] + 1, '\0');
+  SU2_MPI::Allgatherv(sendBuf.data(), sendCount, MPI_CHAR, recvBuf.data(), recvCounts.data(), displs.data(),
+                      MPI_CHAR, SU2_MPI::GetComm());
+
+  state.threads.clear();
+  ++state.generation;
+
+  if (rank != MASTER_NODE) return;
+
+  /*--- Merge the ranks, the time of a rank is the max over its threads. ---*/
+
+  CStatList global;
+  std::map<std::string, size_t> globalIndex;
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    std::istringstream records(std::string(recvBuf.data() + displs[iRank], recvCounts[iRank]));
+    std::string path;
+    while (std::getline(records, path, '\t')) {
+      CStat rankStat;
+      records >> rankStat.depth >> rankStat.calls >> rankStat.time >> rankStat.maxTime >> rankStat.instructions >>
+          rankStat.cycles;
+      records.ignore(1);
+
+      auto& stat = FindOrAdd(global, globalIndex, path);
+      stat.minRankTime = stat.nRanks ? std::min(stat.minRankTime, rankStat.maxTime) : rankStat.maxTime;
+      stat.maxRankTime = std::max(stat.maxRankTime, rankStat.maxTime);
+      stat.sumRankTime += rankStat.maxTime;
+      stat.depth = rankStat.depth;
+      stat.calls += rankStat.calls;
+      stat.time += rankStat.time;
+      stat.instructions += rankStat.instructions;
+      stat.cycles += rankStat.cycles;
+      ++stat.nRanks;
+    }
+  }
+  for (auto& entry : global) {
+    if (entry.second.nRanks < size) entry.second.minRankTime = 0.0;
+  }
+
+  /*--- Summary table. ---*/
+
+  const bool writeCounters = state.hwCounters && allHwAvailable;
+  auto ipc = [](const CStat& stat) { return stat.cycles > 0 ? stat.instructions / stat.cycles : 0.0; };
+
+  std::ofstream csv(fileName + ".csv");
+  csv << std::setprecision(8)
+      << "\"Region\", \"Level\", \"Calls\", \"Ranks\", \"Min_Time\", \"Avg_Time\", \"Max_Time\", \"Thread_Time\"";
+  if (writeCounters) csv << ", \"Instructions\", \"Cycles\", \"IPC\"";
+  csv << "\n\"Total\", 0, 1, " << size << ", " << total << ", " << total << ", " << total << ", " << total << "\n";
+
+  for (const auto& entry : global) {
+    const auto& stat = entry.second;
+    csv << "\"" << entry.first << "\", " << stat.depth + 1 << ", " << stat.calls << ", " << stat.nRanks << ", "
+        << stat.minRankTime << ", " << stat.sumRankTime / size << ", " << stat.maxRankTime << ", " << stat.time;
+    if (writeCounters) csv << ", " << stat.instructions << ", " << stat.cycles << ", " << ipc(stat);
+    csv << "\n";
+  }
+
+  std::ostringstream summary;
+  summary << "\n-------------------------------- Profiling summary --------------------------------\n";
+  summary << "Time per region in seconds (max over threads, avg and max over ranks).\n";
+  summary << std::left << std::setw(44) << "Region" << std::right << std::setw(11) << "Calls" << std::setw(10)
+            << "Avg" << std::setw(10) << "Max" << std::setw(8) << "%";
+  if (writeCounters) summary << std::setw(6) << "IPC";
+  summary << "\n" << std::fixed;
+
+  for (const auto& entry : global) {
+    const auto& stat = entry.second;
+    const auto slash = entry.first.rfind('/');
+    auto label = std::string(2 * stat.depth, ' ') + entry.first.substr(slash == std::string::npos ? 0 : slash + 1);
+    if (label.size() > 43) label.resize(43);
+
+    summary << std::left << std::setw(44) << label << std::right << std::setw(11) << stat.calls
+              << std::setprecision(3) << std::setw(10) << stat.sumRankTime / size << std::setw(10)
+              << stat.maxRankTime << std::setprecision(1) << std::setw(8)
+              << (total > 0 ? 100 * stat.maxRankTime / total : 0.0);
+    if (writeCounters) summary << std::setprecision(2) << std::setw(6) << ipc(stat);
+    summary << "\n";
+  }
+  summary << std::left << std::setw(44) << "Total" << std::right << std::setw(11) << "" << std::setprecision(3)
+            << std::setw(10) << total << std::setw(10) << total << "\n";
+  std::cout << summary.str();
+
+  if (state.hwCounters && !allHwAvailable) {
+    std::cout << "Hardware counters are not available (perf_event_open failed), check kernel.perf_event_paranoid.\n";
+  }
+  std::cout << "Profiling results written to " << fileName << ".csv";
+  if (state.trace) std::cout << " and " << fileName << "_trace_<rank>.json";
+  std::cout << ".\n" << std::endl;
+}
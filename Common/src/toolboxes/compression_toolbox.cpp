@@ -0,0 +1,221 @@
+/*!
+ * \file compression_toolbox.cpp
+ * \brief Lossless compression of numerical arrays for file output.
+ * \author P. Gomes
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/compression_toolbox.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+/*--- Parameters of the LZ4 block format. ---*/
+constexpr size_t MIN_MATCH = 4;      /*!< \brief Shortest match. */
+constexpr size_t LAST_LITERALS = 5;  /*!< \brief The last bytes are always literals. */
+constexpr size_t MF_LIMIT = 12;      /*!< \brief The last match starts this far from the end, or earlier. */
+constexpr size_t MAX_OFFSET = 65535; /*!< \brief Largest distance to a match. */
+constexpr int HASH_LOG = 16;
+constexpr size_t TILE_ROWS = 256;    /*!< \brief Rows shuffled at a time. */
+
+inline uint32_t Read32(const unsigned char* p) {
+  uint32_t v;
+  memcpy(&v, p, sizeof(uint32_t));
+  return v;
+}
+
+inline uint32_t Hash(uint32_t v) { return (v * 2654435761u) >> (32 - HASH_LOG); }
+
+/*--- Lengths above 15 are continued with bytes of 255 and a final byte below 255. ---*/
+inline void WriteLength(size_t len, std::vector<char>& dst) {
+  while (len >= 255) {
+    dst.push_back(char(255));
+    len -= 255;
+  }
+  dst.push_back(char(len));
+}
+
+void WriteSequence(const unsigned char* literals, size_t nLiterals, size_t offset, size_t matchLen,
+                   std::vector<char>& dst) {
+  const bool hasMatch = matchLen >= MIN_MATCH;
+  const size_t extraMatch = hasMatch ? matchLen - MIN_MATCH : 0;
+
+  const unsigned char token = ((nLiterals < 15 ? nLiterals : 15) << 4) | (extraMatch < 15 ? extraMatch : 15);
+  dst.push_back(char(token));
+  if (nLiterals >= 15) WriteLength(nLiterals - 15, dst);
+  dst.insert(dst.end(), literals, literals + nLiterals);
+
+  if (!hasMatch) return;
+  dst.push_back(char(offset & 0xff));
+  dst.push_back(char(offset >> 8));
+  if (extraMatch >= 15) WriteLength(extraMatch - 15, dst);
+}
+
+/*--- Returns false if the length runs past the end of the input. ---*/
+inline bool ReadLength(const unsigned char*& ip, const unsigned char* end, size_t& len) {
+  unsigned char byte = 255;
+  while (byte == 255) {
+    if (ip == end) return false;
+    byte = *ip++;
+    len += byte;
+  }
+  return true;
+}
+}  // namespace
+
+void CompressionToolbox::CompressBlock(const unsigned char* src, size_t srcSize, std::vector<char>& dst) {
+  dst.clear();
+  dst.reserve(srcSize + srcSize / 255 + 16);
+
+  const unsigned char* ip = src;
+  const unsigned char* anchor = src;
+  const unsigned char* const end = src + srcSize;
+
+  if (srcSize > MF_LIMIT) {
+    /*--- Positions are stored +1, 0 means empty. ---*/
+    std::vector<uint32_t> table(size_t(1) << HASH_LOG, 0);
+    const unsigned char* const matchLimit = end - LAST_LITERALS;
+    const unsigned char* const searchLimit = end - MF_LIMIT;
+
+    /*--- Like LZ4, the search skips faster through incompressible data (e.g. low mantissa bytes). ---*/
+    size_t misses = 0;
+
+    while (ip < searchLimit) {
+      const uint32_t seq = Read32(ip);
+      auto& entry = table[Hash(seq)];
+      const bool candidate = entry != 0 && size_t(ip - src) - (entry - 1) <= MAX_OFFSET;
+      const unsigned char* ref = candidate ? src + (entry - 1) : ip;
+      entry = uint32_t(ip - src) + 1;
+
+      if (!candidate || Read32(ref) != seq) {
+        ip += 1 + (misses++ >> 6);
+        continue;
+      }
+      misses = 0;
+
+      size_t len = MIN_MATCH;
+      while (ip + len < matchLimit && ref[len] == ip[len]) ++len;
+
+      WriteSequence(anchor, ip - anchor, ip - ref, len, dst);
+      ip += len;
+      anchor = ip;
+    }
+  }
+
+  WriteSequence(anchor, end - anchor, 0, 0, dst);
+}
+
+bool CompressionToolbox::DecompressBlock(const unsigned char* src, size_t srcSize, unsigned char* dst,
+                                         size_t dstSize) {
+  const unsigned char* ip = src;
+  const unsigned char* const end = src + srcSize;
+  unsigned char* op = dst;
+  unsigned char* const opEnd = dst + dstSize;
+
+  while (ip < end) {
+    const unsigned char token = *ip++;
+
+    size_t nLiterals = token >> 4;
+    if (nLiterals == 15 && !ReadLength(ip, end, nLiterals)) return false;
+    if (size_t(end - ip) < nLiterals || size_t(opEnd - op) < nLiterals) return false;
+    memcpy(op, ip, nLiterals);
+    ip += nLiterals;
+    op += nLiterals;
+
+    /*--- The last sequence has no match. ---*/
+    if (ip == end) break;
+
+    if (end - ip < 2) return false;
+    const size_t offset = ip[0] | (size_t(ip[1]) << 8);
+    ip += 2;
+    if (offset == 0 || offset > size_t(op - dst)) return false;
+
+    size_t matchLen = token & 15;
+    if (matchLen == 15 && !ReadLength(ip, end, matchLen)) return false;
+    matchLen += MIN_MATCH;
+    if (size_t(opEnd - op) < matchLen) return false;
+
+    /*--- Byte by byte, the match may overlap the output. ---*/
+    const unsigned char* ref = op - offset;
+    for (size_t i = 0; i < matchLen; ++i) op[i] = ref[i];
+    op += matchLen;
+  }
+  return op == opEnd;
+}
+
+void CompressionToolbox::Compress(const void* data, size_t nRows, size_t nCols, size_t itemSize,
+                                  std::vector<char>& out) {
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  const size_t rowSize = nCols * itemSize;
+
+  /*--- Column-wise XOR delta and byte shuffle, the planes of each column are contiguous.
+   *    The rows are processed in tiles that fit in cache. ---*/
+
+  std::vector<unsigned char> shuffled(nRows * rowSize);
+  std::vector<unsigned char> prev(rowSize, 0);
+
+  for (size_t iTile = 0; iTile < nRows; iTile += TILE_ROWS) {
+    const size_t tileEnd = std::min(nRows, iTile + TILE_ROWS);
+    for (size_t iPlane = 0; iPlane < rowSize; ++iPlane) {
+      unsigned char* plane = shuffled.data() + iPlane * nRows;
+      unsigned char last = prev[iPlane];
+      for (size_t iRow = iTile; iRow < tileEnd; ++iRow) {
+        const unsigned char value = bytes[iRow * rowSize + iPlane];
+        plane[iRow] = value ^ last;
+        last = value;
+      }
+      prev[iPlane] = last;
+    }
+  }
+
+  CompressBlock(shuffled.data(), shuffled.size(), out);
+}
+
+bool CompressionToolbox::Decompress(const char* in, size_t inSize, size_t nRows, size_t nCols, size_t itemSize,
+                                    void* data) {
+  const size_t rowSize = nCols * itemSize;
+
+  std::vector<unsigned char> shuffled(nRows * rowSize);
+  if (!DecompressBlock(reinterpret_cast<const unsigned char*>(in), inSize, shuffled.data(), shuffled.size())) {
+    return false;
+  }
+
+  auto* bytes = static_cast<unsigned char*>(data);
+  std::vector<unsigned char> prev(rowSize, 0);
+
+  for (size_t iTile = 0; iTile < nRows; iTile += TILE_ROWS) {
+    const size_t tileEnd = std::min(nRows, iTile + TILE_ROWS);
+    for (size_t iPlane = 0; iPlane < rowSize; ++iPlane) {
+      const unsigned char* plane = shuffled.data() + iPlane * nRows;
+      unsigned char last = prev[iPlane];
+      for (size_t iRow = iTile; iRow < tileEnd; ++iRow) {
+        last ^= plane[iRow];
+        bytes[iRow * rowSize + iPlane] = last;
+      }
+      prev[iPlane] = last;
+    }
+  }
+  return true;
+}
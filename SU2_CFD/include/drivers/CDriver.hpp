@@ -79,6 +79,13 @@ class CDriver : public CDriverBase {
   CInterface*** interface_container; /*!< \brief Definition of the interface of information and physics. */
   bool dry_run;                      /*!< \brief Flag if SU2_CFD was started as dry-run via "SU2_CFD -d <config>.cfg" */
 
+  bool concurrent_zones = false; /*!< \brief Zones solved concurrently, each by its own group of ranks. */
+  unsigned short rank_zone = 0;  /*!< \brief Zone solved by the group of this rank (concurrent zones). */
+  vector<int> zone_ranks;        /*!< \brief First rank of the group of each zone, and the total number of ranks. */
+  SU2_Comm driver_comm,          /*!< \brief Communicator of all the ranks of the driver (concurrent zones). */
+      zone_comm;                 /*!< \brief Communicator of the group of ranks of this rank (concurrent zones). */
+  streambuf* cout_buffer = nullptr; /*!< \brief Screen output of the ranks that do not print (concurrent zones). */
+
  public:
   /*!
    * \brief Constructor of the class.
@@ -112,6 +119,30 @@ class CDriver : public CDriverBase {
    */
   void PreprocessInput(CConfig**& config, CConfig*& driver_config);
 
+  /*!
+   * \brief Split the ranks into one group per zone, sized by the load of the zones (cells x equations).
+   * \note Only with MULTIZONE_CONCURRENT_ZONES= YES, the communicator of SU2_MPI is then the one of the group.
+   */
+  void InitializeZoneGroups();
+
+  /*!
+   * \brief Check if a zone is solved by this rank.
+   * \param[in] iZone - Index of the zone.
+   * \return False if the zones are solved concurrently and the zone belongs to another group of ranks.
+   */
+  inline bool IsLocalZone(unsigned short iZone) const { return !concurrent_zones || iZone == rank_zone; }
+
+  /*!
+   * \brief Select the communicator of SU2_MPI, when the zones are solved concurrently.
+   * \note The zones that are not local have dummy geometries (without points) on this rank, the operations that
+   *       involve several zones (interfaces, wall distance, convergence) use all ranks, the ones that involve a
+   *       single zone only use the group of ranks of that zone.
+   * \param[in] all_ranks - All the ranks of the driver, or the group of ranks of the zone of this rank.
+   */
+  inline void SetZoneCommunicator(bool all_ranks) const {
+    if (concurrent_zones) SU2_MPI::SetComm(all_ranks ? driver_comm : zone_comm);
+  }
+
   /*!
    * \brief Construction of the edge-based data structure and the multi-grid structure.
    * \param[in] config - Definition of the particular problem.
@@ -30,6 +30,7 @@
 
 #include <vector>
 #include "../../../Common/include/containers/CLookUpTable.hpp"
+#include "../../../Common/include/toolboxes/CBatchedMLP.hpp"
 #if defined(HAVE_MLPCPP)
 #define MLP_CUSTOM_TYPE su2double
 #include "../../../subprojects/MLPCpp/include/CLookUp_ANN.hpp"
@@ -92,9 +93,35 @@ class CDataDrivenFluid final : public CFluidModel {
   MLPToolbox::CLookUp_ANN* lookup_mlp; /*!< \brief Multi-layer perceptron collection. */
   MLPToolbox::CIOMap* iomap_rhoe;      /*!< \brief Input-output map. */
 #endif
+  CBatchedMLP* batched_mlp = nullptr; /*!< \brief Evaluation of the same MLPs for blocks of states. */
   vector<su2double> MLP_inputs; /*!< \brief Inputs for the multi-layer perceptron look-up operation. */
 
   CLookUpTable* lookup_table; /*!< \brief Look-up table regression object. */
+  vector<unsigned long> idx_outputs_LUT; /*!< \brief Table column indices of the outputs. */
+  vector<su2double> outputs_LUT;         /*!< \brief Outputs of the look-up table. */
+
+  /*--- Data set outputs of prefetched states, consumed in order by SetTDState_rhoe (see FindPrefetched). ---*/
+  vector<su2double> prefetch_rho,   /*!< \brief (Clipped) prefetched densities. */
+      prefetch_e;                   /*!< \brief (Clipped) prefetched static energies. */
+  su2activematrix prefetch_outputs; /*!< \brief Outputs of the prefetched states (states x outputs). */
+  vector<unsigned short> prefetch_exit_codes; /*!< \brief Extrapolation flags of the prefetched states. */
+  unsigned long n_prefetch = 0,     /*!< \brief Number of prefetched states. */
+      i_prefetch = 0;               /*!< \brief First prefetched state that was not consumed. */
+
+  /*--- Energies of prefetched (P, rho) states, consumed in order by SetEnergy_Prho. ---*/
+  vector<su2double> prefetch_P,       /*!< \brief Prefetched pressures. */
+      prefetch_rho_P,                 /*!< \brief Prefetched densities. */
+      prefetch_energy;                /*!< \brief Static energies from the batched Newton solver. */
+  vector<unsigned long> prefetch_iter; /*!< \brief Newton iterations of the prefetched states. */
+  unsigned long n_prefetch_Prho = 0,  /*!< \brief Number of prefetched (P, rho) states. */
+      i_prefetch_Prho = 0;            /*!< \brief First prefetched (P, rho) state that was not consumed. */
+
+  /*--- Work arrays of the batched Newton solver. ---*/
+  vector<unsigned long> newton_states; /*!< \brief States that have not converged. */
+  vector<su2double> newton_rho,        /*!< \brief (Clipped) densities of the states. */
+      newton_e;                        /*!< \brief (Clipped) static energies of the states. */
+  su2activematrix newton_outputs;      /*!< \brief Data set outputs of the states. */
+  vector<unsigned short> newton_exit_codes; /*!< \brief Extrapolation flags of the states. */
 
   unsigned long outside_dataset, /*!< \brief Density-energy combination lies outside data set. */
       nIter_Newton;              /*!< \brief Number of Newton solver iterations. */
@@ -120,6 +147,38 @@ class CDataDrivenFluid final : public CFluidModel {
    */
   unsigned long Predict_LUT(su2double rho, su2double e);
 
+  /*!
+   * \brief Evaluate the data set for a block of states, with the look-up table or the batched MLP.
+   * \param[in] n_states - Number of states.
+   * \param[in] rho - Density values.
+   * \param[in] e - Static energy values.
+   * \param[out] outputs - Outputs of the states, row-major (states x outputs).
+   * \param[out] exit_codes - Extrapolation flags of the states.
+   */
+  void Predict_Batch(unsigned long n_states, const su2double* rho, const su2double* e, su2double* outputs,
+                     unsigned short* exit_codes);
+
+  /*!
+   * \brief Find a state among the prefetched states that were not consumed.
+   * \note The states must be requested in the order they were prefetched, the states that are skipped by the
+   *       caller are skipped here too. A miss (a state that was not prefetched, or one requested after a later
+   *       state was consumed) does not move the cursor, the state is evaluated normally. The states are compared
+   *       exactly, they must be computed in the same way as the prefetched ones.
+   * \param[in] first - First prefetched state that was not consumed (the cursor).
+   * \param[in] n_states - Number of prefetched states.
+   * \param[in] x, y - Prefetched values of the two thermodynamic variables.
+   * \param[in] x0, y0 - Requested state.
+   * \return Index of the state, n_states if it was not found.
+   */
+  static unsigned long FindPrefetched(unsigned long first, unsigned long n_states, const vector<su2double>& x,
+                                      const vector<su2double>& y, su2double x0, su2double y0);
+
+  /*!
+   * \brief Resize the prefetch arrays to hold at least n_states states.
+   * \param[in] n_states - Number of states.
+   */
+  void ResizePrefetch(unsigned long n_states);
+
   /*!
    * \brief Evaluate the data set.
    * \param[in] rho - Density value.
@@ -165,6 +224,28 @@ class CDataDrivenFluid final : public CFluidModel {
    */
   void SetTDState_rhoe(su2double rho, su2double e) override;
 
+  /*!
+   * \brief Evaluate the data set ahead for a block of states, with one LookUp_Batch or batched MLP call.
+   * \note This is only a prefetch, SetTDState_rhoe uses the stored outputs when it is called with one of the
+   *       remaining prefetched states, in order, and evaluates normally otherwise (see FindPrefetched).
+   * \param[in] n_states - Number of states.
+   * \param[in] rho - Density values.
+   * \param[in] e - Static energy values.
+   */
+  void PrefetchTDState_rhoe(unsigned long n_states, const su2double* rho, const su2double* e) override;
+
+  /*!
+   * \brief Solve ahead the static energy of a block of (P, rho) states, with a batched Newton solver.
+   * \note The states iterate together as in SetEnergy_Prho, with one evaluation of the data set per iteration for
+   *       the states that have not converged. SetTDState_Prho and SetEnergy_Prho use the result when they are
+   *       called with one of the remaining prefetched states, in order (see FindPrefetched). This replaces the
+   *       prefetched (rho, e) states.
+   * \param[in] n_states - Number of states.
+   * \param[in] P - Pressure values.
+   * \param[in] rho - Density values.
+   */
+  void PrefetchTDState_Prho(unsigned long n_states, const su2double* P, const su2double* rho) override;
+
   /*!
    * \brief Set the Dimensionless State using Pressure  and Temperature.
    * \param[in] P - first thermodynamic variable (pressure).
@@ -77,8 +77,20 @@ class CFluidFlamelet final : public CFluidModel {
   vector<su2double> val_vars_TD, /*!< \brief References to thermodynamic state variables. */
       val_vars_Sources, val_vars_LookUp;
 
+  vector<unsigned long> idx_vars_TD, /*!< \brief Table column indices of the thermodynamic state variables. */
+      idx_vars_Sources, idx_vars_LookUp;
+
   void PreprocessLookUp(CConfig* config);
 
+  /*!
+   * \brief Get the names and table column indices of the variables of a look-up operation.
+   * \param[in] lookup_type - Type of look-up operation (FLAMELET_LOOKUP_OPS).
+   * \param[out] varnames - Names of the variables.
+   * \param[out] idx_vars - Table column indices of the variables (LUT only).
+   */
+  void GetLookUpVariables(unsigned short lookup_type, const vector<string>*& varnames,
+                          const vector<unsigned long>*& idx_vars) const;
+
  public:
   CFluidFlamelet(CConfig* config, su2double value_pressure_operating);
 
@@ -101,6 +113,20 @@ class CFluidFlamelet final : public CFluidModel {
   inline unsigned long EvaluateDataSet(const vector<su2double>& input_scalar, unsigned short lookup_type,
                                        vector<su2double>& output_refs) override;
 
+  /*!
+   * \brief Evaluate the flamelet manifold for a batch of points.
+   * \param[in] n_points - Number of points.
+   * \param[in] input_scalars - Scalar solution of the first point, the other points follow with stride.
+   * \param[in] stride - Distance between the scalar solutions of consecutive points.
+   * \param[in] lookup_type - Type of look-up operation (FLAMELET_LOOKUP_OPS).
+   * \param[out] output_refs - Output data, row-major (n_points x number of outputs of the operation).
+   * \param[out] misses - Within bounds (0) or out of bounds (1), for each point.
+   * \return Number of points out of bounds.
+   */
+  unsigned long EvaluateDataSetBatch(unsigned long n_points, const su2double* input_scalars, unsigned long stride,
+                                     unsigned short lookup_type, su2double* output_refs,
+                                     unsigned short* misses) override;
+
   /*!
    * \brief Check for out-of-bounds condition for data set interpolation.
    * \return - within bounds (0) or out of bounds (1).
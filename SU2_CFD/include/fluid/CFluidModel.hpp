@@ -149,6 +149,20 @@ class CFluidModel {
    */
   virtual unsigned long EvaluateDataSet(const vector<su2double> &input_scalar, unsigned short lookup_type, vector<su2double> &output_refs) { return 0; }
 
+  /*!
+   * \brief Evaluate data manifold for a batch of points.
+   * \param[in] n_points - Number of points.
+   * \param[in] input_scalars - Input data of the first point, the other points follow with stride.
+   * \param[in] stride - Distance between the input data of consecutive points.
+   * \param[in] lookup_type - Type of look-up operation (FLAMELET_LOOKUP_OPS).
+   * \param[out] output_refs - Output data, row-major (n_points x number of outputs of the operation).
+   * \param[out] misses - Within manifold bounds (0) or out of bounds (1), for each point.
+   * \return Number of points out of bounds.
+   */
+  virtual unsigned long EvaluateDataSetBatch(unsigned long n_points, const su2double* input_scalars,
+                                             unsigned long stride, unsigned short lookup_type, su2double* output_refs,
+                                             unsigned short* misses) { return 0; }
+
   /*!
    * \brief Get fluid dynamic viscosity.
    */
@@ -260,6 +274,26 @@ class CFluidModel {
    */
   virtual void SetMassDiffusivityModel(const CConfig* config);
 
+  /*!
+   * \brief Evaluate ahead the states (rho, e) that the next calls to SetTDState_rhoe will request, in order.
+   * \note Models that can evaluate several states at once (the data-driven model) use this to prefetch
+   *       them, it is a no-op otherwise. States may be skipped, or other states evaluated in between, the
+   *       requested states must be bitwise equal to the prefetched ones to use the prefetched result.
+   * \param[in] n_states - Number of states.
+   * \param[in] rho - Density values.
+   * \param[in] e - Static energy values.
+   */
+  virtual void PrefetchTDState_rhoe(unsigned long n_states, const su2double* rho, const su2double* e) {}
+
+  /*!
+   * \brief Evaluate ahead the states (P, rho) that the next calls to SetTDState_Prho will request, in order.
+   * \note Same as PrefetchTDState_rhoe, for the models that solve this state iteratively.
+   * \param[in] n_states - Number of states.
+   * \param[in] P - Pressure values.
+   * \param[in] rho - Density values.
+   */
+  virtual void PrefetchTDState_Prho(unsigned long n_states, const su2double* P, const su2double* rho) {}
+
   /*!
    * \brief virtual member that would be different for each gas model implemented
    * \param[in] InputSpec - Input pair for FLP calls ("e, rho").
@@ -95,6 +95,15 @@ private:
   Blottner,                      /*!< \brief Blottner viscosity coefficients */
   Dij;                           /*!< \brief Binary diffusion coefficients. */
 
+  vector<su2activematrix> RxnConstantTables; /*!< \brief Equilibrium constant tables of each reaction (built once). */
+
+  su2matrix<int> ReactantOrder,  /*!< \brief Order of each species in the reactants of each reaction. */
+  ProductOrder;                  /*!< \brief Order of each species in the products of each reaction. */
+
+  vector<su2double> Conc;        /*!< \brief Species molar concentrations of the current state. */
+  unsigned short KeqIndex = 0;   /*!< \brief Number density interval of the Keq table look-up. */
+  su2double KeqWeight = 0.0;     /*!< \brief Interpolation weight of the Keq table look-up. */
+
   C3DDoubleMatrix Omega11,       /*!< \brief Collision integrals (Omega^(1,1)) */
   Omega22;                       /*!< \brief Collision integrals (Omega^(2,2)) */
 
@@ -114,9 +123,6 @@ private:
   dRfok, dRbok,
   eve, eve_eq, cvve, cvve_eq;
 
-  vector<int>
-  alphak, betak;
-
 public:
 
   /*!
@@ -220,13 +226,27 @@ public:
   */
   void GetChemistryEquilConstants(unsigned short iReaction);
 
+  /*!
+   * \brief Locate the mixture number density of the current state in the Keq tables.
+   * \note The result is common to all reactions, it is computed once per state.
+   */
+  void SetKeqInterpolation();
+
   /*!
    * \brief Calculates constants used for Keq correlation.
-   * \param[out] A - Reference to coefficient array.
+   * \note ::SetKeqInterpolation must have been called for the current state.
    * \param[in] val_reaction - Reaction number indicator.
    */
   void ComputeKeqConstants(unsigned short val_Reaction);
 
+  /*!
+   * \brief Compute the species V-E energies and specific heats together, sharing the exponentials.
+   * \note Equivalent to ::ComputeSpeciesEve followed by ::ComputeSpeciesCvVibEle, the results are stored in
+   *       the same vectors.
+   * \param[in] val_T - Vibrational-electronic temperature.
+   */
+  void ComputeSpeciesEveCvve(su2double val_T);
+
   /*!
    * \brief Calculate species diffusion coefficients with Wilke/Blottner/Eucken transport model.
    */
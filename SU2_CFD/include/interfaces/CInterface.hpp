@@ -29,6 +29,7 @@
 #pragma once
 
 #include "../../../Common/include/parallelization/mpi_structure.hpp"
+#include "../../../Common/include/containers/C2DContainer.hpp"
 
 #include <cmath>
 #include <string>
@@ -38,6 +39,7 @@
 #include <iostream>
 #include <stdlib.h>
 #include <stdio.h>
+#include <vector>
 
 class CConfig;
 class CGeometry;
@@ -73,6 +75,24 @@ protected:
   unsigned short nVar = 0;
   static constexpr size_t MAXNDIM = 3;  /*!< \brief Max number of space dimensions, used in some static arrays. */
 
+  /*!
+   * \brief Point-to-point communication pattern of one interface, used by the sparse transfer mode.
+   * \details Each rank only receives the values of the donors of its target vertices, from the ranks that own
+   * them. The receive buffer is ordered by source rank and, within each rank, by global donor index.
+   */
+  struct CSparsePattern {
+    bool valid = false;                      /*!< \brief Whether the pattern has been built. */
+    vector<int> sendRanks;                   /*!< \brief Ranks to which values are sent. */
+    vector<int> recvRanks;                   /*!< \brief Ranks from which values are received. */
+    vector<unsigned long> sendStart;         /*!< \brief Start of the values of each send rank in sendBuffer. */
+    vector<unsigned long> recvStart;         /*!< \brief Start of the values of each recv rank in recvBuffer. */
+    vector<unsigned long> sendVertex;        /*!< \brief Donor vertices whose values are sent. */
+    vector<unsigned long> donorGlobalIdx;    /*!< \brief Global index of the donors of the local target vertices. */
+    vector<unsigned long> donorBufferIdx;    /*!< \brief Row of recvBuffer of the donors of the local targets. */
+    su2activematrix sendBuffer, recvBuffer;  /*!< \brief Communication buffers. */
+  };
+  vector<CSparsePattern> sparsePatterns;     /*!< \brief Communication pattern of each interface. */
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -93,6 +113,8 @@ public:
 
   /*!
    * \brief Interpolate data and broadcast it into all processors, for nonmatching meshes.
+   * \details With SPARSE_INTERFACE_TRANSFER the donor values are only sent to the ranks that need them,
+   * otherwise all donor values are gathered on all ranks.
    * \param[in] interpolator - Object defining the interpolation.
    * \param[in] donor_solution - Solution from the donor mesh.
    * \param[in] target_solution - Solution from the target mesh.
@@ -107,6 +129,42 @@ public:
                      const CConfig *donor_config, const CConfig *target_config);
 
 protected:
+  /*!
+   * \brief Check if the donors of the local target vertices differ from those used to build a sparse pattern.
+   * \param[in] interpolator - Object defining the interpolation.
+   * \param[in] target_geometry - Geometry of the target mesh.
+   * \param[in] markTarget - Index of the target marker, negative if not on this rank.
+   * \param[in] pattern - Communication pattern.
+   * \return True if the pattern needs to be rebuilt (local answer, needs to be reduced).
+   */
+  bool SparsePatternChanged(const CInterpolator& interpolator, const CGeometry *target_geometry,
+                            int markTarget, const CSparsePattern& pattern) const;
+
+  /*!
+   * \brief Build the communication pattern of an interface from the donor information of the interpolator.
+   * \note This is a collective operation, but it is only needed when the interpolation changes.
+   * \param[in] interpolator - Object defining the interpolation.
+   * \param[in] donor_geometry - Geometry of the donor mesh.
+   * \param[in] target_geometry - Geometry of the target mesh.
+   * \param[in] markDonor - Index of the donor marker, negative if not on this rank.
+   * \param[in] markTarget - Index of the target marker, negative if not on this rank.
+   * \param[out] pattern - Communication pattern.
+   */
+  void SetSparsePattern(const CInterpolator& interpolator, const CGeometry *donor_geometry,
+                        const CGeometry *target_geometry, int markDonor, int markTarget,
+                        CSparsePattern& pattern) const;
+
+  /*!
+   * \brief Send the donor values to the ranks that need them, according to a sparse pattern.
+   * \param[in] donor_solution - Solution from the donor mesh.
+   * \param[in] donor_geometry - Geometry of the donor mesh.
+   * \param[in] donor_config - Definition of the problem at the donor mesh.
+   * \param[in] markDonor - Index of the donor marker, negative if not on this rank.
+   * \param[in,out] pattern - Communication pattern, the values are exchanged through its buffers.
+   */
+  void SparseDataExchange(CSolver *donor_solution, CGeometry *donor_geometry, const CConfig *donor_config,
+                          int markDonor, CSparsePattern& pattern);
+
   /*!
    * \brief A virtual member.
    */
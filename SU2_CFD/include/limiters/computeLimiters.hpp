@@ -27,6 +27,7 @@
 
 #include "CLimiterDetails.hpp"
 #include "computeLimiters_impl.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 
 /*!
  * \brief A wrapper funtion that calls specialized implementations depending
@@ -51,6 +52,8 @@ void computeLimiters(LIMITER LimiterKind,
                      FieldType& fieldMax,
                      FieldType& limiter)
 {
+  SU2_PROFILE_SCOPE("Limiters");
+
   if (geometry.GetnDim() != 2 && geometry.GetnDim() != 3)
     SU2_MPI::Error("Too many dimensions to compute limiters.", CURRENT_FUNCTION);
 
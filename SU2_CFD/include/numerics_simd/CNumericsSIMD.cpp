@@ -29,11 +29,25 @@
 
 #include "CNumericsSIMD.hpp"
 #include "flow/convection/roe.hpp"
+#include "flow/convection/hllc.hpp"
+#include "flow/convection/ausm_slau.hpp"
 #include "flow/convection/centered.hpp"
 #include "flow/diffusion/viscous_fluxes.hpp"
+#include "scalar/convection/upwind.hpp"
+#include "scalar/diffusion/viscous_fluxes.hpp"
+#include "scalar/sources/turb_sources.hpp"
+#include "../solvers/CSolver.hpp"
 
 namespace {
 
+/*!
+ * \brief Same warning as the scalar AUSM-type schemes, grid velocities are not considered.
+ */
+void WarnGridVelocityAUSM(const CConfig& config) {
+  if (config.GetDynamic_Grid() && (SU2_MPI::GetRank() == MASTER_NODE))
+    cout << "WARNING: Grid velocities are NOT yet considered in AUSM-type schemes." << endl;
+}
+
 /*!
  * \brief Upwind factory implementation for ideal gas.
  */
@@ -44,6 +58,19 @@ CNumericsSIMD* createUpwindIdealNumerics(const CConfig& config, int iMesh, const
     case UPWIND::ROE:
       obj = new CRoeScheme<ViscousDecorator>(config, iMesh, turbVars);
       break;
+    case UPWIND::HLLC:
+      obj = new CHLLCScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case UPWIND::AUSMPLUSUP:
+    case UPWIND::AUSMPLUSUP2:
+      WarnGridVelocityAUSM(config);
+      obj = new CAUSMPLUSUPScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case UPWIND::SLAU:
+    case UPWIND::SLAU2:
+      WarnGridVelocityAUSM(config);
+      obj = new CSLAUScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
     default:
       break;
   }
@@ -126,6 +153,88 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
   return obj;
 }
 
+/*!
+ * \brief Scalar transport factory implementation.
+ */
+template<int nDim>
+CNumericsSIMD* createScalarNumerics(const CConfig& config, unsigned short iSol, const CSolver* const* solvers) {
+  CNumericsSIMD* obj = nullptr;
+  const auto* flowVars = solvers[FLOW_SOL]->GetNodes();
+  const auto* massFluxes = solvers[FLOW_SOL]->GetEdgeMassFluxes();
+
+  if (iSol == TURB_SOL) {
+    if (config.GetKind_ConvNumScheme_Turb() != SPACE_UPWIND) return nullptr;
+    const bool bounded = config.GetBounded_Turb();
+
+    switch (config.GetKind_Turb_Model()) {
+      case TURB_MODEL::SA:
+        obj = new CUpwindScalar<CSAViscousFlux<nDim> >(config, bounded, flowVars, massFluxes);
+        break;
+      case TURB_MODEL::SST: {
+        const su2double* constants = solvers[TURB_SOL]->GetConstants();
+        obj = new CUpwindScalar<CSSTViscousFlux<nDim> >(config, bounded, flowVars, massFluxes, constants);
+        break;
+      }
+      default:
+        break;
+    }
+  }
+  else if (iSol == SPECIES_SOL) {
+    if (config.GetKind_ConvNumScheme_Species() != SPACE_UPWIND) return nullptr;
+    const bool bounded = config.GetBounded_Species();
+
+    /*--- The number of species (or flamelet variables) is only known at runtime,
+     *    larger systems use the edge-by-edge implementation. ---*/
+    switch (solvers[SPECIES_SOL]->GetnVar()) {
+      case 1:
+        obj = new CUpwindScalar<CSpeciesViscousFlux<nDim,1> >(config, bounded, flowVars, massFluxes);
+        break;
+      case 2:
+        obj = new CUpwindScalar<CSpeciesViscousFlux<nDim,2> >(config, bounded, flowVars, massFluxes);
+        break;
+      case 3:
+        obj = new CUpwindScalar<CSpeciesViscousFlux<nDim,3> >(config, bounded, flowVars, massFluxes);
+        break;
+      case 4:
+        obj = new CUpwindScalar<CSpeciesViscousFlux<nDim,4> >(config, bounded, flowVars, massFluxes);
+        break;
+      default:
+        break;
+    }
+  }
+  return obj;
+}
+
+/*!
+ * \brief Turbulence source factory implementation.
+ */
+template<int nDim>
+CSourceSIMD* createTurbSource(const CConfig& config, const CSolver* const* solvers) {
+  const auto* flowVars = static_cast<const CFlowVariable*>(solvers[FLOW_SOL]->GetNodes());
+
+  /*--- Transition models couple through the intermittency, which is only done point-by-point. ---*/
+  if (config.GetKind_Trans_Model() != TURB_TRANS_MODEL::NONE) return nullptr;
+
+  switch (config.GetKind_Turb_Model()) {
+    case TURB_MODEL::SA: {
+      const auto options = config.GetSAParsedOptions();
+      if (options.version == SA_OPTIONS::EDW || options.comp || options.bc ||
+          config.GetKind_HybridRANSLES() != NO_HYBRIDRANSLES) return nullptr;
+      return new CSASource<nDim>(config, flowVars);
+    }
+    case TURB_MODEL::SST: {
+      const auto options = config.GetSSTParsedOptions();
+      if (options.uq || options.production == SST_OPTIONS::UQ || config.GetAxisymmetric()) return nullptr;
+      const auto* turbSolver = solvers[TURB_SOL];
+      return new CSSTSource<nDim>(config, flowVars, turbSolver->GetConstants(),
+                                  turbSolver->GetTke_Inf(), turbSolver->GetOmega_Inf());
+    }
+    default:
+      break;
+  }
+  return nullptr;
+}
+
 } // namespace
 
 /*!
@@ -145,3 +254,24 @@ CNumericsSIMD* CNumericsSIMD::CreateNumerics(const CConfig& config, int nDim, in
 
   return nullptr;
 }
+
+CNumericsSIMD* CNumericsSIMD::CreateScalarNumerics(const CConfig& config, int nDim, unsigned short iSol,
+                                                   const CSolver* const* solvers) {
+  /*--- NEMO primitives are not supported, nor are scalar problems without flow. ---*/
+  if (config.GetNEMOProblem() || !solvers[FLOW_SOL]) return nullptr;
+
+  if (nDim == 2) return createScalarNumerics<2>(config, iSol, solvers);
+  if (nDim == 3) return createScalarNumerics<3>(config, iSol, solvers);
+
+  return nullptr;
+}
+
+CSourceSIMD* CSourceSIMD::CreateTurbSource(const CConfig& config, int nDim, const CSolver* const* solvers) {
+  /*--- NEMO primitives are not supported. ---*/
+  if (config.GetNEMOProblem() || !solvers[FLOW_SOL]) return nullptr;
+
+  if (nDim == 2) return createTurbSource<2>(config, solvers);
+  if (nDim == 3) return createTurbSource<3>(config, solvers);
+
+  return nullptr;
+}
@@ -49,6 +49,7 @@ template<class T> class CSysMatrix;
 class CConfig;
 class CGeometry;
 class CVariable;
+class CSolver;
 
 #ifdef CODI_FORWARD_TYPE
 using SparseMatrixType = CSysMatrix<su2double>;
@@ -97,4 +98,54 @@ public:
    */
   static CNumericsSIMD* CreateNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* turbVars = nullptr);
 
+  /*!
+   * \brief Factory method for scalar transport (convection and diffusion).
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] iSol - Position of the scalar solver (TURB_SOL or SPECIES_SOL).
+   * \param[in] solvers - Solver container, which must contain the flow solver.
+   * \return nullptr if the model in use does not support vectorization.
+   */
+  static CNumericsSIMD* CreateScalarNumerics(const CConfig& config, int nDim, unsigned short iSol,
+                                             const CSolver* const* solvers);
+
+};
+
+/*!
+ * \class CSourceSIMD
+ * \ingroup SourceDiscr
+ * \brief Base class to define the interface of vectorized point source terms.
+ */
+class CSourceSIMD {
+public:
+  /*!
+   * \brief Interface for the source term of a group of points.
+   * \param[in] iPoint - The points for source computation.
+   * \param[in] config - Problem definitions.
+   * \param[in] geometry - Problem geometry.
+   * \param[in] solution - Solution variables.
+   * \param[in] updateMask - SIMD array of 1's and 0's, the latter prevent the update.
+   * \param[in,out] vector - Target for the sources (which are subtracted).
+   * \param[in,out] matrix - Target for the source Jacobians (subtracted from the diagonal).
+   */
+  virtual void ComputeSource(Int iPoint,
+                             const CConfig& config,
+                             const CGeometry& geometry,
+                             const CVariable& solution,
+                             Double updateMask,
+                             CSysVector<su2double>& vector,
+                             SparseMatrixType& matrix) const = 0;
+
+  /*! \brief Destructor of the class. */
+  virtual ~CSourceSIMD(void) = default;
+
+  /*!
+   * \brief Factory method for the sources of the turbulence models.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] solvers - Solver container, which must contain the flow and turbulence solvers.
+   * \return nullptr if the model options in use do not support vectorization.
+   */
+  static CSourceSIMD* CreateTurbSource(const CConfig& config, int nDim, const CSolver* const* solvers);
+
 };
@@ -0,0 +1,384 @@
+/*!
+ * \file ausm_slau.hpp
+ * \brief AUSM+-up and SLAU families of convective schemes.
+ * \author P. Gomes, W. Maier, A. Sachedeva, F. Palacios
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CAUSMSLAUBase
+ * \ingroup ConvDiscr
+ * \brief Base class for schemes in the general form of AUSM+-up and SLAU,
+ * F = ||A|| (0.5 * mdot * (psi_i+psi_j) + 0.5 * |mdot| * (psi_i-psi_j) + N * p), psi = (1, v, H).
+ * Derived classes implement the face mass flux (per unit area) and pressure in a const
+ * "massAndPressureFluxes" method, the Jacobians are approximated with those of the Roe scheme.
+ * A base class implementing "viscousTerms" is accepted as template parameter (see CRoeBase).
+ * \note As in the scalar implementations, grid motion is not accounted for.
+ */
+template<class Derived, class Base>
+class CAUSMSLAUBase : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double gamma;
+  const bool finestGrid;
+  const bool muscl;
+  const LIMITER typeLimiter;
+
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CAUSMSLAUBase(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    gamma(config.GetGamma()),
+    finestGrid(iMesh == MESH_0),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()) {
+  }
+
+public:
+  /*!
+   * \brief Implementation of the general AUSM/SLAU flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                 iEdge, iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Compute conservative variables. ---*/
+
+    CPair<CCompressibleConservatives<nDim> > U;
+    U.i = compressibleConservatives(V.i);
+    U.j = compressibleConservatives(V.j);
+
+    /*--- Mass and pressure fluxes defined by derived classes (static polymorphism). ---*/
+
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    Double mdot, pressure;
+    const auto derived = static_cast<const Derived*>(this);
+    derived->massAndPressureFluxes(V, projVel_i, projVel_j, iPoint, jPoint, solution, mdot, pressure);
+
+    /*--- Assemble the flux. ---*/
+
+    const Double absMdot = abs(mdot);
+
+    VectorDbl<nVar> flux;
+    flux(0) = mdot;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = 0.5 * mdot * (V.i.velocity(iDim) + V.j.velocity(iDim)) +
+                     0.5 * absMdot * (V.i.velocity(iDim) - V.j.velocity(iDim)) + unitNormal(iDim) * pressure;
+    }
+    flux(nVar-1) = 0.5 * mdot * (V.i.enthalpy() + V.j.enthalpy()) +
+                   0.5 * absMdot * (V.i.enthalpy() - V.j.enthalpy());
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) *= area;
+    }
+
+    /*--- Approximate (Roe) Jacobians. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      jac_i = inviscidProjJac(gamma, V.i.velocity(), U.i.energy(), normal, 0.5);
+      jac_j = inviscidProjJac(gamma, V.j.velocity(), U.j.energy(), normal, 0.5);
+
+      const auto roeAvg = roeAveragedVariables(gamma, V, unitNormal);
+
+      const auto pMat = pMatrix(gamma, roeAvg.density, roeAvg.velocity,
+                                roeAvg.projVel, roeAvg.speedSound, unitNormal);
+      const auto pMatInv = pMatrixInv(gamma, roeAvg.density, roeAvg.velocity,
+                                      roeAvg.projVel, roeAvg.speedSound, unitNormal);
+      VectorDbl<nVar> lambda;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        lambda(iDim) = abs(roeAvg.projVel);
+      }
+      lambda(nDim) = abs(roeAvg.projVel + roeAvg.speedSound);
+      lambda(nDim+1) = abs(roeAvg.projVel - roeAvg.speedSound);
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          Double projModJacTensor = 0.0;
+          for (size_t kVar = 0; kVar < nVar; ++kVar) {
+            projModJacTensor += pMat(iVar,kVar) * lambda(kVar) * pMatInv(kVar,jVar);
+          }
+          jac_i(iVar,jVar) += 0.5 * projModJacTensor * area;
+          jac_j(iVar,jVar) -= 0.5 * projModJacTensor * area;
+        }
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
+
+/*!
+ * \class CAUSMPLUSUPScheme
+ * \ingroup ConvDiscr
+ * \brief AUSM+-up and AUSM+-up2 schemes (vectorized CUpwAUSMPLUSUP_Flow and CUpwAUSMPLUSUP2_Flow).
+ */
+template<class Decorator>
+class CAUSMPLUSUPScheme : public CAUSMSLAUBase<CAUSMPLUSUPScheme<Decorator>,Decorator> {
+private:
+  using Base = CAUSMSLAUBase<CAUSMPLUSUPScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const su2double Minf;
+  const bool up2;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CAUSMPLUSUPScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    Minf(config.GetMach()),
+    up2(config.GetKind_Upwind_Flow() == UPWIND::AUSMPLUSUP2) {
+    if (Minf < EPS)
+      SU2_MPI::Error("AUSM+Up requires a reference Mach number (\"MACH_NUMBER\") greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*!
+   * \brief Face mass flux and pressure.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         Double projVel_i,
+                                         Double projVel_j,
+                                         Int,
+                                         Int,
+                                         const CEulerVariable&,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    constexpr passivedouble Kp = 0.25, Ku = 0.75, sigma = 1.0;
+
+    /*--- Interface speed of sound (aF). ---*/
+
+    const Double astarL = sqrt(2*(gamma-1)/(gamma+1) * V.i.enthalpy());
+    const Double astarR = sqrt(2*(gamma-1)/(gamma+1) * V.j.enthalpy());
+
+    const Double ahatL = astarL * astarL / fmax(astarL, projVel_i);
+    const Double ahatR = astarR * astarR / fmax(astarR, -projVel_j);
+
+    const Double aF = fmin(ahatL, ahatR);
+
+    /*--- Left and right Mach numbers and scaling. ---*/
+
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    const Double MFsq = 0.5 * (mL*mL + mR*mR);
+    const Double Mrefsq = fmin(1.0, fmax(MFsq, Minf*Minf));
+
+    const Double fa = 2.0 * sqrt(Mrefsq) - Mrefsq;
+
+    const Double alpha = 3.0/16.0 * (-4.0 + 5.0*fa*fa);
+    constexpr passivedouble beta = 1.0/8.0;
+
+    /*--- Split Mach numbers and pressures, subsonic lanes use the polynomials. ---*/
+
+    const Double subL = abs(mL) <= 1.0;
+    Double p1 = 0.25 * pow(mL+1.0, 2);
+    Double p2 = pow(mL*mL-1.0, 2);
+    const Double mLP = subL * (p1 + beta*p2) + (1-subL) * 0.5 * (mL + abs(mL));
+    const Double pLP = subL * (p1*(2.0-mL) + alpha*mL*p2) + (1-subL) * (mL > 0.0);
+
+    const Double subR = abs(mR) <= 1.0;
+    p1 = 0.25 * pow(mR-1.0, 2);
+    p2 = pow(mR*mR-1.0, 2);
+    const Double mRM = subR * (-p1 - beta*p2) + (1-subR) * 0.5 * (mR - abs(mR));
+    const Double pRM = subR * (p1*(2.0+mR) - alpha*mR*p2) + (1-subR) * (mR < 0.0);
+
+    /*--- Mass flux with pressure diffusion term. ---*/
+
+    const Double rhoF = 0.5 * (V.i.density() + V.j.density());
+    const Double Mp = -(Kp/fa) * fmax(1.0 - sigma*MFsq, 0.0) * (V.j.pressure() - V.i.pressure()) / (rhoF*aF*aF);
+
+    const Double mF = mLP + mRM + Mp;
+    mdot = aF * (fmax(mF, 0.0) * V.i.density() + fmin(mF, 0.0) * V.j.density());
+
+    /*--- Pressure with velocity diffusion term. ---*/
+
+    if (!up2) {
+      const Double Pu = -Ku * fa * pLP * pRM * 2.0 * rhoF * aF * (projVel_j - projVel_i);
+      pressure = pLP * V.i.pressure() + pRM * V.j.pressure() + Pu;
+    }
+    else {
+      const Double sqVel = 0.5 * (squaredNorm<nDim>(V.i.velocity()) + squaredNorm<nDim>(V.j.velocity()));
+      pressure = 0.5 * (V.j.pressure() + V.i.pressure()) + 0.5 * (pLP - pRM) * (V.i.pressure() - V.j.pressure()) +
+                 sqrt(sqVel) * (pLP + pRM - 1.0) * rhoF * aF;
+    }
+  }
+};
+
+/*!
+ * \class CSLAUScheme
+ * \ingroup ConvDiscr
+ * \brief SLAU and SLAU2 schemes, optionally with low dissipation (vectorized CUpwSLAU_Flow and CUpwSLAU2_Flow).
+ */
+template<class Decorator>
+class CSLAUScheme : public CAUSMSLAUBase<CSLAUScheme<Decorator>,Decorator> {
+private:
+  using Base = CAUSMSLAUBase<CSLAUScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const ENUM_ROELOWDISS typeDissip;
+  const bool slau2;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CSLAUScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    typeDissip(static_cast<ENUM_ROELOWDISS>(config.GetKind_RoeLowDiss())),
+    slau2(config.GetKind_Upwind_Flow() == UPWIND::SLAU2) {
+  }
+
+  /*!
+   * \brief Face mass flux and pressure.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         Double projVel_i,
+                                         Double projVel_j,
+                                         Int iPoint,
+                                         Int jPoint,
+                                         const CEulerVariable& solution,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    /*--- Speeds of sound. ---*/
+
+    const Double sqVel_i = squaredNorm<nDim>(V.i.velocity());
+    const Double sqVel_j = squaredNorm<nDim>(V.j.velocity());
+
+    const Double energy_i = V.i.enthalpy() - V.i.pressure() / V.i.density();
+    const Double energy_j = V.j.enthalpy() - V.j.pressure() / V.j.density();
+
+    const Double soundSpeed_i = sqrt(abs(gamma*(gamma-1) * (energy_i - 0.5*sqVel_i)));
+    const Double soundSpeed_j = sqrt(abs(gamma*(gamma-1) * (energy_j - 0.5*sqVel_j)));
+
+    /*--- Interface speed of sound (aF), and left/right Mach number. ---*/
+
+    const Double aF = 0.5 * (soundSpeed_i + soundSpeed_j);
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    /*--- Smooth function of the local Mach number. ---*/
+
+    const Double machTilde = fmin(1.0, sqrt(0.5*(sqVel_i + sqVel_j)) / aF);
+    const Double chi = pow(1.0 - machTilde, 2);
+    const Double fRho = -fmax(fmin(mL, 0.0), -1.0) * fmin(fmax(mR, 0.0), 1.0);
+
+    /*--- Mean normal velocity with density weighting. ---*/
+
+    const Double absVel_i = abs(projVel_i);
+    const Double absVel_j = abs(projVel_j);
+    const Double vnMag = (V.i.density()*absVel_i + V.j.density()*absVel_j) / (V.i.density() + V.j.density());
+    const Double vnMagL = (1.0 - fRho) * vnMag + fRho * absVel_i;
+    const Double vnMagR = (1.0 - fRho) * vnMag + fRho * absVel_j;
+
+    /*--- Mass flux function. ---*/
+
+    mdot = 0.5 * (V.i.density() * (projVel_i + vnMagL) + V.j.density() * (projVel_j - vnMagR) -
+                  (chi/aF) * (V.j.pressure() - V.i.pressure()));
+
+    /*--- Pressure function. ---*/
+
+    const Double subL = abs(mL) < 1.0;
+    const Double betaL = subL * 0.25 * (2.0-mL) * pow(mL+1.0, 2) + (1-subL) * (mL >= 0.0);
+
+    const Double subR = abs(mR) < 1.0;
+    const Double betaR = subR * 0.25 * (2.0+mR) * pow(mR-1.0, 2) + (1-subR) * (mR < 0.0);
+
+    const Double dissipation = roeDissipation(iPoint, jPoint, typeDissip, solution);
+
+    pressure = 0.5 * (V.i.pressure() + V.j.pressure()) + 0.5 * (betaL - betaR) * (V.i.pressure() - V.j.pressure());
+
+    if (!slau2) {
+      pressure += dissipation * (1.0 - chi) * (betaL + betaR - 1.0) * 0.5 * (V.i.pressure() + V.j.pressure());
+    } else {
+      pressure += dissipation * sqrt(0.5*(sqVel_i + sqVel_j)) * (betaL + betaR - 1.0) * aF * 0.5 *
+                  (V.i.density() + V.j.density());
+    }
+  }
+};
@@ -0,0 +1,310 @@
+/*!
+ * \file hllc.hpp
+ * \brief HLLC convective scheme.
+ * \author P. Gomes, G. Gori, F. Palacios
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CHLLCScheme
+ * \ingroup ConvDiscr
+ * \brief HLLC scheme (ideal gas), vectorized version of CUpwHLLC_Flow.
+ * \note The four wave configurations of the scalar implementation are evaluated without branches,
+ * the flux and Jacobians are written in terms of the state on the upwind side of the contact
+ * surface (i if sM > 0, j otherwise) and the lanes select their configuration with 0/1 masks.
+ */
+template<class Decorator>
+class CHLLCScheme : public Decorator {
+private:
+  using Base = Decorator;
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double kappa;
+  const su2double gamma;
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const LIMITER typeLimiter;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CHLLCScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    kappa(config.GetRoe_Kappa()),
+    gamma(config.GetGamma()),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()) {
+  }
+
+  /*!
+   * \brief Implementation of the HLLC flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                 iEdge, iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Compute conservative variables. ---*/
+
+    CPair<CCompressibleConservatives<nDim> > U;
+    U.i = compressibleConservatives(V.i);
+    U.j = compressibleConservatives(V.j);
+
+    /*--- Grid motion. ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), unitNormal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), unitNormal));
+    }
+
+    /*--- Projected velocities (relative to the grid) and speeds of sound. ---*/
+
+    const Double gm1 = gamma - 1;
+    const Double projVel_i = dot(V.i.velocity(), unitNormal) - projGridVel;
+    const Double projVel_j = dot(V.j.velocity(), unitNormal) - projGridVel;
+    const Double soundSpeed_i = sqrt((V.i.enthalpy() - 0.5*squaredNorm<nDim>(V.i.velocity())) * gm1) - projGridVel;
+    const Double soundSpeed_j = sqrt((V.j.enthalpy() - 0.5*squaredNorm<nDim>(V.j.velocity())) * gm1) + projGridVel;
+
+    /*--- Wave speeds from Roe-averaged variables. ---*/
+
+    const auto roeAvg = roeAveragedVariables(gamma, V, unitNormal);
+    const Double roeProjVel = roeAvg.projVel - projGridVel;
+    const Double roeSoundSpeed = roeAvg.speedSound - projGridVel;
+
+    const Double sL = fmin(roeProjVel - roeSoundSpeed, projVel_i - soundSpeed_i);
+    const Double sR = fmax(roeProjVel + roeSoundSpeed, projVel_j + soundSpeed_j);
+
+    /*--- Speed of the contact surface and pressure on both sides of it. ---*/
+
+    const Double RHO = V.j.density() * (sR - projVel_j) - V.i.density() * (sL - projVel_i);
+    const Double sM = (V.i.pressure() - V.j.pressure() - V.i.density() * projVel_i * (sL - projVel_i) +
+                       V.j.density() * projVel_j * (sR - projVel_j)) / RHO;
+    const Double pStar = V.j.density() * (projVel_j - sR) * (projVel_j - sM) + V.j.pressure();
+
+    /*--- Upwind side of the contact surface (w = 1 for i, 0 for j), and
+     *    whether the upwind wave also leaves the face (supersonic flux). ---*/
+
+    const Double w = sM > 0.0;
+    const Double supersonic = w * (sL > 0.0) + (1-w) * (sR < 0.0);
+
+    auto upwind = [&w](const Double& a, const Double& b) { return Double(w*a + (1-w)*b); };
+
+    const Double s = upwind(sL, sR);
+    const Double projVel = upwind(projVel_i, projVel_j);
+    const Double density = upwind(V.i.density(), V.j.density());
+    const Double pressure = upwind(V.i.pressure(), V.j.pressure());
+    const Double enthalpy = upwind(V.i.enthalpy(), V.j.enthalpy());
+    const Double energy = upwind(U.i.energy(), U.j.energy());
+    VectorDbl<nDim> velocity;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      velocity(iDim) = upwind(V.i.velocity(iDim), V.j.velocity(iDim));
+    }
+
+    /*--- Intermediate (star) state on the upwind side. ---*/
+
+    const Double sMinusQ = s - projVel;
+    const Double rhoStar = sMinusQ / (s - sM);
+
+    VectorDbl<nVar> star;
+    star(0) = rhoStar * density;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      star(iDim+1) = rhoStar * (density * velocity(iDim) + (pStar - pressure) / sMinusQ * unitNormal(iDim));
+    }
+    star(nVar-1) = rhoStar * (density * energy - (pressure * projVel - pStar * sM) / sMinusQ);
+
+    /*--- Flux, from the upwind state or from the star state. ---*/
+
+    VectorDbl<nVar> flux;
+    flux(0) = supersonic * density * projVel + (1-supersonic) * sM * star(0);
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = supersonic * (density * velocity(iDim) * projVel + pressure * unitNormal(iDim)) +
+                     (1-supersonic) * (sM * star(iDim+1) + pStar * unitNormal(iDim));
+    }
+    flux(nVar-1) = supersonic * enthalpy * density * projVel +
+                   (1-supersonic) * (sM * (star(nVar-1) + pStar) + pStar * projGridVel);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) *= area;
+    }
+
+    /*--- Jacobians. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      const Double omega = 1 / (s - sM);
+      const Double omegaSM = omega * sM;
+      const Double EStar = star(nVar-1);
+
+      /*--- Terms common to both sides, i.e. the dependence of the star state on sM and pStar,
+       *    "sign" is 1 for i and -1 for j, "Vx/projVel_x" is the side w.r.t. which we differentiate. ---*/
+
+      auto starJacobian = [&](passivedouble sign, const CCompressiblePrimitives<nDim,nPrimVarGrad>& Vx,
+                              const Double& projVel_x, const Double& s_x, const Double& projVel_o,
+                              const Double& s_o, MatrixDbl<nVar>& jac) {
+        VectorDbl<nVar> dPI, dSm, dpStar, dEStar;
+
+        dPI(0) = 0.5 * gm1 * squaredNorm<nDim>(Vx.velocity());
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          dPI(iDim+1) = -gm1 * Vx.velocity(iDim);
+        }
+        dPI(nVar-1) = gm1;
+
+        dSm(0) = sign * (-projVel_x * projVel_x + sM * s_x + dPI(0)) / RHO;
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          dSm(iDim+1) = sign * (unitNormal(iDim) * (2 * projVel_x - s_x - sM) + dPI(iDim+1)) / RHO;
+        }
+        dSm(nVar-1) = sign * dPI(nVar-1) / RHO;
+
+        for (size_t iVar = 0; iVar < nVar; ++iVar) {
+          dpStar(iVar) = Vx.density() * (s_o - projVel_o) * dSm(iVar);
+          dEStar(iVar) = omega * (sM * dpStar(iVar) + (EStar + pStar) * dSm(iVar));
+        }
+
+        for (size_t iVar = 0; iVar < nVar; ++iVar) {
+          jac(0,iVar) = star(0) * (omegaSM + 1) * dSm(iVar);
+          for (size_t iDim = 0; iDim < nDim; ++iDim) {
+            jac(iDim+1,iVar) = (omegaSM + 1) * (star(iDim+1) * dSm(iVar) + unitNormal(iDim) * dpStar(iVar));
+          }
+          jac(nVar-1,iVar) = sM * (dEStar(iVar) + dpStar(iVar)) + (EStar + pStar) * dSm(iVar);
+        }
+      };
+      starJacobian(1, V.i, projVel_i, sL, projVel_j, sR, jac_i);
+      starJacobian(-1, V.j, projVel_j, sR, projVel_i, sL, jac_j);
+
+      /*--- Extra terms of the upwind side, due to the explicit dependence of the star state on it. ---*/
+
+      VectorDbl<nVar> dPI;
+      dPI(0) = 0.5 * gm1 * squaredNorm(velocity);
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        dPI(iDim+1) = -gm1 * velocity(iDim);
+      }
+      dPI(nVar-1) = gm1;
+
+      MatrixDbl<nVar> jacUp;
+      jacUp(0,0) = omegaSM * s;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        jacUp(0,iDim+1) = -omegaSM * unitNormal(iDim);
+      }
+      jacUp(0,nVar-1) = 0.0;
+
+      for (size_t jDim = 0; jDim < nDim; ++jDim) {
+        for (size_t iVar = 0; iVar < nVar; ++iVar) {
+          jacUp(jDim+1,iVar) = -omegaSM * dPI(iVar) * unitNormal(jDim);
+        }
+        jacUp(jDim+1,0) += omegaSM * velocity(jDim) * projVel;
+        jacUp(jDim+1,jDim+1) += omegaSM * sMinusQ;
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          jacUp(jDim+1,iDim+1) -= omegaSM * velocity(jDim) * unitNormal(iDim);
+        }
+      }
+
+      jacUp(nVar-1,0) = omegaSM * projVel * (enthalpy - dPI(0));
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        jacUp(nVar-1,iDim+1) = omegaSM * (-unitNormal(iDim) * enthalpy - projVel * dPI(iDim+1));
+      }
+      jacUp(nVar-1,nVar-1) = omegaSM * (sMinusQ - projVel * dPI(nVar-1));
+
+      /*--- Jacobian of the physical flux of the upwind state, used by the supersonic lanes. ---*/
+
+      const auto jacPhys = inviscidProjJac(gamma, velocity.data(), energy, unitNormal, 1.0);
+
+      /*--- Blend, and scale by k because the flux ~ 0.5*(fc_i+fc_j)*Normal. ---*/
+
+      const Double scale = area * kappa;
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          const Double jac_ij = supersonic * jacPhys(iVar,jVar);
+          jac_i(iVar,jVar) = scale * (w * jac_ij + (1-supersonic) * (jac_i(iVar,jVar) + w * jacUp(iVar,jVar)));
+          jac_j(iVar,jVar) = scale * ((1-w) * jac_ij + (1-supersonic) * (jac_j(iVar,jVar) + (1-w) * jacUp(iVar,jVar)));
+        }
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
@@ -0,0 +1,213 @@
+/*!
+ * \file upwind.hpp
+ * \brief Upwind convective scheme for scalar transport equations.
+ * \author P. Gomes, C. Pederson, A. Bueno, A. Campos
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../../flow/convection/common.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CUpwindScalar
+ * \ingroup ConvDiscr
+ * \brief First order upwind (MUSCL if enabled) convection of scalars, see CUpwScalar.
+ * The viscous decorator provides the model (number of variables, whether the convected
+ * quantity is multiplied by density, and the diffusivities). Convection and diffusion
+ * are computed together because the vectorized matrix update sets the off-diagonal blocks.
+ */
+template<class Decorator>
+class CUpwindScalar final : public Decorator {
+private:
+  using Base = Decorator;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::flowVars;
+  /*--- Flow primitives up to and including density, velocity starts at 1 and density is at nDim+2
+   *    (for compressible and incompressible flow). ---*/
+  static constexpr size_t nPrimVar = nDim+3;
+
+  const su2activevector* const massFluxes;
+  const bool bounded;
+  const bool dynamicGrid;
+
+  /*!
+   * \brief MUSCL reconstruction of the scalars, optionally limited with the point-based limiter.
+   * \note The gradients are accessed via data() because with one variable they are vectors.
+   */
+  FORCEINLINE static void reconstructScalars(Int iPoint,
+                                             const VectorDbl<nDim>& vector_ij,
+                                             Double scale,
+                                             bool limiter,
+                                             const CVariable& solution,
+                                             VectorDbl<nVar>& vars) {
+    const auto grad = gatherVariables<nVar,nDim>(iPoint, solution.GetGradient_Reconstruction());
+    VectorDbl<nVar> lim;
+    if (limiter) lim = gatherVariables<nVar>(iPoint, solution.GetLimiter());
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      const Double proj = scale * dot<nDim>(&grad.data()[iVar*nDim], vector_ij.data());
+      vars(iVar) += limiter ? Double(lim(iVar) * proj) : proj;
+    }
+  }
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   * \param[in] config - Problem definitions.
+   * \param[in] bounded - Use the edge mass fluxes of the flow solver (bounded scalar mode).
+   * \param[in] flowVars - Flow variables.
+   * \param[in] massFluxes - Edge mass fluxes of the flow solver.
+   */
+  template<class... Ts>
+  CUpwindScalar(const CConfig& config, bool bounded_, const CVariable* flowVars_,
+                const su2activevector* massFluxes_, Ts&... args) : Base(config, flowVars_, args...),
+    massFluxes(massFluxes_),
+    bounded(bounded_),
+    dynamicGrid(config.GetDynamic_Grid()) {
+  }
+
+  /*!
+   * \brief Implementation of the edge flux (convection - diffusion).
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const bool muscl = config.GetMUSCL();
+    const bool limiter = (config.GetKind_SlopeLimit() != LIMITER::NONE) &&
+                         (config.GetInnerIter() <= config.GetLimiterIter());
+    /*--- Same logic as CScalarSolver::Upwind_Residual for the reconstruction of flow primitives. ---*/
+    const bool musclFlow = muscl && !bounded && config.GetMUSCL_Flow() &&
+                           (config.GetKind_ConvNumScheme_Flow() == SPACE_UPWIND);
+    const bool limiterFlow = (config.GetKind_SlopeLimit_Flow() != LIMITER::NONE) &&
+                             (config.GetKind_SlopeLimit_Flow() != LIMITER::VAN_ALBADA_EDGE);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+
+    /*--- Flow primitives and scalars at the nodes. ---*/
+
+    CPair<VectorDbl<nPrimVar> > V1st;
+    V1st.i = gatherVariables<nPrimVar>(iPoint, flowVars->GetPrimitive());
+    V1st.j = gatherVariables<nPrimVar>(jPoint, flowVars->GetPrimitive());
+
+    CPair<VectorDbl<nVar> > U1st;
+    U1st.i = gatherVariables<nVar>(iPoint, solution.GetSolution());
+    U1st.j = gatherVariables<nVar>(jPoint, solution.GetSolution());
+
+    /*--- Reconstructed states for convection. ---*/
+
+    auto V = V1st;
+    if (musclFlow) {
+      const auto& gradients = flowVars->GetGradient_Reconstruction();
+      if (limiterFlow) {
+        const auto& limiters = flowVars->GetLimiter_Primitive();
+        musclPointLimited(iPoint, vector_ij, 0.5, limiters, gradients, V.i);
+        musclPointLimited(jPoint, vector_ij,-0.5, limiters, gradients, V.j);
+      } else {
+        musclUnlimited(iPoint, vector_ij, 0.5, gradients, V.i);
+        musclUnlimited(jPoint, vector_ij,-0.5, gradients, V.j);
+      }
+    }
+
+    auto U = U1st;
+    if (muscl) {
+      reconstructScalars(iPoint, vector_ij, 0.5, limiter, solution, U.i);
+      reconstructScalars(jPoint, vector_ij,-0.5, limiter, solution, U.j);
+    }
+
+    /*--- Upwind coefficients, from the edge mass flux or the average normal velocity. ---*/
+
+    Double a0, a1;
+    if (bounded) {
+      const Double massFlux = gatherVariables(iEdge, *massFluxes);
+      a0 = fmax(0.0, massFlux) / V.i(nDim+2);
+      a1 = fmin(0.0, massFlux) / V.j(nDim+2);
+    } else {
+      Double q_ij = 0.0;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        q_ij += 0.5 * (V.i(iDim+1) + V.j(iDim+1)) * normal(iDim);
+      }
+      if (dynamicGrid) {
+        const auto& gridVel = geometry.nodes->GetGridVel();
+        q_ij -= 0.5 * (dot(gatherVariables<nDim>(iPoint, gridVel), normal) +
+                       dot(gatherVariables<nDim>(jPoint, gridVel), normal));
+      }
+      a0 = fmax(0.0, q_ij);
+      a1 = fmin(0.0, q_ij);
+    }
+
+    /*--- Convective flux and Jacobians (w.r.t. the conservative form if the model is conservative). ---*/
+
+    const Double rho_i = Base::conservative ? V.i(nDim+2) : Double(1.0);
+    const Double rho_j = Base::conservative ? V.j(nDim+2) : Double(1.0);
+
+    VectorDbl<nVar> flux;
+    MatrixDbl<nVar> jac_i, jac_j;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = a0 * rho_i * U.i(iVar) + a1 * rho_j * U.j(iVar);
+    }
+    if (implicit) {
+      jac_i = Double(0.0);
+      jac_j = Double(0.0);
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        diagonal(jac_i, iVar) = a0;
+        diagonal(jac_j, iVar) = a1;
+      }
+    }
+
+    /*--- Subtract the viscous fluxes, computed with the nodal (not reconstructed) states. ---*/
+
+    Base::viscousTerms(iPoint, jPoint, V1st, U1st, solution, vector_ij, normal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
@@ -0,0 +1,349 @@
+/*!
+ * \file viscous_fluxes.hpp
+ * \brief Decorator classes for the diffusion of scalar transport equations.
+ * \author P. Gomes, C. Pederson, A. Bueno, F. Palacios
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../../../variables/CTurbSSTVariable.hpp"
+#include "../../../variables/CSpeciesVariable.hpp"
+
+/*!
+ * \class CScalarViscousFluxBase
+ * \ingroup ViscDiscr
+ * \brief Decorator class to add the diffusion of scalar transport equations,
+ * using the average of nodal gradients corrected with the directional derivative.
+ * Derived classes implement the model specific diffusivities in a const "finalizeFlux" method.
+ * The convective class that is decorated is responsible for fetching the flow
+ * primitives (which are also needed for convection), the base class computes
+ * the corrected projected gradients.
+ */
+template<size_t NDIM, size_t NVAR, class Derived>
+class CScalarViscousFluxBase : public CNumericsSIMD {
+protected:
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nVar = NVAR;
+
+  const size_t idxLamVisc;
+  const size_t idxEddyVisc;
+
+  const CVariable* flowVars;
+
+  /*!
+   * \brief Constructor, initialize the indices of the flow primitives.
+   * \note Compressible and incompressible flow share the positions
+   * of velocity and density, but not those of the viscosities.
+   */
+  template<class... Ts>
+  CScalarViscousFluxBase(const CConfig& config, const CVariable* flowVars_, Ts&...) :
+    idxLamVisc(nDim + ((config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE)? 4 : 5)),
+    idxEddyVisc(idxLamVisc + 1),
+    flowVars(flowVars_) {
+  }
+
+  /*!
+   * \brief Subtract the viscous fluxes from the (convective) flux and Jacobians.
+   * \param[in] iPoint, jPoint - Nodes of the edge.
+   * \param[in] V - Flow primitives at i/j (not reconstructed).
+   * \param[in] U - Scalar variables at i/j (not reconstructed).
+   * \param[in] solution - Scalar variables of the solver.
+   * \param[in] vector_ij - Distance vector from i to j.
+   * \param[in] normal - Edge normal.
+   * \param[in] implicit - Whether to compute Jacobians.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void viscousTerms(Int iPoint,
+                                Int jPoint,
+                                const CPair<PrimVarType>& V,
+                                const CPair<VectorDbl<nVar> >& U,
+                                const CVariable& solution,
+                                const VectorDbl<nDim>& vector_ij,
+                                const VectorDbl<nDim>& normal,
+                                bool implicit,
+                                VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j) const {
+
+    /*--- (Edge_Vector DOT normal) / |Edge_Vector|^2, as in CNumerics::ComputeProjectedGradient. ---*/
+
+    const Double proj_vector_ij = dot(vector_ij, normal) / fmax(squaredNorm(vector_ij), EPS);
+
+    /*--- Mean gradient projected on the normal, with correction. ---*/
+
+    /*--- Gradients are accessed via data() because with one variable they are vectors. ---*/
+    const auto grad_i = gatherVariables<nVar,nDim>(iPoint, solution.GetGradient());
+    const auto grad_j = gatherVariables<nVar,nDim>(jPoint, solution.GetGradient());
+
+    VectorDbl<nVar> projGrad;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      Double projNormal = 0.0, edgeProj = 0.0;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        const Double meanGrad = 0.5 * (grad_i.data()[iVar*nDim+iDim] + grad_j.data()[iVar*nDim+iDim]);
+        projNormal += meanGrad * normal(iDim);
+        edgeProj += meanGrad * vector_ij(iDim);
+      }
+      projGrad(iVar) = projNormal - (edgeProj - (U.j(iVar) - U.i(iVar))) * proj_vector_ij;
+    }
+
+    /*--- Model specific diffusivities (static polymorphism). ---*/
+
+    const auto derived = static_cast<const Derived*>(this);
+
+    CPair<Double> density;
+    density.i = V.i(nDim+2);
+    density.j = V.j(nDim+2);
+
+    derived->finalizeFlux(iPoint, jPoint, density, U, solution, projGrad,
+                          proj_vector_ij, implicit, flux, jac_i, jac_j);
+  }
+
+  /*!
+   * \brief Gather a flow primitive variable (e.g. viscosity) for i/j.
+   */
+  FORCEINLINE CPair<Double> gatherPrimitive(Int iPoint, Int jPoint, size_t iVar) const {
+    return {gatherVariable(iPoint, iVar, flowVars->GetPrimitive()),
+            gatherVariable(jPoint, iVar, flowVars->GetPrimitive())};
+  }
+};
+
+/*!
+ * \class CSAViscousFlux
+ * \ingroup ViscDiscr
+ * \brief Diffusion of the Spalart-Allmaras working variable (with the SA-neg modification).
+ */
+template<size_t NDIM>
+class CSAViscousFlux : public CScalarViscousFluxBase<NDIM, 1, CSAViscousFlux<NDIM> > {
+protected:
+  using Base = CScalarViscousFluxBase<NDIM, 1, CSAViscousFlux<NDIM> >;
+  using Base::idxLamVisc;
+  using Base::gatherPrimitive;
+  friend Base;
+
+  /*--- The working variable is not multiplied by density in the convective flux. ---*/
+  static constexpr bool conservative = false;
+
+  const bool negative;
+
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CSAViscousFlux(const CConfig& config, const CVariable* flowVars, Ts&... args) :
+    Base(config, flowVars, args...),
+    negative(config.GetSAParsedOptions().version == SA_OPTIONS::NEG) {
+  }
+
+  /*!
+   * \brief SA specific terms, see CAvgGrad_TurbSA(_Neg).
+   */
+  template<size_t nVar>
+  FORCEINLINE void finalizeFlux(Int iPoint,
+                                Int jPoint,
+                                const CPair<Double>& density,
+                                const CPair<VectorDbl<nVar> >& U,
+                                const CVariable&,
+                                const VectorDbl<nVar>& projGrad,
+                                Double proj_vector_ij,
+                                bool implicit,
+                                VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j) const {
+    constexpr passivedouble sigma = 2.0/3.0;
+    constexpr passivedouble cn1 = 16.0;
+
+    const auto mu = gatherPrimitive(iPoint, jPoint, idxLamVisc);
+    const Double nu_ij = 0.5 * (mu.i / density.i + mu.j / density.j);
+    const Double nu_tilde_ij = 0.5 * (U.i(0) + U.j(0));
+
+    /*--- With SA-neg, fn becomes 1 for positive values of the working variable. ---*/
+    Double fn = 1.0;
+    if (negative) {
+      const Double Xi3 = pow(fmin(nu_tilde_ij / nu_ij, 0.0), 3);
+      fn = (cn1 + Xi3) / (cn1 - Xi3);
+    }
+    const Double nu_e = nu_ij + fn * nu_tilde_ij;
+
+    flux(0) -= nu_e * projGrad(0) / sigma;
+
+    /*--- Use TSL approx. to compute derivatives of the gradients. ---*/
+    if (implicit) {
+      diagonal(jac_i, 0) -= (0.5 * projGrad(0) - nu_e * proj_vector_ij) / sigma;
+      diagonal(jac_j, 0) -= (0.5 * projGrad(0) + nu_e * proj_vector_ij) / sigma;
+    }
+  }
+};
+
+/*!
+ * \class CSSTViscousFlux
+ * \ingroup ViscDiscr
+ * \brief Diffusion of k and omega in the Menter SST model.
+ */
+template<size_t NDIM>
+class CSSTViscousFlux : public CScalarViscousFluxBase<NDIM, 2, CSSTViscousFlux<NDIM> > {
+protected:
+  using Base = CScalarViscousFluxBase<NDIM, 2, CSSTViscousFlux<NDIM> >;
+  using Base::idxLamVisc;
+  using Base::idxEddyVisc;
+  using Base::gatherPrimitive;
+  friend Base;
+
+  static constexpr bool conservative = true;
+
+  const su2double sigma_k1;
+  const su2double sigma_k2;
+  const su2double sigma_om1;
+  const su2double sigma_om2;
+
+  /*!
+   * \brief Constructor, store the model constants and forward args to base.
+   */
+  template<class... Ts>
+  CSSTViscousFlux(const CConfig& config, const CVariable* flowVars, const su2double* constants, Ts&... args) :
+    Base(config, flowVars, args...),
+    sigma_k1(constants[0]),
+    sigma_k2(constants[1]),
+    sigma_om1(constants[2]),
+    sigma_om2(constants[3]) {
+  }
+
+  /*!
+   * \brief SST specific terms, see CAvgGrad_TurbSST.
+   */
+  template<size_t nVar>
+  FORCEINLINE void finalizeFlux(Int iPoint,
+                                Int jPoint,
+                                const CPair<Double>& density,
+                                const CPair<VectorDbl<nVar> >&,
+                                const CVariable& solution,
+                                const VectorDbl<nVar>& projGrad,
+                                Double proj_vector_ij,
+                                bool implicit,
+                                VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j) const {
+
+    const auto& F1 = static_cast<const CTurbSSTVariable&>(solution).GetF1blending();
+    const Double F1_i = gatherVariables(iPoint, F1);
+    const Double F1_j = gatherVariables(jPoint, F1);
+
+    const auto mu = gatherPrimitive(iPoint, jPoint, idxLamVisc);
+    const auto mut = gatherPrimitive(iPoint, jPoint, idxEddyVisc);
+
+    /*--- Blended constants and mean effective dynamic viscosities. ---*/
+    VectorDbl<nVar> diff;
+    const su2double sigma_1[] = {sigma_k1, sigma_om1};
+    const su2double sigma_2[] = {sigma_k2, sigma_om2};
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      const Double sigma_i = F1_i * sigma_1[iVar] + (1.0 - F1_i) * sigma_2[iVar];
+      const Double sigma_j = F1_j * sigma_1[iVar] + (1.0 - F1_j) * sigma_2[iVar];
+      diff(iVar) = 0.5 * (mu.i + sigma_i * mut.i + mu.j + sigma_j * mut.j);
+      flux(iVar) -= diff(iVar) * projGrad(iVar);
+    }
+
+    /*--- Use TSL approx. to compute derivatives of the gradients. ---*/
+    if (implicit) {
+      const Double proj_on_rho_i = proj_vector_ij / density.i;
+      const Double proj_on_rho_j = proj_vector_ij / density.j;
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        diagonal(jac_i, iVar) += diff(iVar) * proj_on_rho_i;
+        diagonal(jac_j, iVar) -= diff(iVar) * proj_on_rho_j;
+      }
+    }
+  }
+};
+
+/*!
+ * \class CSpeciesViscousFlux
+ * \ingroup ViscDiscr
+ * \brief Mass diffusion of species (also used by the flamelet model).
+ */
+template<size_t NDIM, size_t NVAR>
+class CSpeciesViscousFlux : public CScalarViscousFluxBase<NDIM, NVAR, CSpeciesViscousFlux<NDIM,NVAR> > {
+protected:
+  using Base = CScalarViscousFluxBase<NDIM, NVAR, CSpeciesViscousFlux<NDIM,NVAR> >;
+  using Base::idxEddyVisc;
+  using Base::gatherPrimitive;
+  friend Base;
+
+  static constexpr bool conservative = true;
+
+  const bool turbulence;
+  const su2double schmidtTurb;
+
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CSpeciesViscousFlux(const CConfig& config, const CVariable* flowVars, Ts&... args) :
+    Base(config, flowVars, args...),
+    turbulence(config.GetKind_Turb_Model() != TURB_MODEL::NONE),
+    schmidtTurb(config.GetSchmidt_Number_Turbulent()) {
+  }
+
+  /*!
+   * \brief Species specific terms, see CAvgGrad_Species.
+   */
+  template<size_t nVar>
+  FORCEINLINE void finalizeFlux(Int iPoint,
+                                Int jPoint,
+                                const CPair<Double>& density,
+                                const CPair<VectorDbl<nVar> >&,
+                                const CVariable& solution,
+                                const VectorDbl<nVar>& projGrad,
+                                Double proj_vector_ij,
+                                bool implicit,
+                                VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j) const {
+
+    const auto& diffusivity = static_cast<const CSpeciesVariable&>(solution).GetDiffusivity();
+    const auto D_i = gatherVariables<nVar>(iPoint, diffusivity);
+    const auto D_j = gatherVariables<nVar>(jPoint, diffusivity);
+
+    Double diffTurb = 0.0;
+    if (turbulence) {
+      const auto mut = gatherPrimitive(iPoint, jPoint, idxEddyVisc);
+      diffTurb = 0.5 * (mut.i + mut.j) / schmidtTurb;
+    }
+
+    const Double proj_on_rho_i = proj_vector_ij / density.i;
+    const Double proj_on_rho_j = proj_vector_ij / density.j;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      const Double diff = 0.5 * (density.i * D_i(iVar) + density.j * D_j(iVar)) + diffTurb;
+
+      flux(iVar) -= diff * projGrad(iVar);
+
+      /*--- Use TSL approx. to compute derivatives of the gradients. ---*/
+      if (implicit) {
+        diagonal(jac_i, iVar) += diff * proj_on_rho_i;
+        diagonal(jac_j, iVar) -= diff * proj_on_rho_j;
+      }
+    }
+  }
+};
@@ -0,0 +1,348 @@
+/*!
+ * \file turb_sources.hpp
+ * \brief Vectorized point source terms of the turbulence models.
+ * \author P. Gomes, F. Palacios, T. Economon, A. Bueno
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../../../variables/CFlowVariable.hpp"
+#include "../../../variables/CTurbSSTVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \brief Common part of the turbulence sources, gathers the geometric data of the points
+ * and updates the linear system. The derived classes (static polymorphism) implement the
+ * model in a const "sources" method.
+ */
+template<size_t NDIM, size_t NVAR, class Derived>
+class CTurbSourceBase : public CSourceSIMD {
+protected:
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nVar = NVAR;
+
+  const size_t idxLamVisc;
+  const size_t idxEddyVisc;
+
+  const CFlowVariable* flowVars;
+
+  /*!
+   * \brief Constructor, initialize the indices of the flow primitives (see CScalarViscousFluxBase).
+   */
+  CTurbSourceBase(const CConfig& config, const CFlowVariable* flowVars_) :
+    idxLamVisc(nDim + ((config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE)? 4 : 5)),
+    idxEddyVisc(idxLamVisc + 1),
+    flowVars(flowVars_) {
+  }
+
+public:
+  /*!
+   * \brief Implementation of the point source, the residual and Jacobian are zero near walls.
+   */
+  void ComputeSource(Int iPoint,
+                     const CConfig& config,
+                     const CGeometry& geometry,
+                     const CVariable& solution,
+                     Double updateMask,
+                     CSysVector<su2double>& vector,
+                     SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+    const Double volume = gatherVariables(iPoint, geometry.nodes->GetVolume());
+    const Double wallDist = gatherVariables(iPoint, geometry.nodes->GetWall_Distance());
+
+    VectorDbl<nVar> residual;
+    MatrixDbl<nVar> jacobian;
+
+    const Double dist = static_cast<const Derived*>(this)->sources(
+                          iPoint, geometry, solution, wallDist, residual, jacobian);
+
+    /*--- Like the scalar numerics, no source is computed when the distance is 0. ---*/
+
+    const Double valid = dist > 1e-10;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      residual(iVar) = blend(valid, residual(iVar) * volume, Double(0.0));
+    }
+
+    stopPreacc(residual);
+
+    /*--- Subtract from the residual and from the diagonal of the Jacobian. ---*/
+
+    const Double negMask = -updateMask;
+    vector.AddBlock(iPoint, residual, negMask);
+
+    if (implicit) {
+      for (size_t i = 0; i < nVar*nVar; ++i) {
+        jacobian.data()[i] = blend(valid, jacobian.data()[i] * volume, Double(0.0));
+      }
+      auto wasActive = AD::BeginPassive();
+      matrix.AddBlock2Diag(iPoint, jacobian, negMask);
+      AD::EndPassive(wasActive);
+    }
+  }
+};
+
+/*!
+ * \class CSASource
+ * \ingroup SourceDiscr
+ * \brief Source terms of the Spalart-Allmaras model (baseline and negative versions, with
+ * or without ft2, rotation correction, and wall roughness), see CSourceBase_TurbSA.
+ */
+template<size_t NDIM>
+class CSASource final : public CTurbSourceBase<NDIM, 1, CSASource<NDIM> > {
+private:
+  using Base = CTurbSourceBase<NDIM, 1, CSASource<NDIM> >;
+  friend Base;
+  using Base::nDim;
+  using Base::idxLamVisc;
+  using Base::flowVars;
+
+  const bool negative, useFt2, rotation;
+
+  /*!
+   * \brief Production minus destruction plus cross-production, and the derivative w.r.t. nu tilde,
+   * per unit volume. Returns the (modified for roughness) wall distance.
+   */
+  FORCEINLINE Double sources(Int iPoint,
+                             const CGeometry& geometry,
+                             const CVariable& solution,
+                             Double wallDist,
+                             VectorDbl<1>& residual,
+                             MatrixDbl<1>& jacobian) const {
+    /*--- Constants of the model, see CSAVariables. ---*/
+    const su2double cv1_3 = pow(7.1, 3), k2 = pow(0.41, 2), cb1 = 0.1355, cw2 = 0.3, ct3 = 1.2, ct4 = 0.5;
+    const su2double cw3_6 = pow(2, 6), sigma = 2.0 / 3.0, cb2 = 0.622, cr1 = 0.5, CRot = 1.0;
+    const su2double cb2_sigma = cb2 / sigma, cw1 = cb1 / k2 + (1 + cb2) / sigma, cb1_k2 = cb1 / k2;
+    const su2double c2 = 0.7, c3 = 0.9;
+
+    const Double density = gatherVariable(iPoint, nDim+2, flowVars->GetPrimitive());
+    const Double nu = gatherVariable(iPoint, idxLamVisc, flowVars->GetPrimitive()) / density;
+    const Double nue = gatherVariables(iPoint, solution.GetSolution());
+    const auto gradNue = gatherVariables<1,nDim>(iPoint, solution.GetGradient());
+
+    /*--- Wall roughness increases the distance, see CTurbSASolver::Source_Residual. ---*/
+    const Double roughness = gatherVariables(iPoint, geometry.nodes->GetRoughnessHeight());
+    const Double dist = wallDist + 0.03 * roughness;
+
+    /*--- Vorticity magnitude with the Dacles-Mariani rotation correction. ---*/
+    Double Omega = norm(gatherVariables<3>(iPoint, flowVars->GetVorticity()));
+    if (rotation) {
+      Omega += CRot * fmin(0.0, gatherVariables(iPoint, flowVars->GetStrainMag()) - Omega);
+      /*--- Do not allow negative production for SA-neg. ---*/
+      Omega = blend(nue < 0.0, abs(Omega), Omega);
+    }
+
+    /*--- Lanes with 0 distance are discarded by the caller, avoid dividing by 0. ---*/
+    const Double dist_2 = fmax(dist * dist, 1e-20);
+    const Double inv_k2_d2 = 1.0 / (k2 * dist_2);
+
+    const Double Ji = nue / nu + cr1 * (roughness / (dist + EPS));
+    const Double d_Ji = 1.0 / nu;
+    const Double Ji_2 = Ji * Ji;
+    const Double Ji_3 = Ji_2 * Ji;
+
+    const Double fv1 = Ji_3 / (Ji_3 + cv1_3);
+    const Double d_fv1 = 3 * Ji_2 * cv1_3 / (nu * (Ji_3 + cv1_3) * (Ji_3 + cv1_3));
+    const Double fv2 = 1 - nue / (nu + nue * fv1);
+    const Double d_fv2 = -(1 / nu - Ji_2 * d_fv1) / ((1 + Ji * fv1) * (1 + Ji * fv1));
+
+    Double ft2 = 0.0, d_ft2 = 0.0;
+    if (useFt2) {
+      ft2 = ct3 * exp(-ct4 * Ji_2);
+      d_ft2 = -2.0 * ct4 * Ji * ft2 * d_Ji;
+    }
+
+    /*--- Modified vorticity, limited according to note 1(c) of the NASA TMR. ---*/
+    const Double Sbar = nue * fv2 * inv_k2_d2;
+    const Double Den = (c3 - 2 * c2) * Omega - Sbar;
+    Double Shat = Omega + blend(Sbar >= -c2 * Omega, Sbar, Omega * (c2 * c2 * Omega + c3 * Sbar) / Den);
+    Double d_Shat = blend(Shat > 1e-10, (fv2 + nue * d_fv2) * inv_k2_d2, Double(0.0));
+    Shat = fmax(Shat, 1e-10);
+    if (negative) {
+      const Double positive = nue > 0.0;
+      Shat = blend(positive, Shat, Double(1e-10));
+      d_Shat = blend(positive, d_Shat, Double(0.0));
+    }
+    const Double inv_Shat = 1.0 / Shat;
+
+    const Double r = fmin(nue * inv_Shat * inv_k2_d2, 10.0);
+    const Double d_r = blend(r < 10.0, (Shat - nue * d_Shat) * inv_Shat * inv_Shat * inv_k2_d2, Double(0.0));
+    const Double r_5 = r * r * r * r * r;
+
+    const Double g = r + cw2 * (r_5 * r - r);
+    const Double g_6 = pow(g, 6);
+    const Double glim = pow((1 + cw3_6) / (g_6 + cw3_6), 1.0 / 6.0);
+    const Double fw = g * glim;
+    const Double d_g = d_r * (1 + cw2 * (6 * r_5 - 1));
+    const Double d_fw = d_g * glim * (1 - g_6 / (g_6 + cw3_6));
+
+    /*--- Production, destruction, and their derivatives. ---*/
+    Double production = cb1 * (1.0 - ft2) * Shat * nue;
+    Double jac = cb1 * (-Shat * nue * d_ft2 + (1.0 - ft2) * (nue * d_Shat + Shat));
+
+    const Double factor = cw1 * fw - cb1_k2 * ft2;
+    Double destruction = factor * nue * nue / dist_2;
+    jac -= ((cw1 * d_fw - cb1_k2 * d_ft2) * nue * nue + factor * 2 * nue) / dist_2;
+
+    if (negative) {
+      const Double positive = nue > 0.0;
+      const Double dP_dnu = cb1 * (1.0 - ct3) * Omega;
+      const Double dD_dnu = -cw1 * nue / dist_2;
+      production = blend(positive, production, dP_dnu * nue);
+      destruction = blend(positive, destruction, dD_dnu * nue);
+      jac = blend(positive, jac, dP_dnu - 2 * dD_dnu);
+    }
+
+    const Double crossProduction = cb2_sigma * squaredNorm<nDim>(gradNue.data());
+
+    residual(0) = production - destruction + crossProduction;
+    diagonal(jacobian, 0) = jac;
+
+    return dist;
+  }
+
+public:
+  /*!
+   * \brief Constructor.
+   * \param[in] config - Problem definitions.
+   * \param[in] flowVars - Flow variables.
+   */
+  CSASource(const CConfig& config, const CFlowVariable* flowVars_) : Base(config, flowVars_),
+    negative(config.GetSAParsedOptions().version == SA_OPTIONS::NEG),
+    useFt2(config.GetSAParsedOptions().ft2),
+    rotation(config.GetSAParsedOptions().rot) {
+  }
+};
+
+/*!
+ * \class CSSTSource
+ * \ingroup SourceDiscr
+ * \brief Source terms of the Menter SST model (1994 and 2003 versions, with the V and KL
+ * production modifications, and sustaining terms), see CSourcePieceWise_TurbSST.
+ */
+template<size_t NDIM>
+class CSSTSource final : public CTurbSourceBase<NDIM, 2, CSSTSource<NDIM> > {
+private:
+  using Base = CTurbSourceBase<NDIM, 2, CSSTSource<NDIM> >;
+  friend Base;
+  using Base::idxEddyVisc;
+  using Base::flowVars;
+
+  const SST_OPTIONS version, production;
+  const bool sustaining;
+  const su2double beta_1, beta_2, beta_star, alfa_1, alfa_2, prod_lim_const;
+  const su2double kAmb, omegaAmb;
+
+  /*!
+   * \brief Production minus dissipation plus cross-diffusion, and the Jacobian, per unit volume.
+   */
+  FORCEINLINE Double sources(Int iPoint,
+                             const CGeometry&,
+                             const CVariable& solution,
+                             Double wallDist,
+                             VectorDbl<2>& residual,
+                             MatrixDbl<2>& jacobian) const {
+
+    const auto& sstVars = static_cast<const CTurbSSTVariable&>(solution);
+
+    const Double density = gatherVariable(iPoint, NDIM+2, flowVars->GetPrimitive());
+    const Double eddyVisc = gatherVariable(iPoint, idxEddyVisc, flowVars->GetPrimitive());
+    const auto turbVars = gatherVariables<2>(iPoint, solution.GetSolution());
+    const Double& k = turbVars(0);
+    const Double& w = turbVars(1);
+    const Double F1 = gatherVariables(iPoint, sstVars.GetF1blending());
+    const Double CDkw = gatherVariables(iPoint, sstVars.GetCrossDiff());
+
+    const Double alfa_blended = F1 * alfa_1 + (1.0 - F1) * alfa_2;
+    const Double beta_blended = F1 * beta_1 + (1.0 - F1) * beta_2;
+
+    /*--- Base production term. ---*/
+    Double P_Base = gatherVariables(iPoint, flowVars->GetStrainMag());
+    if (production == SST_OPTIONS::V || production == SST_OPTIONS::KL) {
+      const Double vorticityMag = norm(gatherVariables<3>(iPoint, flowVars->GetVorticity()));
+      P_Base = (production == SST_OPTIONS::V) ? vorticityMag : Double(sqrt(P_Base * vorticityMag));
+    }
+
+    /*--- Production limiter, only for V2003 in the omega equation. ---*/
+    const Double prod_limit = prod_lim_const * beta_star * density * w * k;
+    Double pk = fmax(0.0, fmin(eddyVisc * P_Base * P_Base, prod_limit));
+    Double pw;
+    if (version == SST_OPTIONS::V1994) {
+      pw = alfa_blended * density * P_Base * P_Base;
+    } else {
+      pw = (alfa_blended * density / eddyVisc) * pk;
+    }
+
+    if (sustaining) {
+      pk = fmax(pk, beta_star * density * kAmb * omegaAmb);
+      pw = fmax(pw, beta_blended * density * omegaAmb * omegaAmb);
+    }
+
+    /*--- Dissipation. ---*/
+    const Double dk = beta_star * density * w * k;
+    const Double dw = beta_blended * density * w * w;
+
+    residual(0) = pk - dk;
+    residual(1) = pw - dw + (1.0 - F1) * CDkw;
+
+    jacobian(0,0) = -beta_star * w;
+    jacobian(0,1) = -beta_star * k;
+    jacobian(1,0) = 0.0;
+    jacobian(1,1) = -2.0 * beta_blended * w;
+
+    return wallDist;
+  }
+
+public:
+  /*!
+   * \brief Constructor.
+   * \param[in] config - Problem definitions.
+   * \param[in] flowVars - Flow variables.
+   * \param[in] constants - SST model constants.
+   * \param[in] kine_Inf - Freestream k, for SST with sustaining terms.
+   * \param[in] omega_Inf - Freestream w, for SST with sustaining terms.
+   */
+  CSSTSource(const CConfig& config, const CFlowVariable* flowVars_, const su2double* constants,
+             su2double kine_Inf, su2double omega_Inf) : Base(config, flowVars_),
+    version(config.GetSSTParsedOptions().version),
+    production(config.GetSSTParsedOptions().production),
+    sustaining(config.GetSSTParsedOptions().sust),
+    beta_1(constants[4]),
+    beta_2(constants[5]),
+    beta_star(constants[6]),
+    alfa_1(constants[8]),
+    alfa_2(constants[9]),
+    prod_lim_const(constants[10]),
+    kAmb(kine_Inf),
+    omegaAmb(omega_Inf) {
+  }
+};
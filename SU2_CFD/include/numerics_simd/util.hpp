@@ -127,12 +127,29 @@ FORCEINLINE VectorDbl<nDim> tangentProjection(const MatrixDbl<nDim>& tensor,
   return proj;
 }
 
+/*!
+ * \brief Diagonal entry of a square matrix.
+ * \note Static containers with one row are vectors, which do not have (i,j) access.
+ */
+template<size_t N>
+FORCEINLINE Double& diagonal(MatrixDbl<N>& mat, size_t i) { return mat.data()[i*(N+1)]; }
+
 /*!
  * \brief Vector norm.
  */
 template<size_t nDim>
 FORCEINLINE Double norm(const VectorDbl<nDim>& vector) { return sqrt(squaredNorm(vector)); }
 
+/*!
+ * \brief Lane-wise selection, a where the mask is not 0 and b elsewhere.
+ * \note Unlike mask*a + (1-mask)*b, this is safe when the discarded values are not finite.
+ */
+FORCEINLINE Double blend(Double mask, const Double& a, const Double& b) {
+  Double x;
+  for (size_t k=0; k<Double::Size; ++k) x[k] = (mask[k] != 0) ? a[k] : b[k];
+  return x;
+}
+
 #ifndef CODI_REVERSE_TYPE
 /*!
  * \brief Gather a single variable from index iPoint of a 1D container.
@@ -157,6 +174,14 @@ template<size_t nRows, size_t nCols, class Container>
 FORCEINLINE MatrixDbl<nRows,nCols> gatherVariables(Int iPoint, const Container& vars) {
   return vars.template get<MatrixDbl<nRows,nCols> >(iPoint);
 }
+
+/*!
+ * \brief Gather variable iVar from row iPoint of a 2D container.
+ */
+template<class Container>
+FORCEINLINE Double gatherVariable(Int iPoint, size_t iVar, const Container& vars) {
+  return vars.template get<VectorDbl<1> >(iPoint, iVar)(0);
+}
 #else
 
 namespace {
@@ -203,6 +228,16 @@ FORCEINLINE MatrixDbl<nRows,nCols> gatherVariables(Int iPoint, const Container&
   }
   return x;
 }
+
+template<class Container>
+FORCEINLINE Double gatherVariable(Int iPoint, size_t iVar, const Container& vars) {
+  Double x;
+  for (size_t k=0; k<Double::Size; ++k) {
+    AD::SetPreaccIn(vars(iPoint[k],iVar));
+    x[k] = vars(iPoint[k],iVar);
+  }
+  return x;
+}
 #endif
 
 /*!
@@ -42,23 +42,17 @@ class CFVMOutput : public COutput{
   void AddCoordinates();
 
   /*!
-   * \brief Load the coordinates.
+   * \brief Add common FVM outputs.
    */
-  template<class T>
-  inline void LoadCoordinates(const T& Coord, const unsigned long iPoint) {
-    SetVolumeOutputValue("COORD-X", iPoint, Coord[0]);
-    SetVolumeOutputValue("COORD-Y", iPoint, Coord[1]);
-    if (nDim == 3)
-      SetVolumeOutputValue("COORD-Z", iPoint, Coord[2]);
-  }
+  void AddCommonFVMOutputs(const CConfig* config);
 
   /*!
-   * \brief Add common FVM outputs.
+   * \brief Register the bulk loaders of the coordinates.
    */
-  void AddCommonFVMOutputs(const CConfig* config);
+  void SetCoordinateLoaders(const CGeometry* geometry);
 
   /*!
-   * \brief Load common FVM outputs.
+   * \brief Register the bulk loaders of the common FVM outputs.
    */
-  void LoadCommonFVMOutputs(const CConfig* config, const CGeometry* geometry, unsigned long iPoint);
+  void SetCommonFVMLoaders(const CConfig* config, const CGeometry* geometry);
 };
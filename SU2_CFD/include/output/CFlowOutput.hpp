@@ -161,14 +161,12 @@ protected:
   void SetVolumeOutputFieldsScalarMisc(const CConfig* config);
 
   /*!
-   * \brief Set all scalar (turbulence/species) volume field values for a point.
+   * \brief Register the bulk loaders of all scalar (turbulence/species) volume fields.
    * \param[in] config - Definition of the particular problem.
    * \param[in] solver - The container holding all solution data.
    * \param[in] geometry - Geometrical definition of the problem.
-   * \param[in] iPoint - Index of the point.
    */
-  void LoadVolumeDataScalar(const CConfig* config, const CSolver* const* solver, const CGeometry* geometry,
-                             const unsigned long iPoint);
+  void SetVolumeFieldLoadersScalar(const CConfig* config, const CSolver* const* solver, const CGeometry* geometry);
 
   /*!
    * \brief Add aerodynamic coefficients as output fields
@@ -341,11 +339,10 @@ protected:
   void SetTimeAveragedFields();
 
   /*!
-   * \brief Load the time averaged output fields.
-   * \param iPoint
-   * \param node_flow
+   * \brief Register the bulk loaders of the time averaged output fields.
+   * \param[in] node_flow - Flow variables.
    */
-  void LoadTimeAveragedData(unsigned long iPoint, const CVariable *node_flow);
+  void SetTimeAveragedLoaders(const CVariable *node_flow);
 
   /*!
    * \brief Write additional output for fixed CL mode.
@@ -63,13 +63,13 @@ public:
   void SetVolumeOutputFields(CConfig *config) override;
 
   /*!
-   * \brief Set the values of the volume output fields for a point.
+   * \brief Register the bulk loaders of the volume output fields.
    * \param[in] config - Definition of the particular problem.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] solver - The container holding all solution data.
-   * \param[in] iPoint - Index of the point.
+   * \return <TRUE> since all fields have bulk loaders.
    */
-  void LoadVolumeData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint) override;
+  bool SetVolumeFieldLoaders(CConfig *config, CGeometry *geometry, CSolver **solver) override;
 
   /*!
    * \brief LoadSurfaceData
@@ -29,6 +29,7 @@
 
 #include <fstream>
 #include <cmath>
+#include <functional>
 #include <map>
 #include <sstream>
 #include <iomanip>
@@ -54,6 +55,7 @@ class CGeometry;
 class CSolver;
 class CFileWriter;
 class CParallelDataSorter;
+class CAsyncFileWriter;
 class CConfig;
 
 using namespace std;
@@ -244,6 +246,9 @@ protected:
   CParallelDataSorter* volumeDataSorter;    //!< Volume data sorter
   CParallelDataSorter* surfaceDataSorter;   //!< Surface data sorter
 
+  CAsyncFileWriter* asyncWriter = nullptr;  //!< Writes the supported files in the background, created on first use
+  bool asyncOutput;                         //!< Whether the output can be asynchronous (ASYNC_OUTPUT and MPI support)
+
   vector<string> volumeFieldNames;     //!< Vector containing the volume field names
   unsigned short nVolumeFields;        //!< Number of fields in the volume output
 
@@ -288,6 +293,11 @@ protected:
   /*! \brief Current value of the cache index */
   unsigned short                                curGetFieldIndex;
 
+  /*! \brief Function returning the value of a volume output field at a point. */
+  using VolumeFieldLoader = std::function<su2double(unsigned long)>;
+  /*! \brief Bulk loaders of the requested volume fields, paired with their offset in the data sorter. */
+  std::vector<std::pair<unsigned short, VolumeFieldLoader> > volumeFieldLoaders;
+
   /*! \brief Requested volume field names in the config file. */
   std::vector<string> requestedVolumeFields;
   /*! \brief Number of requested volume field names in the config file. */
@@ -530,6 +540,13 @@ public:
     return historyOutputPerSurface_Map;
   }
 
+  /*!
+   * \brief Copy the values of the history fields (and per-surface fields) of one rank to all the others.
+   * \note Used when the zone is solved by a subset of the ranks, collective call on the current communicator.
+   * \param[in] root - Rank that holds the values.
+   */
+  void BroadcastHistoryOutput(int root);
+
   /*!
    * \brief Monitor the convergence of an output field
    * \param[in] config - Definition of the particular problem.
@@ -603,10 +620,24 @@ public:
    */
   void WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE format, string fileName = "");
 
+  /*!
+   * \brief Wait for the files that are written in the background and account for their bandwidth.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void FinishAsyncOutput(CConfig *config);
+
 protected:
 
   /*----------------------------- Protected member functions ----------------------------*/
 
+  /*!
+   * \brief Account for the bandwidth of the files written in the background, as for synchronous output.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] wait - Wait for the pending files, otherwise only the completed ones are reported in the
+   *                   file writing table.
+   */
+  void ReportAsyncOutput(CConfig *config, bool wait);
+
   /*!
    * \brief Set the history file header
    * \param[in] config - Definition of the particular problem.
@@ -756,6 +787,14 @@ protected:
    */
   void SetVolumeOutputValue(const string& name, unsigned long iPoint, su2double value);
 
+  /*!
+   * \brief Register the bulk loader of a volume output field, the loader is ignored if the field is not requested.
+   * \note The loader is called concurrently for different points, it must only read data.
+   * \param[in] name - Name of the field.
+   * \param[in] loader - Function that returns the value of the field at a point.
+   */
+  void SetVolumeFieldLoader(const string& name, VolumeFieldLoader loader);
+
   /*!
    * \brief Set the value of a volume output field
    * \param[in] name - Name of the field.
@@ -764,6 +803,29 @@ protected:
    */
   void SetAvgVolumeOutputValue(const string& name, unsigned long iPoint, su2double value);
 
+  /*!
+   * \brief Register the bulk loader of a time-averaged volume output field (see ::SetAvgVolumeOutputValue).
+   * \param[in] name - Name of the field.
+   * \param[in] loader - Function that returns the instantaneous value of the field at a point.
+   */
+  void SetAvgVolumeFieldLoader(const string& name, VolumeFieldLoader loader);
+
+  /*!
+   * \brief Get a function that returns the value of a volume output field already loaded at a point.
+   * \note The loaders are called in the order they are registered, the field must be requested and its loader
+   *       registered first, otherwise this is an error.
+   * \param[in] name - Name of the field.
+   * \return Function that returns the value of the field at a point.
+   */
+  VolumeFieldLoader GetVolumeFieldValue(const string& name) const;
+
+  /*!
+   * \brief Check if a volume output field is requested, i.e. if its loader would be used.
+   * \param[in] name - Name of the field.
+   * \return <TRUE> if the field exists and is requested.
+   */
+  bool IsVolumeFieldRequested(const string& name) const;
+
   /*!
    * \brief CheckHistoryOutput
    */
@@ -905,6 +967,17 @@ protected:
    */
   inline virtual void LoadVolumeData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint){}
 
+  /*!
+   * \brief Register the bulk loaders of the volume output fields (see ::SetVolumeFieldLoader).
+   * \details Classes that override this method load the volume data with multiple threads, field by field,
+   * without string look-ups in the point loop, and ::LoadVolumeData is not called for them.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - The container holding all solution data.
+   * \return <TRUE> if the loaders were registered.
+   */
+  inline virtual bool SetVolumeFieldLoaders(CConfig *config, CGeometry *geometry, CSolver **solver){ return false; }
+
   /*!
    * \brief Set the values of the volume output fields for a point.
    * \param[in] config - Definition of the particular problem.
@@ -0,0 +1,135 @@
+/*!
+ * \file CAsyncFileWriter.hpp
+ * \brief Headers of the class that writes output files in a background thread.
+ * \author P. Gomes
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CFileWriter.hpp"
+
+/*!
+ * \class CAsyncFileWriter
+ * \brief Writes output files in a background thread while the solver continues.
+ * \details The data of each submitted writer is copied (see CDataSorterSnapshot), the writer is then
+ *          executed by a worker thread, using a duplicate of the communicator for its (collective) MPI-IO
+ *          operations. At most MAX_PENDING files are in flight, if the file system is slower than the solver,
+ *          Submit blocks until the oldest file is written, i.e. the snapshots are double buffered.
+ *          Since all ranks submit the same files in the same order, the collective operations match.
+ *          The worker records the time and size of each file, the reports of the completed jobs are
+ *          collected by the owner (see TakeReports) to account for the bandwidth as in synchronous output.
+ * \note Only writers that perform all their communication through CFileWriter can be used, and the MPI
+ *       library must provide MPI_THREAD_MULTIPLE (see SU2_CFD --thread_multiple).
+ * \author P. Gomes
+ */
+class CAsyncFileWriter {
+ public:
+  /*!
+   * \brief Format, files, and performance of a completed job.
+   */
+  struct CReport {
+    OUTPUT_TYPE format;
+    std::vector<std::string> fileNames; /*!< \brief Names of the files (with extension). */
+    su2double usedTime = 0.0;           /*!< \brief Time to write all the files. */
+    su2double fileSize = 0.0;           /*!< \brief Size of all the files. */
+    su2double bandwidth = 0.0;          /*!< \brief Average bandwidth of the files (MB/s). */
+  };
+
+ private:
+  static constexpr size_t MAX_PENDING = 2; /*!< \brief Maximum number of queued and running jobs. */
+
+  /*!
+   * \brief A writer, the snapshot of its data, and the files to write.
+   */
+  struct CJob {
+    std::unique_ptr<CParallelDataSorter> snapshot;
+    std::unique_ptr<CFileWriter> writer;
+    std::vector<std::string> fileNames;
+    OUTPUT_TYPE format;
+  };
+
+  SU2_MPI::Comm comm;           /*!< \brief Communicator owned by the worker. */
+  std::mutex mtx;               /*!< \brief Protects the members below. */
+  std::condition_variable cond; /*!< \brief Signals new jobs, completed jobs, and termination. */
+  std::deque<CJob> jobs;        /*!< \brief Queued jobs, the front one is being written. */
+  std::vector<CReport> reports; /*!< \brief Reports of the completed jobs, not yet taken. */
+  bool stop = false;            /*!< \brief Request to terminate the worker. */
+  std::thread worker;           /*!< \brief The thread that writes the files. */
+
+  /*!
+   * \brief Main loop of the worker thread.
+   */
+  void Work();
+
+ public:
+  /*!
+   * \brief Duplicate the communicator and start the worker (collective call).
+   */
+  CAsyncFileWriter();
+
+  /*!
+   * \brief Write the pending files, stop the worker, and free the communicator (collective call).
+   */
+  ~CAsyncFileWriter();
+
+  CAsyncFileWriter(const CAsyncFileWriter&) = delete;
+  CAsyncFileWriter& operator=(const CAsyncFileWriter&) = delete;
+
+  /*!
+   * \brief Whether the build and the MPI thread support allow writing in the background.
+   * \note Reverse and forward AD builds always write synchronously.
+   */
+  static bool Supported();
+
+  /*!
+   * \brief Whether a format is written only via the MPI-IO helpers of CFileWriter.
+   * \param[in] format - Output format.
+   */
+  static bool SupportsFormat(OUTPUT_TYPE format);
+
+  /*!
+   * \brief Take ownership of a writer and write its data to one or more files in the background (collective call).
+   * \note Blocks while MAX_PENDING files are in flight. The data is copied, the sorter of the writer can be
+   *       modified as soon as this function returns.
+   * \param[in] writer - Writer of a supported format, allocated with new.
+   * \param[in] format - Output format of the writer.
+   * \param[in] fileNames - Names of the files (without extension).
+   */
+  void Submit(CFileWriter* writer, OUTPUT_TYPE format, std::vector<std::string> fileNames);
+
+  /*!
+   * \brief Take the reports of the jobs completed since the last call.
+   * \param[in] wait - Wait for the pending jobs to complete first.
+   */
+  std::vector<CReport> TakeReports(bool wait);
+};
@@ -0,0 +1,72 @@
+/*!
+ * \file CDataSorterSnapshot.hpp
+ * \brief Headers of the immutable copy of sorted output data.
+ * \author P. Gomes
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CParallelDataSorter.hpp"
+
+/*!
+ * \class CDataSorterSnapshot
+ * \brief Copy of the sorted data and connectivity of a data sorter, taken when the output is written in the
+ *        background. The partition information that derived sorters compute on the fly is evaluated once.
+ * \note Only the methods used by the file writers are meaningful, the data cannot be sorted again.
+ * \author P. Gomes
+ */
+class CDataSorterSnapshot final : public CParallelDataSorter {
+private:
+  vector<unsigned long> nodeBegin;      //!< First node of each rank, see GetNodeBegin
+  vector<unsigned long> pointCumulative; //!< Cumulative number of points, see GetnPointCumulative
+  vector<unsigned long> globalIndex;    //!< Global index of the local points, see GetGlobalIndex
+
+public:
+  /*!
+   * \brief Construct the snapshot of a sorter.
+   * \param[in] source - Sorter with sorted data (and connectivity).
+   */
+  explicit CDataSorterSnapshot(const CParallelDataSorter& source) :
+    CParallelDataSorter(source),
+    nodeBegin(size),
+    pointCumulative(size+1),
+    globalIndex(nPoints) {
+
+    for (int iRank = 0; iRank < size; iRank++) nodeBegin[iRank] = source.GetNodeBegin(iRank);
+    for (int iRank = 0; iRank <= size; iRank++) pointCumulative[iRank] = source.GetnPointCumulative(iRank);
+    for (unsigned long iPoint = 0; iPoint < nPoints; iPoint++) {
+      globalIndex[iPoint] = source.GetGlobalIndex(iPoint);
+    }
+  }
+
+  unsigned long GetNodeBegin(unsigned short rank) const override { return nodeBegin[rank]; }
+
+  unsigned long GetnPointCumulative(unsigned short rank) const override { return pointCumulative[rank]; }
+
+  unsigned long GetGlobalIndex(unsigned long iPoint) const override { return globalIndex[iPoint]; }
+
+  void SortOutputData() override {
+    SU2_MPI::Error("Snapshots of output data cannot be sorted.", CURRENT_FUNCTION);
+  }
+};
@@ -56,6 +56,8 @@ protected:
    */
   std::string fileExt;
 
+  static constexpr unsigned long COMPRESSED_CHUNK_ROWS = 4096; /*!< \brief Rows compressed together. */
+
   su2double startTime, /*!< \brief Start time for time measurement  */
             stopTime , /*!< \brief Stop time for time measurement  */
             usedTime , /*!< \brief Used time for time measurement  */
@@ -78,6 +80,11 @@ protected:
    */
   CParallelDataSorter* dataSorter;
 
+  /*!
+   * \brief Communicator used for the (collective) file operations.
+   */
+  SU2_MPI::Comm comm;
+
 #ifdef HAVE_MPI
   /*!
    * \brief The displacement that every process has in the current file view
@@ -121,6 +128,11 @@ public:
    */
   virtual void WriteData(string val_filename){}
 
+  /*!
+   * \brief Get the extension attached to the file names.
+   */
+  const std::string& GetFileExtension() const {return fileExt;}
+
   /*!
    * \brief Get the bandwith used for the last writing
    */
@@ -137,6 +149,23 @@ public:
    */
   su2double GetUsedTime() const {return usedTime;}
 
+  /*!
+   * \brief Get the data sorter that provides the data to write.
+   */
+  CParallelDataSorter* GetDataSorter() const {return dataSorter;}
+
+  /*!
+   * \brief Replace the data sorter, e.g. by a snapshot of its data.
+   * \param[in] valDataSorter - The parallel sorted data to write.
+   */
+  void SetDataSorter(CParallelDataSorter* valDataSorter) {dataSorter = valDataSorter;}
+
+  /*!
+   * \brief Set the communicator used for the file operations, e.g. a duplicate owned by a writer thread.
+   * \param[in] valComm - The communicator.
+   */
+  void SetComm(SU2_MPI::Comm valComm) {comm = valComm;}
+
 protected:
 
   /*!
@@ -159,6 +188,21 @@ protected:
    */
   bool WriteMPIBinaryData(const void *data, unsigned long sizeInBytes, unsigned short processor);
 
+  /*!
+   * \brief Collectively write a row-major matrix, distributed over all processors by blocks of rows, compressed
+   * without loss (see CompressionToolbox::Compress). Each processor compresses its rows in chunks of at most
+   * COMPRESSED_CHUNK_ROWS. The layout in the file is the number of chunks, a table with the first row, the number of
+   * rows, and the compressed size of each chunk (all uint64_t), followed by the compressed chunks.
+   * \param[in] data - Pointer to the local rows.
+   * \param[in] nRows - Number of local rows.
+   * \param[in] nCols - Number of columns.
+   * \param[in] itemSize - Size of each entry in bytes.
+   * \param[in] firstRow - Global index of the first local row.
+   * \return Boolean indicating whether the writing was successful.
+   */
+  bool WriteMPICompressedDataAll(const void *data, unsigned long nRows, unsigned long nCols,
+                                 unsigned short itemSize, unsigned long firstRow);
+
   /*!
    * \brief Write a string to a currently opened file using MPI I/O. Note: routine must be called collectively,
    *  although only one processor writes the string.
@@ -120,6 +120,13 @@ protected:
    */
   void PrepareSendBuffers(std::vector<unsigned long>& globalID);
 
+  /*!
+   * \brief Deep copy of the sorted data and connectivity (not of the communication buffers),
+   *        used to take snapshots of the output that are written while the solver continues.
+   * \param[in] other - Sorter to copy.
+   */
+  CParallelDataSorter(const CParallelDataSorter& other);
+
 public:
 
   /*!
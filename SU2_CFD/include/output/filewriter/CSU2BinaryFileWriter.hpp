@@ -30,6 +30,7 @@
 
 class CSU2BinaryFileWriter final: public CFileWriter{
 
+  const bool compress; /*!< \brief Write the data compressed without loss. */
 
 public:
 
@@ -41,8 +42,9 @@ public:
   /*!
    * \brief Construct a file writer using field names and the data sorter.
    * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valCompress - Compress the data without loss (the file is still read bit-exact).
    */
-  CSU2BinaryFileWriter(CParallelDataSorter* valDataSorter);
+  CSU2BinaryFileWriter(CParallelDataSorter* valDataSorter, bool valCompress = false);
 
   /*!
    * \brief Destructor
@@ -32,6 +32,22 @@ class CSU2MeshFileWriter final: public CFileWriter{
 private:
   unsigned short iZone, //!< Index of the current zone
   nZone;                //!< Number of zones
+  const bool binary;    //!< Write the binary format instead of ASCII
+
+  /*!
+   * \brief Read the boundary information written by SU2_DEF (only on the master rank).
+   * \param[out] markerTags - The names of the markers.
+   * \param[out] markerSendTo - The SEND_TO values of the markers.
+   * \param[out] markerElems - For each marker, records of the VTK type followed by 4 values (nodes).
+   */
+  void ReadBoundaryFile(vector<string>& markerTags, vector<int>& markerSendTo,
+                        vector<vector<unsigned long> >& markerElems) const;
+
+  /*!
+   * \brief Write sorted data to file in the SU2 binary mesh file format
+   * \param[in] val_filename - The name of the file
+   */
+  void WriteBinaryData(string val_filename);
 
 public:
 
@@ -40,14 +56,20 @@ public:
    */
   const static string fileExt;
 
+  /*!
+   * \brief File extension of the binary format
+   */
+  const static string fileExtBinary;
+
   /*!
    * \brief Construct a file writer using field names, dimension.
    * \param[in] valDataSorter - The parallel sorted data to write
    * \param[in] valiZone - The index of the current zone
    * \param[in] valnZone - The total number of zones
+   * \param[in] valBinary - Write the binary format
    */
   CSU2MeshFileWriter(CParallelDataSorter* valDataSorter,
-                     unsigned short valiZone, unsigned short valnZone);
+                     unsigned short valiZone, unsigned short valnZone, bool valBinary = false);
 
   /*!
    * \brief Write sorted data to file in SU2 mesh file format
@@ -56,4 +78,3 @@ public:
   void WriteData(string val_filename) override ;
 
 };
-
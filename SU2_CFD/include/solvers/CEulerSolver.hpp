@@ -40,6 +40,8 @@ class CEulerSolver : public CFVMFlowSolverBase<CEulerVariable, ENUM_REGIME::COMP
 protected:
   using BaseClass = CFVMFlowSolverBase<CEulerVariable, ENUM_REGIME::COMPRESSIBLE>;
 
+  enum : unsigned long { FLUID_MODEL_BLOCK_SIZE = 64 }; /*!< \brief Points per fluid model prefetch. */
+
   su2double
   Prandtl_Lam = 0.0,    /*!< \brief Laminar Prandtl number. */
   Prandtl_Turb = 0.0;   /*!< \brief Turbulent Prandtl number. */
@@ -273,6 +275,15 @@ protected:
   virtual unsigned long SetPrimitive_Variables(CSolver **solver_container,
                                                const CConfig *config);
 
+  /*!
+   * \brief Prefetch the fluid model states of the block of points that starts at iPoint.
+   * \note Only does work when iPoint is at the start of a block or of a static OpenMP chunk, blocks end at the
+   *       next boundary of either, thus within the loop of SetPrimitive_Variables this covers every point once.
+   * \param[in] iPoint - Point index.
+   * \param[in] turbNodes - Turbulence variables if the turbulent kinetic energy is part of the energy.
+   */
+  void PrefetchFluidModel(unsigned long iPoint, const CVariable* turbNodes = nullptr);
+
   /*!
    * \brief Set gradients of coefficients for fixed CL mode
    * \param[in] config - Definition of the particular problem.
@@ -43,7 +43,7 @@ protected:
   su2double Gamma;           /*!< \brief Fluid's Gamma constant (ratio of specific heats). */
   su2double Gamma_Minus_One; /*!< \brief Fluids's Gamma - 1.0  . */
 
-  CFluidModel  *FluidModel; /*!< \brief fluid model used in the solver */
+  vector<CFluidModel*> FluidModel; /*!< \brief Fluid model used in the solver, one object per thread. */
 
   su2double
   Mach_Inf,         /*!< \brief Mach number at infinity. */
@@ -203,12 +203,12 @@ protected:
                                                                       faces for the time levels of the boundary
                                                                       markers. */
 
-  vector<unsigned long> startLocResInternalFacesLocalElem; /*!< \brief The starting location in the residual of the
-                                                                       faces for the time levels of internal faces
-                                                                       between locally owned elements. */
-  vector<unsigned long> startLocResInternalFacesWithHaloElem; /*!< \brief The starting location in the residual of the
-                                                                          faces for the time levels of internal faces
-                                                                          between an owned and a halo element. */
+  vector<unsigned long> startLocResMatchingFaces; /*!< \brief The starting location in the residual of the faces
+                                                              for every internal matching face, such that chunks
+                                                              of faces can be treated independently. */
+
+  vector<unsigned long> chunksBeg; /*!< \brief Begin indices of the chunks of elements or faces that are treated
+                                               simultaneously in the range currently processed by the threads. */
 
   bool symmetrizingTermsPresent;    /*!< \brief Whether or not symmetrizing terms are present in the
                                                 discretization. */
@@ -324,7 +324,7 @@ public:
    * \brief Compute the pressure at the infinity.
    * \return Value of the pressure at the infinity.
    */
-  inline CFluidModel* GetFluidModel(void) const final { return FluidModel;}
+  inline CFluidModel* GetFluidModel(void) const final { return FluidModel[omp_get_thread_num()]; }
 
   /*!
    * \brief Compute the density at the infinity.
@@ -543,7 +543,9 @@ public:
    * \param[in]  config    - Definition of the particular problem.
    * \param[in]  elemBeg   - Begin index of the element range to be computed.
    * \param[in]  elemEnd   - End index (not included) of the element range to be computed.
-   * \param[out] workArray - Work array.
+   * \param[out] workArray - Work array of the calling thread.
+   * \note Must be called by all threads of the parallel region, the chunks of elements
+           are distributed over the threads.
    */
   virtual void Volume_Residual(CConfig             *config,
                                const unsigned long elemBeg,
@@ -572,15 +574,14 @@ public:
    * \param[in]     config      - Definition of the particular problem.
    * \param[in]     indFaceBeg  - Starting index in the matching faces.
    * \param[in]     indFaceEnd  - End index in the matching faces.
-   * \param[in,out] indResFaces - Index where to store the residuals in
-                                  the vector of face residuals.
    * \param[in]     numerics    - Description of the numerical method.
-   * \param[out]    workArray   - Work array.
+   * \param[out]    workArray   - Work array of the calling thread.
+   * \note The chunks of faces are distributed over the threads, the face residuals are
+           stored in separate locations and gathered per DOF in CreateFinalResidual.
    */
   virtual void ResidualFaces(CConfig             *config,
                              const unsigned long indFaceBeg,
                              const unsigned long indFaceEnd,
-                             unsigned long       &indResFaces,
                              CNumerics           *numerics,
                              su2double           *workArray);
 
@@ -1681,4 +1682,40 @@ protected:
     NPad  = llEnd*nVar;
     if( NPad%nPadMin ) NPad += nPadMin - (NPad%nPadMin);
   }
+
+  /*!
+   * \brief Template function, which determines the begin indices of the chunks of
+            elements/faces that are treated simultaneously in the given range, such
+            that these chunks can be distributed over the threads. The result is stored
+            in chunksBeg, the last entry of which is elemEnd. Only the master thread
+            executes this function and the threads are synchronized afterwards.
+   * \param[in] elem       - Const pointer the volume or face elements.
+   * \param[in] elemBeg    - Begin index of the range of elements/faces.
+   * \param[in] elemEnd    - End index (index not included) of the range of elements/faces.
+   * \param[in] nElemSimul - Desired number of elements/faces that must be treated
+                             simultaneously for optimal performance.
+   * \param[in] nPadMin    - Minimum number of the padding value in the gemm calls.
+   */
+  template <class TElemType>
+  void DetermineChunksOfElem(const TElemType      *elem,
+                             const unsigned long  elemBeg,
+                             const unsigned long  elemEnd,
+                             const unsigned short nElemSimul,
+                             const unsigned short nPadMin) {
+
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+    {
+      chunksBeg.clear();
+      for(unsigned long l=elemBeg; l<elemEnd;) {
+        unsigned long lEnd;
+        unsigned short ind, llEnd, NPad;
+        MetaDataChunkOfElem(elem, l, elemEnd, nElemSimul, nPadMin, lEnd, ind, llEnd, NPad);
+
+        chunksBeg.push_back(l);
+        l = lEnd;
+      }
+      chunksBeg.push_back(elemEnd);
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
 };
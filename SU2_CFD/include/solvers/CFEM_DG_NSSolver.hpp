@@ -159,15 +159,12 @@ public:
    * \param[in]     config      - Definition of the particular problem.
    * \param[in]     indFaceBeg  - Starting index in the matching faces.
    * \param[in]     indFaceEnd  - End index in the matching faces.
-   * \param[in,out] indResFaces - Index where to store the residuals in
-                                  the vector of face residuals.
    * \param[in]     numerics    - Description of the numerical method.
-   * \param[out]    workArray   - Work array.
+   * \param[out]    workArray   - Work array of the calling thread.
    */
   void ResidualFaces(CConfig             *config,
                      const unsigned long indFaceBeg,
                      const unsigned long indFaceEnd,
-                     unsigned long       &indResFaces,
                      CNumerics           *numerics,
                      su2double           *workArray) override;
 
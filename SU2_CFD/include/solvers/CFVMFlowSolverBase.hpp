@@ -27,6 +27,7 @@
 #pragma once
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "CSolver.hpp"
 
@@ -785,6 +786,22 @@ class CFVMFlowSolverBase : public CSolver {
 
   }
 
+  /*!
+   * \brief Hard-coded classical RK4 coefficients of the stages. Will be added to config.
+   */
+  static su2double RK4_TimeCoeff(unsigned short iRKStep) {
+    const su2double coeff[] = {0.5, 0.5, 1.0, 1.0};
+    return coeff[iRKStep];
+  }
+
+  /*!
+   * \brief Hard-coded classical RK4 coefficients of the final combination. Will be added to config.
+   */
+  static su2double RK4_FuncCoeff(unsigned short iRKStep) {
+    const su2double coeff[] = {1.0/6.0, 1.0/3.0, 1.0/3.0, 1.0/6.0};
+    return coeff[iRKStep];
+  }
+
   /*!
    * \brief Generic implementation of explicit iterations with a preconditioner.
    * \note The preconditioner is a functor implementing the methods:
@@ -804,10 +821,6 @@ class CFVMFlowSolverBase : public CSolver {
 
     const su2double RK_AlphaCoeff = config->Get_Alpha_RKStep(iRKStep);
 
-    /*--- Hard-coded classical RK4 coefficients. Will be added to config. ---*/
-    const su2double RK_FuncCoeff[] = {1.0/6.0, 1.0/3.0, 1.0/3.0, 1.0/6.0};
-    const su2double RK_TimeCoeff[] = {0.5, 0.5, 1.0, 1.0};
-
     /*--- Local residual variables for current thread ---*/
     su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
     unsigned long idxMax[MAXNVAR] = {0};
@@ -843,8 +856,8 @@ class CFVMFlowSolverBase : public CSolver {
 
             case CLASSICAL_RK4_EXPLICIT:
             {
-              su2double tmp_time = -1.0*RK_TimeCoeff[iRKStep]*Delta;
-              su2double tmp_func = -1.0*RK_FuncCoeff[iRKStep]*Delta;
+              su2double tmp_time = -1.0*RK4_TimeCoeff(iRKStep)*Delta;
+              su2double tmp_func = -1.0*RK4_FuncCoeff(iRKStep)*Delta;
 
               if (iRKStep < 3) {
                 /* Base Solution Update */
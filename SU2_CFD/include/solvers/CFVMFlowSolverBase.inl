@@ -1581,6 +1581,8 @@ template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
                                                 const CSolver* const* solvers,
                                                 CConfig *config) {
+  SU2_PROFILE_SCOPE("EdgeFluxResidual");
+
   if (!edgeNumerics) {
     if (!ReducerStrategy && (omp_get_max_threads() > 1) &&
         (config->GetEdgeColoringGroupSize() % Double::Size != 0)) {
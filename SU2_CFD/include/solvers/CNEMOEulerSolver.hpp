@@ -55,11 +55,13 @@ protected:
   su2double *Source;              /*!< \brief Auxiliary vector to store source terms. */
 
   unsigned long ErrorCounter = 0; /*!< \brief Counter for number of un-physical states. */
+  unsigned long nChemistryRejectedLocal = 0, /*!< \brief Point updates without the point implicit chemistry (rank). */
+  nChemistryRejected = 0;                    /*!< \brief Point updates without the point implicit chemistry. */
 
   su2double Global_Delta_Time = 0.0, /*!< \brief Time-step for TIME_STEPPING time marching strategy. */
   Global_Delta_UnstTimeND = 0.0;     /*!< \brief Unsteady time step for the dual time strategy. */
 
-  CNEMOGas  *FluidModel;          /*!< \brief fluid model used in the solver */
+  vector<CNEMOGas*> FluidModel;   /*!< \brief fluid model used in the solver (one per thread) */
 
   CNEMOEulerVariable* node_infty = nullptr;
 
@@ -90,6 +92,12 @@ protected:
    */
   void SetReferenceValues(const CConfig& config) final;
 
+  /*!
+   * \brief Generic implementation of explicit iterations, with point implicit chemistry if requested.
+   */
+  template<ENUM_TIME_INT IntegrationType>
+  void Explicit_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iRKStep);
+
 public:
   CNEMOEulerSolver() = delete;
 
@@ -162,6 +170,20 @@ public:
   void Source_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                        CConfig *config, unsigned short iMesh) final;
 
+  /*!
+   * \brief Compute the point implicit chemistry preconditioner, P = (I - dt J)^-1.
+   * \note Only the species rows of the chemistry Jacobian (J) are not zero, therefore only the species
+   *       block needs to be inverted, and the other rows of P are those of the identity.
+   * \param[in] nSpecies - Number of species.
+   * \param[in] nVar - Number of conservative variables.
+   * \param[in] dt - Time step.
+   * \param[in] jacobian - Jacobian of the species net production rates w.r.t. the conservative variables.
+   * \param[out] precond - The preconditioner (nVar x nVar), the identity if the species block is singular.
+   * \return <TRUE> if the species block is not singular.
+   */
+  static bool ComputeChemistryPreconditioner(unsigned short nSpecies, unsigned short nVar, su2double dt,
+                                             const su2double* const* jacobian, su2activematrix& precond);
+
   /*!
    * \brief Preprocessing actions common to the Euler and NS solvers.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -224,7 +246,13 @@ public:
    * \brief Compute the pressure at the infinity.
    * \return Value of the pressure at the infinity.
    */
-  inline CNEMOGas* GetFluidModel(void) const final { return FluidModel;}
+  inline CNEMOGas* GetFluidModel(void) const final { return FluidModel[omp_get_thread_num()]; }
+
+  /*!
+   * \brief Get the number of point updates, over the stages of the last explicit iteration, for which the
+   *        point implicit chemistry was rejected (non-physical candidate state) and the explicit update used.
+   */
+  inline unsigned long GetnChemistryRejected(void) const final { return nChemistryRejected; }
 
   /*!
    * \brief Impose the far-field boundary condition using characteristics.
@@ -0,0 +1,159 @@
+/*!
+ * \file CRestartCheckpoints.hpp
+ * \brief Declaration of the in-memory / node-local store of restart data.
+ * \author P. Gomes
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../../../Common/include/basic_types/datatype_structure.hpp"
+
+class CConfig;
+class CGeometry;
+
+/*!
+ * \class CRestartCheckpoints
+ * \brief Two-level store of the (local part of the) data read from restart files.
+ * \details Every solver of a zone reads the same restart file, and the unsteady adjoint reads a new file
+ *          every time step, plus the previous ones for the mesh solver. This class keeps the data of the
+ *          most recently used files in memory, up to RESTART_CHECKPOINTS_RAM MB per rank, and optionally a copy
+ *          of each rank's part in the node-local directory RESTART_CHECKPOINTS_DIR, where it is reused by later
+ *          runs (e.g. other objective functions of the same design point). The size and modification time (with
+ *          nanoseconds where available) of the restart file are part of the key, together with a generation
+ *          counter that is incremented whenever this program writes the file, a modified file is read again.
+ *          The key also includes a hash of the global indices of the points of the rank, the data of a different
+ *          partitioning (or ordering) of the grid is not reused.
+ * \author P. Gomes
+ */
+class CRestartCheckpoints {
+ public:
+  /*!
+   * \brief Data that CSolver reads from a restart file.
+   */
+  struct CState {
+    std::vector<int> vars;
+    std::vector<std::string> fields;
+    std::vector<passivedouble> data;
+  };
+
+  /*!
+   * \brief Try to retrieve the data of a restart file (collective call).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometry on which the data was read.
+   * \param[in] filename - Restart file name (with extension).
+   * \param[out] state - Restart data.
+   * \return True if the data was retrieved, either all ranks succeed or none does.
+   */
+  static bool Load(const CConfig* config, const CGeometry* geometry, const std::string& filename, CState& state);
+
+  /*!
+   * \brief Store the data of a restart file that was just read (collective call).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometry on which the data was read.
+   * \param[in] filename - Restart file name (with extension).
+   * \param[in] state - Restart data.
+   */
+  static void Store(const CConfig* config, const CGeometry* geometry, const std::string& filename,
+                    const CState& state);
+
+  /*!
+   * \brief Release the in-memory states.
+   */
+  static void Clear() { States().clear(); }
+
+  /*!
+   * \brief Signal that a restart file is being (re)written by this program.
+   * \param[in] filename - Restart file name (with extension).
+   */
+  static void Invalidate(const std::string& filename) { ++Generations()[filename]; }
+
+ private:
+  /*!
+   * \brief Identifies a restart file read on a given geometry.
+   */
+  struct CKey {
+    std::string filename;
+    uint64_t fileStamp = 0, generation = 0;
+    uint64_t nPointDomain = 0, globalPointDomain = 0, pointsHash = 0;
+
+    bool operator==(const CKey& other) const {
+      return filename == other.filename && fileStamp == other.fileStamp && generation == other.generation &&
+             nPointDomain == other.nPointDomain && globalPointDomain == other.globalPointDomain &&
+             pointsHash == other.pointsHash;
+    }
+  };
+
+  /*!
+   * \brief Most recently used states first.
+   */
+  static std::list<std::pair<CKey, CState> >& States() {
+    static std::list<std::pair<CKey, CState> > states;
+    return states;
+  }
+
+  /*!
+   * \brief Number of times each restart file was written by this program.
+   */
+  static std::map<std::string, uint64_t>& Generations() {
+    static std::map<std::string, uint64_t> generations;
+    return generations;
+  }
+
+  /*!
+   * \brief Build the key of a restart file, the master rank checks the file (collective call).
+   * \return False if the file does not exist.
+   */
+  static bool MakeKey(const CGeometry* geometry, const std::string& filename, CKey& key);
+
+  /*!
+   * \brief Name of the node-local file of this rank.
+   */
+  static std::string LocalFileName(const CConfig* config, const std::string& filename);
+
+  /*!
+   * \brief Read the node-local copy of this rank if its key matches.
+   */
+  static bool ReadLocal(const std::string& localName, const CKey& key, CState& state);
+
+  /*!
+   * \brief Write the node-local copy of this rank.
+   */
+  static void WriteLocal(const std::string& localName, const CKey& key, const CState& state);
+
+  /*!
+   * \brief Memory used by a state, in bytes.
+   */
+  static uint64_t Bytes(const CState& state);
+
+  /*!
+   * \brief Insert a state as the most recently used, evicting the oldest ones over the budget.
+   * \param[in] budget - Memory budget in bytes, a state larger than the budget is not kept.
+   */
+  static void Insert(uint64_t budget, const CKey& key, const CState& state);
+};
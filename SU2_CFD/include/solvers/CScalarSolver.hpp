@@ -35,6 +35,8 @@
 #include "../variables/CPrimitiveIndices.hpp"
 #include "CSolver.hpp"
 
+class CNumericsSIMD;
+
 /*!
  * \brief Main class for defining a scalar solver.
  * \tparam VariableType - Class of variable used by the solver inheriting from this template.
@@ -78,6 +80,9 @@ class CScalarSolver : public CSolver {
   /*--- Edge fluxes for reducer strategy (see the notes in CEulerSolver.hpp). ---*/
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
 
+  CNumericsSIMD* edgeNumerics = nullptr; /*!< \brief Object for vectorized edge flux computation. */
+  bool edgeNumericsInstantiated = false; /*!< \brief Whether the creation of edgeNumerics was attempted. */
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use.
    */
@@ -186,6 +191,7 @@ class CScalarSolver : public CSolver {
         su2double* PrimVar_i = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint);
 
         auto* Jacobian_i = Jacobian.GetBlock(iPoint, iPoint);
+        Jacobian.SetSELLDirty();
 
         /*--- Loop over the nDonorVertexes and compute the averaged flux ---*/
 
@@ -295,7 +301,31 @@ class CScalarSolver : public CSolver {
    * \brief Sum the edge fluxes for each cell to populate the residual vector, only used on coarse grids.
    * \param[in] geometry - Geometrical definition of the problem.
    */
-  void SumEdgeFluxes(CGeometry* geometry);
+  void SumEdgeFluxes(const CGeometry* geometry);
+
+  /*!
+   * \brief Instantiate a SIMD numerics object for the convection and diffusion terms.
+   * \note Solvers whose models are supported by CNumericsSIMD::CreateScalarNumerics override this,
+   * the others (with edgeNumerics == nullptr) use the edge-by-edge implementation of Upwind_Residual.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) {}
+
+  /*!
+   * \brief Compute the convective and viscous fluxes (and Jacobians) of all edges with the SIMD numerics.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void EdgeFluxResidual(const CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Apply the bounded scalar correction (see Upwind_Residual) in a loop over nodes.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] edgeMassFluxes - Mass fluxes of the flow solver.
+   * \param[in] implicit - Whether to update the Jacobian.
+   */
+  void BoundedScalarCorrection(const CGeometry* geometry, const su2activevector& edgeMassFluxes, bool implicit);
 
  private:
   /*!
@@ -180,6 +180,39 @@ private:
    */
   void InterpolateRestartData(const CGeometry *geometry, const CConfig *config);
 
+#ifdef HAVE_MPI
+  /*!
+   * \brief Read the data of a compressed binary restart file into Restart_Data.
+   * \note Each rank decompresses the chunks that overlap a linear partition of the file, the points of
+   *       the geometry partition are then requested from the ranks that decompressed them.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] fhw - Open restart file.
+   * \param[in] disp - Position of the table of compressed chunks.
+   * \param[in] nFields - Number of fields in the file.
+   * \param[in] nPointFile - Number of points in the file.
+   */
+  void ReadCompressedRestartData(const CGeometry *geometry, const CConfig *config, MPI_File fhw, MPI_Offset disp,
+                                 unsigned long nFields, unsigned long nPointFile);
+#endif
+
+  /*!
+   * \brief Retrieve the restart data of a file that was read recently (see CRestartCheckpoints).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] filename - Restart file name (with extension).
+   * \return True if Restart_Vars, Restart_Data, and fields were set.
+   */
+  bool LoadRestartCheckpoint(const CGeometry *geometry, const CConfig *config, const string& filename);
+
+  /*!
+   * \brief Keep the restart data that was just read for other solvers or time steps.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] filename - Restart file name (with extension).
+   */
+  void StoreRestartCheckpoint(const CGeometry *geometry, const CConfig *config, const string& filename) const;
+
   /*--- Private to prevent use by derived solvers, each solver MUST have its own "nodes" member of the
    most derived type possible, e.g. CEulerSolver has nodes of CEulerVariable* and not CVariable*.
    This variable is to avoid two virtual functions calls per call i.e. CSolver::GetNodes() returns
@@ -2110,6 +2143,12 @@ public:
    */
   inline virtual unsigned long GetIter_Update_AoA(void) const { return 0; }
 
+  /*!
+   * \brief A virtual member.
+   * \return Number of point updates for which the point implicit chemistry was rejected.
+   */
+  inline virtual unsigned long GetnChemistryRejected(void) const { return 0; }
+
   /*!
    * \brief A virtual member.
    * \return value of the AoA before most recent update
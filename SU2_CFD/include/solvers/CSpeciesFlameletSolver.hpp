@@ -37,6 +37,8 @@
  */
 class CSpeciesFlameletSolver final : public CSpeciesSolver {
  private:
+  enum : unsigned long { LOOKUP_BLOCK_SIZE = 64 }; /*!< \brief Number of points per batched manifold evaluation. */
+
   vector<su2activematrix> conjugate_var; /*!< \brief CHT variables for each boundary and vertex. */
   bool include_mixture_fraction = false; /*!< \brief include mixture fraction as a controlling variable. */
   /*!
@@ -75,27 +77,22 @@ class CSpeciesFlameletSolver final : public CSpeciesSolver {
   su2double GetBurntProgressVariable(CFluidModel* fluid_model, const su2double* scalars);
 
   /*!
-   * \brief Retrieve scalar source terms from manifold.
+   * \brief Set the scalar source terms from the manifold data.
    * \param[in] config - definition of particular problem.
-   * \param[in] fluid_model_local - pointer to flamelet fluid model.
    * \param[in] iPoint - node ID.
    * \param[in] scalars - local scalar solution.
-   * \param[in] table_source_names - variable names of scalar source terms.
-   * \return - within manifold bounds (0) or outside manifold bounds (1).
+   * \param[in] table_sources - source terms evaluated on the manifold (production and consumption).
    */
-  unsigned long SetScalarSources(const CConfig* config, CFluidModel* fluid_model_local, unsigned long iPoint,
-                                 const vector<su2double>& scalars);
+  void SetScalarSources(const CConfig* config, unsigned long iPoint, const su2double* scalars,
+                        const su2double* table_sources);
 
   /*!
-   * \brief Retrieve passive look-up data from manifold.
+   * \brief Set the passive look-up data from the manifold data.
    * \param[in] config - definition of particular problem.
-   * \param[in] fluid_model_local - pointer to flamelet fluid model.
    * \param[in] iPoint - node ID.
-   * \param[in] scalars - local scalar solution.
-   * \return - within manifold bounds (0) or outside manifold bounds (1).
+   * \param[in] table_lookups - look-up data evaluated on the manifold.
    */
-  unsigned long SetScalarLookUps(const CConfig* config, CFluidModel* fluid_model_local, unsigned long iPoint,
-                                 const vector<su2double>& scalars);
+  void SetScalarLookUps(const CConfig* config, unsigned long iPoint, const su2double* table_lookups);
 
  public:
   /*!
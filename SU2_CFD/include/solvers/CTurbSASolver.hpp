@@ -72,6 +72,13 @@ private:
    */
   void ComputeUnderRelaxationFactor(const CConfig *config) final;
 
+  /*!
+   * \brief Instantiate a SIMD numerics object.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) final;
+
 public:
   /*!
    * \brief Constructor.
@@ -31,6 +31,8 @@
 #include "../variables/CTurbVariable.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 
+class CSourceSIMD;
+
 /*!
  * \class CTurbSolver
  * \brief Main class for defining the turbulence model solver.
@@ -42,6 +44,20 @@ protected:
 
   vector<su2activematrix> Inlet_TurbVars;  /*!< \brief Turbulence variables at inlet profiles */
 
+  CSourceSIMD* pointSource = nullptr;    /*!< \brief Object for vectorized point source computation. */
+  bool pointSourceInstantiated = false;  /*!< \brief Whether the creation of pointSource was attempted. */
+
+  /*!
+   * \brief Compute the source terms of the model for groups of points with the vectorized
+   * implementation, if the options of the model support it (the object is created on first use).
+   * \note Must be called by all threads, the caller handles the AD shared reading mode.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \return False if the sources need to be computed point by point.
+   */
+  bool PointSource_Residual(const CGeometry* geometry, const CSolver* const* solver_container, const CConfig* config);
+
 public:
   /*!
    * \brief Destructor of the class.
@@ -31,6 +31,8 @@
 #include "../../../Common/include/geometry/CDummyGeometry.hpp"
 #include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
 #include "../../../Common/include/geometry/CMultiGridGeometry.hpp"
+#include "../../../Common/include/geometry/CGeometryCache.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 
 #include "../../include/solvers/CSolverFactory.hpp"
 #include "../../include/solvers/CFEM_DG_EulerSolver.hpp"
@@ -118,11 +120,22 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
 
   PreprocessInput(config_container, driver_config);
 
+  /*--- Start the profiler, the preprocessing is also profiled. ---*/
+
+  if (config_container[ZONE_0]->GetProfiling()) {
+    CProfiler::Initialize(config_container[ZONE_0]->GetProfiling_Trace(),
+                          config_container[ZONE_0]->GetProfiling_HWCounters());
+  }
+
   /*--- Retrieve dimension from mesh file ---*/
 
   nDim = CConfig::GetnDim(config_container[ZONE_0]->GetMesh_FileName(),
                           config_container[ZONE_0]->GetMesh_FileFormat());
 
+  /*--- Groups of ranks for the zones solved concurrently. ---*/
+
+  InitializeZoneGroups();
+
   /*--- Output preprocessing ---*/
 
   PreprocessOutput(config_container, driver_config, output_container, driver_output);
@@ -155,7 +168,7 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
        identified and linked, face areas and volumes of the dual mesh cells are
        computed, and the multigrid levels are created using an agglomeration procedure. ---*/
 
-      InitializeGeometry(config_container[iZone], geometry_container[iZone][iInst], dry_run);
+      InitializeGeometry(config_container[iZone], geometry_container[iZone][iInst], dry_run || !IsLocalZone(iZone));
 
     }
   }
@@ -165,7 +178,9 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
   if (rank == MASTER_NODE)
     cout << "Computing wall distances." << endl;
 
+  SetZoneCommunicator(true);
   CGeometry::ComputeWallDistance(config_container, geometry_container);
+  SetZoneCommunicator(false);
 
   for (iZone = 0; iZone < nZone; iZone++) {
 
@@ -221,7 +236,9 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
 
   /*! --- Compute the wall distance again to correctly compute the derivatives if we are running direct diff mode --- */
   if (driver_config->GetDirectDiff() == D_DESIGN){
+    SetZoneCommunicator(true);
     CGeometry::ComputeWallDistance(config_container, geometry_container);
+    SetZoneCommunicator(false);
   }
 
   /*--- Definition of the interface and transfer conditions between different zones. ---*/
@@ -230,8 +247,10 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
     if (rank == MASTER_NODE)
       cout << endl <<"------------------- Multizone Interface Preprocessing -------------------" << endl;
 
+    SetZoneCommunicator(true);
     InitializeInterface(config_container, solver_container, geometry_container,
                             interface_types, interface_container, interpolator_container);
+    SetZoneCommunicator(false);
   }
 
   if (fsi) {
@@ -279,6 +298,19 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
     MDOFsDomain   += DOFsPerPoint*geometry_container[iZone][INST_0][MESH_0]->GetGlobal_nPointDomain()/(1.0e6);
   }
 
+  if (concurrent_zones) {
+    /*--- The other zones are dummies on this rank, each zone is counted by the first rank of its group. ---*/
+    su2double sizes[] = {Mpoints, MpointsDomain, MDOFs, MDOFsDomain}, sizesGlobal[4];
+    if (SU2_MPI::GetRank() != MASTER_NODE) {
+      for (auto& value : sizes) value = 0.0;
+    }
+    SU2_MPI::Allreduce(sizes, sizesGlobal, 4, MPI_DOUBLE, MPI_SUM, driver_comm);
+    Mpoints       = sizesGlobal[0];
+    MpointsDomain = sizesGlobal[1];
+    MDOFs         = sizesGlobal[2];
+    MDOFsDomain   = sizesGlobal[3];
+  }
+
   /*--- Reset timer for compute/output performance benchmarking. ---*/
 
   StopTime = SU2_MPI::Wtime();
@@ -358,6 +390,15 @@ void CDriver::Finalize() {
       cout << "Warning: " << config_container[ZONE_0]->GetNonphysical_Reconstr() << " reconstructed states for upwinding are non-physical." << endl;
   }
 
+  /*--- Wait for the files written in the background, their bandwidth is part of the summary. ---*/
+
+  if (output_container != nullptr) {
+    for (iZone = 0; iZone < nZone; iZone++) {
+      if (output_container[iZone] != nullptr) output_container[iZone]->FinishAsyncOutput(config_container[iZone]);
+    }
+    if (OutputCount > 0) BandwidthSum = config_container[ZONE_0]->GetRestart_Bandwidth_Agg();
+  }
+
   if (rank == MASTER_NODE)
     cout <<"\n--------------------------- Finalizing Solver ---------------------------" << endl;
 
@@ -454,12 +495,17 @@ void CDriver::Finalize() {
   delete [] grid_movement;
   if (rank == MASTER_NODE) cout << "Deleted CVolumetricMovement class." << endl;
 
-  /*--- Output profiling information ---*/
-  // Note that for now this is called only by a single thread, but all
-  // necessary variables have been made thread private for safety (tick/tock)!!
+  /*--- Back to all the ranks of the driver for the collective calls below. ---*/
+
+  if (concurrent_zones) {
+    SU2_MPI::SetComm(driver_comm);
+    SU2_MPI::Comm_free(&zone_comm);
+    if (cout_buffer != nullptr) cout.rdbuf(cout_buffer);
+  }
+
+  /*--- Output profiling information (collective call). ---*/
 
-  config_container[ZONE_0]->SetProfilingCSV();
-  config_container[ZONE_0]->GEMMProfilingCSV();
+  CProfiler::Finalize(config_container[ZONE_0]->GetProfiling_FileName());
 
   /*--- Deallocate config container ---*/
   if (config_container!= nullptr) {
@@ -597,6 +643,101 @@ void CDriver::PreprocessInput(CConfig **&config, CConfig *&driver_config) {
   fsi = config_container[ZONE_0]->GetFSI_Simulation();
 }
 
+void CDriver::InitializeZoneGroups() {
+
+  concurrent_zones = driver_config->GetMultizone_Problem() && driver_config->GetMultizone_Concurrent();
+  if (!concurrent_zones) return;
+
+  /*--- Only the zones of a Block-Jacobi iteration are independent, and each zone needs at least one rank.
+   *    Mesh motion (and the wall distance update it requires) and the coupling of time instances or of the
+   *    adjoint tape involve all zones at once. ---*/
+
+  if (driver_config->GetKind_MZSolver() != ENUM_MULTIZONE::MZ_BLOCK_JACOBI) {
+    SU2_MPI::Error("MULTIZONE_CONCURRENT_ZONES= YES requires MULTIZONE_SOLVER= BLOCK_JACOBI.", CURRENT_FUNCTION);
+  }
+  if (size < nZone) {
+    SU2_MPI::Error("MULTIZONE_CONCURRENT_ZONES= YES requires at least one rank per zone.", CURRENT_FUNCTION);
+  }
+  for (iZone = 0; iZone < nZone; iZone++) {
+    const auto config = config_container[iZone];
+    if (config->GetGrid_Movement() || config->GetDeform_Mesh() || config->GetFSI_Simulation() ||
+        config->GetBoolTurbomachinery() || (config->GetnTimeInstances() > 1) || config->GetDiscrete_Adjoint() ||
+        config->GetFEMSolver()) {
+      SU2_MPI::Error("MULTIZONE_CONCURRENT_ZONES= YES does not support mesh motion or deformation, FSI, "
+                     "turbomachinery, harmonic balance, adjoints, or the FEM solver.", CURRENT_FUNCTION);
+    }
+  }
+
+  /*--- Load of each zone, number of cells (from the mesh files) times number of equations. ---*/
+
+  auto nEquations = [&](const CConfig* config) {
+    unsigned long nEqn = nDim + 2;
+    switch (config->GetKind_Solver()) {
+      case MAIN_SOLVER::NEMO_EULER: case MAIN_SOLVER::NEMO_NAVIER_STOKES:
+        nEqn += config->GetnSpecies(); break;
+      case MAIN_SOLVER::FEM_ELASTICITY:
+        nEqn = nDim; break;
+      case MAIN_SOLVER::HEAT_EQUATION:
+        nEqn = 1; break;
+      default:
+        break;
+    }
+    if (config->GetKind_Turb_Model() != TURB_MODEL::NONE)
+      nEqn += (config->GetKind_Turb_Model() == TURB_MODEL::SST) ? 2 : 1;
+    if (config->GetKind_Species_Model() != SPECIES_MODEL::NONE)
+      nEqn += config->GetnSpecies();
+    return nEqn;
+  };
+
+  vector<passivedouble> load(nZone, 0.0);
+  if (rank == MASTER_NODE) {
+    for (iZone = 0; iZone < nZone; iZone++) {
+      const auto config = config_container[iZone];
+      load[iZone] = max<passivedouble>(1.0, passivedouble(config->GetMesh_nElem()) * nEquations(config));
+    }
+  }
+  CBaseMPIWrapper::Bcast(load.data(), nZone, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
+
+  /*--- One rank per zone, and each additional rank to the zone with the largest load per rank,
+   *    this minimizes the time of the slowest zone, which sets the time of the Block-Jacobi iteration. ---*/
+
+  vector<int> nRanks(nZone, 1);
+  for (auto iRank = int(nZone); iRank < size; iRank++) {
+    unsigned short maxZone = 0;
+    for (iZone = 1; iZone < nZone; iZone++) {
+      if (load[iZone] * nRanks[maxZone] > load[maxZone] * nRanks[iZone]) maxZone = iZone;
+    }
+    nRanks[maxZone]++;
+  }
+
+  /*--- Consecutive ranks for each zone, the master of the driver is the master of zone 0. ---*/
+
+  zone_ranks.assign(nZone + 1, 0);
+  for (iZone = 0; iZone < nZone; iZone++) {
+    zone_ranks[iZone + 1] = zone_ranks[iZone] + nRanks[iZone];
+    if (rank >= zone_ranks[iZone]) rank_zone = iZone;
+  }
+
+  if (rank == MASTER_NODE) {
+    cout << endl << "Zones solved concurrently by groups of ranks (load = cells x equations):" << endl;
+    for (iZone = 0; iZone < nZone; iZone++) {
+      cout << "Zone " << iZone << ": ranks " << zone_ranks[iZone] << " to " << zone_ranks[iZone + 1] - 1
+           << ", load " << load[iZone] << "." << endl;
+    }
+  }
+
+  driver_comm = SU2_MPI::GetComm();
+  SU2_MPI::Comm_split(driver_comm, rank_zone, rank, &zone_comm);
+  SU2_MPI::SetComm(zone_comm);
+
+  for (iZone = 0; iZone < nZone; iZone++) config_container[iZone]->SetMPICommunicator(zone_comm);
+
+  /*--- The master of each group is rank 0 of SU2_MPI, only the master of the driver writes to the screen,
+   *    otherwise the output of the groups is interleaved. The multizone history has all the zones. ---*/
+
+  if (rank != MASTER_NODE) cout_buffer = cout.rdbuf(nullptr);
+}
+
 void CDriver::InitializeGeometry(CConfig* config, CGeometry **&geometry, bool dummy){
 
   if (!dummy){
@@ -713,9 +854,15 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
   nDim = geometry_aux->GetnDim();
 
-  /*--- Color the initial grid and set the send-receive domains (ParMETIS) ---*/
+  /*--- Color the initial grid and set the send-receive domains (ParMETIS),
+   *    unless the partitioning of a previous run can be reused. ---*/
 
-  geometry_aux->SetColorGrid_Parallel(config);
+  CGeometryCache geometryCache(config);
+
+  if (!geometryCache.LoadPartitioning(geometry_aux)) {
+    geometry_aux->SetColorGrid_Parallel(config);
+    geometryCache.StorePartitioning(geometry_aux);
+  }
 
   /*--- Allocate the memory of the current domain, and divide the grid
      between the ranks. ---*/
@@ -771,14 +918,17 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
   geometry[MESH_0]->SetEdges();
   geometry[MESH_0]->SetVertex(config);
 
-  /*--- Create the control volume structures ---*/
+  /*--- Create the control volume structures, unless the dual grid of a previous run can be reused. ---*/
 
   if (rank == MASTER_NODE) cout << "Setting the control volume structure." << endl;
-  SU2_OMP_PARALLEL {
-    geometry[MESH_0]->SetControlVolume(config, ALLOCATE);
-    geometry[MESH_0]->SetBoundControlVolume(config, ALLOCATE);
+  if (!geometryCache.LoadDualGrid(geometry[MESH_0], config)) {
+    SU2_OMP_PARALLEL {
+      geometry[MESH_0]->SetControlVolume(config, ALLOCATE);
+      geometry[MESH_0]->SetBoundControlVolume(config, ALLOCATE);
+    }
+    END_SU2_OMP_PARALLEL
+    geometryCache.StoreDualGrid(geometry[MESH_0], config);
   }
-  END_SU2_OMP_PARALLEL
 
   /*--- Visualize a dual control volume if requested ---*/
 
@@ -916,6 +1066,22 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
     geometry[iMGlevel]->CompleteComms(geometry[iMGlevel], config, NEIGHBORS);
   }
 
+  /*--- Reuse or build the edge colorings (only needed with multiple threads), see the solvers'
+   *    constructors for how the colorings are requested. ---*/
+
+  if (geometryCache.IsEnabled() && !fea && omp_get_max_threads() > 1) {
+    for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
+      if (geometryCache.LoadEdgeColoring(iMGlevel, geometry[iMGlevel])) continue;
+#ifdef CODI_REVERSE_TYPE
+      geometry[iMGlevel]->GetEdgeColoring(nullptr, config->GetEdgeColoringRelaxDiscAdj());
+#else
+      geometry[iMGlevel]->GetEdgeColoring();
+#endif
+      geometryCache.StoreEdgeColoring(iMGlevel, geometry[iMGlevel]);
+    }
+  }
+  geometryCache.Write();
+
 }
 
 void CDriver::InitializeGeometryDGFEM(CConfig* config, CGeometry **&geometry) {
@@ -1033,11 +1199,11 @@ void CDriver::InitializeSolver(CConfig* config, CGeometry** geometry, CSolver **
   /*--- Restart solvers, for FSI the geometry cannot be updated because the interpolation classes
    * should always use the undeformed mesh (otherwise the results would not be repeatable). ---*/
 
-  if (!fsi) RestartSolver(solver, geometry, config, true);
+  if (!fsi && IsLocalZone(config->GetiZone())) RestartSolver(solver, geometry, config, true);
 
   /*--- Set up any necessary inlet profiles ---*/
 
-  PreprocessInlet(solver, geometry, config);
+  if (IsLocalZone(config->GetiZone())) PreprocessInlet(solver, geometry, config);
 
 }
 
@@ -2606,8 +2772,8 @@ void CDriver::PreprocessOutput(CConfig **config, CConfig *driver_config, COutput
 
     output[iZone] = COutputFactory::CreateOutput(kindSolver, config[iZone], nDim);
 
-    /*--- If dry-run is used, do not open/overwrite history file. ---*/
-    output[iZone]->PreprocessHistoryOutput(config[iZone], !dry_run);
+    /*--- If dry-run is used, or the zone is solved by other ranks, do not open/overwrite history file. ---*/
+    output[iZone]->PreprocessHistoryOutput(config[iZone], !dry_run && IsLocalZone(iZone));
 
     output[iZone]->PreprocessVolumeOutput(config[iZone]);
 
@@ -2617,9 +2783,14 @@ void CDriver::PreprocessOutput(CConfig **config, CConfig *driver_config, COutput
     if (rank == MASTER_NODE)
       cout << endl <<"------------------- Output Preprocessing ( Multizone ) ------------------" << endl;
 
+    /*--- The multizone output belongs to all the ranks, it is written by the master of the driver. ---*/
+    SetZoneCommunicator(true);
+
     driver_output = COutputFactory::CreateMultizoneOutput(driver_config, config, nDim);
 
     driver_output->PreprocessMultizoneHistoryOutput(output, config, driver_config, !dry_run);
+
+    SetZoneCommunicator(false);
   }
 
   /*--- Check for an unsteady restart. Update ExtIter if necessary. ---*/
@@ -191,6 +191,14 @@ void CMultizoneDriver::StartSolver() {
 
     StopCalc = Monitor(TimeIter);
 
+    /*--- With concurrent zones, all the groups of ranks stop with the master (which solves zone 0). ---*/
+
+    if (concurrent_zones) {
+      int stop = StopCalc;
+      SU2_MPI::Bcast(&stop, 1, MPI_INT, MASTER_NODE, driver_comm);
+      StopCalc = stop;
+    }
+
     /*--- Output the solution in files. ---*/
 
     Output(TimeIter);
@@ -228,6 +236,9 @@ void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
       config_container[iZone]->SetPhysicalTime(0.0);
     }
 
+    /*--- The zones solved by other groups of ranks are dummies on this rank. ---*/
+    if (!IsLocalZone(iZone)) continue;
+
     /*--- Set the initial condition for EULER/N-S/RANS ---------------------------------------------*/
     /*--- For FSI, the initial conditions are set, after the mesh has been moved. --------------------------------------*/
     if (!fsi && config_container[iZone]->GetFluidProblem()) {
@@ -255,7 +266,7 @@ void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
 
   /*--- Run a predictor step ---*/
   for (iZone = 0; iZone < nZone; iZone++) {
-    if (config_container[iZone]->GetPredictor())
+    if (IsLocalZone(iZone) && config_container[iZone]->GetPredictor())
       iteration_container[iZone][INST_0]->Predictor(output_container[iZone], integration_container, geometry_container,
                                                     solver_container, numerics_container, config_container, surface_movement,
                                                     grid_movement, FFDBox, iZone, INST_0);
@@ -339,6 +350,8 @@ void CMultizoneDriver::RunJacobi() {
   /*--- Loop over the number of outer iterations ---*/
   for (auto iOuter_Iter = 0ul; iOuter_Iter < driver_config->GetnOuter_Iter(); iOuter_Iter++){
 
+    /*--- With concurrent zones, the interfaces connect the groups of ranks of different zones. ---*/
+    SetZoneCommunicator(true);
 
     /*--- Transfer from all zones ---*/
     for (iZone = 0; iZone < nZone; iZone++){
@@ -363,6 +376,8 @@ void CMultizoneDriver::RunJacobi() {
 
     }
 
+    SetZoneCommunicator(false);
+
       /*--- Loop over the number of zones (IZONE) ---*/
     for (iZone = 0; iZone < nZone; iZone++) {
 
@@ -371,6 +386,9 @@ void CMultizoneDriver::RunJacobi() {
       config_container[iZone]->Set_StartTime(SU2_MPI::Wtime());
       driver_config->SetOuterIter(iOuter_Iter);
 
+      /*--- With concurrent zones, each group of ranks solves its zone at the same time as the others. ---*/
+      if (!IsLocalZone(iZone)) continue;
+
       /*--- Iterate the zone as a block, either to convergence or to a max number of iterations ---*/
       iteration_container[iZone][INST_0]->Solve(output_container[iZone], integration_container, geometry_container,
                                                 solver_container, numerics_container, config_container,
@@ -401,6 +419,8 @@ bool CMultizoneDriver::OuterConvergence(unsigned long OuterIter) {
 
   for (iZone = 0; iZone < nZone; iZone++) {
 
+    if (!IsLocalZone(iZone)) continue;
+
     /*--- Account for all the solvers in this zone. ---*/
 
     auto solvers = solver_container[iZone][INST_0][MESH_0];
@@ -418,11 +438,22 @@ bool CMultizoneDriver::OuterConvergence(unsigned long OuterIter) {
 
   }
 
+  /*--- The outputs of the zones solved by other groups of ranks are copied from the first rank of those groups,
+   *    then all ranks have the same multizone history and take the same convergence decision. ---*/
+
+  SetZoneCommunicator(true);
+
+  if (concurrent_zones) {
+    for (iZone = 0; iZone < nZone; iZone++) output_container[iZone]->BroadcastHistoryOutput(zone_ranks[iZone]);
+  }
+
   /*--- Print out the convergence data to screen and history file. ---*/
 
   driver_output->SetMultizoneHistoryOutput(output_container, config_container, driver_config,
                                             driver_config->GetTimeIter(), driver_config->GetOuterIter());
 
+  SetZoneCommunicator(false);
+
   return driver_output->GetConvergence();
 
 }
@@ -435,6 +466,8 @@ void CMultizoneDriver::Update() {
 
     unsigned short UpdateMesh = 0;
 
+    SetZoneCommunicator(true);
+
     /*--- Transfer from all the remaining zones (JZONE != IZONE)---*/
     for (auto jZone = 0u; jZone < nZone; jZone++){
       /*--- The target zone is iZone ---*/
@@ -442,9 +475,14 @@ void CMultizoneDriver::Update() {
         UpdateMesh += TransferData(jZone, iZone);
       }
     }
+
+    SetZoneCommunicator(false);
+
     /*--- If a mesh update is required due to the transfer of data ---*/
     if (UpdateMesh > 0) DynamicMeshUpdate(iZone, TimeIter);
 
+    if (!IsLocalZone(iZone)) continue;
+
     iteration_container[iZone][INST_0]->Update(output_container[iZone], integration_container, geometry_container,
         solver_container, numerics_container, config_container,
         surface_movement, grid_movement, FFDBox, iZone, INST_0);
@@ -465,6 +503,7 @@ void CMultizoneDriver::Output(unsigned long TimeIter) {
   bool wrote_files = false;
 
   for (iZone = 0; iZone < nZone; iZone++){
+    if (!IsLocalZone(iZone)) continue;
     wrote_files = output_container[iZone]->SetResultFiles(geometry_container[iZone][INST_0][MESH_0],
                                                             config_container[iZone],
                                                             solver_container[iZone][INST_0][MESH_0], TimeIter, StopCalc );
@@ -44,12 +44,14 @@ CDataDrivenFluid::CDataDrivenFluid(const CConfig* config, bool display) : CFluid
 #ifdef USE_MLPCPP
       lookup_mlp = new MLPToolbox::CLookUp_ANN(config->GetNDataDriven_Files(), config->GetDataDriven_FileNames());
       if ((rank == MASTER_NODE) && display) lookup_mlp->DisplayNetworkInfo();
+      batched_mlp = new CBatchedMLP(config->GetNDataDriven_Files(), config->GetDataDriven_FileNames());
 #else
       SU2_MPI::Error("SU2 was not compiled with MLPCpp enabled (-Denable-mlpcpp=true).", CURRENT_FUNCTION);
 #endif
       break;
     case ENUM_DATADRIVEN_METHOD::LUT:
-      lookup_table = new CLookUpTable(config->GetDataDriven_FileNames()[0], varname_rho, varname_e);
+      lookup_table = new CLookUpTable(config->GetDataDriven_FileNames()[0], varname_rho, varname_e,
+                                      config->GetKind_LUT_Search_Map());
       break;
     default:
       break;
@@ -74,6 +76,7 @@ CDataDrivenFluid::~CDataDrivenFluid() {
       delete iomap_rhoe;
       delete lookup_mlp;
 #endif
+      delete batched_mlp;
       break;
     case ENUM_DATADRIVEN_METHOD::LUT:
       delete lookup_table;
@@ -117,8 +120,14 @@ void CDataDrivenFluid::MapInputs_to_Outputs() {
     iomap_rhoe = new MLPToolbox::CIOMap(input_names_rhoe, output_names_rhoe);
     lookup_mlp->PairVariableswithMLPs(*iomap_rhoe);
     MLP_inputs.resize(2);
+    batched_mlp->PairVariables(input_names_rhoe, output_names_rhoe);
 #endif
   }
+  if (Kind_DataDriven_Method == ENUM_DATADRIVEN_METHOD::LUT) {
+    /*--- Resolve the table columns once. ---*/
+    idx_outputs_LUT = lookup_table->GetIndexOfVars(output_names_rhoe);
+    outputs_LUT.resize(n_outputs);
+  }
 }
 
 void CDataDrivenFluid::SetTDState_rhoe(su2double rho, su2double e) {
@@ -172,12 +181,35 @@ void CDataDrivenFluid::SetTDState_PT(su2double P, su2double T) {
   Run_Newton_Solver(P, T, &Pressure, &Temperature, &dPdrho_e, &dPde_rho, &dTdrho_e, &dTde_rho);
 }
 
+unsigned long CDataDrivenFluid::FindPrefetched(unsigned long first, unsigned long n_states,
+                                               const vector<su2double>& x, const vector<su2double>& y, su2double x0,
+                                               su2double y0) {
+  /*--- Usually the state at the cursor, the states that were not requested are skipped. ---*/
+  for (auto iState = first; iState < n_states; iState++) {
+    if (x[iState] == x0 && y[iState] == y0) return iState;
+  }
+  return n_states;
+}
+
 void CDataDrivenFluid::SetTDState_Prho(su2double P, su2double rho) {
   /*--- Computing static energy according to pressure and density. ---*/
   SetEnergy_Prho(P, rho);
 }
 
 void CDataDrivenFluid::SetEnergy_Prho(su2double P, su2double rho) {
+  /*--- Use the prefetched energy if this is one of the remaining prefetched states, the final (rho, e) state is
+   * the prefetched (rho, e) state with the same index. ---*/
+  const auto iState = FindPrefetched(i_prefetch_Prho, n_prefetch_Prho, prefetch_P, prefetch_rho_P, P, rho);
+  if (iState < n_prefetch_Prho) {
+    i_prefetch = iState;
+    Density = rho;
+    StaticEnergy = prefetch_energy[iState];
+    SetTDState_rhoe(Density, StaticEnergy);
+    nIter_Newton = prefetch_iter[iState];
+    i_prefetch_Prho = iState + 1;
+    return;
+  }
+
   /*--- Run 1D Newton solver for pressure at constant density. ---*/
   Density = rho;
 
@@ -233,24 +265,26 @@ unsigned long CDataDrivenFluid::Predict_MLP(su2double rho, su2double e) {
 }
 
 unsigned long CDataDrivenFluid::Predict_LUT(su2double rho, su2double e) {
-  unsigned long exit_code;
-  std::vector<std::string> output_names_rhoe_LUT;
-  std::vector<su2double*> outputs_LUT;
-  output_names_rhoe_LUT.resize(output_names_rhoe.size());
-  for (auto iOutput = 0u; iOutput < output_names_rhoe.size(); iOutput++) {
-    output_names_rhoe_LUT[iOutput] = output_names_rhoe[iOutput];
-  }
+  unsigned long exit_code = lookup_table->LookUp_Batch(idx_outputs_LUT, 1, &rho, &e, nullptr, 1, outputs_LUT.data());
 
-  outputs_LUT.resize(outputs_rhoe.size());
   for (auto iOutput = 0u; iOutput < outputs_rhoe.size(); iOutput++) {
-    outputs_LUT[iOutput] = outputs_rhoe[iOutput];
+    *outputs_rhoe[iOutput] = outputs_LUT[iOutput];
   }
-
-  exit_code = lookup_table->LookUp_XY(output_names_rhoe_LUT, outputs_LUT, rho, e);
   return exit_code;
 }
 
 void CDataDrivenFluid::Evaluate_Dataset(su2double rho, su2double e) {
+  /*--- Use the prefetched outputs if this is one of the remaining prefetched states. ---*/
+  const auto iState = FindPrefetched(i_prefetch, n_prefetch, prefetch_rho, prefetch_e, rho, e);
+  if (iState < n_prefetch) {
+    for (auto iOutput = 0u; iOutput < outputs_rhoe.size(); iOutput++) {
+      *outputs_rhoe[iOutput] = prefetch_outputs(iState, iOutput);
+    }
+    outside_dataset = prefetch_exit_codes[iState];
+    i_prefetch = iState + 1;
+    return;
+  }
+
   /*--- Evaluate dataset based on regression method. ---*/
   switch (Kind_DataDriven_Method) {
     case ENUM_DATADRIVEN_METHOD::LUT:
@@ -264,6 +298,136 @@ void CDataDrivenFluid::Evaluate_Dataset(su2double rho, su2double e) {
   }
 }
 
+void CDataDrivenFluid::Predict_Batch(unsigned long n_states, const su2double* rho, const su2double* e,
+                                     su2double* outputs, unsigned short* exit_codes) {
+  switch (Kind_DataDriven_Method) {
+    case ENUM_DATADRIVEN_METHOD::LUT:
+      lookup_table->LookUp_Batch(idx_outputs_LUT, n_states, rho, e, nullptr, 1, outputs, exit_codes);
+      break;
+    case ENUM_DATADRIVEN_METHOD::MLP:
+      /*--- Inputs in the order of input_names_rhoe. ---*/
+      batched_mlp->Predict(n_states, {rho, e}, outputs, exit_codes);
+      break;
+    default:
+      break;
+  }
+}
+
+void CDataDrivenFluid::ResizePrefetch(unsigned long n_states) {
+  if (prefetch_rho.size() >= n_states) return;
+
+  prefetch_rho.resize(n_states);
+  prefetch_e.resize(n_states);
+  prefetch_outputs.resize(n_states, outputs_rhoe.size());
+  prefetch_exit_codes.resize(n_states);
+}
+
+void CDataDrivenFluid::PrefetchTDState_rhoe(unsigned long n_states, const su2double* rho, const su2double* e) {
+  ResizePrefetch(n_states);
+
+  /*--- Same clipping as SetTDState_rhoe, so that the states can be matched. ---*/
+  for (auto iState = 0ul; iState < n_states; iState++) {
+    prefetch_rho[iState] = min(rho_max, max(rho_min, rho[iState]));
+    prefetch_e[iState] = min(e_max, max(e_min, e[iState]));
+  }
+  Predict_Batch(n_states, prefetch_rho.data(), prefetch_e.data(), prefetch_outputs.data(),
+                prefetch_exit_codes.data());
+
+  n_prefetch = n_states;
+  i_prefetch = 0;
+  n_prefetch_Prho = 0;
+}
+
+void CDataDrivenFluid::PrefetchTDState_Prho(unsigned long n_states, const su2double* P, const su2double* rho) {
+  ResizePrefetch(n_states);
+  if (prefetch_P.size() < n_states) {
+    prefetch_P.resize(n_states);
+    prefetch_rho_P.resize(n_states);
+    prefetch_energy.resize(n_states);
+    prefetch_iter.resize(n_states);
+    newton_states.resize(n_states);
+    newton_rho.resize(n_states);
+    newton_e.resize(n_states);
+    newton_outputs.resize(n_states, outputs_rhoe.size());
+    newton_exit_codes.resize(n_states);
+  }
+
+  /*--- Same initial guess as SetEnergy_Prho (ideal gas law). ---*/
+  for (auto iState = 0ul; iState < n_states; iState++) {
+    prefetch_P[iState] = P[iState];
+    prefetch_rho_P[iState] = rho[iState];
+    const su2double e_idealgas = Cv_idealgas * (P[iState] / (R_idealgas * rho[iState]));
+    prefetch_energy[iState] = min(e_max, max(e_idealgas, e_min));
+    newton_states[iState] = iState;
+  }
+
+  /*--- Evaluate the data set at the current (rho, e) of the states that have not converged, the outputs are
+   * stored as the prefetched (rho, e) state of the same index. ---*/
+  auto EvaluateStates = [&](unsigned long n_active) {
+    for (auto k = 0ul; k < n_active; k++) {
+      const auto iState = newton_states[k];
+      newton_rho[k] = min(rho_max, max(rho_min, rho[iState]));
+      newton_e[k] = min(e_max, max(e_min, prefetch_energy[iState]));
+    }
+    Predict_Batch(n_active, newton_rho.data(), newton_e.data(), newton_outputs.data(), newton_exit_codes.data());
+
+    for (auto k = 0ul; k < n_active; k++) {
+      const auto iState = newton_states[k];
+      prefetch_rho[iState] = newton_rho[k];
+      prefetch_e[iState] = newton_e[k];
+      for (auto iOutput = 0u; iOutput < outputs_rhoe.size(); iOutput++) {
+        prefetch_outputs(iState, iOutput) = newton_outputs(k, iOutput);
+      }
+      prefetch_exit_codes[iState] = newton_exit_codes[k];
+    }
+  };
+
+  /*--- Columns of the entropy derivatives in the outputs. ---*/
+  auto Column = [&](const su2double* output) {
+    return find(outputs_rhoe.begin(), outputs_rhoe.end(), output) - outputs_rhoe.begin();
+  };
+  const auto idx_dsde_rho = Column(&dsde_rho), idx_dsdrho_e = Column(&dsdrho_e);
+  const auto idx_d2sde2 = Column(&d2sde2), idx_d2sdedrho = Column(&d2sdedrho);
+
+  /*--- 1D Newton solver of SetEnergy_Prho for all the states together, the converged states are removed from the
+   * list of active states. ---*/
+  unsigned long n_active = n_states;
+
+  for (auto Iter = 0ul; (Iter < MaxIter_Newton) && (n_active > 0); Iter++) {
+    EvaluateStates(n_active);
+
+    unsigned long n_next = 0;
+    for (auto k = 0ul; k < n_active; k++) {
+      const auto iState = newton_states[k];
+
+      /*--- Pressure and its derivative w.r.t. energy, as in SetTDState_rhoe. ---*/
+      const su2double ds_de = newton_outputs(k, idx_dsde_rho), ds_drho = newton_outputs(k, idx_dsdrho_e);
+      const su2double d2s_de2 = newton_outputs(k, idx_d2sde2), d2s_dedrho = newton_outputs(k, idx_d2sdedrho);
+      const su2double T = 1.0 / ds_de;
+      const su2double P_state = -pow(rho[iState], 2) * T * ds_drho;
+      const su2double dT_de = -pow(ds_de, -2) * d2s_de2;
+      const su2double dP_de = -pow(rho[iState], 2) * (dT_de * ds_drho + T * d2s_dedrho);
+
+      prefetch_iter[iState] = Iter + 1;
+
+      const su2double delta_P = P[iState] - P_state;
+      if (abs(delta_P / P_state) < Newton_Tolerance) continue;
+
+      prefetch_energy[iState] += Newton_Relaxation * (delta_P / dP_de);
+      newton_states[n_next++] = iState;
+    }
+    n_active = n_next;
+  }
+
+  /*--- States that did not converge are evaluated at their last energy, as in SetEnergy_Prho. ---*/
+  if (n_active > 0) EvaluateStates(n_active);
+
+  n_prefetch = n_states;
+  i_prefetch = 0;
+  n_prefetch_Prho = n_states;
+  i_prefetch_Prho = 0;
+}
+
 void CDataDrivenFluid::Run_Newton_Solver(su2double Y1_target, su2double Y2_target, su2double* Y1, su2double* Y2,
                                          su2double* dY1drho, su2double* dY1de, su2double* dY2drho, su2double* dY2de) {
   /*--- 2D Newton solver, computing the density and internal energy values corresponding to Y1_target and Y2_target.
@@ -73,7 +73,7 @@ CFluidFlamelet::CFluidFlamelet(CConfig* config, su2double value_pressure_operati
         cout << "*****************************************" << endl;
       }
       look_up_table = new CLookUpTable(config->GetDataDriven_FileNames()[0], table_scalar_names[I_PROGVAR],
-                                       table_scalar_names[I_ENTH]);
+                                       table_scalar_names[I_ENTH], config->GetKind_LUT_Search_Map());
       break;
     default:
       if (rank == MASTER_NODE) {
@@ -187,6 +187,13 @@ void CFluidFlamelet::PreprocessLookUp(CConfig* config) {
   val_vars_LookUp.resize(n_lookups);
   for (auto iLookup = 0u; iLookup < n_lookups; iLookup++) varnames_LookUp[iLookup] = config->GetLookupName(iLookup);
 
+  /*--- Resolve the table columns once, the look-ups then work with indices. ---*/
+  if (Kind_DataDriven_Method == ENUM_DATADRIVEN_METHOD::LUT) {
+    idx_vars_TD = look_up_table->GetIndexOfVars(varnames_TD);
+    idx_vars_Sources = look_up_table->GetIndexOfVars(varnames_Sources);
+    idx_vars_LookUp = look_up_table->GetIndexOfVars(varnames_LookUp);
+  }
+
   if (Kind_DataDriven_Method == ENUM_DATADRIVEN_METHOD::MLP) {
 #ifdef USE_MLPCPP
     iomap_TD = new MLPToolbox::CIOMap(controlling_variable_names, varnames_TD);
@@ -199,47 +206,57 @@ void CFluidFlamelet::PreprocessLookUp(CConfig* config) {
   }
 }
 
+void CFluidFlamelet::GetLookUpVariables(unsigned short lookup_type, const vector<string>*& varnames,
+                                        const vector<unsigned long>*& idx_vars) const {
+  switch (lookup_type) {
+    case FLAMELET_LOOKUP_OPS::TD:
+      varnames = &varnames_TD;
+      idx_vars = &idx_vars_TD;
+      break;
+    case FLAMELET_LOOKUP_OPS::SOURCES:
+      varnames = &varnames_Sources;
+      idx_vars = &idx_vars_Sources;
+      break;
+    case FLAMELET_LOOKUP_OPS::LOOKUP:
+      varnames = &varnames_LookUp;
+      idx_vars = &idx_vars_LookUp;
+      break;
+    default:
+      SU2_MPI::Error(string("Unknown manifold lookup operation."), CURRENT_FUNCTION);
+      break;
+  }
+}
+
 unsigned long CFluidFlamelet::EvaluateDataSet(const vector<su2double>& input_scalar, unsigned short lookup_type,
                                               vector<su2double>& output_refs) {
-  su2double val_enth = input_scalar[I_ENTH];
-  su2double val_prog = input_scalar[I_PROGVAR];
-  su2double val_mixfrac = include_mixture_fraction ? input_scalar[I_MIXFRAC] : 0.0;
-  vector<string> varnames;
-  vector<su2double> val_vars;
-  vector<su2double*> refs_vars;
+  const vector<string>* varnames = nullptr;
+  const vector<unsigned long>* idx_vars = nullptr;
+  GetLookUpVariables(lookup_type, varnames, idx_vars);
+
+#ifdef USE_MLPCPP
   switch (lookup_type) {
     case FLAMELET_LOOKUP_OPS::TD:
-      varnames = varnames_TD;
-#ifdef USE_MLPCPP
       iomap_Current = iomap_TD;
-#endif
       break;
     case FLAMELET_LOOKUP_OPS::SOURCES:
-      varnames = varnames_Sources;
-#ifdef USE_MLPCPP
       iomap_Current = iomap_Sources;
-#endif
       break;
     case FLAMELET_LOOKUP_OPS::LOOKUP:
-      varnames = varnames_LookUp;
-#ifdef USE_MLPCPP
       iomap_Current = iomap_LookUp;
-#endif
       break;
     default:
       break;
   }
-  if (output_refs.size() != varnames.size())
+#endif
+  if (output_refs.size() != varnames->size())
     SU2_MPI::Error(string("Output vector size incompatible with manifold lookup operation."), CURRENT_FUNCTION);
 
-  /*--- Add all quantities and their names to the look up vectors. ---*/
+  vector<su2double*> refs_vars;
   switch (Kind_DataDriven_Method) {
     case ENUM_DATADRIVEN_METHOD::LUT:
-      if (include_mixture_fraction) {
-        extrapolation = look_up_table->LookUp_XYZ(varnames, output_refs, val_prog, val_enth, val_mixfrac);
-      } else {
-        extrapolation = look_up_table->LookUp_XY(varnames, output_refs, val_prog, val_enth);
-      }
+      extrapolation = look_up_table->LookUp_Batch(
+          *idx_vars, 1, &input_scalar[I_PROGVAR], &input_scalar[I_ENTH],
+          include_mixture_fraction ? &input_scalar[I_MIXFRAC] : nullptr, n_scalars, output_refs.data());
       break;
     case ENUM_DATADRIVEN_METHOD::MLP:
       refs_vars.resize(output_refs.size());
@@ -254,3 +271,33 @@ unsigned long CFluidFlamelet::EvaluateDataSet(const vector<su2double>& input_sca
 
   return extrapolation;
 }
+
+unsigned long CFluidFlamelet::EvaluateDataSetBatch(unsigned long n_points, const su2double* input_scalars,
+                                                   unsigned long stride, unsigned short lookup_type,
+                                                   su2double* output_refs, unsigned short* misses) {
+  const vector<string>* varnames = nullptr;
+  const vector<unsigned long>* idx_vars = nullptr;
+  GetLookUpVariables(lookup_type, varnames, idx_vars);
+
+  unsigned long n_misses = 0;
+
+  if (Kind_DataDriven_Method == ENUM_DATADRIVEN_METHOD::LUT) {
+    const su2double* val_mixfrac = include_mixture_fraction ? input_scalars + I_MIXFRAC : nullptr;
+    n_misses = look_up_table->LookUp_Batch(*idx_vars, n_points, input_scalars + I_PROGVAR, input_scalars + I_ENTH,
+                                           val_mixfrac, stride, output_refs, misses);
+  } else {
+    /*--- Other methods evaluate the points one at a time. ---*/
+    const auto n_outputs = varnames->size();
+    vector<su2double> input(n_scalars), output(n_outputs);
+
+    for (auto iPoint = 0ul; iPoint < n_points; iPoint++) {
+      for (auto iVar = 0u; iVar < n_scalars; iVar++) input[iVar] = input_scalars[iPoint * stride + iVar];
+      const auto miss = EvaluateDataSet(input, lookup_type, output);
+      for (auto iVar = 0ul; iVar < n_outputs; iVar++) output_refs[iPoint * n_outputs + iVar] = output[iVar];
+      if (misses) misses[iPoint] = miss;
+      n_misses += miss;
+    }
+  }
+  extrapolation = (n_misses > 0);
+  return n_misses;
+}
@@ -1158,6 +1158,26 @@ CSU2TCLib::CSU2TCLib(const CConfig* config, unsigned short val_nDim, bool viscou
 
   if (ionization) { nHeavy = nSpecies-1; nEl = 1; }
   else            { nHeavy = nSpecies;   nEl = 0; }
+
+  /*--- The equilibrium constant tables and the reaction orders do not depend on the state,
+   *    build them once instead of at every evaluation of the production rates. ---*/
+  RxnConstantTables.resize(nReactions);
+  ReactantOrder.resize(nReactions,nSpecies) = 0;
+  ProductOrder.resize(nReactions,nSpecies) = 0;
+
+  for (unsigned short iReaction = 0; iReaction < nReactions; iReaction++) {
+    GetChemistryEquilConstants(iReaction);
+    RxnConstantTables[iReaction] = RxnConstantTable;
+
+    for (unsigned short ii = 0; ii < 3; ii++) {
+      if (Reactions(iReaction,0,ii) != nSpecies) ReactantOrder(iReaction, Reactions(iReaction,0,ii))++;
+      if (Reactions(iReaction,1,ii) != nSpecies) ProductOrder(iReaction, Reactions(iReaction,1,ii))++;
+    }
+  }
+  Conc.resize(nSpecies,0.0);
+
+  /*--- The T-R specific heats are constant, ComputeTemperatures relies on them being set. ---*/
+  GetSpeciesCvTraRot();
 }
 
 CSU2TCLib::~CSU2TCLib()= default;
@@ -1334,6 +1354,57 @@ vector<su2double>& CSU2TCLib::ComputeSpeciesEve(su2double val_T, bool vibe_only)
   return eves;
 }
 
+void CSU2TCLib::ComputeSpeciesEveCvve(su2double val_T){
+
+  su2double Ev, Eel, Cvvs, Cves, thoTve, exptv, num, num2, num3, denom;
+  unsigned short iElectron = 0;
+
+  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++){
+
+    const su2double Rs = Ru/MolarMass[iSpecies];
+
+    /*--- Electron species ---*/
+    if (ionization && (iSpecies == iElectron)) {
+      const su2double Ef = Enthalpy_Formation[iSpecies] - Rs * Ref_Temperature[iSpecies];
+      eves[iSpecies]  = (3.0/2.0) * Rs * (val_T - Ref_Temperature[iSpecies]) + Ef;
+      Cvves[iSpecies] = (3.0/2.0) * Rs;
+      continue;
+    }
+
+    /*--- Vibrational mode (harmonic-oscillator model), one exponential for energy and specific heat ---*/
+    Ev = Cvvs = 0.0;
+    if (CharVibTemp[iSpecies] != 0.0) {
+      thoTve = CharVibTemp[iSpecies]/val_T;
+      exptv  = exp(thoTve);
+      Ev   = Rs * CharVibTemp[iSpecies] / (exptv-1.0);
+      Cvvs = Rs * thoTve*thoTve * exptv / ((exptv-1.0)*(exptv-1.0));
+    }
+
+    /*--- Electronic mode, one exponential per electronic state ---*/
+    Eel = Cves = 0.0;
+    if (nElStates[iSpecies] != 0) {
+      exptv = exp(-CharElTemp(iSpecies,0)/val_T);
+      num = 0.0; num2 = 0.0;
+      denom = ElDegeneracy(iSpecies,0) * exptv;
+      num3  = ElDegeneracy(iSpecies,0) * (CharElTemp(iSpecies,0)/(val_T*val_T)) * exptv;
+      for (iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
+        thoTve = CharElTemp(iSpecies,iEl)/val_T;
+        exptv  = exp(-thoTve);
+
+        num   += ElDegeneracy(iSpecies,iEl) * CharElTemp(iSpecies,iEl) * exptv;
+        denom += ElDegeneracy(iSpecies,iEl) * exptv;
+        num2  += ElDegeneracy(iSpecies,iEl) * (thoTve*thoTve) * exptv;
+        num3  += ElDegeneracy(iSpecies,iEl) * thoTve/val_T * exptv;
+      }
+      Eel  = Rs * (num/denom);
+      Cves = Rs * (num2/denom - num*num3/(denom*denom));
+    }
+
+    eves[iSpecies]  = Ev + Eel;
+    Cvves[iSpecies] = Cvvs + Cves;
+  }
+}
+
 vector<su2double>& CSU2TCLib::ComputeNetProductionRates(bool implicit, const su2double *V, const su2double* eve,
                                                         const su2double* cvve, const su2double* dTdU, const su2double* dTvedU,
                                                         su2double **val_jacobian){
@@ -1358,6 +1429,14 @@ vector<su2double>& CSU2TCLib::ComputeNetProductionRates(bool implicit, const su2
   /*--- Define preferential dissociation coefficient ---*/
   //alpha = 0.3; //TODO: make this a config option?
 
+  /*--- Quantities common to all reactions. ---*/
+  SetKeqInterpolation();
+
+  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+    Conc[iSpecies] = 0.001*rhos[iSpecies]/MolarMass[iSpecies];
+
+  const su2double logT = log(T), logTve = log(Tve);
+
   /*--- Loop over all reactions ---*/
   for (iReaction = 0; iReaction < nReactions; iReaction++) {
 
@@ -1366,8 +1445,8 @@ vector<su2double>& CSU2TCLib::ComputeNetProductionRates(bool implicit, const su2
     bf = Tcf_b[iReaction];
     ab = Tcb_a[iReaction];
     bb = Tcb_b[iReaction];
-    Trxnf = pow(T, af)*pow(Tve, bf);
-    Trxnb = pow(T, ab)*pow(Tve, bb);
+    Trxnf = exp(af*logT + bf*logTve);
+    Trxnb = exp(ab*logT + bb*logTve);
 
     /*--- Calculate the modified temperature ---*/
     Thf = 0.5 * (Trxnf+T_min + sqrt((Trxnf-T_min)*(Trxnf-T_min)+epsilon*epsilon));
@@ -1377,12 +1456,12 @@ vector<su2double>& CSU2TCLib::ComputeNetProductionRates(bool implicit, const su2
     ComputeKeqConstants(iReaction);
 
     /*--- Calculate Keq ---*/
-    const su2double Keq = exp(  A[0]*(Thb/1E4) + A[1] + A[2]*log(1E4/Thb)
-        + A[3]*(1E4/Thb) + A[4]*(1E4/Thb)*(1E4/Thb) );
+    const su2double Z = 1E4/Thb;
+    const su2double Keq = exp( A[0]/Z + A[1] + A[2]*log(Z) + A[3]*Z + A[4]*Z*Z );
 
     /*--- Calculate rate coefficients ---*/
-    kf  = ArrheniusCoefficient[iReaction] * exp(ArrheniusEta[iReaction]*log(Thf)) * exp(-ArrheniusTheta[iReaction]/Thf);
-    kfb = ArrheniusCoefficient[iReaction] * exp(ArrheniusEta[iReaction]*log(Thb)) * exp(-ArrheniusTheta[iReaction]/Thb);
+    kf  = ArrheniusCoefficient[iReaction] * exp(ArrheniusEta[iReaction]*log(Thf) - ArrheniusTheta[iReaction]/Thf);
+    kfb = ArrheniusCoefficient[iReaction] * exp(ArrheniusEta[iReaction]*log(Thb) - ArrheniusTheta[iReaction]/Thb);
     kb  = kfb / Keq;
 
     /*--- Determine production & destruction of each species ---*/
@@ -1393,12 +1472,12 @@ vector<su2double>& CSU2TCLib::ComputeNetProductionRates(bool implicit, const su2
       /*--- Reactants ---*/
       iSpecies = Reactions(iReaction,0,ii);
       if ( iSpecies != nSpecies)
-        fwdRxn *= 0.001*rhos[iSpecies]/MolarMass[iSpecies];
+        fwdRxn *= Conc[iSpecies];
 
       /*--- Products ---*/
       jSpecies = Reactions(iReaction,1,ii);
       if (jSpecies != nSpecies) {
-        bkwRxn *= 0.001*rhos[jSpecies]/MolarMass[jSpecies];
+        bkwRxn *= Conc[jSpecies];
       }
     }
 
@@ -1441,16 +1520,18 @@ void CSU2TCLib::ChemistryJacobian(unsigned short iReaction, const su2double *V,
   /*--- Initializing derivative variables ---*/
   dkf.resize(nVar,0.0);      dkb.resize(nVar,0.0);
   dRfok.resize(nVar,0.0);    dRbok.resize(nVar,0.0);
-  alphak.resize(nSpecies,0); betak.resize(nSpecies,0);
 
   for (iVar=0;iVar<nVar;iVar++){
    dkf[iVar]=0.0; dRfok[iVar]=0.0;
    dkb[iVar]=0.0; dRbok[iVar]=0.0;
   }
 
-  for (iSpecies=0;iSpecies<nSpecies;iSpecies++){
-   alphak[iSpecies]=0; betak[iSpecies]=0;
-  }
+  /*--- The reaction orders are small integers, avoid pow. ---*/
+  auto intPow = [](su2double x, int n) {
+    su2double res = 1.0;
+    for (int i = 0; i < n; i++) res *= x;
+    return res;
+  };
 
   /*--- Extract additional Arrhenius information ---*/
   su2double eta   = ArrheniusEta[iReaction];
@@ -1479,41 +1560,27 @@ void CSU2TCLib::ChemistryJacobian(unsigned short iReaction, const su2double *V,
   }
 
   /*--- Rxn rate derivatives ---*/
-  for (ii = 0; ii < 3; ii++) {
-
-    /*--- Products ---*/
-    iSpecies = Reactions(iReaction,1,ii);
-    if (iSpecies != nSpecies)
-      betak[iSpecies]++;
-
-    /*--- Reactants ---*/
-    iSpecies = Reactions(iReaction,0,ii);
-    if (iSpecies != nSpecies)
-      alphak[iSpecies]++;
-  }
+  const int* alphak = ReactantOrder[iReaction];
+  const int* betak = ProductOrder[iReaction];
 
   for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
 
     // Fwd
     dRfok[iSpecies] =  0.001*alphak[iSpecies]/MolarMass[iSpecies] *
-                       pow(0.001*rhos[iSpecies]/MolarMass[iSpecies],
-                       max(0, alphak[iSpecies]-1));
+                       intPow(Conc[iSpecies], max(0, alphak[iSpecies]-1));
 
     for (jSpecies = 0; jSpecies < nSpecies; jSpecies++)
       if (jSpecies != iSpecies)
-        dRfok[iSpecies] *= pow(0.001*rhos[jSpecies]/MolarMass[jSpecies],
-                                                       alphak[jSpecies]);
+        dRfok[iSpecies] *= intPow(Conc[jSpecies], alphak[jSpecies]);
     dRfok[iSpecies] *= 1000.0;
 
     // Bkw
     dRbok[iSpecies] =  0.001*betak[iSpecies]/MolarMass[iSpecies] *
-                       pow(0.001*rhos[iSpecies]/MolarMass[iSpecies],
-                       max(0, betak[iSpecies]-1));
+                       intPow(Conc[iSpecies], max(0, betak[iSpecies]-1));
 
     for (jSpecies = 0; jSpecies < nSpecies; jSpecies++)
       if (jSpecies != iSpecies)
-        dRbok[iSpecies] *= pow(0.001*rhos[jSpecies]/MolarMass[jSpecies],
-                                                        betak[jSpecies]);
+        dRbok[iSpecies] *= intPow(Conc[jSpecies], betak[jSpecies]);
     dRbok[iSpecies] *= 1000.0;
   }
 
@@ -1555,13 +1622,10 @@ void CSU2TCLib::ChemistryJacobian(unsigned short iReaction, const su2double *V,
   } // ii
 }
 
-void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
+void CSU2TCLib::SetKeqInterpolation() {
 
   unsigned short ii;
 
-  /*--- Acquire database constants from CConfig ---*/
-  GetChemistryEquilConstants(val_Reaction);
-
   /*--- Calculate mixture number density ---*/
   su2double N = 0.0;
   for (iSpecies =0 ; iSpecies < nSpecies; iSpecies++) {
@@ -1577,13 +1641,12 @@ void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
 
   /*--- Bound the interpolation to table limit values ---*/
   unsigned short iIndex = int(pwr) - tbl_offset;
+  KeqWeight = 0.0;
   if (iIndex <= 0) {
-    for (ii = 0; ii < 5; ii++)
-      A[ii] = RxnConstantTable(0,ii);
+    KeqIndex = 0;
     return;
   } if (iIndex >= 5) {
-    for (ii = 0; ii < 5; ii++)
-      A[ii] = RxnConstantTable(5,ii);
+    KeqIndex = 5;
     return;
   }
 
@@ -1596,11 +1659,18 @@ void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
   }
   tmp2 *= 10.0;
 
-  /*--- Interpolate ---*/
-  for (ii = 0; ii < 5; ii++) {
-    A[ii] =  (RxnConstantTable(iIndex+1,ii) - RxnConstantTable(iIndex,ii))
-        / (tmp2 - tmp1) * (N - tmp1)
-        + RxnConstantTable(iIndex,ii);
+  KeqIndex = iIndex;
+  KeqWeight = (N - tmp1) / (tmp2 - tmp1);
+}
+
+void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
+
+  /*--- Interpolate the tables of the reaction at the number density of the state ---*/
+  const auto& table = RxnConstantTables[val_Reaction];
+  const unsigned short iIndex = KeqIndex, jIndex = min(KeqIndex+1, 5);
+
+  for (unsigned short ii = 0; ii < 5; ii++) {
+    A[ii] = KeqWeight * (table(jIndex,ii) - table(iIndex,ii)) + table(iIndex,ii);
   }
 }
 
@@ -2150,12 +2220,11 @@ vector<su2double>& CSU2TCLib::ComputeTemperatures(vector<su2double>& val_rhos, s
   /*--- Newton-Raphson Method --*/
   for (unsigned short iIter = 0; iIter < maxNIter; iIter++) {
     rhoEve_t = rhoCvve = 0.0;
-    const auto& val_eves  = ComputeSpeciesEve(Tve);
-    const auto& val_cvves = ComputeSpeciesCvVibEle(Tve);
+    ComputeSpeciesEveCvve(Tve);
 
     for (iSpecies = 0; iSpecies < nSpecies; iSpecies++){
-      rhoEve_t += rhos[iSpecies] * val_eves[iSpecies];
-      rhoCvve += rhos[iSpecies] * val_cvves[iSpecies];
+      rhoEve_t += rhos[iSpecies] * eves[iSpecies];
+      rhoCvve += rhos[iSpecies] * Cvves[iSpecies];
     }
 
     /*--- Find the roots ---*/
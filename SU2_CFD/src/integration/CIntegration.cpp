@@ -27,6 +27,7 @@
 
 #include "../../include/integration/CIntegration.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 
 
 CIntegration::CIntegration() {
@@ -40,6 +41,7 @@ void CIntegration::Space_Integration(CGeometry *geometry,
                                      CConfig *config, unsigned short iMesh,
                                      unsigned short iRKStep,
                                      unsigned short RunTime_EqSystem) {
+  SU2_PROFILE_SCOPE("SpaceIntegration");
   unsigned short iMarker, KindBC;
 
   unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
@@ -77,6 +79,10 @@ void CIntegration::Space_Integration(CGeometry *geometry,
   /// TODO: Check if this is really needed.
   //const auto pausePreacc = (omp_get_num_threads() > 1) && AD::PausePreaccumulation();
 
+  /*--- The remainder of the function applies boundary conditions. ---*/
+
+  SU2_PROFILE_SCOPE("BoundaryConditions");
+
   /*--- Boundary conditions that depend on other boundaries (they require MPI sincronization)---*/
 
   solver_container[MainSolver]->BC_Fluid_Interface(geometry, solver_container, conv_bound_numerics, visc_bound_numerics, config);
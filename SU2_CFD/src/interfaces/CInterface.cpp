@@ -68,6 +68,9 @@ void CInterface::BroadcastData(const CInterpolator& interpolator,
   GetPhysical_Constants(donor_solution, target_solution, donor_geometry, target_geometry,
                         donor_config, target_config);
 
+  const bool sparse = donor_config->GetSparseInterfaceTransfer();
+  if (sparse) sparsePatterns.resize(donor_config->GetMarker_n_ZoneInterface()/2);
+
   /*--- Loop over interface markers. ---*/
 
   for (auto iMarkerInt = 0u; iMarkerInt < donor_config->GetMarker_n_ZoneInterface()/2; iMarkerInt++) {
@@ -79,84 +82,112 @@ void CInterface::BroadcastData(const CInterpolator& interpolator,
 
     if(!CInterpolator::CheckInterfaceBoundary(markDonor, markTarget)) continue;
 
-    /*--- Count donor vertices on this rank. ---*/
+    CSparsePattern* pattern = nullptr;
+    vector<unsigned long> donorIdx;
+    su2activematrix donorVar;
 
-    int nLocalVertexDonor = 0;
-    if (markDonor >= 0) {
-      for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
-        auto Point_Donor = donor_geometry->vertex[markDonor][iVertex]->GetNode();
-        /*--- Only domain points are donors. ---*/
-        nLocalVertexDonor += donor_geometry->nodes->GetDomain(Point_Donor);
-      }
-    }
+    if (sparse) {
+
+      /*--- The pattern is only (re)built when the interpolation changed on some rank. ---*/
+
+      pattern = &sparsePatterns[iMarkerInt];
+
+      int localChange = SparsePatternChanged(interpolator, target_geometry, markTarget, *pattern);
+      int anyChange = 0;
+      SU2_MPI::Allreduce(&localChange, &anyChange, 1, MPI_INT, MPI_MAX, SU2_MPI::GetComm());
 
-    /*--- Gather donor counts and compute total sizes, and displacements (cumulative
-     * sums) to perform an Allgatherv of donor indices and variables. ---*/
+      if (anyChange) SetSparsePattern(interpolator, donor_geometry, target_geometry, markDonor, markTarget, *pattern);
 
-    vector<int> nAllVertexDonor(size), nAllVarCounts(size), displIdx(size,0), displVar(size);
-    SU2_MPI::Allgather(&nLocalVertexDonor, 1, MPI_INT, nAllVertexDonor.data(), 1, MPI_INT, SU2_MPI::GetComm());
+      /*--- Exchange the donor values with the ranks that need them. ---*/
 
-    for (int i = 0; i < size; ++i) {
-      nAllVarCounts[i] = nAllVertexDonor[i] * nVar;
-      if(i) displIdx[i] = displIdx[i-1] + nAllVertexDonor[i-1];
-      displVar[i] = displIdx[i] * nVar;
+      SparseDataExchange(donor_solution, donor_geometry, donor_config, markDonor, *pattern);
+
+      /*--- This rank does not need to do more work. ---*/
+      if (markTarget < 0) continue;
     }
+    else {
+
+      /*--- Count donor vertices on this rank. ---*/
+
+      int nLocalVertexDonor = 0;
+      if (markDonor >= 0) {
+        for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
+          auto Point_Donor = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+          /*--- Only domain points are donors. ---*/
+          nLocalVertexDonor += donor_geometry->nodes->GetDomain(Point_Donor);
+        }
+      }
 
-    /*--- Fill send buffers. ---*/
+      /*--- Gather donor counts and compute total sizes, and displacements (cumulative
+       * sums) to perform an Allgatherv of donor indices and variables. ---*/
 
-    vector<unsigned long> sendDonorIdx(nLocalVertexDonor);
-    su2activematrix sendDonorVar(nLocalVertexDonor, nVar);
+      vector<int> nAllVertexDonor(size), nAllVarCounts(size), displIdx(size,0), displVar(size);
+      SU2_MPI::Allgather(&nLocalVertexDonor, 1, MPI_INT, nAllVertexDonor.data(), 1, MPI_INT, SU2_MPI::GetComm());
 
-    if (markDonor >= 0) {
-      for (auto iVertex = 0ul, iSend = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
-        const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+      for (int i = 0; i < size; ++i) {
+        nAllVarCounts[i] = nAllVertexDonor[i] * nVar;
+        if(i) displIdx[i] = displIdx[i-1] + nAllVertexDonor[i-1];
+        displVar[i] = displIdx[i] * nVar;
+      }
+
+      /*--- Fill send buffers. ---*/
+
+      vector<unsigned long> sendDonorIdx(nLocalVertexDonor);
+      su2activematrix sendDonorVar(nLocalVertexDonor, nVar);
 
-        /*--- If this processor owns the node. ---*/
-        if (donor_geometry->nodes->GetDomain(iPoint)) {
+      if (markDonor >= 0) {
+        for (auto iVertex = 0ul, iSend = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
+          const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
 
-          GetDonor_Variable(donor_solution, donor_geometry, donor_config, markDonor, iVertex, iPoint);
-          for (auto iVar = 0u; iVar < nVar; iVar++) sendDonorVar(iSend, iVar) = Donor_Variable[iVar];
+          /*--- If this processor owns the node. ---*/
+          if (donor_geometry->nodes->GetDomain(iPoint)) {
 
-          sendDonorIdx[iSend] = donor_geometry->nodes->GetGlobalIndex(iPoint);
-          ++iSend;
+            GetDonor_Variable(donor_solution, donor_geometry, donor_config, markDonor, iVertex, iPoint);
+            for (auto iVar = 0u; iVar < nVar; iVar++) sendDonorVar(iSend, iVar) = Donor_Variable[iVar];
+
+            sendDonorIdx[iSend] = donor_geometry->nodes->GetGlobalIndex(iPoint);
+            ++iSend;
+          }
         }
       }
-    }
 
-    /*--- Gather data. ---*/
+      /*--- Gather data. ---*/
 
-    const auto nGlobalVertexDonor = displIdx.back() + nAllVertexDonor.back();
+      const auto nGlobalVertexDonor = displIdx.back() + nAllVertexDonor.back();
 
-    vector<unsigned long> donorIdx(nGlobalVertexDonor);
-    su2activematrix donorVar(nGlobalVertexDonor, nVar);
+      donorIdx.resize(nGlobalVertexDonor);
+      donorVar.resize(nGlobalVertexDonor, nVar);
 
-    SU2_MPI::Allgatherv(sendDonorIdx.data(), sendDonorIdx.size(), MPI_UNSIGNED_LONG, donorIdx.data(),
-                        nAllVertexDonor.data(), displIdx.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+      SU2_MPI::Allgatherv(sendDonorIdx.data(), sendDonorIdx.size(), MPI_UNSIGNED_LONG, donorIdx.data(),
+                          nAllVertexDonor.data(), displIdx.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
 
-    SU2_MPI::Allgatherv(sendDonorVar.data(), sendDonorVar.size(), MPI_DOUBLE, donorVar.data(),
-                        nAllVarCounts.data(), displVar.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+      SU2_MPI::Allgatherv(sendDonorVar.data(), sendDonorVar.size(), MPI_DOUBLE, donorVar.data(),
+                          nAllVarCounts.data(), displVar.data(), MPI_DOUBLE, SU2_MPI::GetComm());
 
-    /*--- This rank does not need to do more work. ---*/
-    if (markTarget < 0) continue;
+      /*--- This rank does not need to do more work. ---*/
+      if (markTarget < 0) continue;
 
-    /*--- Sort the donor information by index to then use binary searches. ---*/
+      /*--- Sort the donor information by index to then use binary searches. ---*/
 
-    vector<size_t> order(donorIdx.size());
-    iota(order.begin(), order.end(), 0ul);
-    sort(order.begin(), order.end(), [&donorIdx](size_t i, size_t j) {return donorIdx[i] < donorIdx[j];} );
+      vector<size_t> order(donorIdx.size());
+      iota(order.begin(), order.end(), 0ul);
+      sort(order.begin(), order.end(), [&donorIdx](size_t i, size_t j) {return donorIdx[i] < donorIdx[j];} );
 
-    /*--- inplace permutation. ---*/
-    for (size_t i = 0; i < order.size(); ++i) {
-      auto j = order[i];
-      while (j < i) j = order[j];
-      if (i == j) continue;
-      swap(donorIdx[i], donorIdx[j]);
-      for (auto iVar = 0u; iVar < nVar; ++iVar)
-        swap(donorVar(i,iVar), donorVar(j,iVar));
+      /*--- inplace permutation. ---*/
+      for (size_t i = 0; i < order.size(); ++i) {
+        auto j = order[i];
+        while (j < i) j = order[j];
+        if (i == j) continue;
+        swap(donorIdx[i], donorIdx[j]);
+        for (auto iVar = 0u; iVar < nVar; ++iVar)
+          swap(donorVar(i,iVar), donorVar(j,iVar));
+      }
     }
 
     /*--- Loop over target vertices. ---*/
 
+    unsigned long iDonorLocal = 0;
+
     for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
       const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
 
@@ -175,13 +206,20 @@ void CInterface::BroadcastData(const CInterpolator& interpolator,
         const auto donorGlobalIndex = targetVertex.globalPoint[iDonorPoint];
         const auto donorCoeff = targetVertex.coefficient[iDonorPoint];
 
-        /*--- Find the index of the global donor point in the donor data. ---*/
+        /*--- Find the donor data, the sparse pattern stores its location, otherwise
+         * search the index of the global donor point in the gathered data. ---*/
 
-        const auto idx = lower_bound(donorIdx.begin(), donorIdx.end(), donorGlobalIndex) - donorIdx.begin();
-        assert(idx < static_cast<long>(donorIdx.size()));
+        const su2double* donorValues = nullptr;
+        if (sparse) {
+          donorValues = pattern->recvBuffer[pattern->donorBufferIdx[iDonorLocal++]];
+        } else {
+          const auto idx = lower_bound(donorIdx.begin(), donorIdx.end(), donorGlobalIndex) - donorIdx.begin();
+          assert(idx < static_cast<long>(donorIdx.size()));
+          donorValues = donorVar[idx];
+        }
 
         /*--- Recover the Target_Variable from the buffer of variables. ---*/
-        RecoverTarget_Variable(donorVar[idx], donorCoeff);
+        RecoverTarget_Variable(donorValues, donorCoeff);
 
         /*--- If the value is not directly aggregated in the previous function. ---*/
         if (!valAggregated)
@@ -195,6 +233,192 @@ void CInterface::BroadcastData(const CInterpolator& interpolator,
   }
 }
 
+bool CInterface::SparsePatternChanged(const CInterpolator& interpolator, const CGeometry *target_geometry,
+                                      int markTarget, const CSparsePattern& pattern) const {
+  if (!pattern.valid) return true;
+  if (markTarget < 0) return !pattern.donorGlobalIdx.empty();
+
+  /*--- Compare the donors of the local target vertices with those used to build the pattern. ---*/
+
+  unsigned long iDonorLocal = 0;
+  for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
+    const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+    if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+
+    const auto& targetVertex = interpolator.targetVertices[markTarget][iVertex];
+    for (auto iDonorPoint = 0ul; iDonorPoint < targetVertex.nDonor(); iDonorPoint++, iDonorLocal++) {
+      if (iDonorLocal >= pattern.donorGlobalIdx.size() ||
+          pattern.donorGlobalIdx[iDonorLocal] != targetVertex.globalPoint[iDonorPoint]) return true;
+    }
+  }
+  return iDonorLocal != pattern.donorGlobalIdx.size();
+}
+
+void CInterface::SetSparsePattern(const CInterpolator& interpolator, const CGeometry *donor_geometry,
+                                  const CGeometry *target_geometry, int markDonor, int markTarget,
+                                  CSparsePattern& pattern) const {
+
+  /*--- Global indices of the donors of the local target vertices, grouped by the rank that owns them. ---*/
+
+  vector<vector<unsigned long> > requests(size);
+  pattern.donorGlobalIdx.clear();
+
+  if (markTarget >= 0) {
+    for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
+      const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+
+      const auto& targetVertex = interpolator.targetVertices[markTarget][iVertex];
+      for (auto iDonorPoint = 0ul; iDonorPoint < targetVertex.nDonor(); iDonorPoint++) {
+        requests[targetVertex.processor[iDonorPoint]].push_back(targetVertex.globalPoint[iDonorPoint]);
+        pattern.donorGlobalIdx.push_back(targetVertex.globalPoint[iDonorPoint]);
+      }
+    }
+  }
+
+  for (auto& request : requests) {
+    sort(request.begin(), request.end());
+    request.erase(unique(request.begin(), request.end()), request.end());
+  }
+
+  /*--- Tell each rank which of its donors are needed here. ---*/
+
+  vector<int> nRecv(size), nSend(size), displRecv(size, 0), displSend(size, 0);
+  for (int i = 0; i < size; ++i) nRecv[i] = requests[i].size();
+
+  SU2_MPI::Alltoall(nRecv.data(), 1, MPI_INT, nSend.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  for (int i = 1; i < size; ++i) {
+    displRecv[i] = displRecv[i-1] + nRecv[i-1];
+    displSend[i] = displSend[i-1] + nSend[i-1];
+  }
+  const auto nRecvTotal = displRecv.back() + nRecv.back();
+  const auto nSendTotal = displSend.back() + nSend.back();
+
+  vector<unsigned long> requested(nRecvTotal), toSend(nSendTotal);
+  for (int i = 0; i < size; ++i) copy(requests[i].begin(), requests[i].end(), requested.begin() + displRecv[i]);
+
+  SU2_MPI::Alltoallv(requested.data(), nRecv.data(), displRecv.data(), MPI_UNSIGNED_LONG, toSend.data(),
+                     nSend.data(), displSend.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  /*--- Map the requested global indices to donor vertices of this rank. ---*/
+
+  vector<pair<unsigned long, unsigned long> > globalToVertex;
+  if (markDonor >= 0) {
+    for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
+      const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+      if (donor_geometry->nodes->GetDomain(iPoint))
+        globalToVertex.emplace_back(donor_geometry->nodes->GetGlobalIndex(iPoint), iVertex);
+    }
+  }
+  sort(globalToVertex.begin(), globalToVertex.end());
+
+  pattern.sendVertex.resize(nSendTotal);
+  for (auto i = 0ul; i < toSend.size(); ++i) {
+    const auto it = lower_bound(globalToVertex.begin(), globalToVertex.end(), make_pair(toSend[i], 0ul));
+    if (it == globalToVertex.end() || it->first != toSend[i])
+      SU2_MPI::Error("Interface donor point not found on the rank that owns it.", CURRENT_FUNCTION);
+    pattern.sendVertex[i] = it->second;
+  }
+
+  /*--- Keep only the ranks that take part in the communication. ---*/
+
+  pattern.sendRanks.clear();
+  pattern.recvRanks.clear();
+  pattern.sendStart.clear();
+  pattern.recvStart.clear();
+
+  for (int i = 0; i < size; ++i) {
+    if (nSend[i]) {
+      pattern.sendRanks.push_back(i);
+      pattern.sendStart.push_back(displSend[i]);
+    }
+    if (nRecv[i]) {
+      pattern.recvRanks.push_back(i);
+      pattern.recvStart.push_back(displRecv[i]);
+    }
+  }
+  pattern.sendStart.push_back(nSendTotal);
+  pattern.recvStart.push_back(nRecvTotal);
+
+  pattern.sendBuffer.resize(nSendTotal, nVar);
+  pattern.recvBuffer.resize(nRecvTotal, nVar);
+
+  /*--- Location in the receive buffer of each donor of the local target vertices. ---*/
+
+  pattern.donorBufferIdx.resize(pattern.donorGlobalIdx.size());
+
+  if (markTarget >= 0) {
+    unsigned long iDonorLocal = 0;
+    for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
+      const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+
+      const auto& targetVertex = interpolator.targetVertices[markTarget][iVertex];
+      for (auto iDonorPoint = 0ul; iDonorPoint < targetVertex.nDonor(); iDonorPoint++, iDonorLocal++) {
+        const auto& request = requests[targetVertex.processor[iDonorPoint]];
+        const auto pos = lower_bound(request.begin(), request.end(), targetVertex.globalPoint[iDonorPoint]);
+        pattern.donorBufferIdx[iDonorLocal] = displRecv[targetVertex.processor[iDonorPoint]] + (pos - request.begin());
+      }
+    }
+  }
+
+  pattern.valid = true;
+}
+
+void CInterface::SparseDataExchange(CSolver *donor_solution, CGeometry *donor_geometry, const CConfig *donor_config,
+                                    int markDonor, CSparsePattern& pattern) {
+
+  /*--- Pack the values of the donor vertices requested by other ranks. ---*/
+
+  for (auto iSend = 0ul; iSend < pattern.sendVertex.size(); ++iSend) {
+    const auto iVertex = pattern.sendVertex[iSend];
+    const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+
+    GetDonor_Variable(donor_solution, donor_geometry, donor_config, markDonor, iVertex, iPoint);
+    for (auto iVar = 0u; iVar < nVar; iVar++) pattern.sendBuffer(iSend, iVar) = Donor_Variable[iVar];
+  }
+
+  /*--- The values needed by this rank from itself are copied. ---*/
+
+  for (auto iSend = 0ul; iSend < pattern.sendRanks.size(); ++iSend) {
+    if (pattern.sendRanks[iSend] != rank) continue;
+    const auto iRecv = find(pattern.recvRanks.begin(), pattern.recvRanks.end(), rank) - pattern.recvRanks.begin();
+    const auto count = (pattern.sendStart[iSend+1] - pattern.sendStart[iSend]) * nVar;
+    const su2double* begin = pattern.sendBuffer[pattern.sendStart[iSend]];
+    copy(begin, begin + count, pattern.recvBuffer[pattern.recvStart[iRecv]]);
+  }
+
+#ifdef HAVE_MPI
+  /*--- Point-to-point exchange with the other ranks. There is one message per pair of ranks, which is
+   *    identified by the source, the tag is constant (ranks may exceed MPI_TAG_UB). ---*/
+
+  constexpr int tag = 0;
+  vector<SU2_MPI::Request> requests;
+  requests.reserve(pattern.sendRanks.size() + pattern.recvRanks.size());
+
+  for (auto iRecv = 0ul; iRecv < pattern.recvRanks.size(); ++iRecv) {
+    const auto source = pattern.recvRanks[iRecv];
+    if (source == rank) continue;
+    const int count = (pattern.recvStart[iRecv+1] - pattern.recvStart[iRecv]) * nVar;
+    requests.emplace_back();
+    SU2_MPI::Irecv(pattern.recvBuffer[pattern.recvStart[iRecv]], count, MPI_DOUBLE, source, tag,
+                   SU2_MPI::GetComm(), &requests.back());
+  }
+
+  for (auto iSend = 0ul; iSend < pattern.sendRanks.size(); ++iSend) {
+    const auto dest = pattern.sendRanks[iSend];
+    if (dest == rank) continue;
+    const int count = (pattern.sendStart[iSend+1] - pattern.sendStart[iSend]) * nVar;
+    requests.emplace_back();
+    SU2_MPI::Isend(pattern.sendBuffer[pattern.sendStart[iSend]], count, MPI_DOUBLE, dest, tag,
+                   SU2_MPI::GetComm(), &requests.back());
+  }
+
+  SU2_MPI::Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+#endif
+}
+
 void CInterface::PreprocessAverage(CGeometry *donor_geometry, CGeometry *target_geometry,
                                    const CConfig *donor_config, const CConfig *target_config,
                                    unsigned short iMarkerInt){
@@ -62,26 +62,40 @@ void CFVMOutput::AddCommonFVMOutputs(const CConfig *config) {
   }
 }
 
-void CFVMOutput::LoadCommonFVMOutputs(const CConfig* config, const CGeometry* geometry, unsigned long iPoint) {
+void CFVMOutput::SetCoordinateLoaders(const CGeometry* geometry) {
+
+  const auto* nodes = geometry->nodes;
+
+  SetVolumeFieldLoader("COORD-X", [nodes](unsigned long iPoint) { return nodes->GetCoord(iPoint, 0); });
+  SetVolumeFieldLoader("COORD-Y", [nodes](unsigned long iPoint) { return nodes->GetCoord(iPoint, 1); });
+  if (nDim == 3)
+    SetVolumeFieldLoader("COORD-Z", [nodes](unsigned long iPoint) { return nodes->GetCoord(iPoint, 2); });
+}
+
+void CFVMOutput::SetCommonFVMLoaders(const CConfig* config, const CGeometry* geometry) {
 
-  // Mesh quality metrics, computed in CPhysicalGeometry::ComputeMeshQualityStatistics.
   if (config->GetWrt_MeshQuality()) {
-    SetVolumeOutputValue("ORTHOGONALITY", iPoint, geometry->Orthogonality[iPoint]);
-    SetVolumeOutputValue("ASPECT_RATIO",  iPoint, geometry->Aspect_Ratio[iPoint]);
-    SetVolumeOutputValue("VOLUME_RATIO",  iPoint, geometry->Volume_Ratio[iPoint]);
+    SetVolumeFieldLoader("ORTHOGONALITY", [geometry](unsigned long iPoint) { return geometry->Orthogonality[iPoint]; });
+    SetVolumeFieldLoader("ASPECT_RATIO",  [geometry](unsigned long iPoint) { return geometry->Aspect_Ratio[iPoint]; });
+    SetVolumeFieldLoader("VOLUME_RATIO",  [geometry](unsigned long iPoint) { return geometry->Volume_Ratio[iPoint]; });
   }
 
-  SetVolumeOutputValue("RANK", iPoint, rank);
+  const su2double rankValue = rank;
+  SetVolumeFieldLoader("RANK", [rankValue](unsigned long) { return rankValue; });
 
   if (config->GetWrt_MultiGrid()) {
     for (auto iMesh = 1u; iMesh <= config->GetnMGLevels(); ++iMesh) {
       stringstream key;
       key << "MG_" << iMesh;
-      SetVolumeOutputValue(key.str(), iPoint, geometry->CoarseGridColor(iPoint,iMesh-1));
+      SetVolumeFieldLoader(key.str(), [geometry, iMesh](unsigned long iPoint) {
+        return su2double(geometry->CoarseGridColor(iPoint, iMesh-1));
+      });
     }
   }
 
   if (config->GetKind_Linear_Solver_Prec() == LINELET) {
-    SetVolumeOutputValue("LINELET", iPoint, geometry->GetLineletInfo(config).lineletColor[iPoint]);
+    /*--- The linelets are built on first access, which must not happen in the (threaded) point loop. ---*/
+    const auto* color = geometry->GetLineletInfo(config).lineletColor.data();
+    SetVolumeFieldLoader("LINELET", [color](unsigned long iPoint) { return su2double(color[iPoint]); });
   }
 }
@@ -307,84 +307,125 @@ void CFlowCompOutput::SetVolumeOutputFields(CConfig *config){
   }
 }
 
-void CFlowCompOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint){
+bool CFlowCompOutput::SetVolumeFieldLoaders(CConfig *config, CGeometry *geometry, CSolver **solver){
 
-  const auto* Node_Flow = solver[FLOW_SOL]->GetNodes();
+  const auto* flowSolver = solver[FLOW_SOL];
+  const auto* Node_Flow = flowSolver->GetNodes();
   auto* Node_Geo  = geometry->nodes;
 
-  LoadCoordinates(Node_Geo->GetCoord(iPoint), iPoint);
+  SetCoordinateLoaders(geometry);
 
-  SetVolumeOutputValue("DENSITY",    iPoint, Node_Flow->GetSolution(iPoint, 0));
-  SetVolumeOutputValue("MOMENTUM-X", iPoint, Node_Flow->GetSolution(iPoint, 1));
-  SetVolumeOutputValue("MOMENTUM-Y", iPoint, Node_Flow->GetSolution(iPoint, 2));
-  if (nDim == 3){
-    SetVolumeOutputValue("MOMENTUM-Z", iPoint, Node_Flow->GetSolution(iPoint, 3));
-    SetVolumeOutputValue("ENERGY",     iPoint, Node_Flow->GetSolution(iPoint, 4));
-  } else {
-    SetVolumeOutputValue("ENERGY",     iPoint, Node_Flow->GetSolution(iPoint, 3));
-  }
+  const unsigned short iEnergy = nDim + 1;
+
+  SetVolumeFieldLoader("DENSITY",    [Node_Flow](unsigned long iPoint) { return Node_Flow->GetSolution(iPoint, 0); });
+  SetVolumeFieldLoader("MOMENTUM-X", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetSolution(iPoint, 1); });
+  SetVolumeFieldLoader("MOMENTUM-Y", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetSolution(iPoint, 2); });
+  if (nDim == 3)
+    SetVolumeFieldLoader("MOMENTUM-Z", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetSolution(iPoint, 3); });
+  SetVolumeFieldLoader("ENERGY", [Node_Flow, iEnergy](unsigned long iPoint) {
+    return Node_Flow->GetSolution(iPoint, iEnergy);
+  });
 
   if (gridMovement){
-    SetVolumeOutputValue("GRID_VELOCITY-X", iPoint, Node_Geo->GetGridVel(iPoint)[0]);
-    SetVolumeOutputValue("GRID_VELOCITY-Y", iPoint, Node_Geo->GetGridVel(iPoint)[1]);
+    SetVolumeFieldLoader("GRID_VELOCITY-X", [Node_Geo](unsigned long iPoint) {
+      return Node_Geo->GetGridVel(iPoint)[0];
+    });
+    SetVolumeFieldLoader("GRID_VELOCITY-Y", [Node_Geo](unsigned long iPoint) {
+      return Node_Geo->GetGridVel(iPoint)[1];
+    });
     if (nDim == 3)
-      SetVolumeOutputValue("GRID_VELOCITY-Z", iPoint, Node_Geo->GetGridVel(iPoint)[2]);
-  }
-
-  SetVolumeOutputValue("PRESSURE", iPoint, Node_Flow->GetPressure(iPoint));
-  SetVolumeOutputValue("TEMPERATURE", iPoint, Node_Flow->GetTemperature(iPoint));
-  SetVolumeOutputValue("MACH", iPoint, sqrt(Node_Flow->GetVelocity2(iPoint))/Node_Flow->GetSoundSpeed(iPoint));
-
-  const su2double factor = solver[FLOW_SOL]->GetReferenceDynamicPressure();
-  SetVolumeOutputValue("PRESSURE_COEFF", iPoint, (Node_Flow->GetPressure(iPoint) - solver[FLOW_SOL]->GetPressure_Inf())/factor);
-  SetVolumeOutputValue("VELOCITY-X", iPoint, Node_Flow->GetVelocity(iPoint, 0));
-  SetVolumeOutputValue("VELOCITY-Y", iPoint, Node_Flow->GetVelocity(iPoint, 1));
+      SetVolumeFieldLoader("GRID_VELOCITY-Z", [Node_Geo](unsigned long iPoint) {
+        return Node_Geo->GetGridVel(iPoint)[2];
+      });
+  }
+
+  SetVolumeFieldLoader("PRESSURE", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetPressure(iPoint); });
+  SetVolumeFieldLoader("TEMPERATURE", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetTemperature(iPoint); });
+  SetVolumeFieldLoader("MACH", [Node_Flow](unsigned long iPoint) {
+    return sqrt(Node_Flow->GetVelocity2(iPoint))/Node_Flow->GetSoundSpeed(iPoint);
+  });
+
+  const su2double factor = flowSolver->GetReferenceDynamicPressure();
+  const su2double pressureInf = flowSolver->GetPressure_Inf();
+  SetVolumeFieldLoader("PRESSURE_COEFF", [Node_Flow, factor, pressureInf](unsigned long iPoint) {
+    return (Node_Flow->GetPressure(iPoint) - pressureInf)/factor;
+  });
+  SetVolumeFieldLoader("VELOCITY-X", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetVelocity(iPoint, 0); });
+  SetVolumeFieldLoader("VELOCITY-Y", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetVelocity(iPoint, 1); });
   if (nDim == 3){
-    SetVolumeOutputValue("VELOCITY-Z", iPoint, Node_Flow->GetVelocity(iPoint, 2));
+    SetVolumeFieldLoader("VELOCITY-Z", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetVelocity(iPoint, 2); });
   }
 
   if(config->GetKind_FluidModel() == DATADRIVEN_FLUID){
-    SetVolumeOutputValue("EXTRAPOLATION", iPoint, Node_Flow->GetDataExtrapolation(iPoint));
-    SetVolumeOutputValue("FLUIDMODEL_NEWTONITER", iPoint, Node_Flow->GetNewtonSolverIterations(iPoint));
-    SetVolumeOutputValue("ENTROPY", iPoint, Node_Flow->GetEntropy(iPoint));
+    SetVolumeFieldLoader("EXTRAPOLATION", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetDataExtrapolation(iPoint);
+    });
+    SetVolumeFieldLoader("FLUIDMODEL_NEWTONITER", [Node_Flow](unsigned long iPoint) {
+      return su2double(Node_Flow->GetNewtonSolverIterations(iPoint));
+    });
+    SetVolumeFieldLoader("ENTROPY", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetEntropy(iPoint); });
   }
 
   if (config->GetKind_Solver() == MAIN_SOLVER::RANS || config->GetKind_Solver() == MAIN_SOLVER::NAVIER_STOKES){
-    SetVolumeOutputValue("LAMINAR_VISCOSITY", iPoint, Node_Flow->GetLaminarViscosity(iPoint));
-  }
-
-  SetVolumeOutputValue("RES_DENSITY", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, 0));
-  SetVolumeOutputValue("RES_MOMENTUM-X", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, 1));
-  SetVolumeOutputValue("RES_MOMENTUM-Y", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, 2));
-  if (nDim == 3){
-    SetVolumeOutputValue("RES_MOMENTUM-Z", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, 3));
-    SetVolumeOutputValue("RES_ENERGY", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, 4));
-  } else {
-    SetVolumeOutputValue("RES_ENERGY", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, 3));
-  }
+    SetVolumeFieldLoader("LAMINAR_VISCOSITY", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetLaminarViscosity(iPoint);
+    });
+  }
+
+  SetVolumeFieldLoader("RES_DENSITY", [flowSolver](unsigned long iPoint) { return flowSolver->LinSysRes(iPoint, 0); });
+  SetVolumeFieldLoader("RES_MOMENTUM-X", [flowSolver](unsigned long iPoint) {
+    return flowSolver->LinSysRes(iPoint, 1);
+  });
+  SetVolumeFieldLoader("RES_MOMENTUM-Y", [flowSolver](unsigned long iPoint) {
+    return flowSolver->LinSysRes(iPoint, 2);
+  });
+  if (nDim == 3)
+    SetVolumeFieldLoader("RES_MOMENTUM-Z", [flowSolver](unsigned long iPoint) {
+      return flowSolver->LinSysRes(iPoint, 3);
+    });
+  SetVolumeFieldLoader("RES_ENERGY", [flowSolver, iEnergy](unsigned long iPoint) {
+    return flowSolver->LinSysRes(iPoint, iEnergy);
+  });
 
   if (config->GetKind_SlopeLimit_Flow() != LIMITER::NONE && config->GetKind_SlopeLimit_Flow() != LIMITER::VAN_ALBADA_EDGE) {
-    SetVolumeOutputValue("LIMITER_VELOCITY-X", iPoint, Node_Flow->GetLimiter_Primitive(iPoint, 1));
-    SetVolumeOutputValue("LIMITER_VELOCITY-Y", iPoint, Node_Flow->GetLimiter_Primitive(iPoint, 2));
+    const unsigned short iPressure = nDim + 1;
+    SetVolumeFieldLoader("LIMITER_VELOCITY-X", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetLimiter_Primitive(iPoint, 1);
+    });
+    SetVolumeFieldLoader("LIMITER_VELOCITY-Y", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetLimiter_Primitive(iPoint, 2);
+    });
     if (nDim == 3){
-      SetVolumeOutputValue("LIMITER_VELOCITY-Z", iPoint, Node_Flow->GetLimiter_Primitive(iPoint, 3));
+      SetVolumeFieldLoader("LIMITER_VELOCITY-Z", [Node_Flow](unsigned long iPoint) {
+        return Node_Flow->GetLimiter_Primitive(iPoint, 3);
+      });
     }
-    SetVolumeOutputValue("LIMITER_PRESSURE", iPoint, Node_Flow->GetLimiter_Primitive(iPoint, nDim+1));
-    SetVolumeOutputValue("LIMITER_DENSITY", iPoint, Node_Flow->GetLimiter_Primitive(iPoint, nDim+2));
-    SetVolumeOutputValue("LIMITER_ENTHALPY", iPoint, Node_Flow->GetLimiter_Primitive(iPoint, nDim+3));
+    SetVolumeFieldLoader("LIMITER_PRESSURE", [Node_Flow, iPressure](unsigned long iPoint) {
+      return Node_Flow->GetLimiter_Primitive(iPoint, iPressure);
+    });
+    SetVolumeFieldLoader("LIMITER_DENSITY", [Node_Flow, iPressure](unsigned long iPoint) {
+      return Node_Flow->GetLimiter_Primitive(iPoint, iPressure+1);
+    });
+    SetVolumeFieldLoader("LIMITER_ENTHALPY", [Node_Flow, iPressure](unsigned long iPoint) {
+      return Node_Flow->GetLimiter_Primitive(iPoint, iPressure+2);
+    });
   }
 
   if (config->GetKind_RoeLowDiss() != NO_ROELOWDISS){
-    SetVolumeOutputValue("ROE_DISSIPATION", iPoint, Node_Flow->GetRoe_Dissipation(iPoint));
+    SetVolumeFieldLoader("ROE_DISSIPATION", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetRoe_Dissipation(iPoint);
+    });
   }
 
-  LoadVolumeDataScalar(config, solver, geometry, iPoint);
+  SetVolumeFieldLoadersScalar(config, solver, geometry);
 
-  LoadCommonFVMOutputs(config, geometry, iPoint);
+  SetCommonFVMLoaders(config, geometry);
 
   if (config->GetTime_Domain()) {
-    LoadTimeAveragedData(iPoint, Node_Flow);
+    SetTimeAveragedLoaders(Node_Flow);
   }
+
+  return true;
 }
 
 void CFlowCompOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSolver **solver)  {
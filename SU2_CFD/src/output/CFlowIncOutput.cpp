@@ -380,84 +380,132 @@ void CFlowIncOutput::SetVolumeOutputFields(CConfig *config){
   }
 }
 
-void CFlowIncOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint){
+bool CFlowIncOutput::SetVolumeFieldLoaders(CConfig *config, CGeometry *geometry, CSolver **solver){
 
-  const auto* Node_Flow = solver[FLOW_SOL]->GetNodes();
-  const CVariable* Node_Heat = nullptr;
-  const CVariable* Node_Rad = nullptr;
+  const auto* flowSolver = solver[FLOW_SOL];
+  const auto* Node_Flow = flowSolver->GetNodes();
   auto* Node_Geo = geometry->nodes;
 
-  if (weakly_coupled_heat){
-    Node_Heat = solver[HEAT_SOL]->GetNodes();
-  }
+  SetCoordinateLoaders(geometry);
 
-  LoadCoordinates(Node_Geo->GetCoord(iPoint), iPoint);
+  const unsigned short iTemperature = nDim + 1;
 
-  SetVolumeOutputValue("PRESSURE",   iPoint, Node_Flow->GetSolution(iPoint, 0));
-  SetVolumeOutputValue("VELOCITY-X", iPoint, Node_Flow->GetSolution(iPoint, 1));
-  SetVolumeOutputValue("VELOCITY-Y", iPoint, Node_Flow->GetSolution(iPoint, 2));
+  SetVolumeFieldLoader("PRESSURE",   [Node_Flow](unsigned long iPoint) { return Node_Flow->GetSolution(iPoint, 0); });
+  SetVolumeFieldLoader("VELOCITY-X", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetSolution(iPoint, 1); });
+  SetVolumeFieldLoader("VELOCITY-Y", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetSolution(iPoint, 2); });
   if (nDim == 3)
-    SetVolumeOutputValue("VELOCITY-Z", iPoint, Node_Flow->GetSolution(iPoint, 3));
+    SetVolumeFieldLoader("VELOCITY-Z", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetSolution(iPoint, 3); });
 
-  if (heat || flamelet) SetVolumeOutputValue("TEMPERATURE", iPoint, Node_Flow->GetSolution(iPoint, nDim+1));
-  if (weakly_coupled_heat) SetVolumeOutputValue("TEMPERATURE", iPoint, Node_Heat->GetSolution(iPoint, 0));
+  if (heat || flamelet) {
+    SetVolumeFieldLoader("TEMPERATURE", [Node_Flow, iTemperature](unsigned long iPoint) {
+      return Node_Flow->GetSolution(iPoint, iTemperature);
+    });
+  }
+  if (weakly_coupled_heat) {
+    const auto* Node_Heat = solver[HEAT_SOL]->GetNodes();
+    SetVolumeFieldLoader("TEMPERATURE", [Node_Heat](unsigned long iPoint) {
+      return Node_Heat->GetSolution(iPoint, 0);
+    });
+  }
 
   // Radiation solver
   if (config->AddRadiation()){
-    Node_Rad = solver[RAD_SOL]->GetNodes();
-    SetVolumeOutputValue("P1-RAD", iPoint, Node_Rad->GetSolution(iPoint,0));
+    const auto* Node_Rad = solver[RAD_SOL]->GetNodes();
+    SetVolumeFieldLoader("P1-RAD", [Node_Rad](unsigned long iPoint) { return Node_Rad->GetSolution(iPoint, 0); });
   }
 
   if (gridMovement){
-    SetVolumeOutputValue("GRID_VELOCITY-X", iPoint, Node_Geo->GetGridVel(iPoint)[0]);
-    SetVolumeOutputValue("GRID_VELOCITY-Y", iPoint, Node_Geo->GetGridVel(iPoint)[1]);
+    SetVolumeFieldLoader("GRID_VELOCITY-X", [Node_Geo](unsigned long iPoint) {
+      return Node_Geo->GetGridVel(iPoint)[0];
+    });
+    SetVolumeFieldLoader("GRID_VELOCITY-Y", [Node_Geo](unsigned long iPoint) {
+      return Node_Geo->GetGridVel(iPoint)[1];
+    });
     if (nDim == 3)
-      SetVolumeOutputValue("GRID_VELOCITY-Z", iPoint, Node_Geo->GetGridVel(iPoint)[2]);
+      SetVolumeFieldLoader("GRID_VELOCITY-Z", [Node_Geo](unsigned long iPoint) {
+        return Node_Geo->GetGridVel(iPoint)[2];
+      });
   }
 
-  const su2double factor = solver[FLOW_SOL]->GetReferenceDynamicPressure();
-  SetVolumeOutputValue("PRESSURE_COEFF", iPoint, (Node_Flow->GetPressure(iPoint) - solver[FLOW_SOL]->GetPressure_Inf())/factor);
-  SetVolumeOutputValue("DENSITY", iPoint, Node_Flow->GetDensity(iPoint));
+  const su2double factor = flowSolver->GetReferenceDynamicPressure();
+  const su2double pressureInf = flowSolver->GetPressure_Inf();
+  SetVolumeFieldLoader("PRESSURE_COEFF", [Node_Flow, factor, pressureInf](unsigned long iPoint) {
+    return (Node_Flow->GetPressure(iPoint) - pressureInf)/factor;
+  });
+  SetVolumeFieldLoader("DENSITY", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetDensity(iPoint); });
 
   if (config->GetKind_Solver() == MAIN_SOLVER::INC_RANS || config->GetKind_Solver() == MAIN_SOLVER::INC_NAVIER_STOKES){
-    SetVolumeOutputValue("LAMINAR_VISCOSITY", iPoint, Node_Flow->GetLaminarViscosity(iPoint));
-    SetVolumeOutputValue("HEAT_CAPACITY", iPoint, Node_Flow->GetSpecificHeatCp(iPoint));
-    SetVolumeOutputValue("THERMAL_CONDUCTIVITY", iPoint, Node_Flow->GetThermalConductivity(iPoint));
+    SetVolumeFieldLoader("LAMINAR_VISCOSITY", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetLaminarViscosity(iPoint);
+    });
+    SetVolumeFieldLoader("HEAT_CAPACITY", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetSpecificHeatCp(iPoint);
+    });
+    SetVolumeFieldLoader("THERMAL_CONDUCTIVITY", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetThermalConductivity(iPoint);
+    });
   }
 
-  SetVolumeOutputValue("RES_PRESSURE", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, 0));
-  SetVolumeOutputValue("RES_VELOCITY-X", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, 1));
-  SetVolumeOutputValue("RES_VELOCITY-Y", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, 2));
+  SetVolumeFieldLoader("RES_PRESSURE", [flowSolver](unsigned long iPoint) { return flowSolver->LinSysRes(iPoint, 0); });
+  SetVolumeFieldLoader("RES_VELOCITY-X", [flowSolver](unsigned long iPoint) {
+    return flowSolver->LinSysRes(iPoint, 1);
+  });
+  SetVolumeFieldLoader("RES_VELOCITY-Y", [flowSolver](unsigned long iPoint) {
+    return flowSolver->LinSysRes(iPoint, 2);
+  });
   if (nDim == 3)
-    SetVolumeOutputValue("RES_VELOCITY-Z", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, 3));
-  if (config->GetEnergy_Equation())
-    SetVolumeOutputValue("RES_TEMPERATURE", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, nDim+1));
+    SetVolumeFieldLoader("RES_VELOCITY-Z", [flowSolver](unsigned long iPoint) {
+      return flowSolver->LinSysRes(iPoint, 3);
+    });
+  if (config->GetEnergy_Equation()) {
+    SetVolumeFieldLoader("RES_TEMPERATURE", [flowSolver, iTemperature](unsigned long iPoint) {
+      return flowSolver->LinSysRes(iPoint, iTemperature);
+    });
+  }
 
   if (config->GetKind_SlopeLimit_Flow() != LIMITER::NONE && config->GetKind_SlopeLimit_Flow() != LIMITER::VAN_ALBADA_EDGE) {
-    SetVolumeOutputValue("LIMITER_PRESSURE", iPoint, Node_Flow->GetLimiter_Primitive(iPoint, 0));
-    SetVolumeOutputValue("LIMITER_VELOCITY-X", iPoint, Node_Flow->GetLimiter_Primitive(iPoint, 1));
-    SetVolumeOutputValue("LIMITER_VELOCITY-Y", iPoint, Node_Flow->GetLimiter_Primitive(iPoint, 2));
+    SetVolumeFieldLoader("LIMITER_PRESSURE", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetLimiter_Primitive(iPoint, 0);
+    });
+    SetVolumeFieldLoader("LIMITER_VELOCITY-X", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetLimiter_Primitive(iPoint, 1);
+    });
+    SetVolumeFieldLoader("LIMITER_VELOCITY-Y", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetLimiter_Primitive(iPoint, 2);
+    });
     if (nDim == 3)
-      SetVolumeOutputValue("LIMITER_VELOCITY-Z", iPoint, Node_Flow->GetLimiter_Primitive(iPoint, 3));
-    if (heat || weakly_coupled_heat)
-      SetVolumeOutputValue("LIMITER_TEMPERATURE", iPoint, Node_Flow->GetLimiter_Primitive(iPoint, nDim+1));
+      SetVolumeFieldLoader("LIMITER_VELOCITY-Z", [Node_Flow](unsigned long iPoint) {
+        return Node_Flow->GetLimiter_Primitive(iPoint, 3);
+      });
+    if (heat || weakly_coupled_heat) {
+      SetVolumeFieldLoader("LIMITER_TEMPERATURE", [Node_Flow, iTemperature](unsigned long iPoint) {
+        return Node_Flow->GetLimiter_Primitive(iPoint, iTemperature);
+      });
+    }
   }
 
   // All turbulence and species outputs.
-  LoadVolumeDataScalar(config, solver, geometry, iPoint);
+  SetVolumeFieldLoadersScalar(config, solver, geometry);
 
   // Streamwise Periodicity
   if (streamwisePeriodic) {
-    SetVolumeOutputValue("RECOVERED_PRESSURE", iPoint, Node_Flow->GetStreamwise_Periodic_RecoveredPressure(iPoint));
-    if (heat && streamwisePeriodic_temperature)
-      SetVolumeOutputValue("RECOVERED_TEMPERATURE", iPoint, Node_Flow->GetStreamwise_Periodic_RecoveredTemperature(iPoint));
+    SetVolumeFieldLoader("RECOVERED_PRESSURE", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetStreamwise_Periodic_RecoveredPressure(iPoint);
+    });
+    if (heat && streamwisePeriodic_temperature) {
+      SetVolumeFieldLoader("RECOVERED_TEMPERATURE", [Node_Flow](unsigned long iPoint) {
+        return Node_Flow->GetStreamwise_Periodic_RecoveredTemperature(iPoint);
+      });
+    }
   }
 
-  LoadCommonFVMOutputs(config, geometry, iPoint);
+  SetCommonFVMLoaders(config, geometry);
 
   if (config->GetTime_Domain()) {
-    LoadTimeAveragedData(iPoint, Node_Flow);
+    SetTimeAveragedLoaders(Node_Flow);
   }
+
+  return true;
 }
 
 bool CFlowIncOutput::SetInitResiduals(const CConfig *config){
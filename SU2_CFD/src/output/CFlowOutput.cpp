@@ -1488,8 +1488,8 @@ void CFlowOutput::SetVolumeOutputFieldsScalarMisc(const CConfig* config) {
   }
 }
 
-void CFlowOutput::LoadVolumeDataScalar(const CConfig* config, const CSolver* const* solver, const CGeometry* geometry,
-                                        const unsigned long iPoint) {
+void CFlowOutput::SetVolumeFieldLoadersScalar(const CConfig* config, const CSolver* const* solver,
+                                              const CGeometry* geometry) {
   const auto* turb_solver = solver[TURB_SOL];
   const auto* trans_solver = solver[TRANS_SOL];
   const auto* Node_Flow = solver[FLOW_SOL]->GetNodes();
@@ -1497,39 +1497,63 @@ void CFlowOutput::LoadVolumeDataScalar(const CConfig* config, const CSolver* con
   const auto* Node_Trans = (config->GetKind_Trans_Model() != TURB_TRANS_MODEL::NONE) ? trans_solver->GetNodes() : nullptr;
   const auto* Node_Geo = geometry->nodes;
 
-  SetVolumeOutputValue("DELTA_TIME", iPoint, Node_Flow->GetDelta_Time(iPoint));
-  SetVolumeOutputValue("CFL", iPoint, Node_Flow->GetLocalCFL(iPoint));
+  SetVolumeFieldLoader("DELTA_TIME", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetDelta_Time(iPoint); });
+  SetVolumeFieldLoader("CFL", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetLocalCFL(iPoint); });
 
   if (config->GetViscous()) {
     if (nDim == 3){
-      SetVolumeOutputValue("VORTICITY_X", iPoint, Node_Flow->GetVorticity(iPoint)[0]);
-      SetVolumeOutputValue("VORTICITY_Y", iPoint, Node_Flow->GetVorticity(iPoint)[1]);
-      SetVolumeOutputValue("VORTICITY_Z", iPoint, Node_Flow->GetVorticity(iPoint)[2]);
+      SetVolumeFieldLoader("VORTICITY_X", [Node_Flow](unsigned long iPoint) {
+        return Node_Flow->GetVorticity(iPoint)[0];
+      });
+      SetVolumeFieldLoader("VORTICITY_Y", [Node_Flow](unsigned long iPoint) {
+        return Node_Flow->GetVorticity(iPoint)[1];
+      });
+      SetVolumeFieldLoader("VORTICITY_Z", [Node_Flow](unsigned long iPoint) {
+        return Node_Flow->GetVorticity(iPoint)[2];
+      });
     } else {
-      SetVolumeOutputValue("VORTICITY", iPoint, Node_Flow->GetVorticity(iPoint)[2]);
+      SetVolumeFieldLoader("VORTICITY", [Node_Flow](unsigned long iPoint) {
+        return Node_Flow->GetVorticity(iPoint)[2];
+      });
     }
-    SetVolumeOutputValue("Q_CRITERION", iPoint, GetQCriterion(Node_Flow->GetVelocityGradient(iPoint)));
+    SetVolumeFieldLoader("Q_CRITERION", [this, Node_Flow](unsigned long iPoint) {
+      return GetQCriterion(Node_Flow->GetVelocityGradient(iPoint));
+    });
   }
 
   const bool limiter = (config->GetKind_SlopeLimit_Turb() != LIMITER::NONE);
 
   switch (TurbModelFamily(config->GetKind_Turb_Model())) {
     case TURB_FAMILY::SA:
-      SetVolumeOutputValue("NU_TILDE", iPoint, Node_Turb->GetSolution(iPoint, 0));
-      SetVolumeOutputValue("RES_NU_TILDE", iPoint, turb_solver->LinSysRes(iPoint, 0));
+      SetVolumeFieldLoader("NU_TILDE", [Node_Turb](unsigned long iPoint) { return Node_Turb->GetSolution(iPoint, 0); });
+      SetVolumeFieldLoader("RES_NU_TILDE", [turb_solver](unsigned long iPoint) {
+        return turb_solver->LinSysRes(iPoint, 0);
+      });
       if (limiter) {
-        SetVolumeOutputValue("LIMITER_NU_TILDE", iPoint, Node_Turb->GetLimiter(iPoint, 0));
+        SetVolumeFieldLoader("LIMITER_NU_TILDE", [Node_Turb](unsigned long iPoint) {
+          return Node_Turb->GetLimiter(iPoint, 0);
+        });
       }
       break;
 
     case TURB_FAMILY::KW:
-      SetVolumeOutputValue("TKE", iPoint, Node_Turb->GetSolution(iPoint, 0));
-      SetVolumeOutputValue("DISSIPATION", iPoint, Node_Turb->GetSolution(iPoint, 1));
-      SetVolumeOutputValue("RES_TKE", iPoint, turb_solver->LinSysRes(iPoint, 0));
-      SetVolumeOutputValue("RES_DISSIPATION", iPoint, turb_solver->LinSysRes(iPoint, 1));
+      SetVolumeFieldLoader("TKE", [Node_Turb](unsigned long iPoint) { return Node_Turb->GetSolution(iPoint, 0); });
+      SetVolumeFieldLoader("DISSIPATION", [Node_Turb](unsigned long iPoint) {
+        return Node_Turb->GetSolution(iPoint, 1);
+      });
+      SetVolumeFieldLoader("RES_TKE", [turb_solver](unsigned long iPoint) {
+        return turb_solver->LinSysRes(iPoint, 0);
+      });
+      SetVolumeFieldLoader("RES_DISSIPATION", [turb_solver](unsigned long iPoint) {
+        return turb_solver->LinSysRes(iPoint, 1);
+      });
       if (limiter) {
-        SetVolumeOutputValue("LIMITER_TKE", iPoint, Node_Turb->GetLimiter(iPoint, 0));
-        SetVolumeOutputValue("LIMITER_DISSIPATION", iPoint, Node_Turb->GetLimiter(iPoint, 1));
+        SetVolumeFieldLoader("LIMITER_TKE", [Node_Turb](unsigned long iPoint) {
+          return Node_Turb->GetLimiter(iPoint, 0);
+        });
+        SetVolumeFieldLoader("LIMITER_DISSIPATION", [Node_Turb](unsigned long iPoint) {
+          return Node_Turb->GetLimiter(iPoint, 1);
+        });
       }
       break;
 
@@ -1538,88 +1562,118 @@ void CFlowOutput::LoadVolumeDataScalar(const CConfig* config, const CSolver* con
 
   /*--- If we got here a turbulence model is being used, therefore there is eddy viscosity. ---*/
   if (config->GetKind_Turb_Model() != TURB_MODEL::NONE) {
-    SetVolumeOutputValue("EDDY_VISCOSITY", iPoint, Node_Flow->GetEddyViscosity(iPoint));
-    SetVolumeOutputValue("TURB_DELTA_TIME", iPoint, Node_Turb->GetDelta_Time(iPoint));
-    SetVolumeOutputValue("TURB_CFL", iPoint, Node_Turb->GetLocalCFL(iPoint));
+    SetVolumeFieldLoader("EDDY_VISCOSITY", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetEddyViscosity(iPoint);
+    });
+    SetVolumeFieldLoader("TURB_DELTA_TIME", [Node_Turb](unsigned long iPoint) {
+      return Node_Turb->GetDelta_Time(iPoint);
+    });
+    SetVolumeFieldLoader("TURB_CFL", [Node_Turb](unsigned long iPoint) { return Node_Turb->GetLocalCFL(iPoint); });
   }
 
   if (config->GetSAParsedOptions().bc) {
-    SetVolumeOutputValue("INTERMITTENCY", iPoint, Node_Turb->GetIntermittencyEff(iPoint));
+    SetVolumeFieldLoader("INTERMITTENCY", [Node_Turb](unsigned long iPoint) {
+      return Node_Turb->GetIntermittencyEff(iPoint);
+    });
   }
 
   switch (config->GetKind_Trans_Model()) {
     case TURB_TRANS_MODEL::LM:
-      SetVolumeOutputValue("INTERMITTENCY", iPoint, Node_Trans->GetSolution(iPoint, 0));
-      SetVolumeOutputValue("RE_THETA_T", iPoint, Node_Trans->GetSolution(iPoint, 1));
-      SetVolumeOutputValue("INTERMITTENCY_SEP", iPoint, Node_Trans->GetIntermittencySep(iPoint));
-      SetVolumeOutputValue("INTERMITTENCY_EFF", iPoint, Node_Trans->GetIntermittencyEff(iPoint));
-      SetVolumeOutputValue("TURB_INDEX", iPoint, Node_Turb->GetTurbIndex(iPoint));
-      SetVolumeOutputValue("RES_INTERMITTENCY", iPoint, trans_solver->LinSysRes(iPoint, 0));
-      SetVolumeOutputValue("RES_RE_THETA_T", iPoint, trans_solver->LinSysRes(iPoint, 1));
+      SetVolumeFieldLoader("INTERMITTENCY", [Node_Trans](unsigned long iPoint) {
+        return Node_Trans->GetSolution(iPoint, 0);
+      });
+      SetVolumeFieldLoader("RE_THETA_T", [Node_Trans](unsigned long iPoint) {
+        return Node_Trans->GetSolution(iPoint, 1);
+      });
+      SetVolumeFieldLoader("INTERMITTENCY_SEP", [Node_Trans](unsigned long iPoint) {
+        return Node_Trans->GetIntermittencySep(iPoint);
+      });
+      SetVolumeFieldLoader("INTERMITTENCY_EFF", [Node_Trans](unsigned long iPoint) {
+        return Node_Trans->GetIntermittencyEff(iPoint);
+      });
+      SetVolumeFieldLoader("TURB_INDEX", [Node_Turb](unsigned long iPoint) { return Node_Turb->GetTurbIndex(iPoint); });
+      SetVolumeFieldLoader("RES_INTERMITTENCY", [trans_solver](unsigned long iPoint) {
+        return trans_solver->LinSysRes(iPoint, 0);
+      });
+      SetVolumeFieldLoader("RES_RE_THETA_T", [trans_solver](unsigned long iPoint) {
+        return trans_solver->LinSysRes(iPoint, 1);
+      });
       break;
 
     case TURB_TRANS_MODEL::NONE: break;
   }
 
   if (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES) {
-    SetVolumeOutputValue("DES_LENGTHSCALE", iPoint, Node_Flow->GetDES_LengthScale(iPoint));
-    SetVolumeOutputValue("WALL_DISTANCE", iPoint, Node_Geo->GetWall_Distance(iPoint));
+    SetVolumeFieldLoader("DES_LENGTHSCALE", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetDES_LengthScale(iPoint);
+    });
+    SetVolumeFieldLoader("WALL_DISTANCE", [Node_Geo](unsigned long iPoint) {
+      return Node_Geo->GetWall_Distance(iPoint);
+    });
   }
 
   switch (config->GetKind_Species_Model()) {
 
     case SPECIES_MODEL::SPECIES_TRANSPORT: {
-      const auto Node_Species = solver[SPECIES_SOL]->GetNodes();
+      const auto* species_solver = solver[SPECIES_SOL];
+      const auto* Node_Species = species_solver->GetNodes();
       for (unsigned short iVar = 0; iVar < config->GetnSpecies(); iVar++) {
-        SetVolumeOutputValue("SPECIES_" + std::to_string(iVar), iPoint, Node_Species->GetSolution(iPoint, iVar));
-        SetVolumeOutputValue("RES_SPECIES_" + std::to_string(iVar), iPoint, solver[SPECIES_SOL]->LinSysRes(iPoint, iVar));
-        SetVolumeOutputValue("DIFFUSIVITY_"+ std::to_string(iVar), iPoint, Node_Species->GetDiffusivity(iPoint,iVar));
+        const auto suffix = std::to_string(iVar);
+        SetVolumeFieldLoader("SPECIES_" + suffix, [Node_Species, iVar](unsigned long iPoint) {
+          return Node_Species->GetSolution(iPoint, iVar);
+        });
+        SetVolumeFieldLoader("RES_SPECIES_" + suffix, [species_solver, iVar](unsigned long iPoint) {
+          return species_solver->LinSysRes(iPoint, iVar);
+        });
+        SetVolumeFieldLoader("DIFFUSIVITY_" + suffix, [Node_Species, iVar](unsigned long iPoint) {
+          return Node_Species->GetDiffusivity(iPoint, iVar);
+        });
         if (config->GetKind_SlopeLimit_Species() != LIMITER::NONE)
-          SetVolumeOutputValue("LIMITER_SPECIES_" + std::to_string(iVar), iPoint, Node_Species->GetLimiter(iPoint, iVar));
+          SetVolumeFieldLoader("LIMITER_SPECIES_" + suffix, [Node_Species, iVar](unsigned long iPoint) {
+            return Node_Species->GetLimiter(iPoint, iVar);
+          });
       }
       break;
     }
 
     case SPECIES_MODEL::FLAMELET: {
-      const auto Node_Species = solver[SPECIES_SOL]->GetNodes();
-
-      /*--- Controlling variables transport equations. ---*/
-      for (auto iCV=0u; iCV < config->GetNControlVars(); iCV++) {
-        const auto& cv_name = config->GetControllingVariableName(iCV);
-        SetVolumeOutputValue(cv_name, iPoint, Node_Species->GetSolution(iPoint, iCV));
-        SetVolumeOutputValue("RES_" + cv_name, iPoint, solver[SPECIES_SOL]->LinSysRes(iPoint, iCV));
-        const auto& source_name = config->GetControllingVariableSourceName(iCV);
-        if (source_name.compare("NULL") != 0)
-          SetVolumeOutputValue("SOURCE_" + cv_name, iPoint, Node_Species->GetScalarSources(iPoint)[iCV]);
-      }
-      /*--- auxiliary species transport equations ---*/
-      for (unsigned short i_scalar=0; i_scalar<config->GetNUserScalars(); i_scalar++) {
-        const auto& scalar_name = config->GetUserScalarName(i_scalar);
-        SetVolumeOutputValue(scalar_name, iPoint, Node_Species->GetSolution(iPoint, config->GetNControlVars() + i_scalar));
-        SetVolumeOutputValue("SOURCE_" + scalar_name, iPoint, Node_Species->GetScalarSources(iPoint)[config->GetNControlVars() + i_scalar]);
-        SetVolumeOutputValue("RES_" + scalar_name, iPoint, solver[SPECIES_SOL]->LinSysRes(iPoint, config->GetNControlVars() + i_scalar));
-      }
-
-      if (config->GetKind_SlopeLimit_Species() != LIMITER::NONE) {
-        /*--- Limiter for controlling variable transport equations. ---*/
-        for (auto iCV=0u; iCV<config->GetNControlVars(); iCV++) {
-          const auto& cv_name = config->GetControllingVariableName(iCV);
-          SetVolumeOutputValue("LIMITER_" + cv_name, iPoint, Node_Species->GetLimiter(iPoint, iCV));
-        }
-        /*--- limiter for auxiliary species transport equations ---*/
-        for (unsigned short i_scalar=0; i_scalar<config->GetNUserScalars(); i_scalar++) {
-          const auto& scalar_name = config->GetUserScalarName(i_scalar);
-          SetVolumeOutputValue("LIMITER_" + scalar_name, iPoint, Node_Species->GetLimiter(iPoint, config->GetNControlVars() + i_scalar));
-        }
+      const auto* species_solver = solver[SPECIES_SOL];
+      const auto* Node_Species = species_solver->GetNodes();
+      const bool limiterSpecies = (config->GetKind_SlopeLimit_Species() != LIMITER::NONE);
+
+      /*--- Controlling variables and auxiliary species transport equations, the latter have a source. ---*/
+      const auto nControlVars = config->GetNControlVars();
+      for (auto iVar = 0u; iVar < nControlVars + config->GetNUserScalars(); iVar++) {
+        const bool controlVar = (iVar < nControlVars);
+        const auto& name = controlVar ? config->GetControllingVariableName(iVar)
+                                      : config->GetUserScalarName(iVar - nControlVars);
+        SetVolumeFieldLoader(name, [Node_Species, iVar](unsigned long iPoint) {
+          return Node_Species->GetSolution(iPoint, iVar);
+        });
+        SetVolumeFieldLoader("RES_" + name, [species_solver, iVar](unsigned long iPoint) {
+          return species_solver->LinSysRes(iPoint, iVar);
+        });
+        if (!controlVar || config->GetControllingVariableSourceName(iVar).compare("NULL") != 0)
+          SetVolumeFieldLoader("SOURCE_" + name, [Node_Species, iVar](unsigned long iPoint) {
+            return Node_Species->GetScalarSources(iPoint)[iVar];
+          });
+        if (limiterSpecies)
+          SetVolumeFieldLoader("LIMITER_" + name, [Node_Species, iVar](unsigned long iPoint) {
+            return Node_Species->GetLimiter(iPoint, iVar);
+          });
       }
 
       /*--- variables that we look up from the LUT ---*/
       for (int i_lookup = 0; i_lookup < config->GetNLookups(); ++i_lookup) {
         if (config->GetLookupName(i_lookup)!="NULL")
-          SetVolumeOutputValue(config->GetLookupName(i_lookup), iPoint, Node_Species->GetScalarLookups(iPoint)[i_lookup]);
+          SetVolumeFieldLoader(config->GetLookupName(i_lookup), [Node_Species, i_lookup](unsigned long iPoint) {
+            return Node_Species->GetScalarLookups(iPoint)[i_lookup];
+          });
       }
 
-      SetVolumeOutputValue("TABLE_MISSES", iPoint, Node_Species->GetTableMisses(iPoint));
+      SetVolumeFieldLoader("TABLE_MISSES", [Node_Species](unsigned long iPoint) {
+        return su2double(Node_Species->GetTableMisses(iPoint));
+      });
 
       break;
     }
@@ -3969,45 +4023,63 @@ void CFlowOutput::SetTimeAveragedFields() {
   }
 }
 
-void CFlowOutput::LoadTimeAveragedData(unsigned long iPoint, const CVariable *Node_Flow){
-  SetAvgVolumeOutputValue("MEAN_DENSITY", iPoint, Node_Flow->GetDensity(iPoint));
-  SetAvgVolumeOutputValue("MEAN_VELOCITY-X", iPoint, Node_Flow->GetVelocity(iPoint,0));
-  SetAvgVolumeOutputValue("MEAN_VELOCITY-Y", iPoint, Node_Flow->GetVelocity(iPoint,1));
+void CFlowOutput::SetTimeAveragedLoaders(const CVariable *Node_Flow){
+  SetAvgVolumeFieldLoader("MEAN_DENSITY", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetDensity(iPoint); });
+  SetAvgVolumeFieldLoader("MEAN_VELOCITY-X", [Node_Flow](unsigned long iPoint) {
+    return Node_Flow->GetVelocity(iPoint,0);
+  });
+  SetAvgVolumeFieldLoader("MEAN_VELOCITY-Y", [Node_Flow](unsigned long iPoint) {
+    return Node_Flow->GetVelocity(iPoint,1);
+  });
   if (nDim == 3)
-    SetAvgVolumeOutputValue("MEAN_VELOCITY-Z", iPoint, Node_Flow->GetVelocity(iPoint,2));
-
-  SetAvgVolumeOutputValue("MEAN_PRESSURE", iPoint, Node_Flow->GetPressure(iPoint));
-
-  SetAvgVolumeOutputValue("RMS_U", iPoint, pow(Node_Flow->GetVelocity(iPoint,0),2));
-  SetAvgVolumeOutputValue("RMS_V", iPoint, pow(Node_Flow->GetVelocity(iPoint,1),2));
-  SetAvgVolumeOutputValue("RMS_UV", iPoint, Node_Flow->GetVelocity(iPoint,0) * Node_Flow->GetVelocity(iPoint,1));
-  SetAvgVolumeOutputValue("RMS_P", iPoint, pow(Node_Flow->GetPressure(iPoint),2));
+    SetAvgVolumeFieldLoader("MEAN_VELOCITY-Z", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetVelocity(iPoint,2);
+    });
+
+  SetAvgVolumeFieldLoader("MEAN_PRESSURE", [Node_Flow](unsigned long iPoint) {
+    return Node_Flow->GetPressure(iPoint);
+  });
+
+  SetAvgVolumeFieldLoader("RMS_U", [Node_Flow](unsigned long iPoint) {
+    return pow(Node_Flow->GetVelocity(iPoint,0),2);
+  });
+  SetAvgVolumeFieldLoader("RMS_V", [Node_Flow](unsigned long iPoint) {
+    return pow(Node_Flow->GetVelocity(iPoint,1),2);
+  });
+  SetAvgVolumeFieldLoader("RMS_UV", [Node_Flow](unsigned long iPoint) {
+    return Node_Flow->GetVelocity(iPoint,0) * Node_Flow->GetVelocity(iPoint,1);
+  });
+  SetAvgVolumeFieldLoader("RMS_P", [Node_Flow](unsigned long iPoint) { return pow(Node_Flow->GetPressure(iPoint),2); });
   if (nDim == 3){
-    SetAvgVolumeOutputValue("RMS_W", iPoint, pow(Node_Flow->GetVelocity(iPoint,2),2));
-    SetAvgVolumeOutputValue("RMS_VW", iPoint, Node_Flow->GetVelocity(iPoint,2) * Node_Flow->GetVelocity(iPoint,1));
-    SetAvgVolumeOutputValue("RMS_UW", iPoint,  Node_Flow->GetVelocity(iPoint,2) * Node_Flow->GetVelocity(iPoint,0));
-  }
-
-  const su2double umean  = GetVolumeOutputValue("MEAN_VELOCITY-X", iPoint);
-  const su2double uumean = GetVolumeOutputValue("RMS_U", iPoint);
-  const su2double vmean  = GetVolumeOutputValue("MEAN_VELOCITY-Y", iPoint);
-  const su2double vvmean = GetVolumeOutputValue("RMS_V", iPoint);
-  const su2double uvmean = GetVolumeOutputValue("RMS_UV", iPoint);
-  const su2double pmean  = GetVolumeOutputValue("MEAN_PRESSURE", iPoint);
-  const su2double ppmean = GetVolumeOutputValue("RMS_P", iPoint);
-
-  SetVolumeOutputValue("UUPRIME", iPoint, -(umean*umean - uumean));
-  SetVolumeOutputValue("VVPRIME", iPoint, -(vmean*vmean - vvmean));
-  SetVolumeOutputValue("UVPRIME", iPoint, -(umean*vmean - uvmean));
-  SetVolumeOutputValue("PPRIME",  iPoint, -(pmean*pmean - ppmean));
+    SetAvgVolumeFieldLoader("RMS_W", [Node_Flow](unsigned long iPoint) {
+      return pow(Node_Flow->GetVelocity(iPoint,2),2);
+    });
+    SetAvgVolumeFieldLoader("RMS_VW", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetVelocity(iPoint,2) * Node_Flow->GetVelocity(iPoint,1);
+    });
+    SetAvgVolumeFieldLoader("RMS_UW", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetVelocity(iPoint,2) * Node_Flow->GetVelocity(iPoint,0);
+    });
+  }
+
+  /*--- The fluctuations use the means of the same point, which are loaded above (hence they must be
+   * requested too). Only the requested fluctuations are registered, GetVolumeFieldValue checks the means. ---*/
+  auto SetFluctuationLoader = [this](const string& name, const string& mean1, const string& mean2,
+                                     const string& meanProduct) {
+    if (!IsVolumeFieldRequested(name)) return;
+    const auto a = GetVolumeFieldValue(mean1);
+    const auto b = GetVolumeFieldValue(mean2);
+    const auto ab = GetVolumeFieldValue(meanProduct);
+    SetVolumeFieldLoader(name, [=](unsigned long iPoint) { return -(a(iPoint) * b(iPoint) - ab(iPoint)); });
+  };
+  SetFluctuationLoader("UUPRIME", "MEAN_VELOCITY-X", "MEAN_VELOCITY-X", "RMS_U");
+  SetFluctuationLoader("VVPRIME", "MEAN_VELOCITY-Y", "MEAN_VELOCITY-Y", "RMS_V");
+  SetFluctuationLoader("UVPRIME", "MEAN_VELOCITY-X", "MEAN_VELOCITY-Y", "RMS_UV");
+  SetFluctuationLoader("PPRIME", "MEAN_PRESSURE", "MEAN_PRESSURE", "RMS_P");
   if (nDim == 3){
-    const su2double wmean  = GetVolumeOutputValue("MEAN_VELOCITY-Z", iPoint);
-    const su2double wwmean = GetVolumeOutputValue("RMS_W", iPoint);
-    const su2double uwmean = GetVolumeOutputValue("RMS_UW", iPoint);
-    const su2double vwmean = GetVolumeOutputValue("RMS_VW", iPoint);
-    SetVolumeOutputValue("WWPRIME", iPoint, -(wmean*wmean - wwmean));
-    SetVolumeOutputValue("UWPRIME", iPoint, -(umean*wmean - uwmean));
-    SetVolumeOutputValue("VWPRIME",  iPoint, -(vmean*wmean - vwmean));
+    SetFluctuationLoader("WWPRIME", "MEAN_VELOCITY-Z", "MEAN_VELOCITY-Z", "RMS_W");
+    SetFluctuationLoader("UWPRIME", "MEAN_VELOCITY-X", "MEAN_VELOCITY-Z", "RMS_UW");
+    SetFluctuationLoader("VWPRIME", "MEAN_VELOCITY-Y", "MEAN_VELOCITY-Z", "RMS_VW");
   }
 }
 
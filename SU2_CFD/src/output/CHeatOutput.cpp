@@ -131,21 +131,24 @@ void CHeatOutput::SetVolumeOutputFields(CConfig *config){
 }
 
 
-void CHeatOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint){
+bool CHeatOutput::SetVolumeFieldLoaders(CConfig *config, CGeometry *geometry, CSolver **solver){
 
-  CVariable* Node_Heat = solver[HEAT_SOL]->GetNodes();
-  const auto Node_Geo  = geometry->nodes;
+  const auto* heatSolver = solver[HEAT_SOL];
+  const auto* Node_Heat = heatSolver->GetNodes();
 
   // Grid coordinates
-  LoadCoordinates(Node_Geo->GetCoord(iPoint), iPoint);
+  SetCoordinateLoaders(geometry);
 
   // SOLUTION
-  SetVolumeOutputValue("TEMPERATURE", iPoint, Node_Heat->GetSolution(iPoint, 0));
+  SetVolumeFieldLoader("TEMPERATURE", [Node_Heat](unsigned long iPoint) { return Node_Heat->GetSolution(iPoint, 0); });
 
   // Residuals
-  SetVolumeOutputValue("RES_TEMPERATURE", iPoint, solver[HEAT_SOL]->LinSysRes(iPoint, 0));
+  SetVolumeFieldLoader("RES_TEMPERATURE",
+                       [heatSolver](unsigned long iPoint) { return heatSolver->LinSysRes(iPoint, 0); });
 
-  LoadCommonFVMOutputs(config, geometry, iPoint);
+  SetCommonFVMLoaders(config, geometry);
+
+  return true;
 }
 
 void CHeatOutput::LoadSurfaceData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint, unsigned short iMarker, unsigned long iVertex){
@@ -63,20 +63,21 @@ void CMeshOutput::SetVolumeOutputFields(CConfig *config){
 
 }
 
-void CMeshOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint){
+bool CMeshOutput::SetVolumeFieldLoaders(CConfig *config, CGeometry *geometry, CSolver **solver){
 
-  CPoint*    Node_Geo  = geometry->nodes;
+  const auto* Node_Geo = geometry->nodes;
 
-  SetVolumeOutputValue("COORD-X", iPoint,  Node_Geo->GetCoord(iPoint, 0));
-  SetVolumeOutputValue("COORD-Y", iPoint,  Node_Geo->GetCoord(iPoint, 1));
+  SetVolumeFieldLoader("COORD-X", [Node_Geo](unsigned long iPoint) { return Node_Geo->GetCoord(iPoint, 0); });
+  SetVolumeFieldLoader("COORD-Y", [Node_Geo](unsigned long iPoint) { return Node_Geo->GetCoord(iPoint, 1); });
   if (nDim == 3)
-    SetVolumeOutputValue("COORD-Z", iPoint, Node_Geo->GetCoord(iPoint, 2));
+    SetVolumeFieldLoader("COORD-Z", [Node_Geo](unsigned long iPoint) { return Node_Geo->GetCoord(iPoint, 2); });
 
   // Mesh quality metrics
   if (config->GetWrt_MeshQuality()) {
-    SetVolumeOutputValue("ORTHOGONALITY", iPoint, geometry->Orthogonality[iPoint]);
-    SetVolumeOutputValue("ASPECT_RATIO",  iPoint, geometry->Aspect_Ratio[iPoint]);
-    SetVolumeOutputValue("VOLUME_RATIO",  iPoint, geometry->Volume_Ratio[iPoint]);
+    SetVolumeFieldLoader("ORTHOGONALITY", [geometry](unsigned long iPoint) { return geometry->Orthogonality[iPoint]; });
+    SetVolumeFieldLoader("ASPECT_RATIO",  [geometry](unsigned long iPoint) { return geometry->Aspect_Ratio[iPoint]; });
+    SetVolumeFieldLoader("VOLUME_RATIO",  [geometry](unsigned long iPoint) { return geometry->Volume_Ratio[iPoint]; });
   }
 
+  return true;
 }
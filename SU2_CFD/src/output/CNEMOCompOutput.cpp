@@ -174,6 +174,10 @@ void CNEMOCompOutput::SetHistoryOutputFields(CConfig *config){
   AddHistoryOutput("MAX_CFL", "Max CFL", ScreenOutputFormat::SCIENTIFIC, "CFL_NUMBER", "Current maximum of the local CFL numbers");
   AddHistoryOutput("AVG_CFL", "Avg CFL", ScreenOutputFormat::SCIENTIFIC, "CFL_NUMBER", "Current average of the local CFL numbers");
 
+  if (config->GetChemistry_PointImplicit()) {
+    AddHistoryOutput("CHEM_REJECTED", "Chem_Rejected", ScreenOutputFormat::INTEGER, "CHEMISTRY", "Number of point updates that rejected the point implicit chemistry");
+  }
+
   ///   /// BEGIN_GROUP: FIXED_CL, DESCRIPTION: Relevant outputs for the Fixed CL mode
   if (config->GetFixed_CL_Mode()){
     /// DESCRIPTION: Difference between current and target CL
@@ -303,90 +307,151 @@ void CNEMOCompOutput::SetVolumeOutputFields(CConfig *config){
   }
 }
 
-void CNEMOCompOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint){
+bool CNEMOCompOutput::SetVolumeFieldLoaders(CConfig *config, CGeometry *geometry, CSolver **solver){
 
-  const auto* Node_Flow = solver[FLOW_SOL]->GetNodes();
+  const auto* flowSolver = solver[FLOW_SOL];
+  const auto* Node_Flow = flowSolver->GetNodes();
   auto* Node_Geo = geometry->nodes;
   const auto nSpecies = config->GetnSpecies();
 
-  LoadCoordinates(Node_Geo->GetCoord(iPoint), iPoint);
+  SetCoordinateLoaders(geometry);
 
-  for(iSpecies = 0; iSpecies < nSpecies; iSpecies++)
-    SetVolumeOutputValue("DENSITY_" + std::to_string(iSpecies),   iPoint, Node_Flow->GetSolution(iPoint, iSpecies));
-
-  SetVolumeOutputValue("MOMENTUM-X", iPoint, Node_Flow->GetSolution(iPoint, nSpecies));
-  SetVolumeOutputValue("MOMENTUM-Y", iPoint, Node_Flow->GetSolution(iPoint, nSpecies+1));
-  if (nDim == 3){
-    SetVolumeOutputValue("MOMENTUM-Z", iPoint, Node_Flow->GetSolution(iPoint, nSpecies+2));
-    SetVolumeOutputValue("ENERGY",     iPoint, Node_Flow->GetSolution(iPoint, nSpecies+3));
-    SetVolumeOutputValue("ENERGY_VE",  iPoint, Node_Flow->GetSolution(iPoint, nSpecies+4));
-  } else {
-    SetVolumeOutputValue("ENERGY",     iPoint, Node_Flow->GetSolution(iPoint, nSpecies+2));
-    SetVolumeOutputValue("ENERGY_VE",  iPoint, Node_Flow->GetSolution(iPoint, nSpecies+3));
+  for(iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+    const unsigned short iVar = iSpecies;
+    SetVolumeFieldLoader("DENSITY_" + std::to_string(iSpecies), [Node_Flow, iVar](unsigned long iPoint) {
+      return Node_Flow->GetSolution(iPoint, iVar);
+    });
   }
 
-  for(iSpecies = 0; iSpecies < nSpecies; iSpecies++)
-    SetVolumeOutputValue("MASSFRAC_" + std::to_string(iSpecies),   iPoint, Node_Flow->GetSolution(iPoint, iSpecies)/Node_Flow->GetDensity(iPoint));
+  /*--- Indices of the momentum and energies in the conservative variables. ---*/
+  const unsigned short iMom = nSpecies, iEnergy = nSpecies+nDim, iEnergyVe = nSpecies+nDim+1;
+
+  SetVolumeFieldLoader("MOMENTUM-X", [Node_Flow, iMom](unsigned long iPoint) {
+    return Node_Flow->GetSolution(iPoint, iMom);
+  });
+  SetVolumeFieldLoader("MOMENTUM-Y", [Node_Flow, iMom](unsigned long iPoint) {
+    return Node_Flow->GetSolution(iPoint, iMom+1);
+  });
+  if (nDim == 3)
+    SetVolumeFieldLoader("MOMENTUM-Z", [Node_Flow, iMom](unsigned long iPoint) {
+      return Node_Flow->GetSolution(iPoint, iMom+2);
+    });
+  SetVolumeFieldLoader("ENERGY", [Node_Flow, iEnergy](unsigned long iPoint) {
+    return Node_Flow->GetSolution(iPoint, iEnergy);
+  });
+  SetVolumeFieldLoader("ENERGY_VE", [Node_Flow, iEnergyVe](unsigned long iPoint) {
+    return Node_Flow->GetSolution(iPoint, iEnergyVe);
+  });
+
+  for(iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+    const unsigned short iVar = iSpecies;
+    SetVolumeFieldLoader("MASSFRAC_" + std::to_string(iSpecies), [Node_Flow, iVar](unsigned long iPoint) {
+      return Node_Flow->GetSolution(iPoint, iVar)/Node_Flow->GetDensity(iPoint);
+    });
+  }
 
   if (gridMovement){
-    SetVolumeOutputValue("GRID_VELOCITY-X", iPoint, Node_Geo->GetGridVel(iPoint)[0]);
-    SetVolumeOutputValue("GRID_VELOCITY-Y", iPoint, Node_Geo->GetGridVel(iPoint)[1]);
+    SetVolumeFieldLoader("GRID_VELOCITY-X", [Node_Geo](unsigned long iPoint) {
+      return Node_Geo->GetGridVel(iPoint)[0];
+    });
+    SetVolumeFieldLoader("GRID_VELOCITY-Y", [Node_Geo](unsigned long iPoint) {
+      return Node_Geo->GetGridVel(iPoint)[1];
+    });
     if (nDim == 3)
-      SetVolumeOutputValue("GRID_VELOCITY-Z", iPoint, Node_Geo->GetGridVel(iPoint)[2]);
+      SetVolumeFieldLoader("GRID_VELOCITY-Z", [Node_Geo](unsigned long iPoint) {
+        return Node_Geo->GetGridVel(iPoint)[2];
+      });
   }
 
-  SetVolumeOutputValue("PRESSURE", iPoint, Node_Flow->GetPressure(iPoint));
-  SetVolumeOutputValue("TEMPERATURE_TR", iPoint, Node_Flow->GetTemperature(iPoint));
-  SetVolumeOutputValue("TEMPERATURE_VE", iPoint, Node_Flow->GetTemperature_ve(iPoint));
-  SetVolumeOutputValue("VELOCITY-X", iPoint, Node_Flow->GetVelocity(iPoint, 0));
-  SetVolumeOutputValue("VELOCITY-Y", iPoint, Node_Flow->GetVelocity(iPoint, 1));
+  SetVolumeFieldLoader("PRESSURE", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetPressure(iPoint); });
+  SetVolumeFieldLoader("TEMPERATURE_TR", [Node_Flow](unsigned long iPoint) {
+    return Node_Flow->GetTemperature(iPoint);
+  });
+  SetVolumeFieldLoader("TEMPERATURE_VE", [Node_Flow](unsigned long iPoint) {
+    return Node_Flow->GetTemperature_ve(iPoint);
+  });
+  SetVolumeFieldLoader("VELOCITY-X", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetVelocity(iPoint, 0); });
+  SetVolumeFieldLoader("VELOCITY-Y", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetVelocity(iPoint, 1); });
   if (nDim == 3)
-    SetVolumeOutputValue("VELOCITY-Z", iPoint, Node_Flow->GetVelocity(iPoint, 2));
+    SetVolumeFieldLoader("VELOCITY-Z", [Node_Flow](unsigned long iPoint) { return Node_Flow->GetVelocity(iPoint, 2); });
 
-  SetVolumeOutputValue("MACH", iPoint, sqrt(Node_Flow->GetVelocity2(iPoint))/Node_Flow->GetSoundSpeed(iPoint));
+  SetVolumeFieldLoader("MACH", [Node_Flow](unsigned long iPoint) {
+    return sqrt(Node_Flow->GetVelocity2(iPoint))/Node_Flow->GetSoundSpeed(iPoint);
+  });
 
-  const su2double factor = solver[FLOW_SOL]->GetReferenceDynamicPressure();
-  SetVolumeOutputValue("PRESSURE_COEFF", iPoint, (Node_Flow->GetPressure(iPoint) - solver[FLOW_SOL]->GetPressure_Inf())/factor);
+  const su2double factor = flowSolver->GetReferenceDynamicPressure();
+  const su2double pressureInf = flowSolver->GetPressure_Inf();
+  SetVolumeFieldLoader("PRESSURE_COEFF", [Node_Flow, factor, pressureInf](unsigned long iPoint) {
+    return (Node_Flow->GetPressure(iPoint) - pressureInf)/factor;
+  });
 
   if (config->GetViscous()){
-    SetVolumeOutputValue("LAMINAR_VISCOSITY", iPoint, Node_Flow->GetLaminarViscosity(iPoint));
-    SetVolumeOutputValue("THERMAL_CONDUCTIVITY_TR", iPoint, Node_Flow->GetThermalConductivity(iPoint));
-    SetVolumeOutputValue("THERMAL_CONDUCTIVITY_VE", iPoint, Node_Flow->GetThermalConductivity_ve(iPoint));
+    SetVolumeFieldLoader("LAMINAR_VISCOSITY", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetLaminarViscosity(iPoint);
+    });
+    SetVolumeFieldLoader("THERMAL_CONDUCTIVITY_TR", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetThermalConductivity(iPoint);
+    });
+    SetVolumeFieldLoader("THERMAL_CONDUCTIVITY_VE", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetThermalConductivity_ve(iPoint);
+    });
   }
 
-  for(iSpecies = 0; iSpecies < nSpecies; iSpecies++)
-    SetVolumeOutputValue("RES_DENSITY_" + std::to_string(iSpecies), iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, iSpecies));
-
-  SetVolumeOutputValue("RES_MOMENTUM-X", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, nSpecies));
-  SetVolumeOutputValue("RES_MOMENTUM-Y", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, nSpecies+1));
-  if (nDim == 3){
-    SetVolumeOutputValue("RES_MOMENTUM-Z", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, nSpecies+2));
-    SetVolumeOutputValue("RES_ENERGY",     iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, nSpecies+3));
-    SetVolumeOutputValue("RES_ENERGY_VE",  iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, nSpecies+4));
-  } else {
-    SetVolumeOutputValue("RES_ENERGY", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, nSpecies+2));
-    SetVolumeOutputValue("RES_ENERGY_VE", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, nSpecies+3));
+  for(iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+    const unsigned short iVar = iSpecies;
+    SetVolumeFieldLoader("RES_DENSITY_" + std::to_string(iSpecies), [flowSolver, iVar](unsigned long iPoint) {
+      return flowSolver->LinSysRes(iPoint, iVar);
+    });
+  }
+
+  SetVolumeFieldLoader("RES_MOMENTUM-X", [flowSolver, iMom](unsigned long iPoint) {
+    return flowSolver->LinSysRes(iPoint, iMom);
+  });
+  SetVolumeFieldLoader("RES_MOMENTUM-Y", [flowSolver, iMom](unsigned long iPoint) {
+    return flowSolver->LinSysRes(iPoint, iMom+1);
+  });
+  if (nDim == 3) {
+    SetVolumeFieldLoader("RES_MOMENTUM-Z", [flowSolver, iMom](unsigned long iPoint) {
+      return flowSolver->LinSysRes(iPoint, iMom+2);
+    });
   }
+  SetVolumeFieldLoader("RES_ENERGY", [flowSolver, iEnergy](unsigned long iPoint) {
+    return flowSolver->LinSysRes(iPoint, iEnergy);
+  });
+  SetVolumeFieldLoader("RES_ENERGY_VE", [flowSolver, iEnergyVe](unsigned long iPoint) {
+    return flowSolver->LinSysRes(iPoint, iEnergyVe);
+  });
 
   if (config->GetKind_SlopeLimit_Flow() != LIMITER::NONE && config->GetKind_SlopeLimit_Flow() != LIMITER::VAN_ALBADA_EDGE) {
-    SetVolumeOutputValue("LIMITER_DENSITY",    iPoint, Node_Flow->GetLimiter_Primitive(iPoint, 0));
-    SetVolumeOutputValue("LIMITER_MOMENTUM-X", iPoint, Node_Flow->GetLimiter_Primitive(iPoint, 1));
-    SetVolumeOutputValue("LIMITER_MOMENTUM-Y", iPoint, Node_Flow->GetLimiter_Primitive(iPoint, 2));
+    SetVolumeFieldLoader("LIMITER_DENSITY", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetLimiter_Primitive(iPoint, 0);
+    });
+    SetVolumeFieldLoader("LIMITER_MOMENTUM-X", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetLimiter_Primitive(iPoint, 1);
+    });
+    SetVolumeFieldLoader("LIMITER_MOMENTUM-Y", [Node_Flow](unsigned long iPoint) {
+      return Node_Flow->GetLimiter_Primitive(iPoint, 2);
+    });
     if (nDim == 3){
-      SetVolumeOutputValue("LIMITER_MOMENTUM-Z", iPoint, Node_Flow->GetLimiter_Primitive(iPoint, 3));
-      SetVolumeOutputValue("LIMITER_ENERGY",     iPoint, Node_Flow->GetLimiter_Primitive(iPoint, 4));
-    } else {
-      SetVolumeOutputValue("LIMITER_ENERGY", iPoint, Node_Flow->GetLimiter_Primitive(iPoint, 3));
+      SetVolumeFieldLoader("LIMITER_MOMENTUM-Z", [Node_Flow](unsigned long iPoint) {
+        return Node_Flow->GetLimiter_Primitive(iPoint, 3);
+      });
     }
+    const unsigned short iLimEnergy = nDim + 1;
+    SetVolumeFieldLoader("LIMITER_ENERGY", [Node_Flow, iLimEnergy](unsigned long iPoint) {
+      return Node_Flow->GetLimiter_Primitive(iPoint, iLimEnergy);
+    });
   }
 
-  LoadVolumeDataScalar(config, solver, geometry, iPoint);
+  SetVolumeFieldLoadersScalar(config, solver, geometry);
 
-  LoadCommonFVMOutputs(config, geometry, iPoint);
+  SetCommonFVMLoaders(config, geometry);
 
   if (config->GetTime_Domain()) {
-    LoadTimeAveragedData(iPoint, Node_Flow);
+    SetTimeAveragedLoaders(Node_Flow);
   }
+
+  return true;
 }
 
 void CNEMOCompOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSolver **solver)  {
@@ -433,6 +498,10 @@ void CNEMOCompOutput::LoadHistoryData(CConfig *config, CGeometry *geometry, CSol
   SetHistoryOutputValue("MAX_CFL", NEMO_solver->GetMax_CFL_Local());
   SetHistoryOutputValue("AVG_CFL", NEMO_solver->GetAvg_CFL_Local());
 
+  if (config->GetChemistry_PointImplicit()) {
+    SetHistoryOutputValue("CHEM_REJECTED", NEMO_solver->GetnChemistryRejected());
+  }
+
   SetHistoryOutputValue("LINSOL_ITER", NEMO_solver->GetIterLinSolver());
   SetHistoryOutputValue("LINSOL_RESIDUAL", log10(NEMO_solver->GetResLinSolver()));
 
@@ -46,6 +46,9 @@
 #include "../../include/output/filewriter/CSU2FileWriter.hpp"
 #include "../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
 #include "../../include/output/filewriter/CSU2MeshFileWriter.hpp"
+#include "../../include/output/filewriter/CAsyncFileWriter.hpp"
+#include "../../include/solvers/CRestartCheckpoints.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 
 COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
   rank(SU2_MPI::GetRank()),
@@ -59,6 +62,12 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
 
   cauchyTimeConverged = false;
 
+  asyncOutput = config->GetAsync_Output() && CAsyncFileWriter::Supported();
+  if (config->GetAsync_Output() && !asyncOutput && rank == MASTER_NODE) {
+    cout << "WARNING: ASYNC_OUTPUT requires MPI_THREAD_MULTIPLE (SU2_CFD --thread_multiple) and is not "
+            "available in AD builds, the output is written synchronously." << endl;
+  }
+
   convergenceTable = new PrintingToolbox::CTablePrinter(&std::cout);
   multiZoneHeaderTable = new PrintingToolbox::CTablePrinter(&std::cout);
   fileWritingTable = new PrintingToolbox::CTablePrinter(&std::cout);
@@ -174,6 +183,9 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
 
 COutput::~COutput() {
 
+  /*--- Finish writing the files before the program can exit. ---*/
+  delete asyncWriter;
+
   delete convergenceTable;
   delete multiZoneHeaderTable;
   delete fileWritingTable;
@@ -363,6 +375,8 @@ void COutput::LoadData(CGeometry *geometry, CConfig *config, CSolver** solver_co
 
 void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE format, string fileName){
 
+  SU2_PROFILE_SCOPE("WriteToFile");
+
   /*--- File writer that will later be used to write the file to disk. Created below in the "switch" ---*/
   CFileWriter *fileWriter = nullptr;
 
@@ -431,7 +445,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
         filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
 
       LogOutputFiles("SU2 binary restart");
-      fileWriter = new CSU2BinaryFileWriter(volumeDataSorter);
+      fileWriter = new CSU2BinaryFileWriter(volumeDataSorter, config->GetWrt_Restart_Compressed());
 
       break;
 
@@ -454,6 +468,25 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       break;
 
+    case OUTPUT_TYPE::MESH_BINARY:
+
+      extension = CSU2MeshFileWriter::fileExtBinary;
+
+      if (fileName.empty())
+        fileName = volumeFilename;
+
+      if (!config->GetWrt_Volume_Overwrite())
+        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+
+      /*--- Load and sort the output data and connectivity. ---*/
+
+      volumeDataSorter->SortConnectivity(config, geometry, true);
+
+      LogOutputFiles("SU2 binary mesh");
+      fileWriter = new CSU2MeshFileWriter(volumeDataSorter, config->GetiZone(), config->GetnZone(), true);
+
+      break;
+
     case OUTPUT_TYPE::TECPLOT_BINARY:
 
       extension = CTecplotBinaryFileWriter::fileExt;
@@ -738,7 +771,27 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       break;
   }
 
-  if (fileWriter != nullptr) {
+  /*--- Restart data kept in memory is outdated once the file is rewritten. ---*/
+
+  if (format == OUTPUT_TYPE::RESTART_ASCII || format == OUTPUT_TYPE::CSV || format == OUTPUT_TYPE::RESTART_BINARY) {
+    CRestartCheckpoints::Invalidate(fileName + extension);
+    if (!filename_iter.empty()) CRestartCheckpoints::Invalidate(filename_iter + extension);
+  }
+
+  if (fileWriter != nullptr && asyncOutput && CAsyncFileWriter::SupportsFormat(format)) {
+
+    /*--- Copy the data and write it in the background, the writer is deleted once done.
+     *    The bandwidth is reported when the files are complete. ---*/
+
+    if (asyncWriter == nullptr) asyncWriter = new CAsyncFileWriter();
+
+    vector<string> fileNames = {fileName};
+    if (!filename_iter.empty()) fileNames.push_back(filename_iter);
+    asyncWriter->Submit(fileWriter, format, std::move(fileNames));
+
+    ReportAsyncOutput(config, false);
+
+  } else if (fileWriter != nullptr) {
 
     /*--- Write data to file ---*/
 
@@ -788,6 +841,8 @@ bool COutput::GetCauchyCorrectedTimeConvergence(const CConfig *config){
 bool COutput::SetResultFiles(CGeometry *geometry, CConfig *config, CSolver** solver_container,
                               unsigned long iter, bool force_writing) {
 
+  SU2_PROFILE_SCOPE("Output");
+
   bool isFileWrite = false, dataIsLoaded = false;
   const auto nVolumeFiles = config->GetnVolumeOutputFiles();
   const auto* VolumeFiles = config->GetVolumeOutputFiles();
@@ -838,6 +893,57 @@ bool COutput::SetResultFiles(CGeometry *geometry, CConfig *config, CSolver** sol
   return isFileWrite;
 }
 
+void COutput::ReportAsyncOutput(CConfig *config, bool wait) {
+
+  if (asyncWriter == nullptr) return;
+
+  for (const auto& report : asyncWriter->TakeReports(wait)) {
+
+    if (report.format == OUTPUT_TYPE::RESTART_BINARY) {
+      config->SetRestart_Bandwidth_Agg(config->GetRestart_Bandwidth_Agg() + report.bandwidth);
+    }
+
+    /*--- The table is only open while files are being written. ---*/
+
+    if (!wait && config->GetWrt_Performance() && (rank == MASTER_NODE)) {
+      for (const auto& name : report.fileNames) (*fileWritingTable) << "Completed in background" << name;
+      fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+      (*fileWritingTable) << " " << "(" + PrintingToolbox::to_string(report.bandwidth) + " MB/s)";
+      fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+    }
+  }
+}
+
+void COutput::FinishAsyncOutput(CConfig *config) {
+
+  ReportAsyncOutput(config, true);
+
+}
+
+void COutput::BroadcastHistoryOutput(int root) {
+
+  /*--- The lists of fields are the same on all ranks, they depend only on the config. ---*/
+
+  vector<passivedouble> values;
+  for (const auto& name : historyOutput_List) {
+    values.push_back(SU2_TYPE::GetValue(historyOutput_Map.at(name).value));
+  }
+  for (const auto& name : historyOutputPerSurface_List) {
+    for (const auto& field : historyOutputPerSurface_Map.at(name)) values.push_back(SU2_TYPE::GetValue(field.value));
+  }
+
+  CBaseMPIWrapper::Bcast(values.data(), values.size(), MPI_DOUBLE, root, SU2_MPI::GetComm());
+
+  auto iValue = 0ul;
+  for (const auto& name : historyOutput_List) {
+    historyOutput_Map.at(name).value = values[iValue++];
+  }
+  for (const auto& name : historyOutputPerSurface_List) {
+    for (auto& field : historyOutputPerSurface_Map.at(name)) field.value = values[iValue++];
+  }
+
+}
+
 void COutput::PrintConvergenceSummary(){
 
   PrintingToolbox::CTablePrinter  ConvSummary(&cout);
@@ -1614,14 +1720,38 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
 
   } else {
 
-    for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    volumeFieldLoaders.clear();
+
+    if (SetVolumeFieldLoaders(config, geometry, solver)) {
+
+      /*--- Columnar loading, the fields were resolved to their offsets when the loaders were registered,
+       * each thread fills the contiguous rows of its points in the send buffer of the data sorter. ---*/
+
+      const unsigned long nPointDomain = geometry->GetnPointDomain();
+
+      SU2_OMP_PARALLEL
+      {
+        SU2_OMP_FOR_STAT(roundUpDiv(nPointDomain, 2*omp_get_max_threads()))
+        for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+          for (const auto& loader : volumeFieldLoaders) {
+            volumeDataSorter->SetUnsortedData(iPoint, loader.first, loader.second(iPoint));
+          }
+        }
+        END_SU2_OMP_FOR
+      }
+      END_SU2_OMP_PARALLEL
+
+    } else {
+
+      for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
 
-      /*--- Load the volume data into the data sorter. --- */
+        /*--- Load the volume data into the data sorter. --- */
 
-      buildFieldIndexCache = fieldIndexCache.empty();
+        buildFieldIndexCache = fieldIndexCache.empty();
 
-      LoadVolumeData(config, geometry, solver, iPoint);
+        LoadVolumeData(config, geometry, solver, iPoint);
 
+      }
     }
 
     /*--- Reset the offset cache and index --- */
@@ -1686,6 +1816,17 @@ void COutput::SetVolumeOutputValue(const string& name, unsigned long iPoint, su2
 
 }
 
+void COutput::SetVolumeFieldLoader(const string& name, VolumeFieldLoader loader){
+
+  if (volumeOutput_Map.count(name) == 0) {
+    SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
+  }
+  const short Offset = volumeOutput_Map.at(name).offset;
+  if (Offset != -1){
+    volumeFieldLoaders.emplace_back(Offset, std::move(loader));
+  }
+}
+
 su2double COutput::GetVolumeOutputValue(const string& name, unsigned long iPoint){
 
   if (buildFieldIndexCache){
@@ -1762,6 +1903,46 @@ void COutput::SetAvgVolumeOutputValue(const string& name, unsigned long iPoint,
 
 }
 
+void COutput::SetAvgVolumeFieldLoader(const string& name, VolumeFieldLoader loader){
+
+  if (volumeOutput_Map.count(name) == 0) {
+    SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
+  }
+  const short Offset = volumeOutput_Map.at(name).offset;
+  if (Offset == -1) return;
+
+  const su2double scaling = 1.0 / su2double(curAbsTimeIter + 1);
+  const auto* sorter = volumeDataSorter;
+
+  volumeFieldLoaders.emplace_back(Offset, [=](unsigned long iPoint) -> su2double {
+    const su2double old_value = sorter->GetUnsortedData(iPoint, Offset);
+    return loader(iPoint) * scaling + old_value * (1.0 - scaling);
+  });
+}
+
+bool COutput::IsVolumeFieldRequested(const string& name) const {
+  const auto it = volumeOutput_Map.find(name);
+  return it != volumeOutput_Map.end() && it->second.offset != -1;
+}
+
+COutput::VolumeFieldLoader COutput::GetVolumeFieldValue(const string& name) const {
+
+  if (volumeOutput_Map.count(name) == 0) {
+    SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
+  }
+  const short Offset = volumeOutput_Map.at(name).offset;
+
+  /*--- The value is read from the data sorter, it must be requested and loaded before the caller. ---*/
+  const bool loaded = std::any_of(volumeFieldLoaders.begin(), volumeFieldLoaders.end(),
+                                  [Offset](const auto& loader) { return loader.first == Offset; });
+  if (Offset == -1 || !loaded) {
+    SU2_MPI::Error(string("Output field ") + name + " is used by another field, it must be requested and loaded first.",
+                   CURRENT_FUNCTION);
+  }
+  const auto* sorter = volumeDataSorter;
+  return [sorter, Offset](unsigned long iPoint) { return su2double(sorter->GetUnsortedData(iPoint, Offset)); };
+}
+
 void COutput::PostprocessHistoryData(CConfig *config){
 
   map<string, pair<su2double, int> > Average;
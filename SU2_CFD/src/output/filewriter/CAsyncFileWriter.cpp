@@ -0,0 +1,139 @@
+/*!
+ * \file CAsyncFileWriter.cpp
+ * \brief Implementation of the class that writes output files in a background thread.
+ * \author P. Gomes
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "../../../include/output/filewriter/CAsyncFileWriter.hpp"
+#include "../../../include/output/filewriter/CDataSorterSnapshot.hpp"
+
+constexpr size_t CAsyncFileWriter::MAX_PENDING;
+
+CAsyncFileWriter::CAsyncFileWriter() {
+#ifdef HAVE_MPI
+  MPI_Comm_dup(SU2_MPI::GetComm(), &comm);
+#else
+  comm = SU2_MPI::GetComm();
+#endif
+  worker = std::thread(&CAsyncFileWriter::Work, this);
+}
+
+CAsyncFileWriter::~CAsyncFileWriter() {
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    stop = true;
+  }
+  cond.notify_all();
+  worker.join();
+#ifdef HAVE_MPI
+  MPI_Comm_free(&comm);
+#endif
+}
+
+bool CAsyncFileWriter::Supported() {
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  return false;
+#elif defined(HAVE_MPI)
+  int provided = MPI_THREAD_SINGLE;
+  MPI_Query_thread(&provided);
+  return provided == MPI_THREAD_MULTIPLE;
+#else
+  return true;
+#endif
+}
+
+bool CAsyncFileWriter::SupportsFormat(OUTPUT_TYPE format) {
+  switch (format) {
+    case OUTPUT_TYPE::RESTART_BINARY:
+    case OUTPUT_TYPE::PARAVIEW_XML:
+    case OUTPUT_TYPE::SURFACE_PARAVIEW_XML:
+    case OUTPUT_TYPE::PARAVIEW_LEGACY_BINARY:
+    case OUTPUT_TYPE::SURFACE_PARAVIEW_LEGACY_BINARY:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void CAsyncFileWriter::Submit(CFileWriter* writer, OUTPUT_TYPE format, std::vector<std::string> fileNames) {
+  CJob job;
+  job.writer.reset(writer);
+  job.snapshot.reset(new CDataSorterSnapshot(*writer->GetDataSorter()));
+  job.fileNames = std::move(fileNames);
+  job.format = format;
+
+  writer->SetDataSorter(job.snapshot.get());
+  writer->SetComm(comm);
+
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    cond.wait(lock, [this]() { return jobs.size() < MAX_PENDING; });
+    jobs.push_back(std::move(job));
+  }
+  cond.notify_all();
+}
+
+void CAsyncFileWriter::Work() {
+  while (true) {
+    CJob* job = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      cond.wait(lock, [this]() { return stop || !jobs.empty(); });
+      /*--- Pending jobs are always completed before stopping. ---*/
+      if (jobs.empty()) return;
+      /*--- The job is only removed once written, references to deque elements survive push_back. ---*/
+      job = &jobs.front();
+    }
+
+    /*--- Measure the files as the synchronous output does, the bandwidth is averaged over the files. ---*/
+
+    CReport report;
+    report.format = job->format;
+
+    for (const auto& fileName : job->fileNames) {
+      job->writer->WriteData(fileName);
+      report.fileNames.push_back(fileName + job->writer->GetFileExtension());
+      report.usedTime += job->writer->GetUsedTime();
+      report.fileSize += job->writer->GetFilesize();
+      report.bandwidth += job->writer->GetBandwidth();
+    }
+    if (!job->fileNames.empty()) report.bandwidth /= job->fileNames.size();
+
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      reports.push_back(std::move(report));
+      jobs.pop_front();
+    }
+    cond.notify_all();
+  }
+}
+
+std::vector<CAsyncFileWriter::CReport> CAsyncFileWriter::TakeReports(bool wait) {
+  std::vector<CReport> taken;
+  std::unique_lock<std::mutex> lock(mtx);
+  if (wait) cond.wait(lock, [this]() { return jobs.empty(); });
+  taken.swap(reports);
+  return taken;
+}
@@ -66,6 +66,62 @@ CParallelDataSorter::CParallelDataSorter(CConfig *config, const vector<string> &
 
 }
 
+namespace {
+template <class T>
+T* CopyArray(const T* src, unsigned long n) {
+  if (src == nullptr) return nullptr;
+  auto* dst = new T[n];
+  std::copy(src, src + n, dst);
+  return dst;
+}
+}
+
+CParallelDataSorter::CParallelDataSorter(const CParallelDataSorter& other) :
+  rank(other.rank),
+  size(other.size),
+  nGlobalPointBeforeSort(other.nGlobalPointBeforeSort),
+  nLocalPointsBeforeSort(other.nLocalPointsBeforeSort),
+  nElemPerTypeGlobal(other.nElemPerTypeGlobal),
+  nElemPerType(other.nElemPerType),
+  nPointsGlobal(other.nPointsGlobal),
+  nElemGlobal(other.nElemGlobal),
+  nConnGlobal(other.nConnGlobal),
+  nPoints(other.nPoints),
+  nElem(other.nElem),
+  nConn(other.nConn),
+  linearPartitioner(other.linearPartitioner),
+  GlobalField_Counter(other.GlobalField_Counter),
+  connectivitySorted(other.connectivitySorted),
+  fieldNames(other.fieldNames),
+  nDim(other.nDim) {
+
+  Conn_Line_Par = CopyArray(other.Conn_Line_Par, nElemPerType[TypeMap.at(LINE)]*N_POINTS_LINE);
+  Conn_Tria_Par = CopyArray(other.Conn_Tria_Par, nElemPerType[TypeMap.at(TRIANGLE)]*N_POINTS_TRIANGLE);
+  Conn_Quad_Par = CopyArray(other.Conn_Quad_Par, nElemPerType[TypeMap.at(QUADRILATERAL)]*N_POINTS_QUADRILATERAL);
+  Conn_Tetr_Par = CopyArray(other.Conn_Tetr_Par, nElemPerType[TypeMap.at(TETRAHEDRON)]*N_POINTS_TETRAHEDRON);
+  Conn_Hexa_Par = CopyArray(other.Conn_Hexa_Par, nElemPerType[TypeMap.at(HEXAHEDRON)]*N_POINTS_HEXAHEDRON);
+  Conn_Pris_Par = CopyArray(other.Conn_Pris_Par, nElemPerType[TypeMap.at(PRISM)]*N_POINTS_PRISM);
+  Conn_Pyra_Par = CopyArray(other.Conn_Pyra_Par, nElemPerType[TypeMap.at(PYRAMID)]*N_POINTS_PYRAMID);
+
+  dataBuffer = CopyArray(other.dataBuffer, nPoints*GlobalField_Counter);
+
+  /*--- The communication buffers are not needed to write the data. ---*/
+
+  Index    = nullptr;
+  connSend = nullptr;
+  idSend   = nullptr;
+  nSends = 0;
+  nRecvs = 0;
+
+  nPoint_Send = new int[size+1]();
+  nPoint_Recv = new int[size+1]();
+  nElem_Send  = new int[size+1]();
+  nElemConn_Send = new int[size+1]();
+  nElem_Cum = CopyArray(other.nElem_Cum, size+1);
+  nElemConn_Cum = CopyArray(other.nElemConn_Cum, size+1);
+
+}
+
 CParallelDataSorter::~CParallelDataSorter(){
 
   delete [] nPoint_Send;
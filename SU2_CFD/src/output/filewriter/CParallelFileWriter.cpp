@@ -28,10 +28,14 @@
 #include <utility>
 
 #include "../../../include/output/filewriter/CFileWriter.hpp"
+#include "../../../../Common/include/toolboxes/compression_toolbox.hpp"
+
+constexpr unsigned long CFileWriter::COMPRESSED_CHUNK_ROWS;
 
 CFileWriter::CFileWriter(CParallelDataSorter *valDataSorter, string valFileExt):
   fileExt(std::move(valFileExt)),
-  dataSorter(valDataSorter){
+  dataSorter(valDataSorter),
+  comm(SU2_MPI::GetComm()){
 
   rank = SU2_MPI::GetRank();
   size = SU2_MPI::GetSize();
@@ -42,7 +46,8 @@ CFileWriter::CFileWriter(CParallelDataSorter *valDataSorter, string valFileExt):
 }
 
 CFileWriter::CFileWriter(string valFileExt):
-  fileExt(std::move(valFileExt)){
+  fileExt(std::move(valFileExt)),
+  comm(SU2_MPI::GetComm()){
 
   rank = SU2_MPI::GetRank();
   size = SU2_MPI::GetSize();
@@ -153,6 +158,53 @@ bool CFileWriter::WriteMPIBinaryData(const void *data, unsigned long sizeInBytes
 
 }
 
+bool CFileWriter::WriteMPICompressedDataAll(const void *data, unsigned long nRows, unsigned long nCols,
+                                            unsigned short itemSize, unsigned long firstRow){
+
+  /*--- Compress the local rows in chunks, readers then only decompress the chunks they need. ---*/
+
+  const auto* bytes = static_cast<const char*>(data);
+  const unsigned long rowSize = nCols*itemSize;
+  const unsigned long nChunk = (nRows + COMPRESSED_CHUNK_ROWS - 1) / COMPRESSED_CHUNK_ROWS;
+
+  vector<char> compressed, chunk;
+  vector<uint64_t> myChunks(3*nChunk);
+
+  for (unsigned long iChunk = 0; iChunk < nChunk; iChunk++) {
+    const unsigned long begin = iChunk*COMPRESSED_CHUNK_ROWS;
+    const unsigned long count = min(COMPRESSED_CHUNK_ROWS, nRows - begin);
+    CompressionToolbox::Compress(bytes + begin*rowSize, count, nCols, itemSize, chunk);
+    compressed.insert(compressed.end(), chunk.begin(), chunk.end());
+    myChunks[3*iChunk] = firstRow + begin;
+    myChunks[3*iChunk + 1] = count;
+    myChunks[3*iChunk + 2] = chunk.size();
+  }
+
+  /*--- Gather the table of chunks (in rank order, as bytes since the entries are uint64_t), the offset of
+   *    the local chunks is the size of the chunks of lower ranks. ---*/
+
+  const int myTableBytes = myChunks.size()*sizeof(uint64_t);
+  vector<int> tableBytes(size), tableDispl(size+1, 0);
+  SU2_MPI::Allgather(&myTableBytes, 1, MPI_INT, tableBytes.data(), 1, MPI_INT, comm);
+  for (int iRank = 0; iRank < size; iRank++) tableDispl[iRank+1] = tableDispl[iRank] + tableBytes[iRank];
+
+  vector<uint64_t> table(1 + tableDispl[size]/sizeof(uint64_t));
+  table[0] = (table.size() - 1) / 3;
+  SU2_MPI::Allgatherv(myChunks.data(), myTableBytes, MPI_CHAR, &table[1], tableBytes.data(),
+                      tableDispl.data(), MPI_CHAR, comm);
+
+  const uint64_t firstChunk = tableDispl[rank] / (3*sizeof(uint64_t));
+  unsigned long offsetInBytes = 0, totalSizeInBytes = 0;
+  for (uint64_t iChunk = 0; iChunk < table[0]; iChunk++) {
+    if (iChunk < firstChunk) offsetInBytes += table[3*iChunk + 3];
+    totalSizeInBytes += table[3*iChunk + 3];
+  }
+
+  bool success = WriteMPIBinaryData(table.data(), table.size()*sizeof(uint64_t), MASTER_NODE);
+  success &= WriteMPIBinaryDataAll(compressed.data(), compressed.size(), totalSizeInBytes, offsetInBytes);
+  return success;
+}
+
 bool CFileWriter::WriteMPIString(const string &str, unsigned short processor){
 
 #ifdef HAVE_MPI
@@ -212,14 +264,14 @@ bool CFileWriter::OpenMPIFile(string val_filename){
    to write a fresh output file, so we delete any existing files and create
    a new one. ---*/
 
-  ierr = MPI_File_open(SU2_MPI::GetComm(), val_filename.c_str(),
+  ierr = MPI_File_open(comm, val_filename.c_str(),
                        MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
                        MPI_INFO_NULL, &fhw);
   if (ierr != MPI_SUCCESS)  {
     MPI_File_close(&fhw);
     if (rank == 0)
       MPI_File_delete(val_filename.c_str(), MPI_INFO_NULL);
-    ierr = MPI_File_open(SU2_MPI::GetComm(), val_filename.c_str(),
+    ierr = MPI_File_open(comm, val_filename.c_str(),
                          MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
                          MPI_INFO_NULL, &fhw);
   }
@@ -260,7 +312,7 @@ bool CFileWriter::CloseMPIFile(){
 
   su2double my_fileSize = fileSize;
   SU2_MPI::Allreduce(&my_fileSize, &fileSize, 1,
-                     MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+                     MPI_DOUBLE, MPI_SUM, comm);
 
   /*--- Compute and store the bandwidth ---*/
 
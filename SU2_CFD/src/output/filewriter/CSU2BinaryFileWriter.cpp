@@ -29,8 +29,8 @@
 
 const string CSU2BinaryFileWriter::fileExt = ".dat";
 
-CSU2BinaryFileWriter::CSU2BinaryFileWriter(CParallelDataSorter *valDataSorter)  :
-  CFileWriter(valDataSorter, fileExt){}
+CSU2BinaryFileWriter::CSU2BinaryFileWriter(CParallelDataSorter *valDataSorter, bool valCompress)  :
+  CFileWriter(valDataSorter, fileExt), compress(valCompress){}
 
 
 CSU2BinaryFileWriter::~CSU2BinaryFileWriter()= default;
@@ -51,10 +51,10 @@ void CSU2BinaryFileWriter::WriteData(string val_filename){
   /*--- Prepare the first ints containing the counts. The first is a
    magic number that we can use to check for binary files (it is the hex
    representation for "SU2"). The second two values are number of variables
-   and number of points (DoFs). ---*/
+   and number of points (DoFs). The fourth value is 1 if the data is compressed. ---*/
 
   int var_buf_size = 5;
-  int var_buf[5] = {535532, nVar, (int)nPoint_Global, 0, 0};
+  int var_buf[5] = {535532, nVar, (int)nPoint_Global, compress, 0};
 
   /*--- Open the file using MPI I/O ---*/
 
@@ -75,6 +75,15 @@ void CSU2BinaryFileWriter::WriteData(string val_filename){
     WriteMPIBinaryData(str_buf, CGNS_STRING_SIZE*sizeof(char), MASTER_NODE);
   }
 
+  /*--- Compressed data is written in chunks of points, which can be read independently. ---*/
+
+  if (compress) {
+    WriteMPICompressedDataAll(dataSorter->GetData(), nParallel_Poin, nVar, sizeof(passivedouble),
+                              dataSorter->GetnPointCumulative(rank));
+    CloseMPIFile();
+    return;
+  }
+
   /*--- Compute various data sizes --- */
 
   unsigned long sizeInBytesPerPoint = sizeof(passivedouble)*nVar;
@@ -27,15 +27,23 @@
 
 #include "../../../include/output/filewriter/CSU2MeshFileWriter.hpp"
 #include "../../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../../../Common/include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 
 const string CSU2MeshFileWriter::fileExt = ".su2";
+const string CSU2MeshFileWriter::fileExtBinary = ".su2b";
 
 CSU2MeshFileWriter::CSU2MeshFileWriter(CParallelDataSorter *valDataSorter,
-                                       unsigned short valiZone, unsigned short valnZone) :
-   CFileWriter(valDataSorter, fileExt), iZone(valiZone), nZone(valnZone) {}
+                                       unsigned short valiZone, unsigned short valnZone, bool valBinary) :
+   CFileWriter(valDataSorter, valBinary ? fileExtBinary : fileExt), iZone(valiZone), nZone(valnZone),
+   binary(valBinary) {}
 
 void CSU2MeshFileWriter::WriteData(string val_filename) {
 
+  if (binary) {
+    WriteBinaryData(val_filename);
+    return;
+  }
+
   ofstream output_file;
 
   /*--- We append the pre-defined suffix (extension) to the filename (prefix) ---*/
@@ -162,94 +170,229 @@ void CSU2MeshFileWriter::WriteData(string val_filename) {
 
     /*--- Read the boundary information ---*/
 
-    string str = "boundary";
-    if (nZone > 1) str += "_" + PrintingToolbox::to_string(iZone);
-    str += ".dat";
+    vector<string> markerTags;
+    vector<int> markerSendTo;
+    vector<vector<unsigned long> > markerElems;
+    ReadBoundaryFile(markerTags, markerSendTo, markerElems);
+
+    /*--- Write the physical boundaries ---*/
+
+    output_file << "NMARK= " << markerTags.size() << endl;
+
+    for (auto iMarker = 0ul; iMarker < markerTags.size(); iMarker++) {
+
+      const auto nElem_Bound_ = markerElems[iMarker].size() / CSU2BinaryMeshReaderFVM::BOUND_CONN_SIZE;
+      output_file << "MARKER_TAG= " << markerTags[iMarker] << endl;
+      output_file << "MARKER_ELEMS= " << nElem_Bound_<< endl;
+
+      if (markerTags[iMarker] == "SEND_RECEIVE") {
+        output_file << "SEND_TO= " << markerSendTo[iMarker] << endl;
+      }
+
+      for (auto iElem_Bound = 0ul; iElem_Bound < nElem_Bound_; iElem_Bound++) {
 
-    ifstream input_file;
-    input_file.open(str);
+        const auto* record = &markerElems[iMarker][iElem_Bound * CSU2BinaryMeshReaderFVM::BOUND_CONN_SIZE];
+        const auto VTK_Type = record[0];
+        output_file << VTK_Type;
 
-    if (!input_file.is_open()) {
-      SU2_MPI::Error(string("Cannot find ") + str, CURRENT_FUNCTION);
+        const unsigned short nValues = (VTK_Type == LINE || VTK_Type == VERTEX) ? 2 : nPointsOfElementType(VTK_Type);
+        for (unsigned short iValue = 0; iValue < nValues; iValue++) {
+          output_file << "\t" << record[1 + iValue];
+        }
+        output_file << "\n";
+      }
     }
 
-    /*--- Read grid file with format SU2 ---*/
+    output_file.close();
+  }
 
-    string text_line;
-    while (getline(input_file, text_line)) {
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+}
 
-      /*--- Write the physical boundaries ---*/
+void CSU2MeshFileWriter::ReadBoundaryFile(vector<string>& markerTags, vector<int>& markerSendTo,
+                                          vector<vector<unsigned long> >& markerElems) const {
 
-      auto position = text_line.find("NMARK=",0);
+  string str = "boundary";
+  if (nZone > 1) str += "_" + PrintingToolbox::to_string(iZone);
+  str += ".dat";
 
-      if (position == string::npos) continue;
+  ifstream input_file;
+  input_file.open(str);
 
-      text_line.erase(0,6);
-      const auto nMarker_ = atoi(text_line.c_str());
-      output_file << "NMARK= " << nMarker_ << endl;
+  if (!input_file.is_open()) {
+    SU2_MPI::Error(string("Cannot find ") + str, CURRENT_FUNCTION);
+  }
 
-      for (auto iMarker = 0; iMarker < nMarker_; iMarker++) {
+  /*--- Read grid file with format SU2 ---*/
 
-        getline(input_file, text_line);
-        text_line.erase(0,11);
-        for (int iChar = 0; iChar < 20; iChar++) {
-          position = text_line.find(' ', 0);
-          if (position != string::npos) text_line.erase(position,1);
-          position = text_line.find('\r', 0);
-          if (position != string::npos) text_line.erase(position,1);
-          position = text_line.find('\n', 0);
-          if (position != string::npos) text_line.erase(position,1);
-        }
-        string Marker_Tag = text_line;
+  string text_line;
+  while (getline(input_file, text_line)) {
 
-        /*--- Standart physical boundary ---*/
+    auto position = text_line.find("NMARK=",0);
 
-        getline (input_file, text_line);
+    if (position == string::npos) continue;
 
-        text_line.erase(0,13);
-        const auto nElem_Bound_ = atoi(text_line.c_str());
-        output_file << "MARKER_TAG= " << Marker_Tag << endl;
-        output_file << "MARKER_ELEMS= " << nElem_Bound_<< endl;
-        getline (input_file, text_line);
+    text_line.erase(0,6);
+    const auto nMarker_ = atoi(text_line.c_str());
 
-        text_line.erase(0,8);
-        const auto SendTo = atoi(text_line.c_str());
+    markerTags.resize(nMarker_);
+    markerSendTo.resize(nMarker_);
+    markerElems.resize(nMarker_);
 
-        if (Marker_Tag == "SEND_RECEIVE") {
-          output_file << "SEND_TO= " << SendTo << endl;
-        }
+    for (auto iMarker = 0; iMarker < nMarker_; iMarker++) {
 
-        for (auto iElem_Bound = 0; iElem_Bound < nElem_Bound_; iElem_Bound++) {
-
-          getline(input_file, text_line);
-          istringstream bound_line(text_line);
-
-          unsigned short VTK_Type;
-          bound_line >> VTK_Type;
-          output_file << VTK_Type;
-          unsigned long vnodes[4] = {0};
-
-          switch (VTK_Type) {
-          case LINE:
-          case VERTEX:
-            bound_line >> vnodes[0]; bound_line >> vnodes[1];
-            output_file << "\t" << vnodes[0] << "\t" << vnodes[1] << "\n";
-            break;
-          case TRIANGLE:
-            bound_line >> vnodes[0]; bound_line >> vnodes[1]; bound_line >> vnodes[2];
-            output_file << "\t" << vnodes[0] << "\t" << vnodes[1] << "\t" << vnodes[2] << "\n";
-            break;
-          case QUADRILATERAL:
-            bound_line >> vnodes[0]; bound_line >> vnodes[1]; bound_line >> vnodes[2]; bound_line >> vnodes[3];
-            output_file << "\t" << vnodes[0] << "\t" << vnodes[1] << "\t" << vnodes[2] << "\t" << vnodes[3] << "\n";
-            break;
-          }
-        }
+      getline(input_file, text_line);
+      text_line.erase(0,11);
+      for (int iChar = 0; iChar < 20; iChar++) {
+        position = text_line.find(' ', 0);
+        if (position != string::npos) text_line.erase(position,1);
+        position = text_line.find('\r', 0);
+        if (position != string::npos) text_line.erase(position,1);
+        position = text_line.find('\n', 0);
+        if (position != string::npos) text_line.erase(position,1);
+      }
+      markerTags[iMarker] = text_line;
+
+      /*--- Standart physical boundary ---*/
+
+      getline (input_file, text_line);
+
+      text_line.erase(0,13);
+      const auto nElem_Bound_ = atoi(text_line.c_str());
+      getline (input_file, text_line);
+
+      text_line.erase(0,8);
+      markerSendTo[iMarker] = atoi(text_line.c_str());
+
+      auto& elems = markerElems[iMarker];
+      elems.resize(nElem_Bound_ * CSU2BinaryMeshReaderFVM::BOUND_CONN_SIZE, 0);
+
+      for (auto iElem_Bound = 0; iElem_Bound < nElem_Bound_; iElem_Bound++) {
+
+        getline(input_file, text_line);
+        istringstream bound_line(text_line);
+
+        auto* record = &elems[iElem_Bound * CSU2BinaryMeshReaderFVM::BOUND_CONN_SIZE];
+        bound_line >> record[0];
+
+        /*--- Vertices store the rotation type after the node. ---*/
+        const unsigned short nValues = (record[0] == LINE || record[0] == VERTEX) ? 2 : nPointsOfElementType(record[0]);
+        for (unsigned short iValue = 0; iValue < nValues; iValue++) bound_line >> record[1 + iValue];
       }
     }
+  }
+}
 
-    output_file.close();
+void CSU2MeshFileWriter::WriteBinaryData(string val_filename) {
+
+  using BinaryFormat = CSU2BinaryMeshReaderFVM;
+
+  /*--- Binary mesh files contain a single zone, each zone is written to a different file. ---*/
+
+  if (nZone > 1) val_filename += "_" + PrintingToolbox::to_string(iZone);
+
+  const unsigned long nDim = dataSorter->GetnDim();
+  const unsigned long nPoint = dataSorter->GetnPoints();
+  const unsigned long nElem = dataSorter->GetnElem();
+  const unsigned long nPointGlobal = dataSorter->GetnPointsGlobal();
+  const unsigned long nElemGlobal = dataSorter->GetnElemGlobal();
+  const unsigned long nConnGlobal = dataSorter->GetnConnGlobal();
+
+  /*--- Only the master rank reads the markers, they are written at the end of the file. ---*/
+
+  vector<string> markerTags;
+  vector<int> markerSendTo;
+  vector<vector<unsigned long> > markerElems;
+  if (rank == MASTER_NODE) ReadBoundaryFile(markerTags, markerSendTo, markerElems);
+
+  /*--- Header with the sizes and the offsets of the sections. ---*/
+
+  array<uint64_t, BinaryFormat::HEADER_SIZE> header{};
+  header[BinaryFormat::MAGIC] = BinaryFormat::MAGIC_NUMBER;
+  header[BinaryFormat::VERSION] = BinaryFormat::FORMAT_VERSION;
+  header[BinaryFormat::ENDIANNESS] = BinaryFormat::BYTE_ORDER_MARK;
+  header[BinaryFormat::NDIME] = nDim;
+  header[BinaryFormat::NPOIN] = nPointGlobal;
+  header[BinaryFormat::NELEM] = nElemGlobal;
+  header[BinaryFormat::NCONN] = nConnGlobal;
+  header[BinaryFormat::NMARK] = markerTags.size();
+  header[BinaryFormat::POINTS] = BinaryFormat::HEADER_SIZE * sizeof(uint64_t);
+  header[BinaryFormat::ELEM_TYPES] = header[BinaryFormat::POINTS] + nPointGlobal * nDim * sizeof(passivedouble);
+  header[BinaryFormat::ELEM_OFFSETS] = header[BinaryFormat::ELEM_TYPES] + nElemGlobal;
+  header[BinaryFormat::ELEM_CONN] = header[BinaryFormat::ELEM_OFFSETS] + (nElemGlobal + 1) * sizeof(uint64_t);
+  header[BinaryFormat::MARKERS] = header[BinaryFormat::ELEM_CONN] + nConnGlobal * sizeof(uint64_t);
+
+  /*--- Coordinates of the local points. ---*/
+
+  vector<passivedouble> coordinates(nPoint * nDim);
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+    for (auto iDim = 0ul; iDim < nDim; iDim++)
+      coordinates[iPoint * nDim + iDim] = dataSorter->GetData(iDim, iPoint);
+
+  /*--- Local volume elements, the types, the position of their first node, and the (0-based) connectivity.
+   *    The last rank also writes the end position of the connectivity. ---*/
+
+  vector<unsigned char> elemTypes;
+  vector<uint64_t> elemOffsets, elemConn;
+  elemTypes.reserve(nElem);
+  elemOffsets.reserve(nElem + 1);
+  elemConn.reserve(dataSorter->GetnConn());
+
+  uint64_t position = dataSorter->GetnElemConnCumulative(rank);
+
+  for (const auto type : {TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID}) {
+    const auto nPointsElem = nPointsOfElementType(type);
+
+    for (auto iElem = 0ul; iElem < dataSorter->GetnElem(type); iElem++) {
+      elemTypes.push_back(type);
+      elemOffsets.push_back(position);
+      position += nPointsElem;
+      for (auto iNode = 0u; iNode < nPointsElem; ++iNode)
+        elemConn.push_back(dataSorter->GetElemConnectivity(type, iElem, iNode) - 1);
+    }
+  }
+  if (rank == size - 1) elemOffsets.push_back(position);
+
+  /*--- Marker section, the tags, the number of elements, and the element records. ---*/
+
+  vector<char> markerData;
+  auto appendMarkerData = [&markerData](const void* data, size_t nBytes) {
+    const auto* bytes = static_cast<const char*>(data);
+    markerData.insert(markerData.end(), bytes, bytes + nBytes);
+  };
+  for (auto iMarker = 0ul; iMarker < markerTags.size(); iMarker++) {
+    const uint64_t tagLength = markerTags[iMarker].size();
+    appendMarkerData(&tagLength, sizeof(uint64_t));
+    appendMarkerData(markerTags[iMarker].data(), tagLength);
+
+    const uint64_t nElem_Bound = markerElems[iMarker].size() / BinaryFormat::BOUND_CONN_SIZE;
+    appendMarkerData(&nElem_Bound, sizeof(uint64_t));
+
+    for (const auto value : markerElems[iMarker]) {
+      const uint64_t value64 = value;
+      appendMarkerData(&value64, sizeof(uint64_t));
+    }
   }
 
-  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  /*--- Write the sections in order, the volume data is written collectively by all ranks. ---*/
+
+  OpenMPIFile(val_filename);
+
+  WriteMPIBinaryData(header.data(), header.size() * sizeof(uint64_t), MASTER_NODE);
+
+  WriteMPIBinaryDataAll(coordinates.data(), coordinates.size() * sizeof(passivedouble),
+                        nPointGlobal * nDim * sizeof(passivedouble),
+                        dataSorter->GetnPointCumulative(rank) * nDim * sizeof(passivedouble));
+
+  WriteMPIBinaryDataAll(elemTypes.data(), elemTypes.size(), nElemGlobal, dataSorter->GetnElemCumulative(rank));
+
+  WriteMPIBinaryDataAll(elemOffsets.data(), elemOffsets.size() * sizeof(uint64_t),
+                        (nElemGlobal + 1) * sizeof(uint64_t), dataSorter->GetnElemCumulative(rank) * sizeof(uint64_t));
+
+  WriteMPIBinaryDataAll(elemConn.data(), elemConn.size() * sizeof(uint64_t), nConnGlobal * sizeof(uint64_t),
+                        dataSorter->GetnElemConnCumulative(rank) * sizeof(uint64_t));
+
+  WriteMPIBinaryData(markerData.data(), markerData.size(), MASTER_NODE);
+
+  CloseMPIFile();
 }
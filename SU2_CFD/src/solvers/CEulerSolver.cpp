@@ -1674,11 +1674,16 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, c
    *    further reduction if function is called in parallel ---*/
   unsigned long nonPhysicalPoints = 0;
 
+  /*--- Only the data-driven model evaluates several states at once. ---*/
+  const bool prefetch = (config->GetKind_FluidModel() == ENUM_FLUIDMODEL::DATADRIVEN_FLUID);
+
   AD::StartNoSharedReading();
 
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
 
+    if (prefetch) PrefetchFluidModel(iPoint);
+
     /*--- Compressible flow, primitive variables nDim+9, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
 
     bool physical = nodes->SetPrimVar(iPoint, GetFluidModel());
@@ -1695,6 +1700,28 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, c
   return nonPhysicalPoints;
 }
 
+void CEulerSolver::PrefetchFluidModel(unsigned long iPoint, const CVariable* turbNodes) {
+
+  if ((iPoint % FLUID_MODEL_BLOCK_SIZE != 0) && (iPoint % omp_chunk_size != 0)) return;
+
+  const auto iPointEnd = min(nPoint, min((iPoint / FLUID_MODEL_BLOCK_SIZE + 1) * FLUID_MODEL_BLOCK_SIZE,
+                                         (iPoint / omp_chunk_size + 1) * omp_chunk_size));
+
+  /*--- Same static energy as SetPrimVar, the fluid model matches the states exactly. ---*/
+  su2double density[FLUID_MODEL_BLOCK_SIZE], staticEnergy[FLUID_MODEL_BLOCK_SIZE];
+
+  for (auto jPoint = iPoint; jPoint < iPointEnd; jPoint++) {
+    su2double velocity2 = 0.0;
+    for (unsigned long iDim = 0; iDim < nDim; iDim++)
+      velocity2 += pow(nodes->GetSolution(jPoint, iDim+1) / nodes->GetDensity(jPoint), 2);
+
+    density[jPoint-iPoint] = nodes->GetDensity(jPoint);
+    staticEnergy[jPoint-iPoint] = nodes->GetEnergy(jPoint) - 0.5*velocity2;
+    if (turbNodes) staticEnergy[jPoint-iPoint] -= turbNodes->GetSolution(jPoint, 0);
+  }
+  GetFluidModel()->PrefetchTDState_rhoe(iPointEnd - iPoint, density, staticEnergy);
+}
+
 void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                 unsigned short iMesh, unsigned long Iteration) {
 
@@ -1758,8 +1785,15 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
                          (config->GetKind_FluidModel() == IDEAL_GAS);
   const bool low_mach_corr = config->Low_Mach_Correction();
 
-  /*--- Use vectorization if the scheme supports it. ---*/
-  if (config->GetKind_Upwind_Flow() == UPWIND::ROE && ideal_gas && !low_mach_corr) {
+  /*--- Use vectorization if the scheme supports it. The AUSM/SLAU families are only
+   * vectorized with approximate Jacobians (accurate ones are computed numerically). ---*/
+  const auto kind_upwind = config->GetKind_Upwind_Flow();
+  const bool ausm_slau = (kind_upwind == UPWIND::AUSMPLUSUP) || (kind_upwind == UPWIND::AUSMPLUSUP2) ||
+                         (kind_upwind == UPWIND::SLAU) || (kind_upwind == UPWIND::SLAU2);
+  const bool simd_scheme = (kind_upwind == UPWIND::ROE) || (kind_upwind == UPWIND::HLLC) ||
+                           (ausm_slau && !config->GetUse_Accurate_Jacobians());
+
+  if (simd_scheme && ideal_gas && !low_mach_corr) {
     EdgeFluxResidual(geometry, solver_container, config);
     return;
   }
@@ -1773,6 +1807,10 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   const bool limiter          = (config->GetKind_SlopeLimit_Flow() != LIMITER::NONE);
   const bool van_albada       = (config->GetKind_SlopeLimit_Flow() == LIMITER::VAN_ALBADA_EDGE);
 
+  /*--- The data-driven fluid model solves the reconstructed (P, rho) states of a block of edges together. ---*/
+  const bool prefetch = muscl && (config->GetKind_FluidModel() == ENUM_FLUIDMODEL::DATADRIVEN_FLUID);
+  const unsigned long edgeBlockSize = FLUID_MODEL_BLOCK_SIZE / 2;
+
   /*--- Non-physical counter. ---*/
   unsigned long counter_local = 0;
   SU2_OMP_MASTER
@@ -1786,6 +1824,61 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   su2double Primitive_i[MAXNVAR] = {0.0}, Primitive_j[MAXNVAR] = {0.0};
   su2double Secondary_i[MAXNVAR] = {0.0}, Secondary_j[MAXNVAR] = {0.0};
 
+  /*--- Reconstructed primitives (i and j of each edge) of the block of edges that was prefetched,
+   * they are reused by the flux computation instead of reconstructing the edges again. ---*/
+  vector<su2double> blockPrimitive(prefetch ? FLUID_MODEL_BLOCK_SIZE * nPrimVarGrad : 0);
+  unsigned long blockStart = 0;
+
+  /*--- MUSCL reconstruction of the primitive variables of an edge, into Primitive_i and Primitive_j. ---*/
+  auto ReconstructEdge = [&](unsigned long iEdge) {
+
+    unsigned short iDim, iVar;
+
+    auto iPoint = geometry->edges->GetNode(iEdge,0);
+    auto jPoint = geometry->edges->GetNode(iEdge,1);
+
+    auto Coord_i = geometry->nodes->GetCoord(iPoint);
+    auto Coord_j = geometry->nodes->GetCoord(jPoint);
+
+    auto V_i = nodes->GetPrimitive(iPoint); auto V_j = nodes->GetPrimitive(jPoint);
+
+    su2double Vector_ij[MAXNDIM] = {0.0};
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Vector_ij[iDim] = 0.5*(Coord_j[iDim] - Coord_i[iDim]);
+    }
+
+    auto Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
+    auto Gradient_j = nodes->GetGradient_Reconstruction(jPoint);
+
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+
+      su2double Project_Grad_i = 0.0;
+      su2double Project_Grad_j = 0.0;
+
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Project_Grad_i += Vector_ij[iDim]*Gradient_i[iVar][iDim];
+        Project_Grad_j -= Vector_ij[iDim]*Gradient_j[iVar][iDim];
+      }
+
+      su2double lim_i = 1.0;
+      su2double lim_j = 1.0;
+
+      if (van_albada) {
+        su2double V_ij = V_j[iVar] - V_i[iVar];
+        lim_i = LimiterHelpers<>::vanAlbadaFunction(Project_Grad_i, V_ij, EPS);
+        lim_j = LimiterHelpers<>::vanAlbadaFunction(-Project_Grad_j, V_ij, EPS);
+      }
+      else if (limiter) {
+        lim_i = nodes->GetLimiter_Primitive(iPoint, iVar);
+        lim_j = nodes->GetLimiter_Primitive(jPoint, iVar);
+      }
+
+      Primitive_i[iVar] = V_i[iVar] + lim_i * Project_Grad_i;
+      Primitive_j[iVar] = V_j[iVar] + lim_j * Project_Grad_j;
+
+    }
+  };
+
   /*--- For hybrid parallel AD, pause preaccumulation if there is shared reading of
   * variables, otherwise switch to the faster adjoint evaluation mode. ---*/
   bool pausePreacc = false;
@@ -1796,12 +1889,36 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   for (auto color : EdgeColoring)
   {
   /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  const unsigned long chunkSize = nextMultiple(OMP_MIN_SIZE, color.groupSize);
+  SU2_OMP_FOR_DYN(chunkSize)
   for(auto k = 0ul; k < color.size; ++k) {
 
     auto iEdge = color.indices[k];
 
-    unsigned short iDim, iVar;
+    unsigned short iDim;
+
+    /*--- Solve the fluid model ahead for the block of edges that starts at k. Blocks end at the next boundary
+     * of a block or of an OpenMP chunk, thus each thread prefetches the states it will request, in order. ---*/
+
+    if (prefetch && ((k % edgeBlockSize == 0) || (k % chunkSize == 0))) {
+      const auto kEnd = min<unsigned long>(color.size, min((k / edgeBlockSize + 1) * edgeBlockSize,
+                                                           (k / chunkSize + 1) * chunkSize));
+
+      su2double pressure[FLUID_MODEL_BLOCK_SIZE], density[FLUID_MODEL_BLOCK_SIZE];
+
+      for (auto kEdge = k; kEdge < kEnd; kEdge++) {
+        ReconstructEdge(color.indices[kEdge]);
+        const auto iState = 2 * (kEdge - k);
+        pressure[iState] = Primitive_i[prim_idx.Pressure()];
+        density[iState] = Primitive_i[prim_idx.Density()];
+        pressure[iState + 1] = Primitive_j[prim_idx.Pressure()];
+        density[iState + 1] = Primitive_j[prim_idx.Density()];
+        copy_n(Primitive_i, nPrimVarGrad, &blockPrimitive[iState * nPrimVarGrad]);
+        copy_n(Primitive_j, nPrimVarGrad, &blockPrimitive[(iState + 1) * nPrimVarGrad]);
+      }
+      GetFluidModel()->PrefetchTDState_Prho(2 * (kEnd - k), pressure, density);
+      blockStart = k;
+    }
 
     /*--- Points in edge and normal vectors ---*/
 
@@ -1840,42 +1957,15 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
 
     }
     else {
-      /*--- Reconstruction ---*/
+      /*--- Reconstruction, or the one of the prefetched block. ---*/
 
-      su2double Vector_ij[MAXNDIM] = {0.0};
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_ij[iDim] = 0.5*(Coord_j[iDim] - Coord_i[iDim]);
+      if (prefetch) {
+        const auto iState = 2 * (k - blockStart);
+        copy_n(&blockPrimitive[iState * nPrimVarGrad], nPrimVarGrad, Primitive_i);
+        copy_n(&blockPrimitive[(iState + 1) * nPrimVarGrad], nPrimVarGrad, Primitive_j);
       }
-
-      auto Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
-      auto Gradient_j = nodes->GetGradient_Reconstruction(jPoint);
-
-      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-
-        su2double Project_Grad_i = 0.0;
-        su2double Project_Grad_j = 0.0;
-
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_ij[iDim]*Gradient_i[iVar][iDim];
-          Project_Grad_j -= Vector_ij[iDim]*Gradient_j[iVar][iDim];
-        }
-
-        su2double lim_i = 1.0;
-        su2double lim_j = 1.0;
-
-        if (van_albada) {
-          su2double V_ij = V_j[iVar] - V_i[iVar];
-          lim_i = LimiterHelpers<>::vanAlbadaFunction(Project_Grad_i, V_ij, EPS);
-          lim_j = LimiterHelpers<>::vanAlbadaFunction(-Project_Grad_j, V_ij, EPS);
-        }
-        else if (limiter) {
-          lim_i = nodes->GetLimiter_Primitive(iPoint, iVar);
-          lim_j = nodes->GetLimiter_Primitive(jPoint, iVar);
-        }
-
-        Primitive_i[iVar] = V_i[iVar] + lim_i * Project_Grad_i;
-        Primitive_j[iVar] = V_j[iVar] + lim_j * Project_Grad_j;
-
+      else {
+        ReconstructEdge(iEdge);
       }
 
       /*--- Recompute the reconstructed quantities in a thermodynamically consistent way. ---*/
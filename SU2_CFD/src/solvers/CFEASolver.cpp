@@ -871,6 +871,9 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumeri
   }
   END_SU2_OMP_PARALLEL
 
+  /*--- The blocks were updated in place. ---*/
+  Jacobian.SetSELLDirty();
+
 }
 
 void CFEASolver::Compute_MassMatrix(const CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
@@ -956,6 +959,9 @@ void CFEASolver::Compute_MassMatrix(const CGeometry *geometry, CNumerics **numer
   }
   END_SU2_OMP_PARALLEL
 
+  /*--- The blocks were updated in place. ---*/
+  MassMatrix.SetSELLDirty();
+
   AD::EndPassive(wasActive);
 
 }
@@ -344,10 +344,10 @@ void CFEM_DG_NSSolver::Friction_Forces(const CGeometry* geometry, const CConfig*
                 su2double vel2Mag = vel[0]*vel[0] + vel[1]*vel[1] + vel[2]*vel[2];
                 su2double eInt    = rhoInv*solInt[nVar-1] - 0.5*vel2Mag;
 
-                FluidModel->SetTDState_rhoe(solInt[0], eInt);
-                const su2double Pressure = FluidModel->GetPressure();
-                const su2double Temperature = FluidModel->GetTemperature();
-                const su2double LaminarViscosity= FluidModel->GetLaminarViscosity();
+                GetFluidModel()->SetTDState_rhoe(solInt[0], eInt);
+                const su2double Pressure = GetFluidModel()->GetPressure();
+                const su2double Temperature = GetFluidModel()->GetTemperature();
+                const su2double LaminarViscosity= GetFluidModel()->GetLaminarViscosity();
 
                 /* Subtract the prescribed wall velocity, i.e. grid velocity
                    from the velocity in the exchange point. */
@@ -375,7 +375,7 @@ void CFEM_DG_NSSolver::Friction_Forces(const CGeometry* geometry, const CConfig*
                                                                           LaminarViscosity, Pressure,
                                                                           Wall_HeatFlux, HeatFlux_Prescribed,
                                                                           Wall_Temperature, Temperature_Prescribed,
-                                                                          FluidModel, tauWall, qWall,
+                                                                          GetFluidModel(), tauWall, qWall,
                                                                           ViscosityWall, kOverCvWall);
 
                 /* Update the viscous forces and moments. Note that the force direction
@@ -546,8 +546,8 @@ void CFEM_DG_NSSolver::Friction_Forces(const CGeometry* geometry, const CConfig*
                     const su2double divVel = dudx + dvdy;
 
                     /* Compute the laminar viscosity. */
-                    FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                    const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+                    GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                    const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
                     /* Set the value of the second viscosity and compute the
                        divergence term in the viscous normal stresses. */
@@ -679,8 +679,8 @@ void CFEM_DG_NSSolver::Friction_Forces(const CGeometry* geometry, const CConfig*
                     const su2double divVel = dudx + dvdy + dwdz;
 
                     /* Compute the laminar viscosity. */
-                    FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                    const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+                    GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                    const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
                     /* Set the value of the second viscosity and compute the
                        divergence term in the viscous normal stresses. */
@@ -1039,8 +1039,8 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
 
                 /*--- Compute the maximum value of the wave speed. This is a rather
                       conservative estimate. ---*/
-                FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-                const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+                GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+                const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
                 const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
                 const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -1051,7 +1051,7 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
 
                 /* Compute the laminar kinematic viscosity and check if an eddy
                    viscosity must be determined. */
-                const su2double muLam = FluidModel->GetLaminarViscosity();
+                const su2double muLam = GetFluidModel()->GetLaminarViscosity();
                 su2double muTurb      = 0.0;
 
                 if( SGSModelUsed ) {
@@ -1156,8 +1156,8 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
 
                 /*--- Compute the maximum value of the wave speed. This is a rather
                       conservative estimate. ---*/
-                FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-                const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+                GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+                const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
                 const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
                 const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -1169,7 +1169,7 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
 
                 /* Compute the laminar kinematic viscosity and check if an eddy
                    viscosity must be determined. */
-                const su2double muLam = FluidModel->GetLaminarViscosity();
+                const su2double muLam = GetFluidModel()->GetLaminarViscosity();
                 su2double muTurb      = 0.0;
 
                 if( SGSModelUsed ) {
@@ -1413,9 +1413,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double TotalEnergy  = DensityInv*solDOF[3];
       const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure     = FluidModel->GetPressure();
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure     = GetFluidModel()->GetPressure();
+      const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
       /* Compute the Cartesian gradients of the velocities and static energy. */
       const su2double dudx = DensityInv*(drudx - u*drhodx);
@@ -1756,9 +1756,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double TotalEnergy  = DensityInv*solDOF[4];
       const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure     = FluidModel->GetPressure();
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure     = GetFluidModel()->GetPressure();
+      const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
       /* Compute the Cartesian gradients of the velocities and static energy. */
       const su2double dudx = DensityInv*(drudx - u*drhodx);
@@ -2129,13 +2129,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double TotalEnergy  = rhoInv*rE;
       const su2double StaticEnergy = TotalEnergy - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Compute the laminar viscosity and its derivative w.r.t. temperature. */
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-      const su2double dViscLamdT   = FluidModel->GetdmudT_rho();
+      const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
+      const su2double dViscLamdT   = GetFluidModel()->GetdmudT_rho();
 
       /* Set the pointer to the grid velocities in this integration point.
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
@@ -2528,13 +2528,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double TotalEnergy  = rhoInv*rE;
       const su2double StaticEnergy = TotalEnergy - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
        /* Compute the laminar viscosity and its derivative w.r.t. temperature. */
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-      const su2double dViscLamdT   = FluidModel->GetdmudT_rho();
+      const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
+      const su2double dViscLamdT   = GetFluidModel()->GetdmudT_rho();
 
       /* Set the pointer to the grid velocities in this integration point.
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
@@ -2998,6 +2998,7 @@ void CFEM_DG_NSSolver::Shock_Capturing_DG_Persson(const unsigned long elemBeg,
 
   /*--- Loop over the given range of elements to sense the shock. If shock exists,
         add artificial viscosity for DG FEM formulation to the residual.  ---*/
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
   for(unsigned long l=elemBeg; l<elemEnd; ++l) {
 
     /* Get the data from the corresponding standard element. */
@@ -3070,8 +3071,8 @@ void CFEM_DG_NSSolver::Shock_Capturing_DG_Persson(const unsigned long elemBeg,
 
       StaticEnergy = sol[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-      SoundSpeed2 = FluidModel->GetSoundSpeed2();
+      GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+      SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
       machSolDOFs[iInd] = sqrt( Velocity2Rel/SoundSpeed2 );
       machMax = max(machSolDOFs[iInd],machMax);
     }
@@ -3144,6 +3145,7 @@ void CFEM_DG_NSSolver::Shock_Capturing_DG_Persson(const unsigned long elemBeg,
       volElem[l].shockArtificialViscosity = 0.0;
     }
   }
+  END_SU2_OMP_FOR
 }
 
 void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
@@ -3179,12 +3181,16 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
   /*--- Loop over the given element range to compute the contribution of the
         volume integral in the DG FEM formulation to the residual. Multiple
         elements are treated simultaneously to improve the performance
-        of the matrix multiplications. As a consequence, the update of the
-        counter l happens at the end of this loop section. ---*/
-  for(unsigned long l=elemBeg; l<elemEnd;) {
+        of the matrix multiplications. These chunks of elements are
+        independent of each other and are distributed over the threads. ---*/
+  DetermineChunksOfElem(volElem, elemBeg, elemEnd, nElemSimul, nPadMin);
+
+  SU2_OMP_FOR_DYN(1)
+  for(unsigned long iChunk=0; iChunk<(chunksBeg.size()-1); ++iChunk) {
 
     /* Determine the end index for this chunk of elements and the padded
        N value in the gemm computations. */
+    const unsigned long l = chunksBeg[iChunk];
     unsigned long lEnd;
     unsigned short ind, llEnd, NPad;
 
@@ -3326,9 +3332,9 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double divVel = dudx + dvdy;
 
             /*--- Compute the pressure and the laminar viscosity. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure     = FluidModel->GetPressure();
-            const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure     = GetFluidModel()->GetPressure();
+            const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
             /*--- If an SGS model is used the eddy viscosity must be computed. ---*/
             su2double ViscosityTurb = 0.0;
@@ -3519,9 +3525,9 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double divVel = dudx + dvdy + dwdz;
 
             /*--- Compute the pressure and the laminar viscosity. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure     = FluidModel->GetPressure();
-            const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure     = GetFluidModel()->GetPressure();
+            const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
             /*--- If an SGS model is used the eddy viscosity must be computed. ---*/
             su2double ViscosityTurb = 0.0;
@@ -3715,17 +3721,13 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
         for(unsigned short mm=0; mm<nVar; ++mm)
            res[i*nVar+mm] = solDOFs[i*NPad+llNVar+mm];
     }
-
-    /* Update the value of the counter l to the end index of the
-       current chunk. */
-    l = lEnd;
   }
+  END_SU2_OMP_FOR
 }
 
 void CFEM_DG_NSSolver::ResidualFaces(CConfig             *config,
                                      const unsigned long indFaceBeg,
                                      const unsigned long indFaceEnd,
-                                     unsigned long       &indResFaces,
                                      CNumerics           *numerics,
                                      su2double           *workArray) {
 
@@ -3740,12 +3742,18 @@ void CFEM_DG_NSSolver::ResidualFaces(CConfig             *config,
 
   /*--- Loop over the requested range of matching faces. Multiple faces
         are treated simultaneously to improve the performance of the matrix
-        multiplications. As a consequence, the update of the counter l
-        happens at the end of this loop section. ---*/
-  for(unsigned long l=indFaceBeg; l<indFaceEnd;) {
+        multiplications. Every face stores its residual in its own part of
+        VecResFaces, hence the chunks can be distributed over the threads. ---*/
+  DetermineChunksOfElem(matchingInternalFaces, indFaceBeg, indFaceEnd, nFaceSimul, nPadMin);
+
+  SU2_OMP_FOR_DYN(1)
+  for(unsigned long iChunk=0; iChunk<(chunksBeg.size()-1); ++iChunk) {
 
     /* Determine the end index for this chunk of faces and the padded
-       N value in the gemm computations. */
+       N value in the gemm computations. Also set the starting position
+       of the residuals of this chunk in VecResFaces. */
+    const unsigned long l = chunksBeg[iChunk];
+    unsigned long indResFaces = startLocResMatchingFaces[l];
     unsigned long lEnd;
     unsigned short ind, llEnd, NPad;
 
@@ -4125,11 +4133,8 @@ void CFEM_DG_NSSolver::ResidualFaces(CConfig             *config,
             resElem1[nVar*i+mm] = solIntR[NPad*i+llNVar+mm];
       }
     }
-
-    /* Update the value of the counter l to the end index of the
-       current chunk. */
-    l = lEnd;
   }
+  END_SU2_OMP_FOR
 }
 
 void CFEM_DG_NSSolver::ViscousNormalFluxFace(const CVolumeElementFEM *adjVolElem,
@@ -4344,8 +4349,8 @@ void CFEM_DG_NSSolver::ViscousNormalFluxIntegrationPoint_2D(const su2double *sol
   const su2double divVel = dudx + dvdy;
 
   /*--- Compute the laminar viscosity. ---*/
-  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-  const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+  const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
   /*--- Compute the eddy viscosity, if needed. ---*/
   su2double ViscosityTurb = 0.0;
@@ -4440,8 +4445,8 @@ void CFEM_DG_NSSolver::ViscousNormalFluxIntegrationPoint_3D(const su2double *sol
   const su2double divVel = dudx + dvdy + dwdz;
 
   /*--- Compute the laminar viscosity. ---*/
-  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-  const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+  const su2double ViscosityLam = GetFluidModel()->GetLaminarViscosity();
 
   /*--- Compute the eddy viscosity, if needed. ---*/
   su2double ViscosityTurb = 0.0;
@@ -6322,10 +6327,10 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
         su2double vel2Mag = vel[0]*vel[0] + vel[1]*vel[1] + vel[2]*vel[2];
         su2double eInt    = rhoInv*solInt[nVar-1] - 0.5*vel2Mag;
 
-        FluidModel->SetTDState_rhoe(solInt[0], eInt);
-        const su2double Pressure = FluidModel->GetPressure();
-        const su2double Temperature = FluidModel->GetTemperature();
-        const su2double LaminarViscosity= FluidModel->GetLaminarViscosity();
+        GetFluidModel()->SetTDState_rhoe(solInt[0], eInt);
+        const su2double Pressure = GetFluidModel()->GetPressure();
+        const su2double Temperature = GetFluidModel()->GetTemperature();
+        const su2double LaminarViscosity= GetFluidModel()->GetLaminarViscosity();
 
         /* Subtract the prescribed wall velocity, i.e. grid velocity
            from the velocity in the exchange point. */
@@ -6352,7 +6357,7 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
         wallModel->WallShearStressAndHeatFlux(Temperature, velTan, LaminarViscosity, Pressure,
                                               Wall_HeatFlux, HeatFlux_Prescribed,
                                               Wall_Temperature, Temperature_Prescribed,
-                                              FluidModel, tauWall, qWall, ViscosityWall,
+                                              GetFluidModel(), tauWall, qWall, ViscosityWall,
                                               kOverCvWall);
 
         /* Compute the wall velocity in tangential direction. */
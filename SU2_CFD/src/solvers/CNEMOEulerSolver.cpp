@@ -193,24 +193,24 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
     nodes      = new CNEMONSVariable    (Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                          Temperature_Inf, Temperature_ve_Inf,
                                          nPoint, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                         config, FluidModel);
+                                         config, GetFluidModel());
     node_infty = new CNEMONSVariable    (Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                         Temperature_Inf, Temperature_ve_Inf,
                                         1, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                        config, FluidModel);
+                                        config, GetFluidModel());
   } else {
     nodes      = new CNEMOEulerVariable(Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                         Temperature_Inf, Temperature_ve_Inf,
                                         nPoint, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                        config, FluidModel);
+                                        config, GetFluidModel());
     node_infty = new CNEMOEulerVariable(Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                         Temperature_Inf, Temperature_ve_Inf,
                                         1, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                        config, FluidModel);
+                                        config, GetFluidModel());
   }
   SetBaseClassPointerToNodes();
 
-  node_infty->SetPrimVar(0, FluidModel);
+  node_infty->SetPrimVar(0, GetFluidModel());
 
   /*--- Initial comms. ---*/
 
@@ -232,7 +232,7 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
 CNEMOEulerSolver::~CNEMOEulerSolver() {
 
   delete node_infty;
-  delete FluidModel;
+  for (auto& model : FluidModel) delete model;
 
 }
 
@@ -318,23 +318,36 @@ void CNEMOEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_conta
 unsigned long CNEMOEulerSolver::SetPrimitive_Variables(CSolver **solver_container, CConfig *config, bool Output) {
 
   unsigned long nonPhysicalPoints = 0;
-  bool nonphysical = true;
 
-  for (auto iPoint = 0ul; iPoint < nPoint; iPoint ++) {
+  /*--- The thermochemistry (temperatures and derivatives) dominates the cost of the primitive update.
+   *    The NEMO solvers are not hybrid parallel, the point loop opens its own parallel region and
+   *    each thread uses its own fluid model. ---*/
+  SU2_OMP_PARALLEL
+  {
+    unsigned long nonPhysicalPointsLocal = 0;
 
-    /*--- Incompressible flow, primitive variables ---*/
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint ++) {
 
-    nonphysical = nodes->SetPrimVar(iPoint,FluidModel);
+      /*--- Incompressible flow, primitive variables ---*/
 
-    /* Check for non-realizable states for reporting. */
+      const bool nonphysical = nodes->SetPrimVar(iPoint,GetFluidModel());
 
-    if (nonphysical) nonPhysicalPoints++;
+      /* Check for non-realizable states for reporting. */
 
-    /*--- Initialize the convective, source and viscous residual vector ---*/
+      if (nonphysical) nonPhysicalPointsLocal++;
 
-    if (!Output) LinSysRes.SetBlock_Zero(iPoint);
+      /*--- Initialize the convective, source and viscous residual vector ---*/
 
+      if (!Output) LinSysRes.SetBlock_Zero(iPoint);
+
+    }
+    END_SU2_OMP_FOR
+
+    SU2_OMP_ATOMIC
+    nonPhysicalPoints += nonPhysicalPointsLocal;
   }
+  END_SU2_OMP_PARALLEL
 
   return nonPhysicalPoints;
 }
@@ -701,8 +714,8 @@ void CNEMOEulerSolver::RecomputeConservativeVector(su2double *U, const su2double
   }
 
   /*--- Set the fluidmodel and recompute energies ---*/
-  FluidModel->SetTDStateRhosTTv( rhos, V[T_INDEX], V[TVE_INDEX]);
-  const auto& Energies = FluidModel->ComputeMixtureEnergies();
+  GetFluidModel()->SetTDStateRhosTTv( rhos, V[T_INDEX], V[TVE_INDEX]);
+  const auto& Energies = GetFluidModel()->ComputeMixtureEnergies();
 
   /*--- Set conservative energies ---*/
   U[nSpecies+nDim]   = V[RHO_INDEX]*(Energies[0]+0.5*sqvel);
@@ -746,7 +759,6 @@ bool CNEMOEulerSolver::CheckNonPhys(const su2double *V) const {
 void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
   /*--- Assign booleans ---*/
-  bool err        = false;
   const bool implicit   = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
   const bool frozen     = config->GetFrozen();
   const bool monoatomic = config->GetMonoatomic();
@@ -754,8 +766,6 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
   const bool viscous    = config->GetViscous();
   const bool rans       = (config->GetKind_Turb_Model() != TURB_MODEL::NONE);
 
-  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM];
-
   /*--- Initialize the error counter ---*/
   unsigned long eAxi_local = 0;
   unsigned long eChm_local = 0;
@@ -769,116 +779,134 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
     ComputeAxisymmetricAuxGradients(geometry,config);
   }
 
-  AD::StartNoSharedReading();
+  /*--- The chemistry and relaxation sources are evaluated point by point, the NEMO solvers are not
+   *    hybrid parallel so the loop opens its own parallel region, with one numerics object per thread. ---*/
+  SU2_OMP_PARALLEL
+  {
+    CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  /*--- loop over interior points ---*/
-  SU2_OMP_FOR_DYN(omp_chunk_size)
-  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    unsigned long eAxi_thread = 0, eChm_thread = 0, eVib_thread = 0;
 
-    /*--- Set conserved & primitive variables  ---*/
-    numerics->SetConservative(nodes->GetSolution(iPoint),  nullptr);
-    numerics->SetPrimitive   (nodes->GetPrimitive(iPoint), nullptr);
+    AD::StartNoSharedReading();
 
-    /*--- Pass supplementary information to CNumerics ---*/
-    numerics->SetdPdU(nodes->GetdPdU(iPoint),     nullptr);
-    numerics->SetdTdU(nodes->GetdTdU(iPoint),     nullptr);
-    numerics->SetdTvedU(nodes->GetdTvedU(iPoint), nullptr);
-    numerics->SetEve(nodes->GetEve(iPoint),       nullptr);
-    numerics->SetCvve(nodes->GetCvve(iPoint),     nullptr);
+    /*--- loop over interior points ---*/
+    SU2_OMP_FOR_DYN(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+
+      /*--- Set conserved & primitive variables  ---*/
+      numerics->SetConservative(nodes->GetSolution(iPoint),  nullptr);
+      numerics->SetPrimitive   (nodes->GetPrimitive(iPoint), nullptr);
 
-    /*--- Set volume of the dual grid cell ---*/
-    numerics->SetVolume(geometry->nodes->GetVolume(iPoint));
-    numerics->SetCoord(geometry->nodes->GetCoord(iPoint), nullptr);
+      /*--- Pass supplementary information to CNumerics ---*/
+      numerics->SetdPdU(nodes->GetdPdU(iPoint),     nullptr);
+      numerics->SetdTdU(nodes->GetdTdU(iPoint),     nullptr);
+      numerics->SetdTvedU(nodes->GetdTvedU(iPoint), nullptr);
+      numerics->SetEve(nodes->GetEve(iPoint),       nullptr);
+      numerics->SetCvve(nodes->GetCvve(iPoint),     nullptr);
+
+      /*--- Set volume of the dual grid cell ---*/
+      numerics->SetVolume(geometry->nodes->GetVolume(iPoint));
+      numerics->SetCoord(geometry->nodes->GetCoord(iPoint), nullptr);
+
+      /*--- Compute finite rate chemistry ---*/
+
+      if(!monoatomic){
+        if(!frozen){
+          /*--- Compute the non-equilibrium chemistry ---*/
+          auto residual = numerics->ComputeChemistry(config);
+
+          /*--- Check for errors before applying source to the linear system ---*/
+          const bool err = CNumerics::CheckResidualNaNs(implicit, nVar, residual);
+
+          /*--- Apply the chemical sources to the linear system ---*/
+          if (!err) {
+            LinSysRes.SubtractBlock(iPoint, residual);
+            if (implicit)
+              Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
+          } else
+            eChm_thread++;
+        }
+      }
 
-    /*--- Compute finite rate chemistry ---*/
+      /*--- Compute vibrational energy relaxation ---*/
+      /// NOTE: Jacobians don't account for relaxation time derivatives
 
-    if(!monoatomic){
-      if(!frozen){
-        /*--- Compute the non-equilibrium chemistry ---*/
-        auto residual = numerics->ComputeChemistry(config);
+      if (!monoatomic){
+        auto residual = numerics->ComputeVibRelaxation(config);
 
         /*--- Check for errors before applying source to the linear system ---*/
-        err = CNumerics::CheckResidualNaNs(implicit, nVar, residual);
+        const bool err = CNumerics::CheckResidualNaNs(implicit, nVar, residual);
 
-        /*--- Apply the chemical sources to the linear system ---*/
+        /*--- Apply the vibrational relaxation terms to the linear system ---*/
         if (!err) {
           LinSysRes.SubtractBlock(iPoint, residual);
           if (implicit)
             Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
         } else
-          eChm_local++;
+          eVib_thread++;
       }
-    }
 
-    /*--- Compute vibrational energy relaxation ---*/
-    /// NOTE: Jacobians don't account for relaxation time derivatives
+      /*--- Compute axisymmetric source terms (if needed) ---*/
+      if (axisymm) {
 
-    if (!monoatomic){
-      auto residual = numerics->ComputeVibRelaxation(config);
+        /*--- If necessary, set variables needed for viscous computation ---*/
+        if (viscous) {
 
-      /*--- Check for errors before applying source to the linear system ---*/
-      err = CNumerics::CheckResidualNaNs(implicit, nVar, residual);
+          /*--- Set gradient of primitive variables ---*/
+          numerics->SetPrimVarGradient(nodes->GetGradient_Primitive(iPoint), nullptr);
 
-      /*--- Apply the vibrational relaxation terms to the linear system ---*/
-      if (!err) {
-        LinSysRes.SubtractBlock(iPoint, residual);
-        if (implicit)
-          Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
-      } else
-        eVib_local++;
-    }
+          /*--- Set gradient of auxillary variables ---*/
+          numerics->SetAuxVarGrad(nodes->GetAuxVarGradient(iPoint), nullptr);
 
-    /*--- Compute axisymmetric source terms (if needed) ---*/
-    if (axisymm) {
+          /*--- Set diffusion coefficient ---*/
+          numerics->SetDiffusionCoeff(nodes->GetDiffusionCoeff(iPoint), nullptr);
 
-      /*--- If necessary, set variables needed for viscous computation ---*/
-      if (viscous) {
-
-        /*--- Set gradient of primitive variables ---*/
-        numerics->SetPrimVarGradient(nodes->GetGradient_Primitive(iPoint), nullptr);
+          /*--- Laminar viscosity ---*/
+          numerics->SetLaminarViscosity(nodes->GetLaminarViscosity(iPoint), 0.0);
 
-        /*--- Set gradient of auxillary variables ---*/
-        numerics->SetAuxVarGrad(nodes->GetAuxVarGradient(iPoint), nullptr);
+          /*--- Eddy viscosity ---*/
+          numerics->SetEddyViscosity(nodes->GetEddyViscosity(iPoint), 0.0);
 
-        /*--- Set diffusion coefficient ---*/
-        numerics->SetDiffusionCoeff(nodes->GetDiffusionCoeff(iPoint), nullptr);
+          /*--- Thermal conductivity ---*/
+          numerics->SetThermalConductivity(nodes->GetThermalConductivity(iPoint), 0.0);
 
-        /*--- Laminar viscosity ---*/
-        numerics->SetLaminarViscosity(nodes->GetLaminarViscosity(iPoint), 0.0);
+          /*--- Vib-el. thermal conductivity ---*/
+          numerics->SetThermalConductivity_ve(nodes->GetThermalConductivity_ve(iPoint), 0.0);
 
-        /*--- Eddy viscosity ---*/
-        numerics->SetEddyViscosity(nodes->GetEddyViscosity(iPoint), 0.0);
+          /*--- Set turbulence kinetic energy ---*/
+          if (rans){
+            CVariable* turbNodes = solver_container[TURB_SOL]->GetNodes();
+            numerics->SetTurbKineticEnergy(turbNodes->GetSolution(iPoint,0), 0.0);
+          }
+        }
 
-        /*--- Thermal conductivity ---*/
-        numerics->SetThermalConductivity(nodes->GetThermalConductivity(iPoint), 0.0);
+        auto residual = numerics->ComputeAxisymmetric(config);
 
-        /*--- Vib-el. thermal conductivity ---*/
-        numerics->SetThermalConductivity_ve(nodes->GetThermalConductivity_ve(iPoint), 0.0);
+        /*--- Check for errors before applying source to the linear system ---*/
+        const bool err = CNumerics::CheckResidualNaNs(implicit, nVar, residual);
 
-        /*--- Set turbulence kinetic energy ---*/
-        if (rans){
-          CVariable* turbNodes = solver_container[TURB_SOL]->GetNodes();
-          numerics->SetTurbKineticEnergy(turbNodes->GetSolution(iPoint,0), 0.0);
-        }
+        /*--- Apply the update to the linear system ---*/
+        if (!err) {
+          LinSysRes.AddBlock(iPoint, residual);
+          if (implicit)
+            Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
+        } else
+          eAxi_thread++;
       }
+    }
+    END_SU2_OMP_FOR
 
-      auto residual = numerics->ComputeAxisymmetric(config);
-
-      /*--- Check for errors before applying source to the linear system ---*/
-      err = CNumerics::CheckResidualNaNs(implicit, nVar, residual);
+    AD::EndNoSharedReading();
 
-      /*--- Apply the update to the linear system ---*/
-      if (!err) {
-        LinSysRes.AddBlock(iPoint, residual);
-        if (implicit)
-          Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
-      } else
-        eAxi_local++;
+    SU2_OMP_CRITICAL
+    {
+      eAxi_local += eAxi_thread;
+      eChm_local += eChm_thread;
+      eVib_local += eVib_thread;
     }
+    END_SU2_OMP_CRITICAL
   }
-  END_SU2_OMP_FOR
-
-  AD::EndNoSharedReading();
+  END_SU2_OMP_PARALLEL
 
   /*--- Checking for NaN ---*/
   unsigned long eAxi_global = eAxi_local;
@@ -896,6 +924,180 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
   }
 }
 
+bool CNEMOEulerSolver::ComputeChemistryPreconditioner(unsigned short nSpecies, unsigned short nVar, su2double dt,
+                                                      const su2double* const* jacobian, su2activematrix& precond) {
+
+  /*--- I - dt J = [A B; 0 I], with A = I - dt J_ss and B = -dt J_so (s: species, o: others), its inverse
+   *    is [A^-1 -A^-1 B; 0 I]. Gauss-Jordan elimination with partial pivoting of [A | -B | I] gives
+   *    [I | -A^-1 B | A^-1]. ---*/
+
+  su2double aug[MAXNVAR][2*MAXNVAR];
+  const unsigned short nCol = nVar + nSpecies;
+
+  for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) {
+    for (auto jVar = 0u; jVar < nVar; jVar++)
+      aug[iSpecies][jVar] = (jVar < nSpecies ? -dt : dt) * jacobian[iSpecies][jVar];
+    aug[iSpecies][iSpecies] += 1.0;
+    for (auto jSpecies = 0u; jSpecies < nSpecies; jSpecies++)
+      aug[iSpecies][nVar+jSpecies] = (iSpecies == jSpecies) ? 1.0 : 0.0;
+  }
+
+  precond = su2double(0.0);
+  for (auto iVar = 0u; iVar < nVar; iVar++) precond(iVar,iVar) = 1.0;
+
+  for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) {
+    auto pivot = iSpecies;
+    for (auto jSpecies = iSpecies+1u; jSpecies < nSpecies; jSpecies++)
+      if (fabs(aug[jSpecies][iSpecies]) > fabs(aug[pivot][iSpecies])) pivot = jSpecies;
+
+    /*--- Also true for NaN. ---*/
+    if (!(fabs(aug[pivot][iSpecies]) > 0.0)) return false;
+
+    if (pivot != iSpecies) {
+      for (auto iCol = 0u; iCol < nCol; iCol++) swap(aug[iSpecies][iCol], aug[pivot][iCol]);
+    }
+
+    const su2double scale = 1.0 / aug[iSpecies][iSpecies];
+    for (auto iCol = 0u; iCol < nCol; iCol++) aug[iSpecies][iCol] *= scale;
+
+    for (auto jSpecies = 0u; jSpecies < nSpecies; jSpecies++) {
+      if (jSpecies == iSpecies) continue;
+      const su2double factor = aug[jSpecies][iSpecies];
+      for (auto iCol = 0u; iCol < nCol; iCol++) aug[jSpecies][iCol] -= factor * aug[iSpecies][iCol];
+    }
+  }
+
+  for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) {
+    for (auto jVar = 0u; jVar < nVar; jVar++)
+      precond(iSpecies,jVar) = (jVar < nSpecies) ? aug[iSpecies][nVar+jVar] : aug[iSpecies][jVar];
+  }
+  return true;
+}
+
+template<ENUM_TIME_INT IntegrationType>
+void CNEMOEulerSolver::Explicit_Iteration(CGeometry *geometry, CSolver **solver_container,
+                                          CConfig *config, unsigned short iRKStep) {
+
+  if (!config->GetChemistry_PointImplicit() || config->GetFrozen() || config->GetMonoatomic()) {
+    CFVMFlowSolverBase::Explicit_Iteration<IntegrationType>(geometry, solver_container, config, iRKStep);
+    return;
+  }
+
+  /*--- Solution update of this stage in Explicit_Iteration_impl, U = U_base - stageCoeff * dt/Vol * R, where
+   *    U_base is Solution_New for the last stage of the classical RK4, and Solution otherwise. ---*/
+
+  su2double stageCoeff = 1.0;
+  bool fromSolutionNew = false;
+  if (IntegrationType == RUNGE_KUTTA_EXPLICIT) stageCoeff = config->Get_Alpha_RKStep(iRKStep);
+  if (IntegrationType == CLASSICAL_RK4_EXPLICIT) {
+    fromSolutionNew = (iRKStep == 3);
+    stageCoeff = fromSolutionNew ? RK4_FuncCoeff(iRKStep) : RK4_TimeCoeff(iRKStep);
+  }
+
+  /*--- Point implicit chemistry, the update of each point is preconditioned by (I - dt J)^-1, where J is the
+   *    Jacobian of the chemical sources. For a forward Euler step this is the linearized backward Euler step
+   *    of the chemistry. The sources stay in the residual, hence the converged solution does not depend on
+   *    the time step, but their stiffness no longer limits it. ---*/
+
+  struct ChemistryPrecond {
+    CNEMOEulerSolver* solver;
+    const CGeometry* geometry;
+    su2double stageCoeff;
+    bool fromSolutionNew;
+    su2activematrix matrix, jacStorage;
+    vector<su2double*> jacobian;
+    vector<su2double> rhos;
+    su2double U[MAXNVAR], V[MAXNVAR], dPdU[MAXNVAR], dTdU[MAXNVAR], dTvedU[MAXNVAR], eves[MAXNVAR], cvves[MAXNVAR];
+    unsigned long nRejected = 0;
+
+    ChemistryPrecond(CNEMOEulerSolver* s, const CGeometry* geo, su2double coeff, bool fromNew)
+        : solver(s), geometry(geo), stageCoeff(coeff), fromSolutionNew(fromNew) {
+      matrix.resize(s->nVar, s->nVar);
+      jacStorage.resize(s->nVar, s->nVar);
+      for (auto iVar = 0ul; iVar < s->nVar; iVar++) jacobian.push_back(jacStorage[iVar]);
+      rhos.resize(s->nSpecies);
+    }
+
+    void compute(const CConfig*, unsigned long iPoint) {
+      const auto nVar = solver->nVar;
+      const auto nSpecies = solver->nSpecies;
+      auto* nodes = solver->nodes;
+      auto* fluidmodel = solver->GetFluidModel();
+
+      const su2double dt = nodes->GetDelta_Time(iPoint);
+      if (dt <= 0.0) {
+        matrix = su2double(0.0);
+        for (auto iVar = 0ul; iVar < nVar; iVar++) matrix(iVar,iVar) = 1.0;
+        return;
+      }
+
+      /*--- Chemistry Jacobian at the state where the residual was computed. ---*/
+
+      const su2double* Vi = nodes->GetPrimitive(iPoint);
+      for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies++) rhos[iSpecies] = Vi[nodes->GetRhosIndex()+iSpecies];
+      fluidmodel->SetTDStateRhosTTv(rhos, Vi[nodes->GetTIndex()], Vi[nodes->GetTveIndex()]);
+
+      jacStorage = su2double(0.0);
+      fluidmodel->ComputeNetProductionRates(true, Vi, nodes->GetEve(iPoint), nodes->GetCvve(iPoint),
+                                            nodes->GetdTdU(iPoint), nodes->GetdTvedU(iPoint), jacobian.data());
+
+      bool accepted = ComputeChemistryPreconditioner(nSpecies, nVar, dt, jacobian.data(), matrix);
+
+      /*--- Candidate state (all the conservative variables) after the update of this stage, the point implicit
+       *    update is only used if this state is physical, otherwise the point gets the explicit update. ---*/
+
+      if (accepted) {
+        const su2double Vol = geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint);
+        const su2double* res = solver->LinSysRes.GetBlock(iPoint);
+        const su2double* resTrunc = nodes->GetResTruncError(iPoint);
+
+        for (auto iVar = 0ul; iVar < nVar; iVar++) {
+          su2double resPrec = 0.0;
+          for (auto jVar = 0ul; jVar < nVar; jVar++) resPrec += matrix(iVar,jVar) * (res[jVar] + resTrunc[jVar]);
+          const su2double base = fromSolutionNew ? nodes->GetSolution_New(iPoint, iVar)
+                                                 : nodes->GetSolution(iPoint, iVar);
+          U[iVar] = base - stageCoeff * resPrec * dt / Vol;
+          accepted &= std::isfinite(SU2_TYPE::GetValue(U[iVar]));
+        }
+        accepted = accepted && !nodes->Cons2PrimVar(fluidmodel, U, V, dPdU, dTdU, dTvedU, eves, cvves);
+      }
+
+      if (!accepted) {
+        matrix = su2double(0.0);
+        for (auto iVar = 0ul; iVar < nVar; iVar++) matrix(iVar,iVar) = 1.0;
+        nRejected++;
+      }
+    }
+
+    FORCEINLINE su2double apply(unsigned short iVar, const su2double* res, const su2double* resTrunc) const {
+      su2double resPrec = 0.0;
+      for (unsigned short jVar = 0; jVar < solver->nVar; ++jVar)
+        resPrec += matrix(iVar,jVar) * (res[jVar] + resTrunc[jVar]);
+      return resPrec;
+    }
+  } precond(this, geometry, stageCoeff, fromSolutionNew);
+
+  /*--- The rejections are counted over the stages of the iteration, and reported in the history output. ---*/
+
+  if (iRKStep == 0) ompMasterAssignBarrier(nChemistryRejectedLocal, 0);
+
+  Explicit_Iteration_impl<IntegrationType>(precond, geometry, solver_container, config, iRKStep);
+
+  SU2_OMP_ATOMIC
+  nChemistryRejectedLocal += precond.nRejected;
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+    if (config->GetComm_Level() == COMM_FULL) {
+      SU2_MPI::Allreduce(&nChemistryRejectedLocal, &nChemistryRejected, 1, MPI_UNSIGNED_LONG, MPI_SUM,
+                         SU2_MPI::GetComm());
+    } else {
+      nChemistryRejected = nChemistryRejectedLocal;
+    }
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
 void CNEMOEulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **solver_container,
                                             CConfig *config, unsigned short iRKStep) {
 
@@ -1022,19 +1224,24 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
   config->SetViscosity_Ref(1.0);
   config->SetConductivity_Ref(1.0);
 
-  /*--- Instatiate the fluid model ---*/
-  switch (config->GetKind_FluidModel()) {
-  case MUTATIONPP:
-   #if defined(HAVE_MPP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
-     FluidModel = new CMutationTCLib(config, nDim);
-   #else
-     SU2_MPI::Error(string("Either 1) Mutation++ has not been configured/compiled (add '-Denable-mpp=true' to your meson string) or 2) CODI must be deactivated since it is not compatible with Mutation++."),
-     CURRENT_FUNCTION);
-   #endif
-   break;
-  case SU2_NONEQ:
-   FluidModel = new CSU2TCLib(config, nDim, viscous);
-   break;
+  /*--- Instatiate the fluid model, one object per OpenMP thread since the models store the
+   *    thermodynamic state. GetFluidModel() should be used to access the object of each thread. ---*/
+  FluidModel.resize(omp_get_max_threads(), nullptr);
+
+  for (auto& model : FluidModel) {
+    switch (config->GetKind_FluidModel()) {
+    case MUTATIONPP:
+     #if defined(HAVE_MPP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+       model = new CMutationTCLib(config, nDim);
+     #else
+       SU2_MPI::Error(string("Either 1) Mutation++ has not been configured/compiled (add '-Denable-mpp=true' to your meson string) or 2) CODI must be deactivated since it is not compatible with Mutation++."),
+       CURRENT_FUNCTION);
+     #endif
+     break;
+    case SU2_NONEQ:
+     model = new CSU2TCLib(config, nDim, viscous);
+     break;
+    }
   }
 
   /*--- Compute the Free Stream Pressure, Temperatrue, and Density ---*/
@@ -1047,17 +1254,17 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
   /*---                                     ---*/
 
   /*--- Set mixture state based on pressure, mass fractions and temperatures ---*/
-  FluidModel->SetTDStatePTTv(Pressure_FreeStream, MassFrac_Inf,
+  GetFluidModel()->SetTDStatePTTv(Pressure_FreeStream, MassFrac_Inf,
                              Temperature_FreeStream, Temperature_ve_FreeStream);
 
   /*--- Compute Gas Constant ---*/
-  GasConstant_Inf = FluidModel->ComputeGasConstant();
+  GasConstant_Inf = GetFluidModel()->ComputeGasConstant();
   config->SetGas_Constant(GasConstant_Inf);
 
   /*--- Compute the freestream density, soundspeed ---*/
-  Density_FreeStream = FluidModel->GetDensity();
-  soundspeed         = FluidModel->ComputeSoundSpeed();
-  Gamma              = FluidModel->ComputeGamma();
+  Density_FreeStream = GetFluidModel()->GetDensity();
+  soundspeed         = GetFluidModel()->ComputeSoundSpeed();
+  Gamma              = GetFluidModel()->ComputeGamma();
 
   /*--- Compute the Free Stream velocity, using the Mach number ---*/
   if (nDim == 2) {
@@ -1079,7 +1286,7 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
   ModVel_FreeStream = sqrt(ModVel_FreeStream); config->SetModVel_FreeStream(ModVel_FreeStream);
 
   /*--- Calculate energies ---*/
-  const auto& energies = FluidModel->ComputeMixtureEnergies();
+  const auto& energies = GetFluidModel()->ComputeMixtureEnergies();
 
   /*--- Viscous initialization ---*/
   if (viscous) {
@@ -1093,7 +1300,7 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
     if (!reynolds_init) {
 
       /*--- Thermodynamics quantities based initialization ---*/
-      Viscosity_FreeStream = FluidModel->GetViscosity();
+      Viscosity_FreeStream = GetFluidModel()->GetViscosity();
       Energy_FreeStream    = energies[0] + 0.5*sqvel;
 
     } else {
@@ -1441,7 +1648,7 @@ void CNEMOEulerSolver::BC_Sym_Plane(CGeometry *geometry, CSolver **solver_contai
         su2double Velocity[MAXNDIM] = {0.0};
 
         /*--- Get species molar mass ---*/
-        auto& Ms = FluidModel->GetSpeciesMolarMass();
+        auto& Ms = GetFluidModel()->GetSpeciesMolarMass();
 
         /*--- Initialize Jacobian ---*/
         for (auto iVar = 0ul; iVar < nVar; iVar++)
@@ -2027,11 +2234,11 @@ void CNEMOEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container
         V_outlet[A_INDEX]     = SoundSpeed;
 
         /*--- Set mixture state and compute quantities ---*/
-        FluidModel->SetTDStateRhosTTv(rhos, Temperature, Tve);
-        V_outlet[RHOCVTR_INDEX] = FluidModel->ComputerhoCvtr();
-        V_outlet[RHOCVVE_INDEX] = FluidModel->ComputerhoCvve();
+        GetFluidModel()->SetTDStateRhosTTv(rhos, Temperature, Tve);
+        V_outlet[RHOCVTR_INDEX] = GetFluidModel()->ComputerhoCvtr();
+        V_outlet[RHOCVVE_INDEX] = GetFluidModel()->ComputerhoCvve();
 
-        const auto& energies = FluidModel->ComputeMixtureEnergies();
+        const auto& energies = GetFluidModel()->ComputeMixtureEnergies();
 
         /*--- Conservative variables, using the derived quantities ---*/
         for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies ++){
@@ -2155,10 +2362,10 @@ void CNEMOEulerSolver::BC_Supersonic_Inlet(
   }
 
   /*--- Set mixture state ---*/
-  FluidModel->SetTDStatePTTv(Pressure, Mass_Frac, Temperature, Temperature_ve);
+  GetFluidModel()->SetTDStatePTTv(Pressure, Mass_Frac, Temperature, Temperature_ve);
 
   /*--- Compute Ma vector for flow direction ---*/
-  const su2double soundspeed = FluidModel->ComputeSoundSpeed();
+  const su2double soundspeed = GetFluidModel()->ComputeSoundSpeed();
 
   su2double Mvec[MAXNDIM] = {0.0};
 
@@ -2168,8 +2375,8 @@ void CNEMOEulerSolver::BC_Supersonic_Inlet(
   /*--- Allocate inlet node to compute gradients for numerics ---*/
   CNEMOEulerVariable node_inlet(Pressure, Mass_Frac, Mvec, Temperature,
                                 Temperature_ve, 1, nDim, nVar, nPrimVar,
-                                nPrimVarGrad, config, FluidModel);
-  node_inlet.SetPrimVar(0, FluidModel);
+                                nPrimVarGrad, config, GetFluidModel());
+  node_inlet.SetPrimVar(0, GetFluidModel());
 
   su2double Normal[MAXNDIM] = {0.0};
 
@@ -109,37 +109,47 @@ void CNEMONSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_containe
 
 unsigned long CNEMONSSolver::SetPrimitive_Variables(CSolver **solver_container,CConfig *config, bool Output) {
 
-  /*--- Number of non-physical points, local to the thread, needs
-   *    further reduction if function is called in parallel ---*/
+  /*--- Number of non-physical points, reduced over the threads of the local parallel region
+   *    (the NEMO solvers are not hybrid parallel, see CNEMOEulerSolver::SetPrimitive_Variables). ---*/
   unsigned long nonPhysicalPoints = 0;
 
   const TURB_MODEL turb_model = config->GetKind_Turb_Model();
   //const bool tkeNeeded = (turb_model == TURB_MODEL::SST);
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (auto iPoint = 0ul; iPoint < nPoint; iPoint ++) {
+  SU2_OMP_PARALLEL
+  {
+    unsigned long nonPhysicalPointsLocal = 0;
 
-    /*--- Retrieve the value of the kinetic energy (if needed). ---*/
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint ++) {
 
-    su2double eddy_visc = 0.0; //su2double turb_ke = 0.0;
+      /*--- Retrieve the value of the kinetic energy (if needed). ---*/
 
-    if (turb_model != TURB_MODEL::NONE && solver_container[TURB_SOL] != nullptr) {
-      eddy_visc = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
-      //if (tkeNeeded) turb_ke = solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
+      su2double eddy_visc = 0.0; //su2double turb_ke = 0.0;
 
-      nodes->SetEddyViscosity(iPoint, eddy_visc);
-    }
+      if (turb_model != TURB_MODEL::NONE && solver_container[TURB_SOL] != nullptr) {
+        eddy_visc = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
+        //if (tkeNeeded) turb_ke = solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
+
+        nodes->SetEddyViscosity(iPoint, eddy_visc);
+      }
 
-    /*--- Compressible flow, primitive variables. ---*/
+      /*--- Compressible flow, primitive variables. ---*/
 
-    bool nonphysical = nodes->SetPrimVar(iPoint,FluidModel);
+      bool nonphysical = nodes->SetPrimVar(iPoint,GetFluidModel());
 
-    /* Check for non-realizable states for reporting. */
+      /* Check for non-realizable states for reporting. */
 
-    nonPhysicalPoints += nonphysical;
+      nonPhysicalPointsLocal += nonphysical;
 
+    }
+    END_SU2_OMP_FOR
+
+    SU2_OMP_ATOMIC
+    nonPhysicalPoints += nonPhysicalPointsLocal;
   }
-  END_SU2_OMP_FOR
+  END_SU2_OMP_PARALLEL
+
   return nonPhysicalPoints;
 }
 
@@ -667,7 +677,7 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
   /*--- Get universal information ---*/
   const su2double RuSI = UNIVERSAL_GAS_CONSTANT;
   const su2double Ru = 1000.0*RuSI;
-  const auto& Ms = FluidModel->GetSpeciesMolarMass();
+  const auto& Ms = GetFluidModel()->GetSpeciesMolarMass();
 
   /*--- Get the locations of the primitive variables ---*/
   const unsigned short RHOS_INDEX  = nodes->GetRhosIndex();
@@ -711,7 +721,7 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
       const auto& Vj = nodes->GetPrimitive(jPoint);
       const auto& Di = nodes->GetDiffusionCoeff(iPoint);
       const auto& eves = nodes->GetEve(iPoint);
-      const auto& hs = FluidModel->ComputeSpeciesEnthalpy(Vi[T_INDEX], Vi[TVE_INDEX], eves);
+      const auto& hs = GetFluidModel()->ComputeSpeciesEnthalpy(Vi[T_INDEX], Vi[TVE_INDEX], eves);
       const su2double rho = Vi[RHO_INDEX];
       const auto& dTdU = nodes->GetdTdU(iPoint);
       const auto& dTvedU = nodes->GetdTvedU(iPoint);
@@ -755,7 +765,7 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
           }
 
           /*--- Calculate supplementary quantities ---*/
-          const auto& Cvtrs = FluidModel->GetSpeciesCvTraRot();
+          const auto& Cvtrs = GetFluidModel()->GetSpeciesCvTraRot();
           const auto& Cvve = nodes->GetCvve(iPoint);
 
           /*--- Take the primitive var. Jacobian & store in Jac. jj ---*/
@@ -809,7 +819,7 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
         const su2double gam = config->GetCatalytic_Efficiency();
 
         /*--- Get cataltyic reaction map ---*/
-        const auto& RxnTable = FluidModel->GetCatalyticRecombination();
+        const auto& RxnTable = GetFluidModel()->GetCatalyticRecombination();
 
         /*--- Common catalytic flux factor ---*/
         const su2double factor = gam*rho*sqrt(RuSI*Tw/2/PI_NUMBER)*Area;
@@ -926,7 +936,7 @@ void CNEMONSSolver::BC_Smoluchowski_Maxwell(CGeometry *geometry,
     const auto Grad_PrimVar = nodes->GetGradient_Primitive(iPoint);
 
     /*--- Calculate specific gas constant --- */
-    const su2double GasConstant = FluidModel->ComputeGasConstant();
+    const su2double GasConstant = GetFluidModel()->ComputeGasConstant();
 
     /*--- Calculate temperature gradients normal to surface---*/ //Doubt about minus sign
     const su2double dTn = GeometryToolbox::DotProduct(nDim, Grad_PrimVar[T_INDEX], UnitNormal);
@@ -135,11 +135,18 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, cons
   const TURB_MODEL turb_model = config->GetKind_Turb_Model();
   const bool tkeNeeded = (turb_model == TURB_MODEL::SST);
 
+  /*--- Only the data-driven model evaluates several states at once. ---*/
+  const bool prefetch = (config->GetKind_FluidModel() == ENUM_FLUIDMODEL::DATADRIVEN_FLUID);
+  const CVariable* turbNodes = nullptr;
+  if (tkeNeeded && solver_container[TURB_SOL] != nullptr) turbNodes = solver_container[TURB_SOL]->GetNodes();
+
   AD::StartNoSharedReading();
 
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
 
+    if (prefetch) PrefetchFluidModel(iPoint, turbNodes);
+
     /*--- Retrieve the value of the kinetic energy (if needed). ---*/
 
     su2double eddy_visc = 0.0, turb_ke = 0.0;
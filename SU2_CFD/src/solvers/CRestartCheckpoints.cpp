@@ -0,0 +1,200 @@
+/*!
+ * \file CRestartCheckpoints.cpp
+ * \brief In-memory / node-local store of restart data.
+ * \author P. Gomes
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/solvers/CRestartCheckpoints.hpp"
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/geometry/CGeometry.hpp"
+#include "../../../Common/include/geometry/CGeometryCache.hpp"
+#include "../../../Common/include/toolboxes/printing_toolbox.hpp"
+
+#include <fstream>
+
+namespace {
+constexpr uint64_t CHECKPOINT_MAGIC = 0x53553243484bull;  // "SU2CHK"
+constexpr uint64_t CHECKPOINT_VERSION = 3;
+}
+
+bool CRestartCheckpoints::MakeKey(const CGeometry* geometry, const string& filename, CKey& key) {
+  unsigned long fileStamp = 0;
+  if (SU2_MPI::GetRank() == MASTER_NODE) fileStamp = CGeometryCache::StampFile(filename);
+  SU2_MPI::Bcast(&fileStamp, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+
+  /*--- The generation is the same on all ranks, they all go through the same output calls. ---*/
+  const auto it = Generations().find(filename);
+
+  key.filename = filename;
+  key.fileStamp = fileStamp;
+  key.generation = (it != Generations().end()) ? it->second : 0;
+  key.nPointDomain = geometry->GetnPointDomain();
+  key.globalPointDomain = geometry->GetGlobal_nPointDomain();
+
+  /*--- The rows of the data follow the local order of the points. ---*/
+  key.pointsHash = CGeometryCache::HASH_SEED;
+  for (auto iPoint = 0ul; iPoint < key.nPointDomain; ++iPoint) {
+    const uint64_t globalIndex = geometry->nodes->GetGlobalIndex(iPoint);
+    key.pointsHash = CGeometryCache::Hash(&globalIndex, sizeof(uint64_t), key.pointsHash);
+  }
+  return fileStamp != 0;
+}
+
+string CRestartCheckpoints::LocalFileName(const CConfig* config, const string& filename) {
+  auto flatName = filename;
+  for (auto& c : flatName) if (c == '/' || c == '\\') c = '_';
+  return config->GetRestart_Checkpoints_Dir() + "/" + flatName + "_rank" +
+         PrintingToolbox::to_string(SU2_MPI::GetRank()) + ".chk";
+}
+
+bool CRestartCheckpoints::ReadLocal(const string& localName, const CKey& key, CState& state) {
+  ifstream file(localName, ios::binary);
+  if (!file.is_open()) return false;
+
+  auto readValue = [&file]() {
+    uint64_t value = 0;
+    file.read(reinterpret_cast<char*>(&value), sizeof(uint64_t));
+    return value;
+  };
+
+  /*--- The generation only applies to this program. ---*/
+  if (readValue() != CHECKPOINT_MAGIC || readValue() != CHECKPOINT_VERSION || readValue() != key.fileStamp ||
+      readValue() != key.nPointDomain || readValue() != key.globalPointDomain || readValue() != key.pointsHash) {
+    return false;
+  }
+
+  state.vars.resize(readValue());
+  file.read(reinterpret_cast<char*>(state.vars.data()), state.vars.size() * sizeof(int));
+
+  state.fields.resize(readValue());
+  for (auto& field : state.fields) {
+    field.resize(readValue());
+    file.read(&field[0], field.size());
+  }
+
+  state.data.resize(readValue());
+  file.read(reinterpret_cast<char*>(state.data.data()), state.data.size() * sizeof(passivedouble));
+
+  return static_cast<bool>(file);
+}
+
+void CRestartCheckpoints::WriteLocal(const string& localName, const CKey& key, const CState& state) {
+  ofstream file(localName, ios::binary | ios::trunc);
+
+  auto writeValue = [&file](uint64_t value) {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(uint64_t));
+  };
+
+  writeValue(CHECKPOINT_MAGIC);
+  writeValue(CHECKPOINT_VERSION);
+  writeValue(key.fileStamp);
+  writeValue(key.nPointDomain);
+  writeValue(key.globalPointDomain);
+  writeValue(key.pointsHash);
+
+  writeValue(state.vars.size());
+  file.write(reinterpret_cast<const char*>(state.vars.data()), state.vars.size() * sizeof(int));
+
+  writeValue(state.fields.size());
+  for (const auto& field : state.fields) {
+    writeValue(field.size());
+    file.write(field.data(), field.size());
+  }
+
+  writeValue(state.data.size());
+  file.write(reinterpret_cast<const char*>(state.data.data()), state.data.size() * sizeof(passivedouble));
+
+  if (!file) {
+    cout << "WARNING: Rank " << SU2_MPI::GetRank() << " could not write the restart checkpoint " << localName
+         << "." << endl;
+  }
+}
+
+uint64_t CRestartCheckpoints::Bytes(const CState& state) {
+  uint64_t bytes = state.vars.size() * sizeof(int) + state.data.size() * sizeof(passivedouble);
+  for (const auto& field : state.fields) bytes += field.size();
+  return bytes;
+}
+
+void CRestartCheckpoints::Insert(uint64_t budget, const CKey& key, const CState& state) {
+  auto& states = States();
+  states.remove_if([&key](const pair<CKey, CState>& entry) { return entry.first == key; });
+  if (Bytes(state) > budget) return;
+
+  states.emplace_front(key, state);
+  uint64_t used = 0;
+  for (auto it = states.begin(); it != states.end(); ++it) {
+    used += Bytes(it->second);
+    if (used > budget) {
+      states.erase(it, states.end());
+      break;
+    }
+  }
+}
+
+bool CRestartCheckpoints::Load(const CConfig* config, const CGeometry* geometry, const string& filename,
+                               CState& state) {
+  const uint64_t budget = config->GetRestart_Checkpoints_RAM() << 20;
+  const bool local = !config->GetRestart_Checkpoints_Dir().empty();
+  if (budget == 0 && !local) return false;
+
+  CKey key;
+  if (!MakeKey(geometry, filename, key)) return false;
+
+  /*--- Memory first, then the node-local copy. ---*/
+
+  auto& states = States();
+  auto it = states.begin();
+  for (; it != states.end(); ++it) if (it->first == key) break;
+
+  const bool inMemory = (it != states.end());
+  int found = inMemory || (local && ReadLocal(LocalFileName(config, filename), key, state));
+
+  /*--- All ranks need the data, otherwise the file is read collectively. ---*/
+
+  int allFound = found;
+  SU2_MPI::Allreduce(&found, &allFound, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+  if (!allFound) return false;
+
+  if (inMemory) {
+    state = it->second;
+    states.splice(states.begin(), states, it);
+  } else if (budget > 0) {
+    Insert(budget, key, state);
+  }
+  return true;
+}
+
+void CRestartCheckpoints::Store(const CConfig* config, const CGeometry* geometry, const string& filename,
+                                const CState& state) {
+  const uint64_t budget = config->GetRestart_Checkpoints_RAM() << 20;
+  const bool local = !config->GetRestart_Checkpoints_Dir().empty();
+  if (budget == 0 && !local) return;
+
+  CKey key;
+  if (!MakeKey(geometry, filename, key)) return;
+
+  if (budget > 0) Insert(budget, key, state);
+  if (local) WriteLocal(LocalFileName(config, filename), key, state);
+}
@@ -48,6 +48,70 @@
 #include "../../../Common/include/toolboxes/CLinearPartitioner.hpp"
 #include "../../../Common/include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/CMarkerProfileReaderFVM.hpp"
+#include "../../include/solvers/CRestartCheckpoints.hpp"
+#include "../../../Common/include/toolboxes/compression_toolbox.hpp"
+
+#include <climits>
+
+namespace {
+/*!
+ * \brief Decompress the rows [begin, begin+count) of a compressed restart file (see CFileWriter::WriteMPICompressedDataAll).
+ * \note Only the chunks that overlap the rows are read, with one call for the range of bytes they span.
+ * \param[in] table - Number of chunks followed by first row, number of rows, and compressed size of each chunk.
+ * \param[in] nFields - Number of fields (columns).
+ * \param[in] begin - First row to read.
+ * \param[in] count - Number of rows to read.
+ * \param[in] readBytes - Reads a number of bytes at an offset relative to the start of the chunks.
+ * \param[out] data - Rows that were read.
+ */
+template <class ReadFunc>
+void DecompressRestartRows(const vector<uint64_t>& table, unsigned long nFields, unsigned long begin,
+                           unsigned long count, const ReadFunc& readBytes, passivedouble* data) {
+  const uint64_t nChunk = table[0];
+  auto first = [&](uint64_t iChunk) { return table[1 + 3*iChunk]; };
+  auto nRows = [&](uint64_t iChunk) { return table[2 + 3*iChunk]; };
+  auto nBytes = [&](uint64_t iChunk) { return table[3 + 3*iChunk]; };
+
+  /*--- Range of overlapping chunks and of their bytes. ---*/
+
+  uint64_t startChunk = nChunk, endChunk = 0, startByte = 0, endByte = 0, offset = 0;
+
+  for (uint64_t iChunk = 0; iChunk < nChunk; ++iChunk) {
+    if (max<uint64_t>(first(iChunk), begin) < min<uint64_t>(first(iChunk) + nRows(iChunk), begin + count)) {
+      if (startChunk == nChunk) {
+        startChunk = iChunk;
+        startByte = offset;
+      }
+      endChunk = iChunk + 1;
+      endByte = offset + nBytes(iChunk);
+    }
+    offset += nBytes(iChunk);
+  }
+  if (startChunk >= endChunk) return;
+
+  vector<char> compressed(endByte - startByte);
+  readBytes(startByte, compressed.size(), compressed.data());
+
+  vector<passivedouble> rows;
+  offset = 0;
+
+  for (auto iChunk = startChunk; iChunk < endChunk; ++iChunk) {
+    const auto start = max<uint64_t>(first(iChunk), begin);
+    const auto end = min<uint64_t>(first(iChunk) + nRows(iChunk), begin + count);
+
+    if (start < end) {
+      rows.resize(nRows(iChunk)*nFields);
+      if (!CompressionToolbox::Decompress(compressed.data() + offset, nBytes(iChunk), nRows(iChunk), nFields,
+                                          sizeof(passivedouble), rows.data())) {
+        SU2_MPI::Error("The compressed restart file is corrupted.", CURRENT_FUNCTION);
+      }
+      copy(rows.begin() + (start - first(iChunk))*nFields, rows.begin() + (end - first(iChunk))*nFields,
+           data + (start - begin)*nFields);
+    }
+    offset += nBytes(iChunk);
+  }
+}
+}
 
 
 CSolver::CSolver(LINEAR_SOLVER_MODE linear_solver_mode) : System(linear_solver_mode) {
@@ -1407,6 +1471,8 @@ void CSolver::InitiateComms(CGeometry *geometry,
                             const CConfig *config,
                             unsigned short commType) {
 
+  SU2_PROFILE_SCOPE("HaloInitiateComms");
+
   /*--- Local variables ---*/
 
   unsigned short iVar, iDim;
@@ -1549,6 +1615,8 @@ void CSolver::CompleteComms(CGeometry *geometry,
                             const CConfig *config,
                             unsigned short commType) {
 
+  SU2_PROFILE_SCOPE("HaloCompleteComms");
+
   /*--- Local variables ---*/
 
   unsigned short iDim, iVar;
@@ -2749,6 +2817,8 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, const CConfig *config,
   strcpy(fname, val_filename.c_str());
   int magic_number;
 
+  if (LoadRestartCheckpoint(geometry, config, val_filename)) return;
+
 #ifndef HAVE_MPI
 
   /*--- Serial binary input. ---*/
@@ -2889,6 +2959,7 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, const CConfig *config,
     SU2_MPI::Error("The solution file does not match the mesh, currently only binary files can be interpolated.",
                    CURRENT_FUNCTION);
 
+  StoreRestartCheckpoint(geometry, config, val_filename);
 }
 
 void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config, string val_filename) {
@@ -2900,6 +2971,10 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
   Restart_Vars.resize(nRestart_Vars);
   fields.clear();
 
+  /*--- Reuse the data if the file was read recently, e.g. by another solver of the zone. ---*/
+
+  if (LoadRestartCheckpoint(geometry, config, val_filename)) return;
+
 #ifndef HAVE_MPI
 
   /*--- Serial binary input. ---*/
@@ -2954,11 +3029,35 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
 
   Restart_Data.resize(nFields*nPointFile);
 
-  /*--- Read in the data for the restart at all local points. ---*/
+  if (Restart_Vars[3] == 1) {
 
-  ret = fread(Restart_Data.data(), sizeof(passivedouble), nFields*nPointFile, fhw);
-  if (ret != nFields*nPointFile) {
-    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    /*--- Compressed data, read the table of chunks and decompress all of them. ---*/
+
+    uint64_t nChunk = 0;
+    ret = fread(&nChunk, sizeof(uint64_t), 1, fhw);
+    vector<uint64_t> table(1 + 3*nChunk);
+    table[0] = nChunk;
+    ret += fread(&table[1], sizeof(uint64_t), 3*nChunk, fhw);
+    if (ret != table.size()) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+    const long dataStart = ftell(fhw);
+
+    auto readBytes = [&](uint64_t offset, uint64_t nBytes, char* buf) {
+      if (fseek(fhw, dataStart + offset, SEEK_SET) != 0 || fread(buf, 1, nBytes, fhw) != nBytes) {
+        SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+      }
+    };
+    DecompressRestartRows(table, nFields, 0, nPointFile, readBytes, Restart_Data.data());
+
+  } else {
+
+    /*--- Read in the data for the restart at all local points. ---*/
+
+    ret = fread(Restart_Data.data(), sizeof(passivedouble), nFields*nPointFile, fhw);
+    if (ret != nFields*nPointFile) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
   }
 
   /*--- Close the file. ---*/
@@ -3041,79 +3140,84 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
 
   delete [] mpi_str_buf;
 
-  /*--- We're writing only su2doubles in the data portion of the file. ---*/
-
-  etype = MPI_DOUBLE;
-
   /*--- We need to ignore the 4 ints describing the nVar_Restart and nPoints,
    along with the string names of the variables. ---*/
 
   disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
 
-  /*--- Define a derived datatype for this rank's set of non-contiguous data
-   that will be placed in the restart. Here, we are collecting each one of the
-   points which are distributed throughout the file in blocks of nVar_Restart data. ---*/
-
-  int nBlock;
-  int *blocklen = nullptr;
-  MPI_Aint *displace = nullptr;
-
-  if (nPointFile == geometry->GetGlobal_nPointDomain() ||
-      config->GetKind_SU2() == SU2_COMPONENT::SU2_SOL) {
-    /*--- No interpolation, each rank reads the indices it needs. ---*/
-    nBlock = geometry->GetnPointDomain();
-
-    blocklen = new int[nBlock];
-    displace = new MPI_Aint[nBlock];
-    int counter = 0;
-    for (auto iPoint_Global = 0ul; iPoint_Global < geometry->GetGlobal_nPointDomain(); ++iPoint_Global) {
-      if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) {
-        blocklen[counter] = nFields;
-        displace[counter] = iPoint_Global*nFields*sizeof(passivedouble);
-        counter++;
+  if (Restart_Vars[3] == 1) {
+    ReadCompressedRestartData(geometry, config, fhw, disp, nFields, nPointFile);
+  } else {
+
+    /*--- We're writing only su2doubles in the data portion of the file. ---*/
+
+    etype = MPI_DOUBLE;
+
+    /*--- Define a derived datatype for this rank's set of non-contiguous data
+     that will be placed in the restart. Here, we are collecting each one of the
+     points which are distributed throughout the file in blocks of nVar_Restart data. ---*/
+
+    int nBlock;
+    int *blocklen = nullptr;
+    MPI_Aint *displace = nullptr;
+
+    if (nPointFile == geometry->GetGlobal_nPointDomain() ||
+        config->GetKind_SU2() == SU2_COMPONENT::SU2_SOL) {
+      /*--- No interpolation, each rank reads the indices it needs. ---*/
+      nBlock = geometry->GetnPointDomain();
+
+      blocklen = new int[nBlock];
+      displace = new MPI_Aint[nBlock];
+      int counter = 0;
+      for (auto iPoint_Global = 0ul; iPoint_Global < geometry->GetGlobal_nPointDomain(); ++iPoint_Global) {
+        if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) {
+          blocklen[counter] = nFields;
+          displace[counter] = iPoint_Global*nFields*sizeof(passivedouble);
+          counter++;
+        }
       }
     }
-  }
-  else {
-    /*--- Interpolation required, read large blocks of data. ---*/
-    nBlock = 1;
+    else {
+      /*--- Interpolation required, read large blocks of data. ---*/
+      nBlock = 1;
 
-    blocklen = new int[nBlock];
-    displace = new MPI_Aint[nBlock];
+      blocklen = new int[nBlock];
+      displace = new MPI_Aint[nBlock];
 
-    const auto partitioner = CLinearPartitioner(nPointFile,0);
+      const auto partitioner = CLinearPartitioner(nPointFile,0);
 
-    blocklen[0] = nFields*partitioner.GetSizeOnRank(rank);
-    displace[0] = nFields*partitioner.GetFirstIndexOnRank(rank)*sizeof(passivedouble);;
-  }
+      blocklen[0] = nFields*partitioner.GetSizeOnRank(rank);
+      displace[0] = nFields*partitioner.GetFirstIndexOnRank(rank)*sizeof(passivedouble);;
+    }
 
-  MPI_Type_create_hindexed(nBlock, blocklen, displace, MPI_DOUBLE, &filetype);
-  MPI_Type_commit(&filetype);
+    MPI_Type_create_hindexed(nBlock, blocklen, displace, MPI_DOUBLE, &filetype);
+    MPI_Type_commit(&filetype);
 
-  /*--- Set the view for the MPI file write, i.e., describe the location in
-   the file that this rank "sees" for writing its piece of the restart file. ---*/
+    /*--- Set the view for the MPI file write, i.e., describe the location in
+     the file that this rank "sees" for writing its piece of the restart file. ---*/
 
-  MPI_File_set_view(fhw, disp, etype, filetype, (char*)"native", MPI_INFO_NULL);
+    MPI_File_set_view(fhw, disp, etype, filetype, (char*)"native", MPI_INFO_NULL);
 
-  /*--- For now, create a temp 1D buffer to read the data from file. ---*/
+    /*--- For now, create a temp 1D buffer to read the data from file. ---*/
 
-  const int bufSize = nBlock*blocklen[0];
-  Restart_Data.resize(bufSize);
+    const int bufSize = nBlock*blocklen[0];
+    Restart_Data.resize(bufSize);
 
-  /*--- Collective call for all ranks to read from their view simultaneously. ---*/
+    /*--- Collective call for all ranks to read from their view simultaneously. ---*/
 
-  MPI_File_read_all(fhw, Restart_Data.data(), bufSize, MPI_DOUBLE, &status);
+    MPI_File_read_all(fhw, Restart_Data.data(), bufSize, MPI_DOUBLE, &status);
 
-  /*--- All ranks close the file after writing. ---*/
+    /*--- Free the derived datatype and release temp memory. ---*/
 
-  MPI_File_close(&fhw);
+    MPI_Type_free(&filetype);
 
-  /*--- Free the derived datatype and release temp memory. ---*/
+    delete [] blocklen;
+    delete [] displace;
+  }
 
-  MPI_Type_free(&filetype);
+  /*--- All ranks close the file after reading. ---*/
 
-  delete [] blocklen;
-  delete [] displace;
+  MPI_File_close(&fhw);
 
 #endif
 
@@ -3121,6 +3225,120 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
       config->GetKind_SU2() != SU2_COMPONENT::SU2_SOL) {
     InterpolateRestartData(geometry, config);
   }
+
+  StoreRestartCheckpoint(geometry, config, val_filename);
+}
+
+#ifdef HAVE_MPI
+void CSolver::ReadCompressedRestartData(const CGeometry *geometry, const CConfig *config, MPI_File fhw,
+                                        MPI_Offset disp, unsigned long nFields, unsigned long nPointFile) {
+
+  /*--- The master reads the table of chunks, it is broadcast as bytes since the entries are uint64_t. ---*/
+
+  uint64_t nChunk = 0;
+  if (rank == MASTER_NODE) MPI_File_read_at(fhw, disp, &nChunk, sizeof(uint64_t), MPI_BYTE, MPI_STATUS_IGNORE);
+  SU2_MPI::Bcast(&nChunk, sizeof(uint64_t), MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
+
+  vector<uint64_t> table(1 + 3*nChunk);
+  table[0] = nChunk;
+  if (rank == MASTER_NODE) {
+    MPI_File_read_at(fhw, disp + sizeof(uint64_t), &table[1], 3*nChunk*sizeof(uint64_t), MPI_BYTE,
+                     MPI_STATUS_IGNORE);
+  }
+  SU2_MPI::Bcast(table.data(), table.size()*sizeof(uint64_t), MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
+
+  /*--- The count of MPI_File_read_at is an int, large ranges are read in pieces. ---*/
+
+  const MPI_Offset dataStart = disp + table.size()*sizeof(uint64_t);
+  auto readBytes = [&](uint64_t offset, uint64_t nBytes, char* buf) {
+    for (uint64_t done = 0; done < nBytes;) {
+      const int piece = static_cast<int>(min<uint64_t>(nBytes - done, INT_MAX));
+      MPI_File_read_at(fhw, dataStart + offset + done, buf + done, piece, MPI_BYTE, MPI_STATUS_IGNORE);
+      done += piece;
+    }
+  };
+
+  /*--- Decompress a linear partition of the file. ---*/
+
+  const auto partitioner = CLinearPartitioner(nPointFile,0);
+  const auto begin = partitioner.GetFirstIndexOnRank(rank);
+  const auto count = partitioner.GetSizeOnRank(rank);
+
+  if (nPointFile != geometry->GetGlobal_nPointDomain() &&
+      config->GetKind_SU2() != SU2_COMPONENT::SU2_SOL) {
+    /*--- Interpolation required, which uses the linear partition. ---*/
+    Restart_Data.resize(nFields*count);
+    DecompressRestartRows(table, nFields, begin, count, readBytes, Restart_Data.data());
+    return;
+  }
+
+  vector<passivedouble> linearData(nFields*count);
+  DecompressRestartRows(table, nFields, begin, count, readBytes, linearData.data());
+
+  /*--- Request the points of this rank (in increasing global order) from the ranks that own them in the
+   *    linear partition. Since the owners increase with the global index, the replies are in the same order. ---*/
+
+  vector<unsigned long> request;
+  request.reserve(geometry->GetnPointDomain());
+  vector<int> nRequest(size, 0), nReply(size, 0);
+
+  for (auto iPoint_Global = 0ul; iPoint_Global < geometry->GetGlobal_nPointDomain(); ++iPoint_Global) {
+    if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) {
+      request.push_back(iPoint_Global);
+      nRequest[partitioner.GetRankContainingIndex(iPoint_Global)]++;
+    }
+  }
+  SU2_MPI::Alltoall(nRequest.data(), 1, MPI_INT, nReply.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  vector<int> requestDispl(size, 0), replyDispl(size, 0);
+  for (int iRank = 1; iRank < size; iRank++) {
+    requestDispl[iRank] = requestDispl[iRank-1] + nRequest[iRank-1];
+    replyDispl[iRank] = replyDispl[iRank-1] + nReply[iRank-1];
+  }
+
+  vector<unsigned long> requested(replyDispl[size-1] + nReply[size-1]);
+  SU2_MPI::Alltoallv(request.data(), nRequest.data(), requestDispl.data(), MPI_UNSIGNED_LONG,
+                     requested.data(), nReply.data(), replyDispl.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  vector<passivedouble> reply(requested.size()*nFields);
+  for (auto i = 0ul; i < requested.size(); ++i) {
+    const auto* row = &linearData[(requested[i] - begin)*nFields];
+    copy(row, row + nFields, &reply[i*nFields]);
+  }
+
+  /*--- Scale the counts to send rows of data. ---*/
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    nRequest[iRank] *= nFields; requestDispl[iRank] *= nFields;
+    nReply[iRank] *= nFields; replyDispl[iRank] *= nFields;
+  }
+
+  Restart_Data.resize(request.size()*nFields);
+  SU2_MPI::Alltoallv(reply.data(), nReply.data(), replyDispl.data(), MPI_DOUBLE,
+                     Restart_Data.data(), nRequest.data(), requestDispl.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+}
+#endif
+
+bool CSolver::LoadRestartCheckpoint(const CGeometry *geometry, const CConfig *config, const string& filename) {
+
+  CRestartCheckpoints::CState state;
+  if (!CRestartCheckpoints::Load(config, geometry, filename, state)) return false;
+
+  Restart_Vars = move(state.vars);
+  fields = move(state.fields);
+  Restart_Data = move(state.data);
+  return true;
+}
+
+void CSolver::StoreRestartCheckpoint(const CGeometry *geometry, const CConfig *config, const string& filename) const {
+
+  if (config->GetRestart_Checkpoints_RAM() == 0 && config->GetRestart_Checkpoints_Dir().empty()) return;
+
+  CRestartCheckpoints::CState state;
+  state.vars = Restart_Vars;
+  state.fields = fields;
+  state.data = Restart_Data;
+  CRestartCheckpoints::Store(config, geometry, filename, state);
 }
 
 void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *config) {
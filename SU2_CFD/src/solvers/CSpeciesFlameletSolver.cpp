@@ -67,34 +67,55 @@ void CSpeciesFlameletSolver::Preprocessing(CGeometry* geometry, CSolver** solver
                                            unsigned short iMesh, unsigned short iRKStep,
                                            unsigned short RunTime_EqSystem, bool Output) {
   unsigned long n_not_in_domain_local = 0, n_not_in_domain_global = 0;
-  vector<su2double> scalars_vector(nVar);
 
   auto* flowNodes = su2staticcast_p<CFlowVariable*>(solver_container[FLOW_SOL]->GetNodes());
 
   SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetGlobalParam(config->GetKind_Solver(), RunTime_EqSystem);)
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (auto i_point = 0u; i_point < nPoint; i_point++) {
+  /*--- The manifold is evaluated for blocks of points, which amortizes the cost of the look-up calls. ---*/
+  const unsigned long n_sources = config->GetNControlVars() + 2 * config->GetNUserScalars();
+  const unsigned long n_lookups = config->GetNLookups();
+  const unsigned long n_blocks = (nPoint + LOOKUP_BLOCK_SIZE - 1) / LOOKUP_BLOCK_SIZE;
+
+  vector<su2double> table_sources(LOOKUP_BLOCK_SIZE * n_sources), table_lookups(LOOKUP_BLOCK_SIZE * n_lookups);
+  unsigned short misses[LOOKUP_BLOCK_SIZE];
+
+  SU2_OMP_FOR_DYN(1)
+  for (auto i_block = 0ul; i_block < n_blocks; i_block++) {
     CFluidModel* fluid_model_local = solver_container[FLOW_SOL]->GetFluidModel();
-    su2double* scalars = nodes->GetSolution(i_point);
-    for (auto iVar = 0u; iVar < nVar; iVar++) scalars_vector[iVar] = scalars[iVar];
+    const auto i_begin = i_block * LOOKUP_BLOCK_SIZE;
+    const auto n_block = min<unsigned long>(LOOKUP_BLOCK_SIZE, nPoint - i_begin);
 
     /*--- Compute total source terms from the production and consumption. ---*/
-    unsigned long misses = SetScalarSources(config, fluid_model_local, i_point, scalars_vector);
-    nodes->SetTableMisses(i_point, misses);
-    n_not_in_domain_local += misses;
+    fluid_model_local->EvaluateDataSetBatch(n_block, nodes->GetSolution(i_begin), nVar, FLAMELET_LOOKUP_OPS::SOURCES,
+                                            table_sources.data(), misses);
+
     /*--- Obtain passive look-up scalars. ---*/
-    SetScalarLookUps(config, fluid_model_local, i_point, scalars_vector);
-
-    /*--- Set mass diffusivity based on thermodynamic state. ---*/
-    su2double T = flowNodes->GetTemperature(i_point);
-    fluid_model_local->SetTDState_T(T, scalars);
-    /*--- set the diffusivity in the fluid model to the diffusivity obtained from the lookup table ---*/
-    for (auto i_scalar = 0u; i_scalar < nVar; ++i_scalar) {
-      nodes->SetDiffusivity(i_point, fluid_model_local->GetMassDiffusivity(i_scalar), i_scalar);
+    if (n_lookups > 0) {
+      fluid_model_local->EvaluateDataSetBatch(n_block, nodes->GetSolution(i_begin), nVar,
+                                              FLAMELET_LOOKUP_OPS::LOOKUP, table_lookups.data(), nullptr);
     }
 
-    if (!Output) LinSysRes.SetBlock_Zero(i_point);
+    for (auto i = 0ul; i < n_block; i++) {
+      const auto i_point = i_begin + i;
+      su2double* scalars = nodes->GetSolution(i_point);
+
+      SetScalarSources(config, i_point, scalars, &table_sources[i * n_sources]);
+      nodes->SetTableMisses(i_point, misses[i]);
+      n_not_in_domain_local += misses[i];
+
+      SetScalarLookUps(config, i_point, &table_lookups[i * n_lookups]);
+
+      /*--- Set mass diffusivity based on thermodynamic state. ---*/
+      su2double T = flowNodes->GetTemperature(i_point);
+      fluid_model_local->SetTDState_T(T, scalars);
+      /*--- set the diffusivity in the fluid model to the diffusivity obtained from the lookup table ---*/
+      for (auto i_scalar = 0u; i_scalar < nVar; ++i_scalar) {
+        nodes->SetDiffusivity(i_point, fluid_model_local->GetMassDiffusivity(i_scalar), i_scalar);
+      }
+
+      if (!Output) LinSysRes.SetBlock_Zero(i_point);
+    }
   }
   END_SU2_OMP_FOR
   /* --- Sum up some global counters over processes. --- */
@@ -436,17 +457,13 @@ void CSpeciesFlameletSolver::BC_ConjugateHeat_Interface(CGeometry* geometry, CSo
   BC_Isothermal_Wall_Generic(geometry, solver_container, conv_numerics, nullptr, config, val_marker, true);
 }
 
-unsigned long CSpeciesFlameletSolver::SetScalarSources(const CConfig* config, CFluidModel* fluid_model_local,
-                                                       unsigned long iPoint, const vector<su2double>& scalars) {
+void CSpeciesFlameletSolver::SetScalarSources(const CConfig* config, unsigned long iPoint, const su2double* scalars,
+                                              const su2double* table_sources) {
   /*--- Compute total source terms from the production and consumption. ---*/
 
-  vector<su2double> table_sources(config->GetNControlVars() + 2 * config->GetNUserScalars());
-  unsigned long misses = fluid_model_local->EvaluateDataSet(scalars, FLAMELET_LOOKUP_OPS::SOURCES, table_sources);
-  nodes->SetTableMisses(iPoint, misses);
-
   /*--- The source term for progress variable is always positive, we clip from below to makes sure. --- */
 
-  vector<su2double> source_scalar(config->GetNScalars());
+  su2double source_scalar[MAXNVAR];
   for (auto iCV = 0u; iCV < config->GetNControlVars(); iCV++) source_scalar[iCV] = table_sources[iCV];
   source_scalar[I_PROGVAR] = fmax(EPS, source_scalar[I_PROGVAR]);
 
@@ -461,20 +478,13 @@ unsigned long CSpeciesFlameletSolver::SetScalarSources(const CConfig* config, CF
   }
   for (auto i_scalar = 0u; i_scalar < nVar; i_scalar++)
     nodes->SetScalarSource(iPoint, i_scalar, source_scalar[i_scalar]);
-  return misses;
 }
 
-unsigned long CSpeciesFlameletSolver::SetScalarLookUps(const CConfig* config, CFluidModel* fluid_model_local,
-                                                       unsigned long iPoint, const vector<su2double>& scalars) {
-  /*--- Compute total source terms from the production and consumption. ---*/
-
-  vector<su2double> lookup_scalar(config->GetNLookups());
-  unsigned long misses = fluid_model_local->EvaluateDataSet(scalars, FLAMELET_LOOKUP_OPS::LOOKUP, lookup_scalar);
-
+void CSpeciesFlameletSolver::SetScalarLookUps(const CConfig* config, unsigned long iPoint,
+                                              const su2double* table_lookups) {
   for (auto i_lookup = 0u; i_lookup < config->GetNLookups(); i_lookup++) {
-    nodes->SetLookupScalar(iPoint, lookup_scalar[i_lookup], i_lookup);
+    nodes->SetLookupScalar(iPoint, table_lookups[i_lookup], i_lookup);
   }
-  return misses;
 }
 
 unsigned long CSpeciesFlameletSolver::GetEnthFromTemp(CFluidModel* fluid_model, su2double const val_temp,
@@ -26,6 +26,7 @@
  */
 
 #include "../../include/solvers/CSpeciesSolver.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
@@ -328,6 +329,10 @@ void CSpeciesSolver::Viscous_Residual(unsigned long iEdge, CGeometry* geometry,
   Viscous_Residual_impl(SolverSpecificNumerics, iEdge, geometry, solver_container, numerics, config);
 }
 
+void CSpeciesSolver::InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) {
+  edgeNumerics = CNumericsSIMD::CreateScalarNumerics(*config, nDim, SPECIES_SOL, solvers);
+}
+
 void CSpeciesSolver::BC_Inlet(CGeometry* geometry, CSolver** solver_container, CNumerics* conv_numerics,
                               CNumerics* visc_numerics, CConfig* config, unsigned short val_marker) {
 
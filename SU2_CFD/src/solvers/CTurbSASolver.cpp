@@ -26,6 +26,7 @@
  */
 
 #include "../../include/solvers/CTurbSASolver.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 #include "../../include/variables/CTurbSAVariable.hpp"
 #include "../../include/variables/CFlowVariable.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
@@ -305,6 +306,10 @@ void CTurbSASolver::Viscous_Residual(unsigned long iEdge, CGeometry* geometry, C
   Viscous_Residual_impl(SolverSpecificNumerics, iEdge, geometry, solver_container, numerics, config);
 }
 
+void CTurbSASolver::InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) {
+  edgeNumerics = CNumericsSIMD::CreateScalarNumerics(*config, nDim, TURB_SOL, solvers);
+}
+
 void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_container,
                                     CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
@@ -319,7 +324,34 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
 
   AD::StartNoSharedReading();
 
-  /*--- Loop over all points. ---*/
+  /*--- Add the stored harmonic balance source term. ---*/
+
+  auto HarmonicBalance_Residual = [&]() {
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+      su2double Volume = geometry->nodes->GetVolume(iPoint);
+
+      /*--- Access stored harmonic balance source term ---*/
+
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        su2double Source = nodes->GetHarmonicBalance_Source(iPoint,iVar);
+        LinSysRes(iPoint,iVar) += Source*Volume;
+      }
+    }
+    END_SU2_OMP_FOR
+  };
+
+  /*--- Use the vectorized implementation if the model options support it. ---*/
+
+  if (PointSource_Residual(geometry, solver_container, config)) {
+    if (harmonic_balance) HarmonicBalance_Residual();
+    AD::EndNoSharedReading();
+    return;
+  }
+
+  /*--- Otherwise loop over all points. ---*/
 
   SU2_OMP_FOR_DYN(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
@@ -402,22 +434,7 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
   }
   END_SU2_OMP_FOR
 
-  if (harmonic_balance) {
-
-    SU2_OMP_FOR_STAT(omp_chunk_size)
-    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
-
-      su2double Volume = geometry->nodes->GetVolume(iPoint);
-
-      /*--- Access stored harmonic balance source term ---*/
-
-      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-        su2double Source = nodes->GetHarmonicBalance_Source(iPoint,iVar);
-        LinSysRes(iPoint,iVar) += Source*Volume;
-      }
-    }
-    END_SU2_OMP_FOR
-  }
+  if (harmonic_balance) HarmonicBalance_Residual();
 
   AD::EndNoSharedReading();
 
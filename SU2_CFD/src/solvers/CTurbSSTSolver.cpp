@@ -26,6 +26,7 @@
  */
 
 #include "../../include/solvers/CTurbSSTSolver.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 #include "../../include/variables/CTurbSSTVariable.hpp"
 #include "../../include/variables/CFlowVariable.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
@@ -290,6 +291,10 @@ void CTurbSSTSolver::Viscous_Residual(unsigned long iEdge, CGeometry* geometry,
   Viscous_Residual_impl(SolverSpecificNumerics, iEdge, geometry, solver_container, numerics, config);
 }
 
+void CTurbSSTSolver::InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) {
+  edgeNumerics = CNumericsSIMD::CreateScalarNumerics(*config, nDim, TURB_SOL, solvers);
+}
+
 void CTurbSSTSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container,
                                      CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
@@ -302,10 +307,17 @@ void CTurbSSTSolver::Source_Residual(CGeometry *geometry, CSolver **solver_conta
   /*--- Pick one numerics object per thread. ---*/
   auto* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  /*--- Loop over all points. ---*/
-
   AD::StartNoSharedReading();
 
+  /*--- Use the vectorized implementation if the model options support it. ---*/
+
+  if (PointSource_Residual(geometry, solver_container, config)) {
+    AD::EndNoSharedReading();
+    return;
+  }
+
+  /*--- Otherwise loop over all points. ---*/
+
   SU2_OMP_FOR_DYN(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
@@ -29,6 +29,7 @@
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/solvers/CScalarSolver.inl"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 
 /*--- Explicit instantiation of the parent class of CTurbSolver. ---*/
 template class CScalarSolver<CTurbVariable>;
@@ -43,6 +44,38 @@ CTurbSolver::~CTurbSolver() {
   for (auto& mat : SlidingState) {
     for (auto ptr : mat) delete [] ptr;
   }
+  delete pointSource;
+}
+
+bool CTurbSolver::PointSource_Residual(const CGeometry* geometry, const CSolver* const* solver_container,
+                                       const CConfig* config) {
+  if (!pointSourceInstantiated) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+    {
+      pointSource = CSourceSIMD::CreateTurbSource(*config, nDim, solver_container);
+      pointSourceInstantiated = true;
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  if (!pointSource) return false;
+
+  /*--- Loop over groups of points, the last one is padded with masked out points. ---*/
+
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (auto k = 0ul; k < nPointDomain; k += Double::Size) {
+    Int iPoint;
+    Double mask;
+    for (auto j = 0ul; j < Double::Size; ++j) {
+      bool in = (k + j < nPointDomain);
+      mask[j] = in;
+      iPoint[j] = k + j * in;
+    }
+    pointSource->ComputeSource(iPoint, *config, *geometry, *nodes, mask, LinSysRes, Jacobian);
+  }
+  END_SU2_OMP_FOR
+
+  return true;
 }
 
 void CTurbSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
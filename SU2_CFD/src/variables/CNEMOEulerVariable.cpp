@@ -141,10 +141,10 @@ bool CNEMOEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidMode
 
   unsigned short iVar;
 
-  fluidmodel = static_cast<CNEMOGas*>(FluidModel);
+  auto* fluidmodel = static_cast<CNEMOGas*>(FluidModel);
 
   /*--- Convert conserved to primitive variables ---*/
-  bool nonPhys = Cons2PrimVar(Solution[iPoint], Primitive[iPoint],
+  bool nonPhys = Cons2PrimVar(fluidmodel, Solution[iPoint], Primitive[iPoint],
                               dPdU[iPoint], dTdU[iPoint], dTvedU[iPoint], eves[iPoint], Cvves[iPoint]);
 
   /*--- Reset solution to previous one, if nonphys ---*/
@@ -153,7 +153,7 @@ bool CNEMOEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidMode
       Solution(iPoint,iVar) = Solution_Old(iPoint,iVar);
 
     /*--- Recompute Primitive from previous solution ---*/
-    Cons2PrimVar(Solution[iPoint], Primitive[iPoint],
+    Cons2PrimVar(fluidmodel, Solution[iPoint], Primitive[iPoint],
                    dPdU[iPoint], dTdU[iPoint], dTvedU[iPoint], eves[iPoint], Cvves[iPoint]);
   }
 
@@ -165,7 +165,7 @@ bool CNEMOEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidMode
   return nonPhys;
 }
 
-bool CNEMOEulerVariable::Cons2PrimVar(su2double *U, su2double *V,
+bool CNEMOEulerVariable::Cons2PrimVar(CNEMOGas *fluidmodel, su2double *U, su2double *V,
                                       su2double *val_dPdU, su2double *val_dTdU,
                                       su2double *val_dTvedU, su2double *val_eves,
                                       su2double *val_Cvves) {
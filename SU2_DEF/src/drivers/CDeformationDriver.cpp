@@ -31,6 +31,7 @@
 #include "../../../SU2_CFD/include/numerics/elasticity/CFEALinearElasticity.hpp"
 #include "../../../SU2_CFD/include/output/CMeshOutput.hpp"
 #include "../../../SU2_CFD/include/solvers/CMeshSolver.hpp"
+#include "../../../SU2_CFD/include/output/filewriter/CSU2MeshFileWriter.hpp"
 
 using namespace std;
 
@@ -497,8 +498,15 @@ void CDeformationDriver::OutputFiles() {
 
     output_container[iZone]->LoadData(geometry_container[iZone][INST_0][MESH_0], config_container[iZone], nullptr);
 
+    /*--- The binary format is selected by the extension of the output file name. ---*/
+
+    const auto meshOutFilename = driver_config->GetMesh_Out_FileName();
+    const auto binaryExt = CSU2MeshFileWriter::fileExtBinary;
+    const bool binaryMesh = meshOutFilename.size() >= binaryExt.size() &&
+        meshOutFilename.compare(meshOutFilename.size() - binaryExt.size(), binaryExt.size(), binaryExt) == 0;
+
     output_container[iZone]->WriteToFile(config_container[iZone], geometry_container[iZone][INST_0][MESH_0],
-                                         OUTPUT_TYPE::MESH, driver_config->GetMesh_Out_FileName());
+                                         binaryMesh ? OUTPUT_TYPE::MESH_BINARY : OUTPUT_TYPE::MESH, meshOutFilename);
 
     /*--- Set the file names for the visualization files. ---*/
 
@@ -0,0 +1,122 @@
+#!/usr/bin/env python
+
+## \file run.py
+#  \brief Block-Jacobi CHT case, the zones solved concurrently must give the same history as
+#         the zones solved sequentially.
+#  \version 8.0.1 "Harrier"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+import os
+import subprocess
+import sys
+
+# Ranks of the runs, the zones get 2 and 1 ranks when solved concurrently.
+NRANKS = 3
+# Absolute tolerance on the (log) values of the histories, the linear systems are solved tightly.
+TOL = 1e-6
+
+
+def write_rectangle(filename, x0, x1, y0, y1, nx, ny, markers):
+  """ Structured quadrilateral mesh of a rectangle, markers maps names to lists of sides. """
+
+  def index(i, j):
+    return j * (nx + 1) + i
+
+  sides = {"bottom": [(index(i, 0), index(i + 1, 0)) for i in range(nx)],
+           "top": [(index(i + 1, ny), index(i, ny)) for i in range(nx)],
+           "left": [(index(0, j + 1), index(0, j)) for j in range(ny)],
+           "right": [(index(nx, j), index(nx, j + 1)) for j in range(ny)]}
+
+  with open(filename, "w") as mesh:
+    mesh.write("NDIME= 2\nNELEM= %d\n" % (nx * ny))
+    for j in range(ny):
+      for i in range(nx):
+        mesh.write("9 %d %d %d %d %d\n" % (index(i, j), index(i + 1, j), index(i + 1, j + 1), index(i, j + 1),
+                                           j * nx + i))
+    mesh.write("NPOIN= %d\n" % ((nx + 1) * (ny + 1)))
+    for j in range(ny + 1):
+      for i in range(nx + 1):
+        mesh.write("%.10f %.10f %d\n" % (x0 + (x1 - x0) * i / nx, y0 + (y1 - y0) * j / ny, index(i, j)))
+    mesh.write("NMARK= %d\n" % len(markers))
+    for name, names in markers:
+      edges = sum((sides[side] for side in names), [])
+      mesh.write("MARKER_TAG= %s\nMARKER_ELEMS= %d\n" % (name, len(edges)))
+      for a, b in edges:
+        mesh.write("3 %d %d\n" % (a, b))
+
+
+def read_history(filename):
+  with open(filename) as history:
+    lines = [line.strip() for line in history if line.strip()]
+  names = [name.strip().strip('"') for name in lines[0].split(",")]
+  rows = [[float(value) for value in line.split(",")] for line in lines[1:]]
+  return names, rows
+
+
+def run_su2(config, log):
+  launch = ["mpirun", "-n", str(NRANKS)]
+  if os.geteuid() == 0:
+    launch.append("--allow-run-as-root")
+  return subprocess.call(launch + ["SU2_CFD", config], stdout=log, stderr=subprocess.STDOUT)
+
+
+def main():
+  config = sys.argv[1] if len(sys.argv) > 1 else "cht_concurrent.cfg"
+
+  write_rectangle("mesh_channel.su2", 0.0, 2.0, 0.0, 0.5, 40, 16,
+                  [("fluid_interface", ["bottom"]), ("inlet", ["left"]), ("outlet", ["right"]), ("top", ["top"])])
+  write_rectangle("mesh_plate.su2", 0.0, 2.0, -0.3, 0.0, 20, 8,
+                  [("solid_interface", ["top"]), ("core", ["bottom"]), ("sides", ["left", "right"])])
+
+  # Same case (and number of iterations) with the zones solved in turn by all the ranks.
+  sequential = config.split(".")[0] + "_sequential.cfg"
+  with open(config) as original, open(sequential, "w") as copy:
+    for line in original:
+      if line.replace(" ", "").startswith("MULTIZONE_CONCURRENT_ZONES="):
+        line = "MULTIZONE_CONCURRENT_ZONES= NO\n"
+      copy.write(line)
+
+  with open(sequential.split(".")[0] + ".log", "w") as log:
+    if run_su2(sequential, log) != 0:
+      sys.exit("The sequential run failed.")
+
+  # The output of the concurrent run is the one checked by the regression script.
+  sys.stdout.flush()
+  if run_su2(config, sys.stdout) != 0:
+    sys.exit("The concurrent run failed.")
+
+  names, concurrent = read_history(config.split(".")[0] + ".csv")
+  names_seq, sequential = read_history(sequential.split(".")[0] + ".csv")
+
+  if names != names_seq or len(concurrent) != len(sequential):
+    sys.exit("The histories of the concurrent and sequential runs have different fields or lengths.")
+
+  for row, row_seq in zip(concurrent, sequential):
+    for name, value, value_seq in zip(names, row, row_seq):
+      if "Time" not in name and abs(value - value_seq) > TOL:
+        sys.exit("%s differs between the concurrent (%f) and sequential (%f) runs." % (name, value, value_seq))
+
+  print("The histories of the concurrent and sequential runs match.")
+
+
+if __name__ == '__main__':
+  main()
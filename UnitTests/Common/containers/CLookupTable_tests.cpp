@@ -130,3 +130,51 @@ TEST_CASE("LUTreader_3D", "[tabulated chemistry]") {
   look_up_table.LookUp_XYZ(look_up_tag, &look_up_dat, prog, enth, mfrac);
   CHECK(look_up_dat == Approx(1.1738796125));
 }
+
+TEST_CASE("LUTreader_batch", "[tabulated chemistry]") {
+  CLookUpTable look_up_table("src/SU2/UnitTests/Common/containers/lookuptable_3D.drg", "ProgressVariable",
+                             "EnthalpyTot");
+
+  /*--- resolve the columns once, "null" variables are set to zero ---*/
+
+  const auto idx_vars = look_up_table.GetIndexOfVars({"Density", "Viscosity", "NULL"});
+  CHECK(idx_vars[2] == CLookUpTable::NULL_VAR);
+
+  /*--- queries (prog, enth, mfrac) of the single point tests, the last one is outside of the table ---*/
+
+  const su2double queries[] = {0.55, -0.5, 0.5, 0.6, 0.9, 0.8, 1.10, 1.1, 2.0};
+  su2double look_up_dat[9];
+  unsigned short exit_codes[3];
+
+  const auto misses =
+      look_up_table.LookUp_Batch(idx_vars, 3, &queries[0], &queries[1], &queries[2], 3, look_up_dat, exit_codes);
+
+  CHECK(misses == 1);
+  CHECK(exit_codes[0] == 0);
+  CHECK(exit_codes[2] == 1);
+  CHECK(look_up_dat[0] == Approx(1.02));
+  CHECK(look_up_dat[4] == Approx(0.0000674286));
+  CHECK(look_up_dat[6] == Approx(1.1738796125));
+  CHECK(look_up_dat[8] == 0.0);
+}
+
+TEST_CASE("LUTreader_search_maps", "[tabulated chemistry]") {
+  /*--- both search structures locate the same triangles, including the points outside of the table ---*/
+
+  CLookUpTable trap_table("src/SU2/UnitTests/Common/containers/lookuptable_3D.drg", "ProgressVariable",
+                          "EnthalpyTot", LUT_SEARCH_MAP::TRAPEZOIDAL);
+  CLookUpTable grid_table("src/SU2/UnitTests/Common/containers/lookuptable_3D.drg", "ProgressVariable",
+                          "EnthalpyTot", LUT_SEARCH_MAP::UNIFORM_GRID);
+
+  const su2double queries[] = {0.55, -0.5, 0.5, 0.6, 0.9, 0.8, 1.10, 1.1, 2.0, 0.31, 0.27, 0.1};
+  const vector<string> names = {"Density", "Viscosity"};
+
+  for (int i = 0; i < 4; ++i) {
+    const su2double* q = &queries[3 * i];
+    vector<su2double> trap_dat(2), grid_dat(2);
+    const auto trap_code = trap_table.LookUp_XYZ(names, trap_dat, q[0], q[1], q[2]);
+    const auto grid_code = grid_table.LookUp_XYZ(names, grid_dat, q[0], q[1], q[2]);
+    CHECK(trap_code == grid_code);
+    for (int i_var = 0; i_var < 2; ++i_var) CHECK(trap_dat[i_var] == Approx(grid_dat[i_var]));
+  }
+}
@@ -27,6 +27,7 @@
 
 #include "catch.hpp"
 #include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/geometry/CGeometryCache.hpp"
 
 std::unique_ptr<UnitQuadTestCase> TestCase;
 
@@ -140,3 +141,80 @@ TEST_CASE("Set bound control volume", "[Geometry]") {
   CHECK(TestCase->geometry->vertex[3][2]->GetNormal()[1] == -0.0625);
   CHECK(TestCase->geometry->vertex[5][3]->GetNormal()[2] == 0.03125);
 }
+
+TEST_CASE("Geometry cache", "[Geometry]") {
+  auto makeCase = [](const std::string& options) {
+    auto testCase = std::unique_ptr<UnitQuadTestCase>(new UnitQuadTestCase());
+    testCase->AddOption("GEOMETRY_CACHE= YES\nGEOMETRY_CACHE_FILENAME= geometry_cache_test\n" + options);
+    testCase->InitConfig();
+    testCase->InitGeometry();
+    return testCase;
+  };
+
+  auto original = makeCase("");
+  const auto& coloring = original->geometry->GetEdgeColoring();
+  {
+    CGeometryCache cache(original->config.get());
+    cache.StorePartitioning(original->geometry.get());
+    cache.StoreEdgeColoring(MESH_0, original->geometry.get());
+    cache.StoreDualGrid(original->geometry.get(), original->config.get());
+    cache.Write();
+  }
+
+  /*--- Same options, the coloring must be reused as is. ---*/
+  auto reused = makeCase("");
+  {
+    CGeometryCache cache(reused->config.get());
+    CHECK(cache.LoadPartitioning(reused->geometry.get()));
+    REQUIRE(cache.LoadEdgeColoring(MESH_0, reused->geometry.get()));
+  }
+  const auto& loaded = reused->geometry->GetEdgeColoring();
+  REQUIRE(loaded.getOuterSize() == coloring.getOuterSize());
+  REQUIRE(loaded.getNumNonZeros() == coloring.getNumNonZeros());
+  for (auto i = 0ul; i < coloring.getNumNonZeros(); ++i) CHECK(loaded.innerIdx()[i] == coloring.innerIdx()[i]);
+  CHECK(reused->geometry->GetEdgeColorGroupSize() == original->geometry->GetEdgeColorGroupSize());
+
+  /*--- The dual grid metrics must be restored exactly. ---*/
+  const auto* geo = original->geometry.get();
+  auto* reusedGeo = reused->geometry.get();
+  const su2double zero[3] = {0.0};
+  for (auto iPoint = 0ul; iPoint < reusedGeo->GetnPoint(); ++iPoint) reusedGeo->nodes->SetVolume(iPoint, 0.0);
+  for (auto iEdge = 0ul; iEdge < reusedGeo->GetnEdge(); ++iEdge) reusedGeo->edges->SetNormal(iEdge, zero);
+  reused->config->SetDomainVolume(0.0);
+  {
+    CGeometryCache cache(reused->config.get());
+    REQUIRE(cache.LoadDualGrid(reusedGeo, reused->config.get()));
+  }
+  CHECK(reused->config->GetDomainVolume() == original->config->GetDomainVolume());
+  for (auto iPoint = 0ul; iPoint < geo->GetnPoint(); ++iPoint)
+    CHECK(reusedGeo->nodes->GetVolume(iPoint) == geo->nodes->GetVolume(iPoint));
+  for (auto iEdge = 0ul; iEdge < geo->GetnEdge(); ++iEdge)
+    for (auto iDim = 0u; iDim < geo->GetnDim(); ++iDim)
+      CHECK(reusedGeo->edges->GetNormal(iEdge)[iDim] == geo->edges->GetNormal(iEdge)[iDim]);
+  for (auto iMarker = 0u; iMarker < geo->GetnMarker(); ++iMarker)
+    for (auto iVertex = 0ul; iVertex < geo->GetnVertex(iMarker); ++iVertex)
+      for (auto iDim = 0u; iDim < geo->GetnDim(); ++iDim)
+        CHECK(reusedGeo->vertex[iMarker][iVertex]->GetNormal(iDim) == geo->vertex[iMarker][iVertex]->GetNormal(iDim));
+  for (auto iElem = 0ul; iElem < geo->GetnElem(); ++iElem)
+    for (auto iDim = 0u; iDim < geo->GetnDim(); ++iDim)
+      CHECK(reusedGeo->elem[iElem]->GetCG(iDim) == geo->elem[iElem]->GetCG(iDim));
+
+  /*--- Moving a point invalidates the dual grid, but not the rest. ---*/
+  reusedGeo->nodes->SetCoord(0, 0, reusedGeo->nodes->GetCoord(0, 0) + 1e-3);
+  {
+    CGeometryCache cache(reused->config.get());
+    CHECK_FALSE(cache.LoadDualGrid(reusedGeo, reused->config.get()));
+    CHECK(cache.LoadEdgeColoring(MESH_0, reusedGeo));
+  }
+
+  /*--- Different coloring options, the cache must be ignored. ---*/
+  auto changed = makeCase("EDGE_COLORING_GROUP_SIZE= 8\n");
+  {
+    CGeometryCache cache(changed->config.get());
+    CHECK_FALSE(cache.LoadPartitioning(changed->geometry.get()));
+    CHECK_FALSE(cache.LoadEdgeColoring(MESH_0, changed->geometry.get()));
+    CHECK_FALSE(cache.LoadDualGrid(changed->geometry.get(), changed->config.get()));
+  }
+
+  std::remove("geometry_cache_test_0.dat");
+}
@@ -0,0 +1,92 @@
+/*!
+ * \file CMultiGridGeometry_tests.cpp
+ * \brief Unit tests for the multigrid agglomeration.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/geometry/CMultiGridGeometry.hpp"
+
+namespace {
+
+struct AgglomerationStats {
+  unsigned long nFine = 0, nCoarse = 0, nSingle = 0;
+  vector<unsigned long> parents;
+};
+
+AgglomerationStats Agglomerate(const std::string& kind, int nThreads) {
+  UnitQuadTestCase testCase;
+  const std::string size = "MESH_BOX_SIZE=5,5,5";
+  testCase.config_options.replace(testCase.config_options.find(size), size.size(), "MESH_BOX_SIZE=13,13,13");
+  testCase.AddOption("MGLEVEL= 1\nMG_AGGLOMERATION= " + kind);
+  testCase.InitConfig();
+  testCase.InitGeometry();
+
+  const auto maxThreads = omp_get_max_threads();
+  omp_set_num_threads(nThreads);
+  cout.rdbuf(nullptr);
+  CMultiGridGeometry coarse(testCase.geometry.get(), testCase.config.get(), MESH_1);
+  cout.rdbuf(testCase.orig_buf);
+  omp_set_num_threads(maxThreads);
+
+  const auto* fine = testCase.geometry.get();
+  AgglomerationStats stats;
+  stats.nFine = fine->GetnPointDomain();
+  stats.nCoarse = coarse.GetnPointDomain();
+
+  /*--- Every fine point must be the child of its parent. ---*/
+  unsigned long nChildren = 0;
+  for (auto iCoarse = 0ul; iCoarse < stats.nCoarse; ++iCoarse) {
+    const auto n = coarse.nodes->GetnChildren_CV(iCoarse);
+    nChildren += n;
+    stats.nSingle += (n == 1);
+    for (auto iChild = 0u; iChild < n; ++iChild) {
+      CHECK(fine->nodes->GetParent_CV(coarse.nodes->GetChildren_CV(iCoarse, iChild)) == iCoarse);
+    }
+  }
+  CHECK(nChildren == stats.nFine);
+
+  for (auto iPoint = 0ul; iPoint < stats.nFine; ++iPoint) stats.parents.push_back(fine->nodes->GetParent_CV(iPoint));
+  return stats;
+}
+
+}  // namespace
+
+TEST_CASE("Parallel agglomeration", "[Geometry]") {
+  const auto queue = Agglomerate("QUEUE", 1);
+  const auto parallel = Agglomerate("PARALLEL", omp_get_max_threads());
+
+  /*--- The coarse grids should be of similar quality, the parallel algorithm is allowed
+   to produce slightly more coarse points. ---*/
+  const auto ratioQueue = double(queue.nFine) / queue.nCoarse;
+  const auto ratioParallel = double(parallel.nFine) / parallel.nCoarse;
+  INFO("Agglomeration ratio, queue: " << ratioQueue << ", parallel: " << ratioParallel);
+  INFO("Single child, queue: " << queue.nSingle << ", parallel: " << parallel.nSingle);
+  CHECK(ratioParallel > 0.75 * ratioQueue);
+  CHECK(parallel.nSingle <= queue.nSingle + parallel.nCoarse / 20);
+
+  /*--- The result must not depend on the number of threads. ---*/
+  const auto serial = Agglomerate("PARALLEL", 1);
+  CHECK(serial.parents == parallel.parents);
+}
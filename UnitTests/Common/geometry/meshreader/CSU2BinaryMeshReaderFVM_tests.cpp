@@ -0,0 +1,142 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM_tests.cpp
+ * \brief Round trip (write and read back) of the native SU2 binary mesh format.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include "../../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../../Common/include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+#include "../../../../SU2_CFD/include/output/filewriter/CFVMDataSorter.hpp"
+#include "../../../../SU2_CFD/include/output/filewriter/CSU2MeshFileWriter.hpp"
+
+namespace {
+
+const std::string baseOptions =
+    "SOLVER= EULER\n"
+    "MARKER_EULER= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+    "MESH_BOX_SIZE= 4, 3, 5\n"
+    "MESH_BOX_LENGTH= 1, 2, 3\n"
+    "MESH_BOX_OFFSET= 0, 0, 0\n";
+
+std::unique_ptr<CConfig> MakeConfig(const std::string& options, SU2_COMPONENT component) {
+  std::stringstream ss(baseOptions + options);
+  return std::unique_ptr<CConfig>(new CConfig(ss, component, false));
+}
+
+/*--- Sorted nodes of each element, the writer may change the order of the elements. ---*/
+std::vector<std::vector<unsigned long>> SortedElements(const CGeometry& geometry) {
+  std::vector<std::vector<unsigned long>> elems(geometry.GetnElem());
+  for (auto iElem = 0ul; iElem < geometry.GetnElem(); ++iElem) {
+    const auto* elem = geometry.elem[iElem];
+    elems[iElem].push_back(elem->GetVTK_Type());
+    for (auto iNode = 0u; iNode < elem->GetnNodes(); ++iNode) elems[iElem].push_back(elem->GetNode(iNode));
+    std::sort(elems[iElem].begin() + 1, elems[iElem].end());
+  }
+  std::sort(elems.begin(), elems.end());
+  return elems;
+}
+
+}  // namespace
+
+TEST_CASE("SU2 binary mesh round trip", "[Geometry]") {
+  const std::string filename = "binary_mesh_round_trip";
+
+  auto orig_buf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+
+  /*--- Box mesh, running as SU2_DEF also writes the boundary file that the mesh writer uses. ---*/
+  auto boxConfig = MakeConfig("MESH_FORMAT= BOX\n", SU2_COMPONENT::SU2_DEF);
+  CPhysicalGeometry box(boxConfig.get(), 0, 1);
+  {
+    CPhysicalGeometry partitioned(&box, boxConfig.get());
+    partitioned.SetSendReceive(boxConfig.get());
+    partitioned.SetBoundaries(boxConfig.get());
+
+    CFVMDataSorter sorter(boxConfig.get(), &partitioned, {"x", "y", "z"});
+    for (auto iPoint = 0ul; iPoint < partitioned.GetnPointDomain(); ++iPoint)
+      for (auto iDim = 0u; iDim < partitioned.GetnDim(); ++iDim)
+        sorter.SetUnsortedData(iPoint, iDim, partitioned.nodes->GetCoord(iPoint, iDim));
+    sorter.SortOutputData();
+    sorter.SortConnectivity(boxConfig.get(), &partitioned, true);
+
+    CSU2MeshFileWriter writer(&sorter, 0, 1, true);
+    writer.WriteData(filename);
+  }
+
+  auto binConfig = MakeConfig("MESH_FORMAT= SU2_BINARY\nMESH_FILENAME= " + filename + ".su2b\n",
+                              SU2_COMPONENT::SU2_CFD);
+  CPhysicalGeometry binary(binConfig.get(), 0, 1);
+
+  cout.rdbuf(orig_buf);
+
+  /*--- Points, bit-wise identical. ---*/
+  REQUIRE(binary.GetnDim() == box.GetnDim());
+  REQUIRE(binary.GetnPoint() == box.GetnPoint());
+
+  for (auto iPoint = 0ul; iPoint < box.GetnPoint(); ++iPoint)
+    for (auto iDim = 0u; iDim < box.GetnDim(); ++iDim)
+      CHECK(binary.nodes->GetCoord(iPoint, iDim) == box.nodes->GetCoord(iPoint, iDim));
+
+  /*--- Volume elements. ---*/
+  REQUIRE(binary.GetnElem() == box.GetnElem());
+  CHECK(SortedElements(binary) == SortedElements(box));
+
+  /*--- Markers, in the original order. ---*/
+  REQUIRE(binary.GetnMarker() == box.GetnMarker());
+
+  for (auto iMarker = 0u; iMarker < box.GetnMarker(); ++iMarker) {
+    CHECK(binConfig->GetMarker_All_TagBound(iMarker) == boxConfig->GetMarker_All_TagBound(iMarker));
+    REQUIRE(binary.GetnElem_Bound(iMarker) == box.GetnElem_Bound(iMarker));
+
+    for (auto iElem = 0ul; iElem < box.GetnElem_Bound(iMarker); ++iElem) {
+      const auto* ref = box.bound[iMarker][iElem];
+      const auto* elem = binary.bound[iMarker][iElem];
+      CHECK(elem->GetVTK_Type() == ref->GetVTK_Type());
+      for (auto iNode = 0u; iNode < ref->GetnNodes(); ++iNode) CHECK(elem->GetNode(iNode) == ref->GetNode(iNode));
+    }
+  }
+
+  /*--- The header is valid, and rejected if read with the other byte order. ---*/
+  using BinaryFormat = CSU2BinaryMeshReaderFVM;
+  std::array<uint64_t, BinaryFormat::HEADER_SIZE> header{};
+  {
+    std::ifstream file(filename + ".su2b", std::ios::binary);
+    file.read(reinterpret_cast<char*>(header.data()), header.size() * sizeof(uint64_t));
+    REQUIRE(file.good());
+  }
+  CHECK(BinaryFormat::CheckHeader(header).empty());
+
+  for (auto& field : header) {
+    auto* bytes = reinterpret_cast<unsigned char*>(&field);
+    std::reverse(bytes, bytes + sizeof(uint64_t));
+  }
+  CHECK(BinaryFormat::CheckHeader(header).find("byte order") != std::string::npos);
+
+  std::remove((filename + ".su2b").c_str());
+  std::remove("boundary.dat");
+}
@@ -0,0 +1,49 @@
+/*!
+ * \file CBezierBlending_tests.cpp
+ * \brief Unit tests for the Bezier blending functions of the FFD boxes.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include "../../../Common/include/grid_movement/CBezierBlending.hpp"
+#include "../../../Common/include/grid_movement/CFreeFormDefBox.hpp"
+
+TEST_CASE("Bezier blending of the largest FFD degree", "[FFD]") {
+  const short degree = CFreeFormDefBox::MAX_DEGREE;
+  CBezierBlending bezier(degree + 1, degree + 1);
+
+  /*--- Middle basis function, its binomial coefficient is close to the largest one. ---*/
+  const short i = degree / 2;
+  const passivedouble t = 0.5;
+  const passivedouble expected =
+      exp(lgamma(degree + 1.0) - lgamma(i + 1.0) - lgamma(degree - i + 1.0) - degree * log(2.0));
+  CHECK(SU2_TYPE::GetValue(bezier.GetBasis(i, t)) == Approx(expected).epsilon(1e-10));
+
+  /*--- Partition of unity. ---*/
+  for (const passivedouble s : {0.1, 0.37, 0.5, 0.93}) {
+    passivedouble sum = 0.0;
+    for (short j = 0; j <= degree; ++j) sum += SU2_TYPE::GetValue(bezier.GetBasis(j, s));
+    CHECK(sum == Approx(1.0).epsilon(1e-10));
+  }
+}
@@ -0,0 +1,131 @@
+/*!
+ * \file CRadialBasisFunction_tests.cpp
+ * \brief Unit tests for the radial basis function interpolation.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../Common/include/interface_interpolation/CRadialBasisFunction.hpp"
+#include "../../../Common/include/toolboxes/CPointBins.hpp"
+#include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+
+namespace {
+
+/*--- Curved surface interface, the target points are offset from the donor points. The whole interface
+ * can be translated by "shift". ---*/
+struct CInterface {
+  static constexpr int nSide = 16;
+  static constexpr passivedouble radius = 0.25;
+  su2activematrix donors, targets;
+  vector<const su2double*> targetCoords;
+
+  explicit CInterface(passivedouble shift = 0.0) : donors(nSide * nSide, 3), targets((nSide - 1) * (nSide - 1), 3) {
+    for (int i = 0; i < nSide; ++i) {
+      for (int j = 0; j < nSide; ++j) {
+        const passivedouble x = 0.1 * i, y = 0.1 * j;
+        donors(i * nSide + j, 0) = x + shift;
+        donors(i * nSide + j, 1) = y + shift;
+        donors(i * nSide + j, 2) = 0.1 * sin(2 * x) * cos(3 * y) + shift;
+      }
+    }
+    for (int i = 0; i < nSide - 1; ++i) {
+      for (int j = 0; j < nSide - 1; ++j) {
+        const passivedouble x = 0.1 * i + 0.037, y = 0.1 * j + 0.061;
+        targets(i * (nSide - 1) + j, 0) = x + shift;
+        targets(i * (nSide - 1) + j, 1) = y + shift;
+        targets(i * (nSide - 1) + j, 2) = 0.1 * sin(2 * x) * cos(3 * y) + shift;
+      }
+    }
+    for (auto i = 0ul; i < targets.rows(); ++i) targetCoords.push_back(targets[i]);
+  }
+
+  /*--- Dense interpolation matrix with the generator matrix. ---*/
+  su2passivematrix Dense() const {
+    int nPolynomial = 0;
+    vector<int> keepPolynomialRow(3, 1);
+    su2passivematrix C_inv_trunc, interp(targets.rows(), donors.rows());
+    CRadialBasisFunction::ComputeGeneratorMatrix(RADIAL_BASIS::WENDLAND_C2, false, radius, donors, nPolynomial,
+                                                 keepPolynomialRow, C_inv_trunc);
+    interp = 0.0;
+    for (auto i = 0ul; i < targets.rows(); ++i) {
+      for (auto k = 0ul; k < donors.rows(); ++k) {
+        const auto dist = GeometryToolbox::Distance(3, targets[i], donors[k]);
+        const auto rbf = SU2_TYPE::GetValue(
+            CRadialBasisFunction::Get_RadialBasisValue(RADIAL_BASIS::WENDLAND_C2, radius, dist));
+        for (auto j = 0ul; j < donors.rows(); ++j) interp(i, j) += rbf * C_inv_trunc(k, j);
+      }
+    }
+    return interp;
+  }
+
+  /*--- Sparse interpolation matrix, returns the number of points that did not converge. ---*/
+  unsigned long Sparse(passivedouble neighborhood, unsigned long iterLimit, su2passivematrix& interp,
+                       passivedouble& maxTruncation) const {
+    interp.resize(targets.rows(), donors.rows()) = 0.0;
+    unsigned long maxIterations = 0;
+    return CRadialBasisFunction::ComputeSparseCoefficients(
+        RADIAL_BASIS::WENDLAND_C2, radius, neighborhood, iterLimit, donors, targetCoords,
+        [&](unsigned long iTarget, const vector<unsigned long>& donorIdx, vector<passivedouble>& coeffs) {
+          for (auto k = 0ul; k < donorIdx.size(); ++k) interp(iTarget, donorIdx[k]) = coeffs[k];
+        },
+        maxIterations, maxTruncation);
+  }
+};
+
+}  // namespace
+
+TEST_CASE("Sparse RBF solver", "[Interpolation]") {
+  const CInterface interface;
+  const auto dense = interface.Dense();
+
+  /*--- With a neighbourhood that includes all the donors the coefficients match the dense ones. ---*/
+  su2passivematrix sparse;
+  passivedouble maxTruncation = 0.0;
+  REQUIRE(interface.Sparse(100, 1000, sparse, maxTruncation) == 0);
+  for (auto i = 0ul; i < dense.rows(); ++i)
+    for (auto j = 0ul; j < dense.cols(); ++j) REQUIRE(sparse(i, j) == Approx(dense(i, j)).margin(1e-8));
+
+  /*--- Local neighbourhoods truncate coefficients that are already small. ---*/
+  REQUIRE(interface.Sparse(5, 1000, sparse, maxTruncation) == 0);
+  CHECK(maxTruncation < 1e-4);
+  for (auto i = 0ul; i < dense.rows(); ++i)
+    for (auto j = 0ul; j < dense.cols(); ++j) REQUIRE(sparse(i, j) == Approx(dense(i, j)).margin(1e-5));
+
+  /*--- Non-convergence is reported for every target point. ---*/
+  CHECK(interface.Sparse(100, 1, sparse, maxTruncation) == interface.targets.rows());
+}
+
+TEST_CASE("Sparse RBF solver, offset interface", "[Interpolation]") {
+  /*--- All the coordinates are negative, the bins and the result must not depend on the translation. ---*/
+  const CInterface interface, shifted(-1000);
+  const CPointBins bins(interface.donors, CInterface::radius), binsShifted(shifted.donors, CInterface::radius);
+  for (int iDim = 0; iDim < 3; ++iDim) CHECK(abs(binsShifted.GetNumBins(iDim) - bins.GetNumBins(iDim)) <= 1);
+
+  su2passivematrix sparse, sparseShifted;
+  passivedouble maxTruncation = 0.0, maxTruncationShifted = 0.0;
+  REQUIRE(interface.Sparse(5, 1000, sparse, maxTruncation) == 0);
+  REQUIRE(shifted.Sparse(5, 1000, sparseShifted, maxTruncationShifted) == 0);
+  CHECK(maxTruncationShifted == Approx(maxTruncation).margin(1e-8));
+  for (auto i = 0ul; i < sparse.rows(); ++i)
+    for (auto j = 0ul; j < sparse.cols(); ++j) REQUIRE(sparseShifted(i, j) == Approx(sparse(i, j)).margin(1e-8));
+}
@@ -0,0 +1,178 @@
+/*!
+ * \file CPreconditioner_tests.cpp
+ * \brief Unit tests for the preconditioners of the linear solvers.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <functional>
+#include <sstream>
+#include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../../../Common/include/linear_algebra/CSysMatrix.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+
+namespace {
+
+/*--- Box mesh with the connectivity required by CSysMatrix. ---*/
+struct CBoxLinearSystem {
+  std::unique_ptr<CConfig> config;
+  std::unique_ptr<CGeometry> geometry;
+  CSysMatrix<su2mixedfloat> matrix;
+
+  explicit CBoxLinearSystem(const std::string& options) {
+    std::stringstream ss(
+        "SOLVER= EULER\n"
+        "MESH_FORMAT= BOX\n"
+        "MESH_BOX_SIZE= 12, 12, 12\n"
+        "MESH_BOX_LENGTH= 1, 1, 1\n"
+        "MESH_BOX_OFFSET= 0, 0, 0\n"
+        "MARKER_EULER= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+        "LINEAR_SOLVER_ERROR= 1e-8\n"
+        "LINEAR_SOLVER_ITER= 200\n" +
+        options);
+
+    auto orig_buf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+    config = std::unique_ptr<CConfig>(new CConfig(ss, SU2_COMPONENT::SU2_CFD, false));
+    {
+      auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config.get(), 0, 1));
+      geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), config.get()));
+    }
+    geometry->SetSendReceive(config.get());
+    geometry->SetBoundaries(config.get());
+    geometry->SetPoint_Connectivity();
+    geometry->SetEdges();
+    geometry->PreprocessP2PComms(geometry.get(), config.get());
+    cout.rdbuf(orig_buf);
+
+    /*--- Coupled 2 variable diffusion-like operator, non-symmetric off-diagonal blocks. ---*/
+    const auto nPoint = geometry->GetnPoint();
+    matrix.Initialize(nPoint, geometry->GetnPointDomain(), 2, 2, true, geometry.get(), config.get());
+
+    for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); ++iEdge) {
+      const su2double bi[2][2] = {{1.0, 0.0}, {0.0, 1.0}}, bj[2][2] = {{-1.0, -0.2}, {0.1, -1.0}};
+      matrix.UpdateBlocks(iEdge, geometry->edges->GetNode(iEdge, 0), geometry->edges->GetNode(iEdge, 1), bi, bj);
+    }
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      matrix.AddVal2Diag(iPoint, geometry->nodes->GetPhysicalBoundary(iPoint) ? 1.0 : 1e-3);
+    }
+  }
+
+  /*--- Solve and return the number of iterations and the true relative residual. ---*/
+  std::pair<unsigned long, passivedouble> Solve() {
+    const auto nPoint = geometry->GetnPoint();
+    const auto nPointDomain = geometry->GetnPointDomain();
+    CSysVector<su2double> rhs(nPoint, nPointDomain, 2, 0.0), sol(nPoint, nPointDomain, 2, 0.0);
+    for (auto i = 0ul; i < rhs.GetLocSize(); ++i) rhs[i] = sin(0.37 * i);
+
+    CSysSolve<su2mixedfloat> solver;
+    const auto iter = solver.Solve(matrix, rhs, sol, geometry.get(), config.get());
+
+    CSysVector<su2mixedfloat> x(nPoint, nPointDomain, 2, 0.0), Ax(nPoint, nPointDomain, 2, 0.0);
+    for (auto i = 0ul; i < x.GetLocSize(); ++i) x[i] = SU2_TYPE::GetValue(sol[i]);
+    matrix.MatrixVectorProduct(x, Ax, geometry.get(), config.get());
+
+    passivedouble res = 0.0, norm = 0.0;
+    for (auto i = 0ul; i < rhs.GetNElmDomain(); ++i) {
+      res += pow(Ax[i] - SU2_TYPE::GetValue(rhs[i]), 2);
+      norm += pow(SU2_TYPE::GetValue(rhs[i]), 2);
+    }
+    return std::make_pair(iter, sqrt(res / norm));
+  }
+};
+
+}  // namespace
+
+TEST_CASE("AMG preconditioner", "[LinearAlgebra]") {
+  CBoxLinearSystem jacobi("LINEAR_SOLVER_PREC= JACOBI"), amg("LINEAR_SOLVER_PREC= AMG");
+
+  const auto resJacobi = jacobi.Solve();
+  const auto resAMG = amg.Solve();
+
+  CHECK(resAMG.second < 1e-6);
+  CHECK(resAMG.first < resJacobi.first / 2);
+}
+
+TEST_CASE("Level-scheduled ILU", "[LinearAlgebra]") {
+  /*--- The level-scheduled factorization keeps all couplings, it must match the single partition ILU. ---*/
+  CBoxLinearSystem serial("LINEAR_SOLVER_PREC= ILU\nLINEAR_SOLVER_PREC_THREADS= 1\n");
+  CBoxLinearSystem partitioned("LINEAR_SOLVER_PREC= ILU\nLINEAR_SOLVER_PREC_THREADS= 8\n");
+  CBoxLinearSystem scheduled(
+      "LINEAR_SOLVER_PREC= ILU\nLINEAR_SOLVER_PREC_THREADS= 8\nLINEAR_SOLVER_ILU_LEVEL_SCHEDULING= YES\n");
+
+  const auto resSerial = serial.Solve();
+  const auto resPartitioned = partitioned.Solve();
+  const auto resScheduled = scheduled.Solve();
+
+  CHECK(resScheduled.second < 1e-6);
+  CHECK(resScheduled.first == resSerial.first);
+  CHECK(resScheduled.first <= resPartitioned.first);
+}
+
+TEST_CASE("SELL-C-sigma matrix-vector product", "[LinearAlgebra]") {
+  CBoxLinearSystem csr("LINEAR_SOLVER_PREC= JACOBI\nLINEAR_SOLVER_SPMV_FORMAT= CSR\n");
+  CBoxLinearSystem sell("LINEAR_SOLVER_PREC= JACOBI\nLINEAR_SOLVER_SPMV_FORMAT= SELL\n");
+
+  const auto nPoint = csr.geometry->GetnPoint();
+  const auto nPointDomain = csr.geometry->GetnPointDomain();
+  CSysVector<su2mixedfloat> x(nPoint, nPointDomain, 2, 0.0), y_csr(x), y_sell(x);
+  for (auto i = 0ul; i < x.GetLocSize(); ++i) x[i] = cos(0.11 * i);
+
+  csr.matrix.MatrixVectorProduct(x, y_csr, csr.geometry.get(), csr.config.get());
+  sell.matrix.MatrixVectorProduct(x, y_sell, sell.geometry.get(), sell.config.get());
+
+  for (auto i = 0ul; i < y_csr.GetNElmDomain(); ++i) REQUIRE(y_sell[i] == Approx(y_csr[i]));
+
+  /*--- The SELL copy is refreshed automatically when the values change. ---*/
+  const su2mixedfloat block[] = {1.0, 0.5, 0.25, 2.0};
+  auto modifyAndCompare = [&](const std::function<void(CSysMatrix<su2mixedfloat>&)>& modify) {
+    modify(csr.matrix);
+    modify(sell.matrix);
+    csr.matrix.MatrixVectorProduct(x, y_csr, csr.geometry.get(), csr.config.get());
+    sell.matrix.MatrixVectorProduct(x, y_sell, sell.geometry.get(), sell.config.get());
+    for (auto i = 0ul; i < y_csr.GetNElmDomain(); ++i) REQUIRE(y_sell[i] == Approx(y_csr[i]));
+  };
+  modifyAndCompare([](CSysMatrix<su2mixedfloat>& matrix) { matrix.AddVal2Diag(0, 1.0); });
+  modifyAndCompare([&](CSysMatrix<su2mixedfloat>& matrix) { matrix.AddBlock(1, 1, block); });
+  modifyAndCompare([&](CSysMatrix<su2mixedfloat>& matrix) {
+    auto* block_22 = matrix.GetBlock(2, 2);
+    for (auto i = 0; i < 4; ++i) block_22[i] += block[i];
+    matrix.SetSELLDirty();
+  });
+
+  CHECK(sell.Solve().first == csr.Solve().first);
+}
+
+TEST_CASE("Pipelined Krylov solvers", "[LinearAlgebra]") {
+  /*--- In exact arithmetic the pipelined variants produce the same iterates as the standard methods. ---*/
+  for (const std::string solver : {"FGMRES", "BCGSTAB"}) {
+    CBoxLinearSystem standard("LINEAR_SOLVER_PREC= ILU\nLINEAR_SOLVER= " + solver + "\n");
+    CBoxLinearSystem pipelined("LINEAR_SOLVER_PREC= ILU\nLINEAR_SOLVER= PIPELINED_" + solver + "\n");
+
+    const auto resStandard = standard.Solve();
+    const auto resPipelined = pipelined.Solve();
+
+    CHECK(resPipelined.second < 1e-6);
+    CHECK(resPipelined.first <= resStandard.first + 1);
+  }
+}
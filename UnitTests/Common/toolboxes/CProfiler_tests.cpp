@@ -0,0 +1,65 @@
+/*!
+ * \file CProfiler_tests.cpp
+ * \brief Unit tests for the hierarchical profiler.
+ * \author P. Gomes
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
+
+TEST_CASE("Profiler nesting and aggregation", "[Toolboxes]") {
+  /*--- Disabled scopes are not recorded. ---*/
+  { SU2_PROFILE_SCOPE("Ignored"); }
+
+  CProfiler::Initialize(false, false);
+  CHECK(CProfiler::IsEnabled());
+
+  for (int i = 0; i < 3; ++i) {
+    SU2_PROFILE_SCOPE("Outer");
+    for (int j = 0; j < 2; ++j) {
+      SU2_PROFILE_SCOPE("Inner");
+    }
+  }
+  { SU2_PROFILE_SCOPE("Inner"); }
+
+  CProfiler::Finalize("profiler_test");
+  CHECK_FALSE(CProfiler::IsEnabled());
+
+  std::vector<std::string> lines;
+  {
+    std::ifstream file("profiler_test.csv");
+    for (std::string line; std::getline(file, line);) lines.push_back(line);
+  }
+  std::remove("profiler_test.csv");
+
+  /*--- Header, total, and the regions in order of first appearance. ---*/
+  REQUIRE(lines.size() == 5);
+  CHECK(lines[2].find("\"Outer\", 1, 3,") == 0);
+  CHECK(lines[3].find("\"Outer/Inner\", 2, 6,") == 0);
+  CHECK(lines[4].find("\"Inner\", 1, 1,") == 0);
+}
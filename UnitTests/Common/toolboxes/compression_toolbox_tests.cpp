@@ -0,0 +1,70 @@
+/*!
+ * \file compression_toolbox_tests.cpp
+ * \brief Unit tests for the lossless compression of output arrays.
+ * \author P. Gomes
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <cstring>
+#include <random>
+#include "../../../Common/include/toolboxes/compression_toolbox.hpp"
+
+TEST_CASE("Lossless compression", "[Toolboxes]") {
+  const size_t nRows = 5000, nCols = 7;
+
+  /*--- Smooth fields, a constant one, and noise. ---*/
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> data(nRows * nCols);
+  for (size_t i = 0; i < nRows; ++i) {
+    for (size_t j = 0; j < 5; ++j) data[i * nCols + j] = std::sin(0.001 * i * (j + 1)) + j;
+    data[i * nCols + 5] = 101325.0;
+    data[i * nCols + 6] = dist(gen);
+  }
+
+  std::vector<char> compressed;
+  CompressionToolbox::Compress(data.data(), nRows, nCols, sizeof(double), compressed);
+  CHECK(compressed.size() < data.size() * sizeof(double));
+
+  std::vector<double> result(nRows * nCols);
+  REQUIRE(CompressionToolbox::Decompress(compressed.data(), compressed.size(), nRows, nCols, sizeof(double),
+                                         result.data()));
+  CHECK(memcmp(data.data(), result.data(), data.size() * sizeof(double)) == 0);
+
+  /*--- Corrupted or mismatched streams are detected. ---*/
+  CHECK_FALSE(CompressionToolbox::Decompress(compressed.data(), compressed.size() / 2, nRows, nCols,
+                                             sizeof(double), result.data()));
+  CHECK_FALSE(CompressionToolbox::Decompress(compressed.data(), compressed.size(), nRows - 1, nCols,
+                                             sizeof(double), result.data()));
+
+  /*--- Degenerate sizes. ---*/
+  for (size_t n : {0, 1, 3}) {
+    std::vector<char> block;
+    CompressionToolbox::Compress(data.data(), n, 1, sizeof(double), block);
+    std::vector<double> small(n);
+    REQUIRE(CompressionToolbox::Decompress(block.data(), block.size(), n, 1, sizeof(double), small.data()));
+    for (size_t i = 0; i < n; ++i) CHECK(small[i] == data[i]);
+  }
+}
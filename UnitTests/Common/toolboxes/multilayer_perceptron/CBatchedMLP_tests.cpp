@@ -0,0 +1,70 @@
+/*!
+ * \file CBatchedMLP_tests.cpp
+ * \brief Unit tests for the batched evaluation of multi-layer perceptrons.
+ * \author E.C.Bunschoten
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <string>
+#include <vector>
+#include "../../../../Common/include/toolboxes/CBatchedMLP.hpp"
+
+#if defined(HAVE_MLPCPP)
+TEST_CASE("Batched MLP test", "[LookUpANN]") {
+  std::string MLP_input_files[] = {"src/SU2/UnitTests/Common/toolboxes/multilayer_perceptron/simple_mlp.mlp"};
+  CBatchedMLP MLP(1, MLP_input_files);
+
+  /*--- Inputs in the opposite order of the file, the pairing must map them. ---*/
+  MLP.PairVariables({"y", "x"}, {"z"});
+  CHECK(MLP.GetInputNorm(1).first == Approx(0.0));
+  CHECK(MLP.GetInputNorm(1).second == Approx(2.0));
+
+  /*--- Same points as the MLPCpp test, in the middle and outside of the training data range. ---*/
+  const unsigned long n_points = 2;
+  const su2double x[] = {1.0, 3.0}, y[] = {-0.5, -10.0};
+  su2double z[n_points];
+  unsigned short exit_codes[n_points];
+
+  CHECK(MLP.Predict(n_points, {y, x}, z, exit_codes) == 1);
+  CHECK(z[0] == Approx(0.344829));
+  CHECK(z[1] == Approx(0.012737));
+  CHECK(exit_codes[0] == 0);
+  CHECK(exit_codes[1] == 1);
+
+  /*--- Several blocks, each point matches its evaluation on its own. ---*/
+  const unsigned long n_batch = 3 * CBatchedMLP::BLOCK_SIZE + 5;
+  std::vector<su2double> x_batch(n_batch), y_batch(n_batch), z_batch(n_batch);
+  for (auto i = 0ul; i < n_batch; i++) {
+    x_batch[i] = 2.0 * i / n_batch;
+    y_batch[i] = -1.0 + 1.0 * (i % 7) / 7;
+  }
+  CHECK(MLP.Predict(n_batch, {y_batch.data(), x_batch.data()}, z_batch.data()) == 0);
+
+  for (auto i = 0ul; i < n_batch; i += 37) {
+    su2double z_point;
+    MLP.Predict(1, {&y_batch[i], &x_batch[i]}, &z_point);
+    CHECK(z_batch[i] == Approx(z_point));
+  }
+}
+#endif
@@ -0,0 +1,112 @@
+/*!
+ * \file CAsyncFileWriter_tests.cpp
+ * \brief Unit tests for the output of files in the background.
+ * \author P. Gomes
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include "../UnitQuadTestCase.hpp"
+#include "../../SU2_CFD/include/output/filewriter/CAsyncFileWriter.hpp"
+#include "../../SU2_CFD/include/output/filewriter/CFVMDataSorter.hpp"
+#include "../../SU2_CFD/include/output/filewriter/CSU2BinaryFileWriter.hpp"
+
+namespace {
+
+void LoadData(const CGeometry* geometry, passivedouble scale, CParallelDataSorter& sorter) {
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+    for (auto iDim = 0u; iDim < 3; ++iDim) {
+      sorter.SetUnsortedData(iPoint, iDim, geometry->nodes->GetCoord(iPoint, iDim));
+    }
+    sorter.SetUnsortedData(iPoint, 3, scale * geometry->nodes->GetGlobalIndex(iPoint));
+  }
+  sorter.SortOutputData();
+}
+
+std::string ReadFile(const std::string& fileName) {
+  std::ifstream file(fileName, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+}  // namespace
+
+TEST_CASE("Asynchronous output matches the synchronous output", "[Output]") {
+  if (!CAsyncFileWriter::Supported()) {
+    WARN("The MPI library does not provide MPI_THREAD_MULTIPLE, the asynchronous output is not tested.");
+    return;
+  }
+
+  UnitQuadTestCase testCase;
+  testCase.InitConfig();
+  testCase.InitGeometry();
+  const auto* geometry = testCase.geometry.get();
+
+  CFVMDataSorter sorter(testCase.config.get(), testCase.geometry.get(), {"x", "y", "z", "f"});
+
+  /*--- Reference files written synchronously. ---*/
+  LoadData(geometry, 1.0, sorter);
+  CSU2BinaryFileWriter(&sorter).WriteData("async_test_sync_1");
+  LoadData(geometry, 2.0, sorter);
+  CSU2BinaryFileWriter(&sorter).WriteData("async_test_sync_2");
+
+  {
+    CAsyncFileWriter async;
+
+    /*--- The data is copied on submission, the sorter can be modified while the files are written. ---*/
+    LoadData(geometry, 1.0, sorter);
+    async.Submit(new CSU2BinaryFileWriter(&sorter), OUTPUT_TYPE::RESTART_BINARY, {"async_test_1a", "async_test_1b"});
+    LoadData(geometry, 2.0, sorter);
+    async.Submit(new CSU2BinaryFileWriter(&sorter), OUTPUT_TYPE::RESTART_BINARY, {"async_test_2"});
+    LoadData(geometry, 3.0, sorter);
+
+    const auto reports = async.TakeReports(true);
+    REQUIRE(reports.size() == 2);
+    CHECK(reports[0].fileNames.size() == 2);
+    CHECK(reports[1].fileNames[0] == "async_test_2.dat");
+
+    /*--- Submitted without waiting, the destructor writes the pending files. ---*/
+    LoadData(geometry, 2.0, sorter);
+    async.Submit(new CSU2BinaryFileWriter(&sorter), OUTPUT_TYPE::RESTART_BINARY, {"async_test_3"});
+  }
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+
+  const auto reference1 = ReadFile("async_test_sync_1.dat");
+  const auto reference2 = ReadFile("async_test_sync_2.dat");
+  REQUIRE(!reference1.empty());
+  CHECK(reference1 != reference2);
+  CHECK(ReadFile("async_test_1a.dat") == reference1);
+  CHECK(ReadFile("async_test_1b.dat") == reference1);
+  CHECK(ReadFile("async_test_2.dat") == reference2);
+  CHECK(ReadFile("async_test_3.dat") == reference2);
+
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    for (const auto* name : {"sync_1", "sync_2", "1a", "1b", "2", "3"}) {
+      std::remove(("async_test_" + std::string(name) + ".dat").c_str());
+    }
+  }
+}
@@ -0,0 +1,132 @@
+/*!
+ * \file CRestartCheckpoints_tests.cpp
+ * \brief Unit tests for the in-memory and node-local store of restart data.
+ * \author P. Gomes
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include "../UnitQuadTestCase.hpp"
+#include "../../SU2_CFD/include/solvers/CRestartCheckpoints.hpp"
+
+namespace {
+
+const std::string restartName = "restart_checkpoints_test.dat";
+
+void WriteRestart(const std::string& content) {
+  std::ofstream file(restartName, std::ios::trunc);
+  file << content;
+}
+
+CRestartCheckpoints::CState MakeState(const CGeometry* geometry) {
+  CRestartCheckpoints::CState state;
+  state.vars = {5, int(geometry->GetGlobal_nPointDomain())};
+  state.fields = {"\"PointID\"", "\"x\"", "\"y\"", "\"z\"", "\"Density\""};
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+    state.data.push_back(geometry->nodes->GetGlobalIndex(iPoint));
+    for (auto iDim = 0u; iDim < 3; ++iDim) {
+      state.data.push_back(SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim)));
+    }
+    state.data.push_back(1.0 + 0.5 * iPoint);
+  }
+  return state;
+}
+
+bool SameState(const CRestartCheckpoints::CState& a, const CRestartCheckpoints::CState& b) {
+  return a.vars == b.vars && a.fields == b.fields && a.data == b.data;
+}
+
+}  // namespace
+
+TEST_CASE("Restart checkpoints in memory", "[Restart]") {
+  UnitQuadTestCase testCase;
+  testCase.AddOption("RESTART_CHECKPOINTS_RAM= 1");
+  testCase.InitConfig();
+  testCase.InitGeometry();
+  const auto* config = testCase.config.get();
+  const auto* geometry = testCase.geometry.get();
+
+  CRestartCheckpoints::Clear();
+  WriteRestart("first version of the restart file\n");
+  const auto stored = MakeState(geometry);
+  CRestartCheckpoints::CState loaded;
+
+  /*--- Nothing stored yet. ---*/
+  CHECK_FALSE(CRestartCheckpoints::Load(config, geometry, restartName, loaded));
+
+  CRestartCheckpoints::Store(config, geometry, restartName, stored);
+  REQUIRE(CRestartCheckpoints::Load(config, geometry, restartName, loaded));
+  CHECK(SameState(stored, loaded));
+
+  /*--- Other files do not match, and missing files are never loaded. ---*/
+  CHECK_FALSE(CRestartCheckpoints::Load(config, geometry, "missing_" + restartName, loaded));
+
+  /*--- Writing the file from this program invalidates the data. ---*/
+  CRestartCheckpoints::Invalidate(restartName);
+  CHECK_FALSE(CRestartCheckpoints::Load(config, geometry, restartName, loaded));
+
+  CRestartCheckpoints::Store(config, geometry, restartName, stored);
+  CHECK(CRestartCheckpoints::Load(config, geometry, restartName, loaded));
+
+  /*--- So does modifying it externally (the size changes). ---*/
+  WriteRestart("second, longer, version of the restart file\n");
+  CHECK_FALSE(CRestartCheckpoints::Load(config, geometry, restartName, loaded));
+
+  CRestartCheckpoints::Store(config, geometry, restartName, stored);
+  CHECK(CRestartCheckpoints::Load(config, geometry, restartName, loaded));
+
+  CRestartCheckpoints::Clear();
+  CHECK_FALSE(CRestartCheckpoints::Load(config, geometry, restartName, loaded));
+
+  std::remove(restartName.c_str());
+}
+
+TEST_CASE("Restart checkpoints in a local directory", "[Restart]") {
+  UnitQuadTestCase testCase;
+  testCase.AddOption("RESTART_CHECKPOINTS_DIR= .");
+  testCase.InitConfig();
+  testCase.InitGeometry();
+  const auto* config = testCase.config.get();
+  const auto* geometry = testCase.geometry.get();
+
+  CRestartCheckpoints::Clear();
+  WriteRestart("restart file for the local checkpoints\n");
+  const auto stored = MakeState(geometry);
+  CRestartCheckpoints::CState loaded;
+
+  /*--- Without memory budget the data only goes to the local copy, which survives Clear. ---*/
+  CRestartCheckpoints::Store(config, geometry, restartName, stored);
+  CRestartCheckpoints::Clear();
+  REQUIRE(CRestartCheckpoints::Load(config, geometry, restartName, loaded));
+  CHECK(SameState(stored, loaded));
+
+  /*--- The local copy is also tied to the version of the restart file. ---*/
+  WriteRestart("restart file for the local checkpoints, modified\n");
+  CHECK_FALSE(CRestartCheckpoints::Load(config, geometry, restartName, loaded));
+
+  std::remove(restartName.c_str());
+  std::remove(("./" + restartName + "_rank" + std::to_string(SU2_MPI::GetRank()) + ".chk").c_str());
+}
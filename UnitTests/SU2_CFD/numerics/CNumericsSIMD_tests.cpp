@@ -0,0 +1,226 @@
+/*!
+ * \file CNumericsSIMD_tests.cpp
+ * \brief Unit tests comparing the vectorized numerics with the edge-by-edge (CNumerics) implementations.
+ * \author P. Gomes
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../SU2_CFD/include/numerics_simd/CNumericsSIMD.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/ausm_slau.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/hllc.hpp"
+
+namespace {
+
+/*--- Small box with random states, the boundaries do not matter since only the edge fluxes are compared. ---*/
+const std::string boxOptions =
+    "MESH_FORMAT= BOX\n"
+    "MESH_BOX_SIZE= 5,5,5\n"
+    "MESH_BOX_LENGTH= 1,1,1\n"
+    "MESH_BOX_OFFSET= 0,0,0\n"
+    "MACH_NUMBER= 0.8\n"
+    "FREESTREAM_PRESSURE= 101325.0\n"
+    "FREESTREAM_TEMPERATURE= 288.15\n"
+    "MARKER_EULER= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+    "MUSCL_FLOW= NO\n"
+    "TIME_DISCRE_FLOW= EULER_IMPLICIT\n"
+    "REF_ORIGIN_MOMENT_X= 0.0\n"
+    "REF_ORIGIN_MOMENT_Y= 0.0\n"
+    "REF_ORIGIN_MOMENT_Z= 0.0\n";
+
+/*!
+ * \brief Test case with random subsonic and supersonic flow states at the points.
+ */
+struct RandomFlowCase : UnitQuadTestCase {
+  explicit RandomFlowCase(const std::string& options) {
+    config_options = boxOptions + options;
+    InitConfig();
+    InitGeometry();
+    InitSolver();
+    config->SetGlobalParam(config->GetKind_Solver(), RUNTIME_FLOW_SYS);
+
+    auto* flow = solver[FLOW_SOL];
+    auto* nodes = flow->GetNodes();
+    const auto nDim = geometry->GetnDim();
+    const su2double gamma = config->GetGamma();
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<passivedouble> dist(-1.0, 1.0);
+
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+      const su2double density = 1.2 * (1.0 + 0.3 * dist(gen));
+      const su2double pressure = 101325.0 * (1.0 + 0.3 * dist(gen));
+      const su2double soundSpeed = sqrt(gamma * pressure / density);
+
+      su2double U[5] = {density}, sqVel = 0.0;
+      for (auto iDim = 0u; iDim < nDim; ++iDim) {
+        const su2double velocity = 1.5 * soundSpeed * dist(gen);
+        U[iDim + 1] = density * velocity;
+        sqVel += velocity * velocity;
+      }
+      U[nDim + 1] = pressure / (gamma - 1) + 0.5 * density * sqVel;
+
+      nodes->SetSolution(iPoint, U);
+      nodes->SetPrimVar(iPoint, flow->GetFluidModel());
+    }
+  }
+};
+
+/*!
+ * \brief Assemble the edge fluxes (into the residual) and their Jacobians (into the matrix) of all edges.
+ */
+template <class Vector, class Matrix>
+void AssembleSIMD(const UnitQuadTestCase& test, const CNumericsSIMD& numerics, const CVariable& nodes,
+                  Vector& residual, Matrix& jacobian) {
+  const auto nEdge = test.geometry->GetnEdge();
+  for (auto iEdge = 0ul; iEdge < nEdge; iEdge += Double::Size) {
+    Int edges;
+    Double mask;
+    for (auto k = 0ul; k < Double::Size; ++k) {
+      const bool in = (iEdge + k < nEdge);
+      mask[k] = in;
+      edges[k] = in ? iEdge + k : iEdge;
+    }
+    numerics.ComputeFlux(edges, *test.config, *test.geometry, nodes, UpdateType::COLORING, mask, residual, jacobian);
+  }
+}
+
+/*!
+ * \brief Compare two assembled systems, relative to the largest entry of the residual and of the matrix.
+ */
+template <class Vector, class Matrix>
+void CompareSystems(const CGeometry& geometry, unsigned short nVar, const Vector& res1, const Matrix& jac1,
+                    const Vector& res2, const Matrix& jac2) {
+  passivedouble resScale = 0.0, jacScale = 0.0;
+  for (auto i = 0ul; i < res1.GetLocSize(); ++i) resScale = std::max(resScale, fabs(SU2_TYPE::GetValue(res1[i])));
+
+  auto blocks = [&](unsigned long iEdge) {
+    const auto iPoint = geometry.edges->GetNode(iEdge, 0), jPoint = geometry.edges->GetNode(iEdge, 1);
+    return std::vector<std::pair<unsigned long, unsigned long>>{
+        {iPoint, iPoint}, {iPoint, jPoint}, {jPoint, iPoint}, {jPoint, jPoint}};
+  };
+  for (auto iEdge = 0ul; iEdge < geometry.GetnEdge(); ++iEdge) {
+    for (const auto& ij : blocks(iEdge)) {
+      for (auto k = 0u; k < nVar * nVar; ++k) {
+        jacScale = std::max(jacScale, fabs(SU2_TYPE::GetValue(jac1.GetBlock(ij.first, ij.second)[k])));
+      }
+    }
+  }
+  REQUIRE(resScale > 0.0);
+  REQUIRE(jacScale > 0.0);
+
+  for (auto i = 0ul; i < res1.GetLocSize(); ++i) {
+    CHECK(SU2_TYPE::GetValue(res2[i]) == Approx(SU2_TYPE::GetValue(res1[i])).margin(1e-10 * resScale));
+  }
+  for (auto iEdge = 0ul; iEdge < geometry.GetnEdge(); ++iEdge) {
+    for (const auto& ij : blocks(iEdge)) {
+      const auto* block1 = jac1.GetBlock(ij.first, ij.second);
+      const auto* block2 = jac2.GetBlock(ij.first, ij.second);
+      for (auto k = 0u; k < nVar * nVar; ++k) {
+        CHECK(SU2_TYPE::GetValue(block2[k]) == Approx(SU2_TYPE::GetValue(block1[k])).margin(1e-10 * jacScale));
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Compare a vectorized upwind scheme with its edge-by-edge implementation.
+ */
+void CompareUpwindFlow(const std::string& options) {
+  RandomFlowCase test(options);
+  auto* config = test.config.get();
+  auto* geometry = test.geometry.get();
+  auto* flow = test.solver[FLOW_SOL];
+  auto* nodes = flow->GetNodes();
+  const auto nDim = geometry->GetnDim();
+  const auto nVar = flow->GetnVar();
+  const auto nPoint = geometry->GetnPoint(), nPointDomain = geometry->GetnPointDomain();
+
+  std::unique_ptr<CNumerics> scalar;
+  switch (config->GetKind_Upwind_Flow()) {
+    case UPWIND::HLLC:
+      scalar.reset(new CUpwHLLC_Flow(nDim, nVar, config));
+      break;
+    case UPWIND::AUSMPLUSUP:
+      scalar.reset(new CUpwAUSMPLUSUP_Flow(nDim, nVar, config));
+      break;
+    case UPWIND::AUSMPLUSUP2:
+      scalar.reset(new CUpwAUSMPLUSUP2_Flow(nDim, nVar, config));
+      break;
+    case UPWIND::SLAU:
+      scalar.reset(new CUpwSLAU_Flow(nDim, nVar, config, false));
+      break;
+    case UPWIND::SLAU2:
+      scalar.reset(new CUpwSLAU2_Flow(nDim, nVar, config, false));
+      break;
+    default:
+      FAIL("Scheme not covered by the test.");
+  }
+  std::unique_ptr<CNumericsSIMD> simd(CNumericsSIMD::CreateNumerics(*config, nDim, MESH_0));
+  REQUIRE(simd != nullptr);
+
+  CSysVector<su2double> res1(nPoint, nPointDomain, nVar, nullptr), res2(nPoint, nPointDomain, nVar, nullptr);
+  SparseMatrixType jac1, jac2;
+  jac1.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+  jac2.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+  res1 = su2double(0.0);
+  res2 = su2double(0.0);
+  jac1.SetValZero();
+  jac2.SetValZero();
+
+  for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); ++iEdge) {
+    const auto iPoint = geometry->edges->GetNode(iEdge, 0), jPoint = geometry->edges->GetNode(iEdge, 1);
+    scalar->SetNormal(geometry->edges->GetNormal(iEdge));
+    scalar->SetPrimitive(nodes->GetPrimitive(iPoint), nodes->GetPrimitive(jPoint));
+    scalar->SetSecondary(nodes->GetSecondary(iPoint), nodes->GetSecondary(jPoint));
+    const auto residual = scalar->ComputeResidual(config);
+    res1.AddBlock(iPoint, residual);
+    res1.SubtractBlock(jPoint, residual);
+    jac1.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
+  }
+  AssembleSIMD(test, *simd, *nodes, res2, jac2);
+
+  CompareSystems(*geometry, nVar, res1, jac1, res2, jac2);
+}
+
+}  // namespace
+
+TEST_CASE("Vectorized HLLC matches CUpwHLLC_Flow", "[Numerics SIMD]") {
+  CompareUpwindFlow("SOLVER= EULER\nCONV_NUM_METHOD_FLOW= HLLC\n");
+}
+
+TEST_CASE("Vectorized AUSM+-up matches CUpwAUSMPLUSUP_Flow", "[Numerics SIMD]") {
+  CompareUpwindFlow("SOLVER= EULER\nCONV_NUM_METHOD_FLOW= AUSMPLUSUP\n");
+  CompareUpwindFlow("SOLVER= EULER\nCONV_NUM_METHOD_FLOW= AUSMPLUSUP2\n");
+}
+
+TEST_CASE("Vectorized SLAU matches CUpwSLAU_Flow", "[Numerics SIMD]") {
+  CompareUpwindFlow("SOLVER= EULER\nCONV_NUM_METHOD_FLOW= SLAU\n");
+  CompareUpwindFlow("SOLVER= EULER\nCONV_NUM_METHOD_FLOW= SLAU2\n");
+}
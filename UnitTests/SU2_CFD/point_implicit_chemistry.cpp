@@ -0,0 +1,162 @@
+/*!
+ * \file point_implicit_chemistry.cpp
+ * \brief Unit tests for the point implicit chemistry preconditioner of the NEMO solvers.
+ * \version 8.0.1 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2024, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <sstream>
+#include "../../SU2_CFD/include/fluid/CSU2TCLib.hpp"
+#include "../../SU2_CFD/include/solvers/CNEMOEulerSolver.hpp"
+#include "../../SU2_CFD/include/variables/CNEMOEulerVariable.hpp"
+
+namespace {
+
+/*--- Dissociating nitrogen, as in the finite rate thermal bath test case. ---*/
+struct CNitrogenBath {
+  static constexpr unsigned short nDim = 2, nSpecies = 2, nVar = nSpecies + nDim + 2;
+
+  std::unique_ptr<CConfig> config;
+  std::unique_ptr<CSU2TCLib> fluidModel;
+  std::unique_ptr<CNEMOEulerVariable> nodes;
+  su2activematrix jacStorage;
+  std::vector<su2double*> jacobian;
+  std::vector<su2double> ws;
+
+  CNitrogenBath() : jacStorage(nVar, nVar), jacobian(nVar) {
+    std::stringstream options;
+    options << "SOLVER= NEMO_EULER\n"
+               "FLUID_MODEL= SU2_NONEQ\n"
+               "GAS_MODEL= N2\n"
+               "GAS_COMPOSITION= (0.666667, 0.333333)\n"
+               "MACH_NUMBER= 0.0\n"
+               "FREESTREAM_PRESSURE= 101325.0\n"
+               "FREESTREAM_TEMPERATURE= 30000\n"
+               "FREESTREAM_TEMPERATURE_VE= 1000\n"
+               "TIME_DISCRE_FLOW= EULER_EXPLICIT\n";
+
+    auto orig_buf = std::cout.rdbuf();
+    std::cout.rdbuf(nullptr);
+    config = std::unique_ptr<CConfig>(new CConfig(options, SU2_COMPONENT::SU2_CFD, false));
+    fluidModel = std::unique_ptr<CSU2TCLib>(new CSU2TCLib(config.get(), nDim, false));
+    std::cout.rdbuf(orig_buf);
+
+    const su2double massFrac[] = {0.666667, 0.333333}, mach[] = {0.0, 0.0};
+    nodes = std::unique_ptr<CNEMOEulerVariable>(new CNEMOEulerVariable(
+        101325.0, massFrac, mach, 30000.0, 1000.0, 1, nDim, nVar, nSpecies + nDim + 8, nSpecies + nDim + 8,
+        config.get(), fluidModel.get()));
+    nodes->SetPrimVar(0, fluidModel.get());
+
+    /*--- Net production rates and their Jacobian, as in CSource_NEMO::ComputeChemistry. ---*/
+    for (auto iVar = 0u; iVar < nVar; iVar++) jacobian[iVar] = jacStorage[iVar];
+    jacStorage = su2double(0.0);
+
+    const su2double* V = nodes->GetPrimitive(0);
+    std::vector<su2double> rhos(V + nodes->GetRhosIndex(), V + nodes->GetRhosIndex() + nSpecies);
+    fluidModel->SetTDStateRhosTTv(rhos, V[nodes->GetTIndex()], V[nodes->GetTveIndex()]);
+    ws = fluidModel->ComputeNetProductionRates(true, V, nodes->GetEve(0), nodes->GetCvve(0), nodes->GetdTdU(0),
+                                               nodes->GetdTvedU(0), jacobian.data());
+  }
+};
+
+}  // namespace
+
+TEST_CASE("Point implicit chemistry preconditioner inverts I - dt J", "[NEMO]") {
+  CNitrogenBath bath;
+  const auto nVar = CNitrogenBath::nVar, nSpecies = CNitrogenBath::nSpecies;
+
+  /*--- The reactions are not in equilibrium. ---*/
+  REQUIRE(fabs(bath.ws[0]) > 0.0);
+
+  /*--- Time step much larger than the chemical time scale, i.e. stiff. ---*/
+  const su2double chemTime = bath.nodes->GetSolution(0, 0) / fabs(bath.ws[0]);
+  const su2double dt = 100 * chemTime;
+
+  su2activematrix precond(nVar, nVar);
+  REQUIRE(CNEMOEulerSolver::ComputeChemistryPreconditioner(nSpecies, nVar, dt, bath.jacobian.data(), precond));
+
+  for (auto iVar = 0u; iVar < nVar; iVar++) {
+    for (auto jVar = 0u; jVar < nVar; jVar++) {
+      if (iVar < nSpecies) {
+        /*--- Species rows of (I - dt J) P = I. ---*/
+        su2double prod = precond(iVar, jVar);
+        for (auto kVar = 0u; kVar < nVar; kVar++) prod -= dt * bath.jacobian[iVar][kVar] * precond(kVar, jVar);
+        CHECK(prod == Approx(iVar == jVar ? 1.0 : 0.0).margin(1e-8));
+      } else {
+        /*--- Momentum and energy are not preconditioned. ---*/
+        CHECK(precond(iVar, jVar) == (iVar == jVar ? 1.0 : 0.0));
+      }
+    }
+  }
+}
+
+TEST_CASE("Point implicit chemistry update", "[NEMO]") {
+  CNitrogenBath bath;
+  const auto nVar = CNitrogenBath::nVar, nSpecies = CNitrogenBath::nSpecies;
+
+  /*--- Update from a residual that only has the chemical sources, dU = -dt/Vol P R with R = -Vol w. ---*/
+  auto update = [&](su2double dt, su2double* dU) {
+    su2activematrix precond(nVar, nVar);
+    REQUIRE(CNEMOEulerSolver::ComputeChemistryPreconditioner(nSpecies, nVar, dt, bath.jacobian.data(), precond));
+    for (auto iVar = 0u; iVar < nVar; iVar++) {
+      dU[iVar] = 0.0;
+      for (auto jSpecies = 0u; jSpecies < nSpecies; jSpecies++)
+        dU[iVar] += dt * precond(iVar, jSpecies) * bath.ws[jSpecies];
+    }
+  };
+  su2double dU[CNitrogenBath::nVar];
+
+  /*--- Small time step, same as the explicit update. ---*/
+  const su2double chemTime = bath.nodes->GetSolution(0, 0) / fabs(bath.ws[0]);
+  su2double dt = 1e-6 * chemTime;
+  update(dt, dU);
+  for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++)
+    CHECK(dU[iSpecies] == Approx(dt * bath.ws[iSpecies]).epsilon(1e-4));
+
+  /*--- Large time step, the mixture density is conserved and the step is bounded (an explicit one is not). ---*/
+  dt = 1e4 * chemTime;
+  update(dt, dU);
+  su2double sumRhos = 0.0;
+  for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) {
+    sumRhos += dU[iSpecies];
+    CHECK(fabs(dU[iSpecies]) < fabs(dt * bath.ws[iSpecies]));
+  }
+  CHECK(sumRhos == Approx(0.0).margin(1e-8 * bath.nodes->GetDensity(0)));
+  for (auto iVar = nSpecies; iVar < nVar; iVar++) CHECK(dU[iVar] == 0.0);
+}
+
+TEST_CASE("Point implicit chemistry preconditioner, singular species block", "[NEMO]") {
+  const unsigned short nSpecies = 2, nVar = 6;
+  su2activematrix jacStorage(nVar, nVar), precond(nVar, nVar);
+  std::vector<su2double*> jacobian(nVar);
+  for (auto iVar = 0u; iVar < nVar; iVar++) jacobian[iVar] = jacStorage[iVar];
+
+  /*--- I - dt J_ss is zero for dt = 1. ---*/
+  jacStorage = su2double(0.0);
+  for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) jacStorage(iSpecies, iSpecies) = 1.0;
+  jacStorage(0, nVar - 1) = 1.0;
+
+  CHECK_FALSE(CNEMOEulerSolver::ComputeChemistryPreconditioner(nSpecies, nVar, 1.0, jacobian.data(), precond));
+  for (auto iVar = 0u; iVar < nVar; iVar++)
+    for (auto jVar = 0u; jVar < nVar; jVar++) CHECK(precond(iVar, jVar) == (iVar == jVar ? 1.0 : 0.0));
+}
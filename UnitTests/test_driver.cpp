@@ -35,16 +35,26 @@
 #include "../../../Common/include/option_structure.hpp"
 
 int main(int argc, char* argv[]) {
+  Catch::Session session;
+
+  /*--- As for SU2_CFD, MPI_THREAD_MULTIPLE is optional (e.g. for the tests of the asynchronous output). ---*/
+  bool use_thread_mult = false;
+  session.cli(session.cli() |
+              Catch::clara::Opt(use_thread_mult)["--thread_multiple"]("Request MPI_THREAD_MULTIPLE thread support."));
+  const int cliResult = session.applyCommandLine(argc, argv);
+  if (cliResult != 0) return cliResult;
+
   /*--- Startup MPI, if supported ---*/
-#if defined(HAVE_OMP) && defined(HAVE_MPI)
+#if defined(HAVE_MPI)
+  int required = use_thread_mult ? MPI_THREAD_MULTIPLE : MPI_THREAD_FUNNELED;
   int provided;
-  SU2_MPI::Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+  SU2_MPI::Init_thread(&argc, &argv, required, &provided);
 #else
   SU2_MPI::Init(&argc, &argv);
 #endif
 
   /*--- Run the test driver supplied by Catch ---*/
-  int result = Catch::Session().run(argc, argv);
+  int result = session.run();
 
   /*--- Finalize MPI parallelization ---*/
   SU2_MPI::Finalize();